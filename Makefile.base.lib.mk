@@ -1,6 +1,9 @@
 LIBRARY_LIBS += `freetype-config --libs` -lm
 
 LIBRARY_BASE_CFLAGS = -std=c++11 -D_USE_MATH_DEFINES
+ifeq ($(TRACE_EVENTS),1)
+LIBRARY_BASE_CFLAGS += -DFASTUIDRAW_TRACE_EVENTS
+endif
 LIBRARY_debug_BASE_CFLAGS = $(LIBRARY_BASE_CFLAGS) -DFASTUIDRAW_DEBUG
 LIBRARY_release_BASE_CFLAGS = $(LIBRARY_BASE_CFLAGS)
 
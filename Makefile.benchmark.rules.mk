@@ -0,0 +1,63 @@
+BENCHMARK_COMMON_CFLAGS = $(LIBRARY_BUILD_WARN_FLAGS) $(LIBRARY_BUILD_INCLUDES_CFLAGS) -Idemos/common
+
+BENCHMARK_release_CFLAGS = -O3 -fstrict-aliasing $(BENCHMARK_COMMON_CFLAGS) $(LIBRARY_release_CFLAGS)
+BENCHMARK_debug_CFLAGS = -g $(BENCHMARK_COMMON_CFLAGS) $(LIBRARY_debug_CFLAGS)
+
+# $1 --> release or debug
+define benchmarkobjrules
+$(eval $(1)/benchmarks/%.o: %.cpp
+	@mkdir -p $$(dir $$@)
+	$(CXX) $$(BENCHMARK_$(1)_CFLAGS) -c $$< -o $$@
+$(1)/benchmarks/%.d: %.cpp
+	@mkdir -p $$(dir $$@)
+	@echo Generating $$@
+	@$(MAKEDEPEND) "$$(CXX)" "$$(BENCHMARK_$(1)_CFLAGS)" $(1)/benchmarks "$$*" "$$<" "$$@"
+)
+endef
+
+# how to build each benchmark:
+# $1 --> Benchmark name
+# $2 --> release or debug
+define benchmarkrule
+$(eval THISBENCHMARK_$(1)_$(2)_SOURCES = $$($(1)_SOURCES) $$(COMMON_BENCHMARK_SOURCES)
+THISBENCHMARK_$(1)_$(2)_DEPS = $$(addprefix $(2)/benchmarks/, $$(patsubst %.cpp, %.d, $$(THISBENCHMARK_$(1)_$(2)_SOURCES)))
+THISBENCHMARK_$(1)_$(2)_OBJS = $$(addprefix $(2)/benchmarks/, $$(patsubst %.cpp, %.o, $$(THISBENCHMARK_$(1)_$(2)_SOURCES)))
+THISBENCHMARK_$(1)_$(2)_EXE = $(1)-$(2)
+CLEAN_FILES += $$(THISBENCHMARK_$(1)_$(2)_OBJS) $$(THISBENCHMARK_$(1)_$(2)_EXE) $$(THISBENCHMARK_$(1)_$(2)_EXE).exe
+SUPER_CLEAN_FILES += $$(THISBENCHMARK_$(1)_$(2)_DEPS)
+ifneq ($(MAKECMDGOALS),clean)
+ifneq ($(MAKECMDGOALS),clean-all)
+ifneq ($(MAKECMDGOALS),targets)
+ifneq ($(MAKECMDGOALS),docs)
+ifneq ($(MAKECMDGOALS),clean-docs)
+ifneq ($(MAKECMDGOALS),install-docs)
+ifneq ($(MAKECMDGOALS),uninstall-docs)
+-include $$(THISBENCHMARK_$(1)_$(2)_DEPS)
+endif
+endif
+endif
+endif
+endif
+endif
+endif
+benchmarks-$(2): $$(THISBENCHMARK_$(1)_$(2)_EXE)
+BENCHMARK_TARGETLIST += $$(THISBENCHMARK_$(1)_$(2)_EXE)
+$$(THISBENCHMARK_$(1)_$(2)_EXE): libFastUIDraw_$(2) $$(THISBENCHMARK_$(1)_$(2)_OBJS) $$(THISBENCHMARK_$(1)_$(2)_DEPS)
+	$$(CXX) -o $$@ $$(THISBENCHMARK_$(1)_$(2)_OBJS) -L. $$(FASTUIDRAW_$(2)_LIBS)
+)
+endef
+
+# $1 --> release or debug
+define benchmarkset
+$(eval $(call benchmarkobjrules,$(1))
+$(foreach benchmarkname,$(BENCHMARKS),$(call benchmarkrule,$(benchmarkname),$(1)))
+.PHONY: benchmarks-$(1)
+TARGETLIST += benchmarks-$(1)
+)
+endef
+
+$(call benchmarkset,release)
+$(call benchmarkset,debug)
+benchmarks: benchmarks-debug benchmarks-release
+.PHONY: benchmarks
+TARGETLIST += benchmarks
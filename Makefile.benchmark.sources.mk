@@ -0,0 +1,18 @@
+# The Rules.mk file for each benchmark needs to do:
+#  1. Place the "standard header" at the top of the Rules.mk, this
+#     header is to set Make variable(s) correctly so that the functor
+#     filelist will function correctly.
+#  2. add its name to BENCHMARKS. Lets say the name of the benchmark is foo
+#  3. Set (using := ) foo_SOURCES the sources the benchmark has, using filelist
+#     to get path correct
+#  4. Place the "standard footer" at the end of the Rules.mk, this
+#     restores Make variable(s) correctly so that the functor filelist
+#     will function correctly.
+#  5. Add to benchmarks/Rules.mk your Rules.mk (follow the form in the file)
+#
+# Benchmarks only link against libFastUIDraw (and not against any GL
+# library or SDL), they draw using fastuidraw::headless::PainterBackendHeadless
+# so that what is measured is the CPU cost of FastUIDraw alone.
+
+dir := benchmarks
+include $(dir)/Rules.mk
@@ -0,0 +1,29 @@
+# Begin standard header
+sp 		:= $(sp).x
+dirstack_$(sp)	:= $(d)
+d		:= $(dir)
+# End standard header
+
+COMMON_BENCHMARK_SOURCES := demos/common/generic_command_line.cpp demos/common/text_helper.cpp
+
+dir := $(d)/painter_headless
+include $(dir)/Rules.mk
+
+dir := $(d)/packed_value_pool
+include $(dir)/Rules.mk
+
+dir := $(d)/bulk_copy
+include $(dir)/Rules.mk
+
+dir := $(d)/path_tessellation
+include $(dir)/Rules.mk
+
+dir := $(d)/bezier_tessellation
+include $(dir)/Rules.mk
+
+
+
+# Begin standard footer
+d		:= $(dirstack_$(sp))
+sp		:= $(basename $(sp))
+# End standard footer
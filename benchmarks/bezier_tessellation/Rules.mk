@@ -0,0 +1,16 @@
+# Begin standard header
+sp 		:= $(sp).x
+dirstack_$(sp)	:= $(d)
+d		:= $(dir)
+# End standard header
+
+
+# BezierBatch is private to libFastUIDraw, so the
+# benchmark is built with its own copy of it.
+BENCHMARKS += bezier-tessellation
+bezier-tessellation_SOURCES := $(call filelist, main.cpp) src/fastuidraw/private/bezier_batch.cpp
+
+# Begin standard footer
+d		:= $(dirstack_$(sp))
+sp		:= $(basename $(sp))
+# End standard footer
@@ -0,0 +1,476 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+
+#include "generic_command_line.hpp"
+#include "simple_time.hpp"
+#include "../../src/fastuidraw/private/bezier_batch.hpp"
+
+using namespace fastuidraw;
+
+template<typename T>
+c_array<T>
+make_array(std::vector<T> &v)
+{
+  return c_array<T>(v.data(), v.size());
+}
+
+/* bezier_tessellation measures the tessellation of quadratic and
+   cubic curves by PathContour::bezier, which goes through the
+   subdivision one level at a time and evaluates all the points
+   of a level together, against the recursive tessellation of
+   PathContour::interpolator_generic, which evaluates the curve
+   one point at a time. The recursive tessellation is run through
+   recursive_bezier, which forwards compute() and tessellate() to
+   a bezier but does not override produce_tessellation(). It also
+   measures the routines of BezierBatch against evaluating the
+   curve one point at a time with bezier::compute().
+ */
+class recursive_bezier:public PathContour::interpolator_generic
+{
+public:
+  recursive_bezier(const reference_counted_ptr<const PathContour::interpolator_base> &prev,
+                   const reference_counted_ptr<const PathContour::bezier> &b):
+    PathContour::interpolator_generic(prev, b->end_pt()),
+    m_bezier(b)
+  {}
+
+  virtual
+  bool
+  is_flat(void) const
+  {
+    return m_bezier->is_flat();
+  }
+
+  virtual
+  void
+  compute(float in_t, vec2 *outp, vec2 *outp_t, vec2 *outp_tt) const
+  {
+    m_bezier->compute(in_t, outp, outp_t, outp_tt);
+  }
+
+  virtual
+  void
+  tessellate(tessellated_region *in_region,
+             tessellated_region **out_regionA, tessellated_region **out_regionB,
+             float *out_t, vec2 *out_p, vec2 *out_p_t, vec2 *out_p_tt,
+             float *out_effective_curve_distance) const
+  {
+    m_bezier->tessellate(in_region, out_regionA, out_regionB,
+                         out_t, out_p, out_p_t, out_p_tt,
+                         out_effective_curve_distance);
+  }
+
+  virtual
+  void
+  approximate_bounding_box(vec2 *out_min_bb, vec2 *out_max_bb) const
+  {
+    m_bezier->approximate_bounding_box(out_min_bb, out_max_bb);
+  }
+
+  virtual
+  PathContour::interpolator_base*
+  deep_copy(const reference_counted_ptr<const PathContour::interpolator_base> &prev) const
+  {
+    return FASTUIDRAWnew recursive_bezier(prev, m_bezier);
+  }
+
+private:
+  reference_counted_ptr<const PathContour::bezier> m_bezier;
+};
+
+class curve
+{
+public:
+  std::vector<vec2> m_pts;
+  reference_counted_ptr<const PathContour::interpolator_base> m_start;
+  reference_counted_ptr<const PathContour::bezier> m_bezier;
+  reference_counted_ptr<const recursive_bezier> m_recursive;
+};
+
+class tessellation_result
+{
+public:
+  tessellation_result(void):
+    m_us(0),
+    m_points(0),
+    m_curve_distance(0.0f),
+    m_curvature(0.0f)
+  {}
+
+  int64_t m_us;
+  std::vector<std::vector<TessellatedPath::point> > m_data;
+  std::vector<unsigned int> m_sizes;
+  unsigned int m_points;
+  float m_curve_distance, m_curvature;
+};
+
+class bezier_tessellation:public command_line_register
+{
+public:
+  bezier_tessellation(void);
+
+  int
+  main(int argc, char **argv);
+
+private:
+  void
+  construct_curves(void);
+
+  void
+  run_tessellation(const TessellatedPath::TessellationParams &params,
+                   bool recursive, tessellation_result &out);
+
+  bool
+  compare_tessellation(const tessellation_result &a,
+                       const tessellation_result &b,
+                       float *out_max_deviation);
+
+  bool
+  run_evaluation(void);
+
+  float
+  random_coordinate(void);
+
+  command_separator m_benchmark_options;
+  command_line_argument_value<int> m_num_curves;
+  command_line_argument_value<int> m_num_iterations;
+  command_line_argument_value<int> m_max_segments;
+  command_line_argument_value<int> m_fine_max_segments;
+  command_line_argument_value<float> m_curvature_thresh;
+  command_line_argument_value<float> m_distance_thresh;
+  command_line_argument_value<int> m_num_times;
+
+  uint32_t m_random;
+  std::vector<curve> m_curves;
+};
+
+bezier_tessellation::
+bezier_tessellation(void):
+  m_benchmark_options("Benchmark Options", *this),
+  m_num_curves(2000, "num_curves", "Number of curves, half are quadratic and half cubic", *this),
+  m_num_iterations(20, "num_iterations", "Number of times each curve is tessellated", *this),
+  m_max_segments(32, "max_segments",
+                 "Value of TessellationParams::m_max_segments of the first runs", *this),
+  m_fine_max_segments(1024, "fine_max_segments",
+                      "Value of TessellationParams::m_max_segments of the second runs", *this),
+  m_curvature_thresh(float(M_PI) / 30.0f, "curvature_thresh",
+                     "Value of TessellationParams::m_threshhold with curvature tessellation", *this),
+  m_distance_thresh(0.05f, "distance_thresh",
+                    "Value of TessellationParams::m_threshhold with curve distance tessellation", *this),
+  m_num_times(256, "num_times",
+              "Number of evenly spaced times at which each curve is evaluated "
+              "to measure the evaluation routines", *this),
+  m_random(1)
+{}
+
+float
+bezier_tessellation::
+random_coordinate(void)
+{
+  m_random = m_random * 1664525u + 1013904223u;
+  return 1000.0f * static_cast<float>(m_random >> 8) / static_cast<float>(1u << 24);
+}
+
+void
+bezier_tessellation::
+construct_curves(void)
+{
+  m_curves.resize(t_max(1, m_num_curves.m_value));
+  for(unsigned int c = 0; c < m_curves.size(); ++c)
+    {
+      curve &C(m_curves[c]);
+      unsigned int n((c & 1) ? 4 : 3);
+
+      for(unsigned int i = 0; i < n; ++i)
+        {
+          vec2 p;
+
+          p.x() = random_coordinate();
+          p.y() = random_coordinate();
+          C.m_pts.push_back(p);
+        }
+
+      /* the first interpolator of a PathContour is a flat one
+         that only gives the start point of the next one.
+       */
+      C.m_start = FASTUIDRAWnew PathContour::flat(reference_counted_ptr<const PathContour::interpolator_base>(),
+                                                  C.m_pts.front());
+      C.m_bezier = FASTUIDRAWnew PathContour::bezier(C.m_start,
+                                                     const_c_array<vec2>(&C.m_pts[1], n - 2),
+                                                     C.m_pts.back());
+      C.m_recursive = FASTUIDRAWnew recursive_bezier(C.m_start, C.m_bezier);
+    }
+}
+
+void
+bezier_tessellation::
+run_tessellation(const TessellatedPath::TessellationParams &params,
+                 bool recursive, tessellation_result &out)
+{
+  simple_time timer;
+  unsigned int sz(t_max(params.m_max_segments + 1u, 3u));
+
+  out.m_data.resize(m_curves.size());
+  out.m_sizes.resize(m_curves.size());
+  for(unsigned int c = 0; c < m_curves.size(); ++c)
+    {
+      out.m_data[c].resize(sz);
+    }
+
+  for(int i = 0; i < m_num_iterations.m_value; ++i)
+    {
+      out.m_points = 0;
+      out.m_curve_distance = 0.0f;
+      out.m_curvature = 0.0f;
+      timer.restart_us();
+      for(unsigned int c = 0; c < m_curves.size(); ++c)
+        {
+          const PathContour::interpolator_base *h;
+          c_array<TessellatedPath::point> dst(&out.m_data[c][0], sz);
+          float curve_distance, curvature;
+          unsigned int n;
+
+          if(recursive)
+            {
+              h = m_curves[c].m_recursive.get();
+            }
+          else
+            {
+              h = m_curves[c].m_bezier.get();
+            }
+          n = h->produce_tessellation(params, dst, &curve_distance, &curvature);
+          out.m_sizes[c] = n;
+          out.m_points += n;
+          out.m_curve_distance = t_max(out.m_curve_distance, curve_distance);
+          out.m_curvature = t_max(out.m_curvature, curvature);
+        }
+      out.m_us += timer.elapsed_us();
+    }
+}
+
+bool
+bezier_tessellation::
+compare_tessellation(const tessellation_result &a,
+                     const tessellation_result &b,
+                     float *out_max_deviation)
+{
+  bool identical(true);
+
+  *out_max_deviation = 0.0f;
+  for(unsigned int c = 0; c < m_curves.size(); ++c)
+    {
+      if(a.m_sizes[c] != b.m_sizes[c])
+        {
+          identical = false;
+          continue;
+        }
+
+      for(unsigned int i = 0, endi = a.m_sizes[c]; i < endi; ++i)
+        {
+          const TessellatedPath::point &pa(a.m_data[c][i]), &pb(b.m_data[c][i]);
+
+          identical = identical
+            && pa.m_p == pb.m_p
+            && pa.m_p_t == pb.m_p_t
+            && pa.m_distance_from_edge_start == pb.m_distance_from_edge_start;
+          *out_max_deviation = t_max(*out_max_deviation, (pa.m_p - pb.m_p).magnitude());
+        }
+    }
+  return identical
+    && a.m_points == b.m_points
+    && a.m_curve_distance == b.m_curve_distance
+    && a.m_curvature == b.m_curvature;
+}
+
+bool
+bezier_tessellation::
+run_evaluation(void)
+{
+  unsigned int N(t_max(2, m_num_times.m_value));
+  std::vector<float> t(N);
+  std::vector<vec2> p(N), p_t(N), p_tt(N);
+  std::vector<vec2> q(N), q_t(N), q_tt(N);
+  float dt(1.0f / static_cast<float>(N - 1));
+  double per_point(1.0e3 / static_cast<double>(N * m_curves.size() * t_max(1, m_num_iterations.m_value)));
+  simple_time timer;
+  int64_t us;
+  float max_error(0.0f);
+  bool identical(true);
+
+  for(unsigned int i = 0; i < N; ++i)
+    {
+      t[i] = static_cast<float>(i) * dt;
+    }
+
+  std::cout << "\nEvaluating each curve at " << N << " times, ns per time:\n";
+
+  us = 0;
+  for(int i = 0; i < m_num_iterations.m_value; ++i)
+    {
+      timer.restart_us();
+      for(unsigned int c = 0; c < m_curves.size(); ++c)
+        {
+          for(unsigned int k = 0; k < N; ++k)
+            {
+              m_curves[c].m_bezier->compute(t[k], &q[k], &q_t[k], &q_tt[k]);
+            }
+        }
+      us += timer.elapsed_us();
+    }
+  std::cout << std::setw(22) << "bezier::compute()"
+            << std::setw(10) << static_cast<double>(us) * per_point << "\n";
+
+  for(int m = 0; m < detail::bezier_batch_number_impls; ++m)
+    {
+      enum detail::bezier_batch_impl_t impl;
+
+      impl = static_cast<enum detail::bezier_batch_impl_t>(m);
+      if(!detail::bezier_batch_impl_supported(impl))
+        {
+          continue;
+        }
+
+      us = 0;
+      for(int i = 0; i < m_num_iterations.m_value; ++i)
+        {
+          timer.restart_us();
+          for(unsigned int c = 0; c < m_curves.size(); ++c)
+            {
+              detail::BezierBatch B(make_array(m_curves[c].m_pts));
+              B.evaluate(make_array(t), make_array(p), make_array(p_t),
+                         make_array(p_tt), impl);
+            }
+          us += timer.elapsed_us();
+        }
+      std::cout << std::setw(22) << detail::bezier_batch_impl_label(impl)
+                << std::setw(10) << static_cast<double>(us) * per_point << "\n";
+
+      for(unsigned int c = 0; c < m_curves.size(); ++c)
+        {
+          detail::BezierBatch B(make_array(m_curves[c].m_pts));
+
+          B.evaluate(make_array(t), make_array(p), make_array(p_t),
+                     make_array(p_tt), impl);
+          for(unsigned int k = 0; k < N; ++k)
+            {
+              m_curves[c].m_bezier->compute(t[k], &q[k], &q_t[k], &q_tt[k]);
+              identical = identical && p[k] == q[k] && p_t[k] == q_t[k] && p_tt[k] == q_tt[k];
+            }
+        }
+    }
+
+  us = 0;
+  for(int i = 0; i < m_num_iterations.m_value; ++i)
+    {
+      timer.restart_us();
+      for(unsigned int c = 0; c < m_curves.size(); ++c)
+        {
+          detail::BezierBatch B(make_array(m_curves[c].m_pts));
+          B.evaluate_uniform(0.0f, dt, make_array(p), make_array(p_t), make_array(p_tt));
+        }
+      us += timer.elapsed_us();
+    }
+  std::cout << std::setw(22) << "forward differencing"
+            << std::setw(10) << static_cast<double>(us) * per_point << "\n";
+
+  for(unsigned int c = 0; c < m_curves.size(); ++c)
+    {
+      detail::BezierBatch B(make_array(m_curves[c].m_pts));
+
+      B.evaluate_uniform(0.0f, dt, make_array(p), make_array(p_t), make_array(p_tt));
+      for(unsigned int k = 0; k < N; ++k)
+        {
+          m_curves[c].m_bezier->compute(t[k], &q[k], &q_t[k], &q_tt[k]);
+          max_error = t_max(max_error, (p[k] - q[k]).magnitude());
+        }
+    }
+
+  std::cout << "Batched evaluation identical to bezier::compute(): "
+            << (identical ? "yes" : "NO") << "\n"
+            << "Largest distance from bezier::compute() with forward differencing: "
+            << std::scientific << max_error << std::fixed << "\n";
+  return identical;
+}
+
+int
+bezier_tessellation::
+main(int argc, char **argv)
+{
+  if(argc == 2 && (std::string(argv[1]) == "-help" || std::string(argv[1]) == "--help"))
+    {
+      std::cout << "\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  parse_command_line(argc, argv);
+  std::cout << "\n\n" << std::flush;
+
+  bool all_same_points(true);
+  double N(static_cast<double>(t_max(1, m_num_iterations.m_value)));
+
+  construct_curves();
+  std::cout << "Best implementation: "
+            << detail::bezier_batch_impl_label(detail::bezier_batch_best_impl()) << "\n"
+            << "Curves: " << m_curves.size() << ", ms per tessellation of all curves:\n"
+            << std::setw(10) << "mode" << std::setw(14) << "max_segments"
+            << std::setw(10) << "points" << std::setw(12) << "recursive"
+            << std::setw(10) << "batched" << std::setw(11) << "identical"
+            << std::setw(15) << "max deviation" << "\n";
+
+  for(int curvature = 1; curvature >= 0; --curvature)
+    {
+      for(int fine = 0; fine < 2; ++fine)
+        {
+          TessellatedPath::TessellationParams params;
+          tessellation_result recursive, batched;
+          float deviation;
+          bool identical;
+
+          if(curvature)
+            {
+              params.curvature_tessellate(m_curvature_thresh.m_value);
+            }
+          else
+            {
+              params.curve_distance_tessellate(m_distance_thresh.m_value);
+            }
+          params.max_segments(t_max(1, fine ? m_fine_max_segments.m_value : m_max_segments.m_value));
+
+          run_tessellation(params, true, recursive);
+          run_tessellation(params, false, batched);
+          identical = compare_tessellation(recursive, batched, &deviation);
+          all_same_points = all_same_points && recursive.m_points == batched.m_points;
+
+          std::cout << std::setw(10) << (curvature ? "curvature" : "distance")
+                    << std::setw(14) << params.m_max_segments
+                    << std::setw(10) << batched.m_points
+                    << std::fixed << std::setprecision(3)
+                    << std::setw(12) << static_cast<double>(recursive.m_us) * 1e-3 / N
+                    << std::setw(10) << static_cast<double>(batched.m_us) * 1e-3 / N
+                    << std::setw(11) << (identical ? "yes" : "no")
+                    << std::setw(15) << std::scientific << std::setprecision(2) << deviation
+                    << std::fixed << "\n";
+        }
+    }
+
+  bool eval_ok;
+  eval_ok = run_evaluation();
+
+  return (all_same_points && eval_ok) ? 0 : 1;
+}
+
+int
+main(int argc, char **argv)
+{
+  bezier_tessellation P;
+  return P.main(argc, argv);
+}
@@ -0,0 +1,16 @@
+# Begin standard header
+sp 		:= $(sp).x
+dirstack_$(sp)	:= $(d)
+d		:= $(dir)
+# End standard header
+
+
+# the routines are private to libFastUIDraw, so the
+# benchmark is built with its own copy of them.
+BENCHMARKS += bulk-copy
+bulk-copy_SOURCES := $(call filelist, main.cpp) src/fastuidraw/private/bulk_copy.cpp
+
+# Begin standard footer
+d		:= $(dirstack_$(sp))
+sp		:= $(basename $(sp))
+# End standard footer
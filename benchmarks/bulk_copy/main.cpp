@@ -0,0 +1,269 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/painter/painter_attribute.hpp>
+
+#include "generic_command_line.hpp"
+#include "simple_time.hpp"
+#include "../../src/fastuidraw/private/bulk_copy.hpp"
+
+using namespace fastuidraw;
+
+template<typename T>
+c_array<T>
+make_array(std::vector<T> &v)
+{
+  return c_array<T>(v.data(), v.size());
+}
+
+/* bulk_copy measures the routines PainterPacker uses to write
+   attributes and indices into the buffers of a PainterDraw, for
+   each implementation the CPU supports, with and without
+   streaming stores, over a range of chunk sizes. Each chunk
+   is written after the previous one into a destination larger
+   than the caches, as the packer fills a mapped buffer.
+ */
+class bulk_copy:public command_line_register
+{
+public:
+  bulk_copy(void);
+
+  int
+  main(int argc, char **argv);
+
+private:
+  bool
+  check(enum detail::bulk_copy_impl_t impl, bool streaming);
+
+  double
+  run_indices(enum detail::bulk_copy_impl_t impl, bool streaming, unsigned int chunk_size);
+
+  double
+  run_short_indices(enum detail::bulk_copy_impl_t impl, bool streaming, unsigned int chunk_size);
+
+  double
+  run_attributes(enum detail::bulk_copy_impl_t impl, bool streaming, unsigned int chunk_size);
+
+  command_separator m_benchmark_options;
+  command_line_argument_value<int> m_min_chunk_size;
+  command_line_argument_value<int> m_max_chunk_size;
+  command_line_argument_value<int> m_destination_mb;
+  command_line_argument_value<int> m_num_passes;
+
+  std::vector<PainterIndex> m_src_indices, m_dst_indices;
+  std::vector<PainterShortIndex> m_dst_short_indices;
+  std::vector<PainterAttribute> m_src_attributes, m_dst_attributes;
+};
+
+bulk_copy::
+bulk_copy(void):
+  m_benchmark_options("Benchmark Options", *this),
+  m_min_chunk_size(16, "min_chunk_size", "Smallest number of elements per chunk", *this),
+  m_max_chunk_size(65536, "max_chunk_size",
+                   "Largest number of elements per chunk, chunk sizes "
+                   "go from min_chunk_size to max_chunk_size by factors of 4", *this),
+  m_destination_mb(64, "destination_mb", "Size in MB of each destination buffer", *this),
+  m_num_passes(8, "num_passes", "Number of times the destination is filled", *this)
+{}
+
+/* compare against the scalar routine, at every alignment
+   of the destination and with sizes that leave tails.
+ */
+bool
+bulk_copy::
+check(enum detail::bulk_copy_impl_t impl, bool streaming)
+{
+  for(unsigned int start = 0; start < 8; ++start)
+    {
+      for(unsigned int sz = 0; sz < 40; ++sz)
+        {
+          std::vector<PainterIndex> expected(sz), indices(sz + 8);
+          std::vector<PainterShortIndex> short_indices(sz + 8);
+          std::vector<PainterAttribute> attributes(sz + 8);
+          const_c_array<PainterIndex> src_indices(make_array(m_src_indices).sub_array(0, sz));
+          const_c_array<PainterAttribute> src_attributes(make_array(m_src_attributes).sub_array(0, sz));
+
+          detail::rebase_indices(make_array(expected), src_indices, -3, false, detail::bulk_copy_scalar);
+          detail::rebase_indices(make_array(indices).sub_array(start, sz), src_indices, -3, streaming, impl);
+          detail::rebase_indices(make_array(short_indices).sub_array(start, sz), src_indices, 3, streaming, impl);
+          detail::copy_attributes(make_array(attributes).sub_array(start, sz), src_attributes, streaming, impl);
+          for(unsigned int i = 0; i < sz; ++i)
+            {
+              if(indices[start + i] != expected[i]
+                 || short_indices[start + i] != src_indices[i] + 3u
+                 || attributes[start + i].m_attrib0 != src_attributes[i].m_attrib0
+                 || attributes[start + i].m_attrib1 != src_attributes[i].m_attrib1
+                 || attributes[start + i].m_attrib2 != src_attributes[i].m_attrib2)
+                {
+                  return false;
+                }
+            }
+        }
+    }
+  return true;
+}
+
+double
+bulk_copy::
+run_indices(enum detail::bulk_copy_impl_t impl, bool streaming, unsigned int chunk_size)
+{
+  c_array<PainterIndex> dst(make_array(m_dst_indices));
+  const_c_array<PainterIndex> src(make_array(m_src_indices).sub_array(0, chunk_size));
+  uint64_t elements(0);
+  simple_time timer;
+  int64_t us;
+
+  for(int pass = 0; pass < m_num_passes.m_value; ++pass)
+    {
+      for(unsigned int loc = 0; loc + chunk_size <= dst.size(); loc += chunk_size)
+        {
+          detail::rebase_indices(dst.sub_array(loc, chunk_size), src, loc, streaming, impl);
+          elements += chunk_size;
+        }
+    }
+  us = t_max(int64_t(1), timer.elapsed_us());
+
+  /* GB/s written */
+  return static_cast<double>(elements * sizeof(PainterIndex)) / (static_cast<double>(us) * 1e3);
+}
+
+double
+bulk_copy::
+run_short_indices(enum detail::bulk_copy_impl_t impl, bool streaming, unsigned int chunk_size)
+{
+  c_array<PainterShortIndex> dst(make_array(m_dst_short_indices));
+  const_c_array<PainterIndex> src(make_array(m_src_indices).sub_array(0, chunk_size));
+  uint64_t elements(0);
+  simple_time timer;
+  int64_t us;
+
+  /* the offset is 0 since the values must fit in 16-bits */
+  for(int pass = 0; pass < m_num_passes.m_value; ++pass)
+    {
+      for(unsigned int loc = 0; loc + chunk_size <= dst.size(); loc += chunk_size)
+        {
+          detail::rebase_indices(dst.sub_array(loc, chunk_size), src, 0, streaming, impl);
+          elements += chunk_size;
+        }
+    }
+  us = t_max(int64_t(1), timer.elapsed_us());
+
+  return static_cast<double>(elements * sizeof(PainterShortIndex)) / (static_cast<double>(us) * 1e3);
+}
+
+double
+bulk_copy::
+run_attributes(enum detail::bulk_copy_impl_t impl, bool streaming, unsigned int chunk_size)
+{
+  c_array<PainterAttribute> dst(make_array(m_dst_attributes));
+  const_c_array<PainterAttribute> src(make_array(m_src_attributes).sub_array(0, chunk_size));
+  uint64_t elements(0);
+  simple_time timer;
+  int64_t us;
+
+  for(int pass = 0; pass < m_num_passes.m_value; ++pass)
+    {
+      for(unsigned int loc = 0; loc + chunk_size <= dst.size(); loc += chunk_size)
+        {
+          detail::copy_attributes(dst.sub_array(loc, chunk_size), src, streaming, impl);
+          elements += chunk_size;
+        }
+    }
+  us = t_max(int64_t(1), timer.elapsed_us());
+
+  return static_cast<double>(elements * sizeof(PainterAttribute)) / (static_cast<double>(us) * 1e3);
+}
+
+int
+bulk_copy::
+main(int argc, char **argv)
+{
+  if(argc == 2 && (std::string(argv[1]) == "-help" || std::string(argv[1]) == "--help"))
+    {
+      std::cout << "\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  parse_command_line(argc, argv);
+  std::cout << "\n\n" << std::flush;
+
+  unsigned int min_chunk(t_max(1, m_min_chunk_size.m_value));
+  unsigned int max_chunk(t_max(static_cast<int>(min_chunk), m_max_chunk_size.m_value));
+  size_t bytes(static_cast<size_t>(t_max(1, m_destination_mb.m_value)) * 1024u * 1024u);
+
+  m_src_indices.resize(max_chunk);
+  m_src_attributes.resize(max_chunk);
+  for(unsigned int i = 0; i < max_chunk; ++i)
+    {
+      /* keep values in 16-bits for the 16-bit index routines */
+      m_src_indices[i] = (i * 7u) % t_min(max_chunk, 65536u);
+      m_src_attributes[i].m_attrib0 = uvec4(i, i + 1, i + 2, i + 3);
+      m_src_attributes[i].m_attrib1 = uvec4(i * 2u);
+      m_src_attributes[i].m_attrib2 = uvec4(i * 3u);
+    }
+  m_dst_indices.resize(t_max(static_cast<size_t>(max_chunk), bytes / sizeof(PainterIndex)));
+  m_dst_short_indices.resize(t_max(static_cast<size_t>(max_chunk), bytes / sizeof(PainterShortIndex)));
+  m_dst_attributes.resize(t_max(static_cast<size_t>(max_chunk), bytes / sizeof(PainterAttribute)));
+
+  std::cout << "Best implementation: "
+            << detail::bulk_copy_impl_label(detail::bulk_copy_best_impl()) << "\n"
+            << "GB/s written:\n"
+            << std::setw(10) << "impl" << std::setw(11) << "streaming"
+            << std::setw(8) << "chunk" << std::setw(10) << "indices"
+            << std::setw(8) << "short"
+            << std::setw(12) << "attributes" << "\n";
+
+  for(int i = 0; i < detail::bulk_copy_number_impls; ++i)
+    {
+      enum detail::bulk_copy_impl_t impl;
+
+      impl = static_cast<enum detail::bulk_copy_impl_t>(i);
+      if(!detail::bulk_copy_impl_supported(impl))
+        {
+          continue;
+        }
+
+      for(int s = 0; s < 2; ++s)
+        {
+          bool streaming(s == 1);
+
+          if(!check(impl, streaming))
+            {
+              std::cout << detail::bulk_copy_impl_label(impl)
+                        << (streaming ? " with" : " without")
+                        << " streaming does not match scalar\n";
+              return -1;
+            }
+
+          for(unsigned int chunk = min_chunk; chunk <= max_chunk; chunk *= 4)
+            {
+              double gb_indices, gb_short_indices, gb_attributes;
+
+              gb_indices = run_indices(impl, streaming, chunk);
+              gb_short_indices = run_short_indices(impl, streaming, chunk);
+              gb_attributes = run_attributes(impl, streaming, chunk);
+              std::cout << std::setw(10) << detail::bulk_copy_impl_label(impl)
+                        << std::setw(11) << (streaming ? "yes" : "no")
+                        << std::setw(8) << chunk
+                        << std::fixed << std::setprecision(2)
+                        << std::setw(10) << gb_indices
+                        << std::setw(8) << gb_short_indices
+                        << std::setw(12) << gb_attributes << "\n";
+            }
+        }
+    }
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  bulk_copy P;
+  return P.main(argc, argv);
+}
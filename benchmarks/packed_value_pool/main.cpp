@@ -0,0 +1,212 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/painter/painter_packed_value.hpp>
+
+#include "generic_command_line.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* packed_value_pool measures the cost of creating, copying
+   and destroying PainterPackedValue objects from several
+   threads at once. Each thread repeatedly creates a batch of
+   brush and item matrix values, copies a set of values that
+   all threads share and then drops all of them. The pool is
+   either one thread safe PainterPackedValuePool used by all
+   threads or one PainterPackedValuePool per thread.
+ */
+class packed_value_pool:public command_line_register
+{
+public:
+  packed_value_pool(void);
+
+  int
+  main(int argc, char **argv);
+
+private:
+  enum mode_t
+    {
+      shared_mode,
+      per_thread_mode,
+    };
+
+  class per_thread_values
+  {
+  public:
+    std::vector<PainterPackedValue<PainterBrush> > m_brushes;
+    std::vector<PainterPackedValue<PainterItemMatrix> > m_matrices;
+  };
+
+  void
+  create_shared_values(PainterPackedValuePool &pool, per_thread_values &dst);
+
+  void
+  run_thread(PainterPackedValuePool *pool, const per_thread_values *shared);
+
+  command_separator m_benchmark_options;
+  command_line_argument_value<int> m_num_threads;
+  command_line_argument_value<int> m_num_iterations;
+  command_line_argument_value<int> m_values_per_iteration;
+  command_line_argument_value<int> m_num_shared_values;
+  enumerated_command_line_argument_value<enum mode_t> m_mode;
+  command_line_argument_value<bool> m_thread_safe;
+};
+
+packed_value_pool::
+packed_value_pool(void):
+  m_benchmark_options("Benchmark Options", *this),
+  m_num_threads(4, "num_threads", "Number of threads creating values", *this),
+  m_num_iterations(1000, "num_iterations", "Number of batches each thread creates", *this),
+  m_values_per_iteration(256, "values_per_iteration",
+                         "Number of brush and of item matrix values created in each batch", *this),
+  m_num_shared_values(64, "num_shared_values",
+                      "Number of values that each batch copies from values "
+                      "created before the threads start", *this),
+  m_mode(shared_mode,
+         enumerated_string_type<enum mode_t>()
+         .add_entry("shared", shared_mode,
+                    "All threads use one PainterPackedValuePool and copy the same shared values, "
+                    "the pool is constructed thread safe if there is more than one thread "
+                    "or if thread_safe is true")
+         .add_entry("per_thread", per_thread_mode,
+                    "Each thread uses its own PainterPackedValuePool and its own shared values"),
+         "mode", "Specifies how the pools are shared between threads", *this),
+  m_thread_safe(false, "thread_safe",
+                "If true, the pools are always constructed thread safe; use to measure "
+                "the cost of the atomic operations without contention", *this)
+{}
+
+void
+packed_value_pool::
+create_shared_values(PainterPackedValuePool &pool, per_thread_values &dst)
+{
+  for(int i = 0; i < m_num_shared_values.m_value; ++i)
+    {
+      float f(static_cast<float>(i));
+
+      dst.m_brushes.push_back(pool.create_packed_value(PainterBrush(vec4(f, 0.0f, 1.0f, 1.0f))));
+      dst.m_matrices.push_back(pool.create_packed_value(PainterItemMatrix(float3x3())));
+    }
+}
+
+void
+packed_value_pool::
+run_thread(PainterPackedValuePool *pool, const per_thread_values *shared)
+{
+  per_thread_values values;
+
+  values.m_brushes.reserve(m_values_per_iteration.m_value + m_num_shared_values.m_value);
+  values.m_matrices.reserve(m_values_per_iteration.m_value + m_num_shared_values.m_value);
+  for(int iteration = 0; iteration < m_num_iterations.m_value; ++iteration)
+    {
+      for(int i = 0; i < m_values_per_iteration.m_value; ++i)
+        {
+          PainterBrush brush;
+          float3x3 m;
+
+          brush.pen(static_cast<float>(i), static_cast<float>(iteration), 0.0f, 1.0f);
+          m(0, 2) = static_cast<float>(i);
+          values.m_brushes.push_back(pool->create_packed_value(brush));
+          values.m_matrices.push_back(pool->create_packed_value(PainterItemMatrix(m)));
+        }
+
+      for(const PainterPackedValue<PainterBrush> &v : shared->m_brushes)
+        {
+          values.m_brushes.push_back(v);
+        }
+
+      for(const PainterPackedValue<PainterItemMatrix> &v : shared->m_matrices)
+        {
+          values.m_matrices.push_back(v);
+        }
+
+      values.m_brushes.clear();
+      values.m_matrices.clear();
+    }
+}
+
+int
+packed_value_pool::
+main(int argc, char **argv)
+{
+  if(argc == 2 && (std::string(argv[1]) == "-help" || std::string(argv[1]) == "--help"))
+    {
+      std::cout << "\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  parse_command_line(argc, argv);
+  std::cout << "\n\n" << std::flush;
+
+  int num_threads(t_max(1, m_num_threads.m_value));
+  bool shared(m_mode.m_value.m_value == shared_mode);
+  bool thread_safe(m_thread_safe.m_value || (shared && num_threads > 1));
+  int num_pools(shared ? 1 : num_threads);
+  std::vector<PainterPackedValuePool*> pools;
+  std::vector<per_thread_values> shared_values(num_pools);
+  std::vector<std::thread> threads;
+  simple_time timer;
+  int64_t us;
+
+  for(int i = 0; i < num_pools; ++i)
+    {
+      /* the alignment of the GL backend */
+      pools.push_back(FASTUIDRAWnew PainterPackedValuePool(4, thread_safe));
+      create_shared_values(*pools.back(), shared_values[i]);
+    }
+
+  timer.restart_us();
+  for(int i = 0; i < num_threads; ++i)
+    {
+      int p(shared ? 0 : i);
+      threads.push_back(std::thread(&packed_value_pool::run_thread, this,
+                                    pools[p], &shared_values[p]));
+    }
+
+  for(std::thread &t : threads)
+    {
+      t.join();
+    }
+  us = timer.elapsed_us();
+
+  shared_values.clear();
+  for(PainterPackedValuePool *p : pools)
+    {
+      FASTUIDRAWdelete(p);
+    }
+
+  double num_created, num_copied;
+
+  num_created = 2.0 * static_cast<double>(num_threads)
+    * static_cast<double>(m_num_iterations.m_value)
+    * static_cast<double>(m_values_per_iteration.m_value);
+  num_copied = 2.0 * static_cast<double>(num_threads)
+    * static_cast<double>(m_num_iterations.m_value)
+    * static_cast<double>(m_num_shared_values.m_value);
+
+  std::cout << std::fixed << std::setprecision(2)
+            << "Threads: " << num_threads << "\n"
+            << "Pools: " << num_pools << (thread_safe ? " (thread safe)" : "") << "\n"
+            << "Total time: " << static_cast<double>(us) * 1e-3 << " ms\n"
+            << "Values created: " << num_created << "\n"
+            << "Values copied: " << num_copied << "\n"
+            << "Time per created value: "
+            << 1e3 * static_cast<double>(us) / num_created << " ns\n"
+            << "Values created per second per thread: "
+            << num_created * 1e6 / (static_cast<double>(us) * static_cast<double>(num_threads)) << "\n";
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  packed_value_pool P;
+  return P.main(argc, argv);
+}
@@ -0,0 +1,125 @@
+/*!
+ * \file heap_count.cpp
+ * \brief file heap_count.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <atomic>
+#include <new>
+#include <cstdlib>
+
+#include <fastuidraw/util/fastuidraw_memory.hpp>
+#include "heap_count.hpp"
+
+/* Every form of the global operator new and operator delete
+   is replaced together: the replacements allocate with
+   std::malloc and release with std::free. The memory of
+   FASTUIDRAWnew also comes from std::malloc and is released
+   by FASTUIDRAWdelete through the global operator delete, so
+   it is released by the replacement too. The replacements
+   are kept out of main.cpp so that they are not inlined next
+   to their callers.
+ */
+namespace
+{
+  std::atomic<uint64_t> heap_allocation_counter(0);
+
+  void*
+  counted_malloc(std::size_t n)
+  {
+    heap_allocation_counter.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(n == 0 ? 1 : n);
+  }
+
+  void*
+  counted_malloc_or_throw(std::size_t n)
+  {
+    void *p;
+
+    p = counted_malloc(n);
+    if(!p)
+      {
+        throw std::bad_alloc();
+      }
+    return p;
+  }
+}
+
+void*
+operator new(std::size_t n)
+{
+  return counted_malloc_or_throw(n);
+}
+
+void*
+operator new[](std::size_t n)
+{
+  return counted_malloc_or_throw(n);
+}
+
+void*
+operator new(std::size_t n, const std::nothrow_t&) noexcept
+{
+  return counted_malloc(n);
+}
+
+void*
+operator new[](std::size_t n, const std::nothrow_t&) noexcept
+{
+  return counted_malloc(n);
+}
+
+void
+operator delete(void *p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete[](void *p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void *p, const std::nothrow_t&) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete[](void *p, const std::nothrow_t&) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void *p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete[](void *p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+uint64_t
+number_heap_allocations(void)
+{
+  return heap_allocation_counter.load(std::memory_order_relaxed)
+    + fastuidraw::memory::number_allocations();
+}
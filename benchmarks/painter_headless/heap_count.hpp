@@ -0,0 +1,30 @@
+/*!
+ * \file heap_count.hpp
+ * \brief file heap_count.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* returns the number of heap allocations made so far: the
+   calls to the global operator new, which include those of
+   the std containers used by FastUIDraw, plus the allocations
+   made by FastUIDraw with FASTUIDRAWnew and FASTUIDRAWmalloc,
+   see fastuidraw::memory::number_allocations().
+ */
+uint64_t
+number_heap_allocations(void);
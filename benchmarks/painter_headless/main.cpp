@@ -0,0 +1,1062 @@
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <math.h>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/trace.hpp>
+#include <fastuidraw/util/thread_pool.hpp>
+#include <fastuidraw/painter/painter.hpp>
+#include <fastuidraw/painter/painter_attribute_data_filler_glyphs.hpp>
+#include <fastuidraw/painter/painter_glyph_run_bounds.hpp>
+#include <fastuidraw/text/freetype_font.hpp>
+#include <fastuidraw/text/glyph_selector.hpp>
+#include <fastuidraw/headless_backend/painter_backend_headless.hpp>
+
+#include "generic_command_line.hpp"
+#include "text_helper.hpp"
+#include "simple_time.hpp"
+#include "heap_count.hpp"
+
+using namespace fastuidraw;
+
+/* painter_headless drives workloads modeled on the demos
+   painter_cells and painter_path_test through a Painter
+   whose backend is a headless::PainterBackendHeadless.
+   Since nothing is sent to a GPU, the time reported is
+   the CPU cost of Painter and PainterPacker alone.
+ */
+class painter_headless:public command_line_register
+{
+public:
+  painter_headless(void);
+
+  ~painter_headless();
+
+  int
+  main(int argc, char **argv);
+
+private:
+  enum workload_t
+    {
+      cells_workload,
+      paths_workload,
+      all_workload,
+      document_workload,
+      layers_workload,
+    };
+
+  /* a rectangle of the layers workload, in pixels */
+  class layer_rect
+  {
+  public:
+    vec2 m_min, m_size;
+    vec4 m_color;
+  };
+
+  void
+  init(void);
+
+  void
+  construct_path(void);
+
+  void
+  construct_text(void);
+
+  void
+  construct_document(void);
+
+  void
+  construct_layers(void);
+
+  void
+  estimate_layer_fragments(void);
+
+  void
+  draw_cells(Painter &painter, int frame, range_type<int> rows);
+
+  void
+  draw_paths(Painter &painter, int frame, range_type<int> paths);
+
+  void
+  draw_document(Painter &painter, int frame);
+
+  void
+  draw_layers(Painter &painter, range_type<int> layers);
+
+  void
+  draw_content(Painter &painter, int frame, int slice, int num_slices);
+
+  void
+  draw_frame(int frame);
+
+  void
+  record_frame(int frame);
+
+  unsigned int
+  query_packer_stat(enum PainterPacker::stats_t st) const;
+
+  command_separator m_benchmark_options;
+  command_line_argument_value<int> m_num_frames;
+  command_line_argument_value<int> m_width, m_height;
+  enumerated_command_line_argument_value<enum workload_t> m_workload;
+  command_line_argument_value<bool> m_print_each_frame;
+  command_line_argument_value<bool> m_opaque_brushes;
+  command_line_argument_value<int> m_record_threads;
+  command_line_argument_value<bool> m_retained;
+  command_line_argument_value<bool> m_frame_stats;
+  command_line_argument_value<std::string> m_trace_file;
+
+  command_separator m_cells_options;
+  command_line_argument_value<int> m_num_cells_x, m_num_cells_y;
+  command_line_argument_value<std::string> m_font;
+  command_line_argument_value<float> m_pixel_size;
+  command_line_argument_value<bool> m_draw_text;
+  command_line_argument_value<bool> m_draw_lines;
+  command_line_argument_value<float> m_stroke_width;
+  command_line_argument_value<bool> m_packed_brushes;
+  command_line_argument_value<bool> m_clip_cells;
+  command_line_argument_value<bool> m_capture_cells;
+  command_line_argument_value<int> m_invalidate_captures;
+
+  command_separator m_paths_options;
+  command_line_argument_value<int> m_num_paths;
+  command_line_argument_value<bool> m_draw_fill;
+  command_line_argument_value<bool> m_draw_stroke;
+  command_line_argument_value<bool> m_anti_alias;
+  command_line_argument_value<float> m_path_perspective;
+  command_line_argument_value<float> m_path_zoom;
+  command_line_argument_value<int> m_lod_cache_kb;
+
+  command_separator m_document_options;
+  command_line_argument_value<int> m_document_lines;
+  command_line_argument_value<bool> m_cull_glyphs;
+  command_line_argument_value<int> m_glyphs_per_block;
+
+  command_separator m_layers_options;
+  command_line_argument_value<int> m_num_layers;
+
+  command_separator m_backend_options;
+  command_line_argument_value<int> m_attributes_per_buffer;
+  command_line_argument_value<int> m_indices_per_buffer;
+  command_line_argument_value<int> m_data_blocks_per_store_buffer;
+  command_line_argument_value<int> m_data_blocks_per_persistent_store;
+  command_line_argument_value<bool> m_break_on_shader_change;
+  command_line_argument_value<bool> m_short_indices;
+  command_line_argument_value<bool> m_compact_attributes;
+  command_line_argument_value<bool> m_reorder_opaque_draws;
+  command_line_argument_value<bool> m_front_to_back_opaque_draws;
+  command_line_argument_value<bool> m_cache_clip_paths;
+  command_line_argument_value<bool> m_intern_packed_state;
+  command_line_argument_value<int> m_async_tessellation_threads;
+
+  reference_counted_ptr<headless::PainterBackendHeadless> m_backend;
+  reference_counted_ptr<ThreadPool> m_tessellation_pool;
+  reference_counted_ptr<PathLODCache> m_lod_cache;
+  reference_counted_ptr<Painter> m_painter;
+  reference_counted_ptr<PainterPacker> m_packer;
+  std::vector<reference_counted_ptr<Painter> > m_recording_painters;
+  std::vector<reference_counted_ptr<PainterPackerRecorder> > m_recorders;
+  reference_counted_ptr<PainterDrawList> m_draw_list;
+  std::vector<reference_counted_ptr<PainterDrawList> > m_cell_captures;
+  unsigned int m_next_invalidated_capture;
+  int64_t m_replay_us;
+  reference_counted_ptr<GlyphCache> m_glyph_cache;
+  reference_counted_ptr<GlyphSelector> m_glyph_selector;
+  reference_counted_ptr<FreetypeLib> m_ft_lib;
+
+  Path m_path, m_cell_line, m_cell_clip;
+  reference_counted_ptr<const FontBase> m_text_font;
+  PainterAttributeData m_text;
+  bool m_have_text;
+  PainterAttributeData m_document;
+  PainterGlyphRunBounds *m_document_bounds;
+  float m_document_height;
+  std::vector<layer_rect> m_layer_rects;
+  uint64_t m_layer_fragments_in_order, m_layer_fragments_front_to_back;
+};
+
+painter_headless::
+painter_headless(void):
+  m_benchmark_options("Benchmark Options", *this),
+  m_num_frames(300, "num_frames", "Number of frames to pack", *this),
+  m_width(1920, "width", "Width of the virtual render target", *this),
+  m_height(1080, "height", "Height of the virtual render target", *this),
+  m_workload(all_workload,
+             enumerated_string_type<enum workload_t>()
+             .add_entry("cells", cells_workload, "Grid of cells as in painter_cells")
+             .add_entry("paths", paths_workload, "Filled and stroked paths as in painter_path_test")
+             .add_entry("all", all_workload, "Both cells and paths workloads")
+             .add_entry("document", document_workload,
+                        "Long glyph run scrolled within a clipping rectangle")
+             .add_entry("layers", layers_workload,
+                        "Overlapping opaque panels, each with a translucent "
+                        "highlight, as a stack of windows of a UI"),
+             "workload", "Specifies what to draw each frame", *this),
+  m_print_each_frame(false, "print_each_frame", "If true, print the stats of each frame", *this),
+  m_opaque_brushes(false, "opaque_brushes", "If true, the pen color of all brushes has alpha 1.0", *this),
+  m_record_threads(0, "record_threads",
+                   "If positive, each frame is recorded by that many threads, "
+                   "each with its own Painter and PainterPackerRecorder, and the "
+                   "recordings are replayed in order into a single PainterPacker", *this),
+  m_retained(false, "retained",
+             "If true, the first frame is captured to a PainterDrawList and "
+             "each frame draws that list with the brush of the item of the "
+             "first cell patched, ignored if record_threads is positive", *this),
+  m_frame_stats(false, "frame_stats",
+                "If true, the timers of Painter::frame_stats() are enabled and "
+                "the average of each value of the PainterFrameStats of the frames "
+                "is printed, ignored if record_threads is positive", *this),
+  m_trace_file("", "trace_file",
+               "If non-empty, write the trace events of FastUIDraw of all "
+               "frames as a Chrome trace JSON file to the named file, FastUIDraw "
+               "must be built with TRACE_EVENTS=1", *this),
+  m_cells_options("Cells Options", *this),
+  m_num_cells_x(10, "num_cells_x", "Number of cells across", *this),
+  m_num_cells_y(10, "num_cells_y", "Number of cells down", *this),
+  m_font("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf", "font", "File from which to take font", *this),
+  m_pixel_size(24.0f, "font_pixel_size", "Render size for text rendering", *this),
+  m_draw_text(true, "draw_text", "If true, draw text in each cell", *this),
+  m_draw_lines(true, "draw_lines", "If true, stroke a line in each cell", *this),
+  m_stroke_width(10.0f, "stroke_width", "Stroking width of the line in each cell", *this),
+  m_packed_brushes(false, "packed_brushes",
+                   "If true, the brushes of each cell are created each frame as "
+                   "PainterPackedValue objects from the pool of the Painter and "
+                   "are held until all cells are drawn, as painter_cells does when "
+                   "the content of its cells changes", *this),
+  m_clip_cells(false, "clip_cells",
+               "If true, the content of each cell is clipped with clipInPath() "
+               "to a rounded rectangle", *this),
+  m_capture_cells(false, "capture_cells",
+                  "If true, the draws of each cell are captured with "
+                  "Painter::begin_draw_capture() and replayed, so that the cell "
+                  "is drawn with the methods of Painter only when its capture "
+                  "is invalidated, ignored if record_threads is positive "
+                  "or retained is true", *this),
+  m_invalidate_captures(0, "invalidate_captures",
+                        "Number of cell captures invalidated each frame when "
+                        "capture_cells is true", *this),
+  m_paths_options("Paths Options", *this),
+  m_num_paths(16, "num_paths", "Number of times to draw the path per frame", *this),
+  m_draw_fill(true, "draw_fill", "If true, fill the path", *this),
+  m_draw_stroke(true, "draw_stroke", "If true, stroke the path", *this),
+  m_anti_alias(true, "anti_alias", "If true, anti-alias filling and stroking", *this),
+  m_path_perspective(0.0f, "path_perspective",
+                     "If non-zero, each path is drawn with a perspective transformation "
+                     "whose w-coordinate changes by this amount per pixel along the "
+                     "y-axis of the screen", *this),
+  m_path_zoom(0.0f, "path_zoom",
+              "Amount by which the scale of the paths grows each frame, "
+              "a positive value makes the Painter ask for finer tessellations "
+              "as the frames advance", *this),
+  m_lod_cache_kb(-1, "lod_cache_kb",
+                 "If non-negative, the tessellations of the paths are kept "
+                 "by a PathLODCache with a budget of this many kilobytes, "
+                 "ignored if record_threads is positive", *this),
+  m_document_options("Document Options", *this),
+  m_document_lines(2000, "document_lines", "Number of lines of text of the document", *this),
+  m_cull_glyphs(true, "cull_glyphs",
+                "If true, the document is drawn with a PainterGlyphRunBounds "
+                "so that only the glyphs within the clipping rectangle are packed", *this),
+  m_glyphs_per_block(16, "glyphs_per_block",
+                     "Number of glyphs per block of the PainterGlyphRunBounds "
+                     "of the document", *this),
+  m_layers_options("Layers Options", *this),
+  m_num_layers(12, "num_layers", "Number of panels of the layers workload", *this),
+  m_backend_options("Backend Options", *this),
+  m_attributes_per_buffer(512 * 512, "attributes_per_buffer",
+                          "Number of attributes per PainterDraw", *this),
+  m_indices_per_buffer((512 * 512 * 6) / 4, "indices_per_buffer",
+                       "Number of indices per PainterDraw", *this),
+  m_data_blocks_per_store_buffer(1024 * 64, "data_blocks_per_store_buffer",
+                                 "Number of data blocks per PainterDraw", *this),
+  m_data_blocks_per_persistent_store(0, "data_blocks_per_persistent_store",
+                                     "Number of data blocks of the persistent data store "
+                                     "that holds PainterPackedValue data once per frame, "
+                                     "0 means no persistent data store", *this),
+  m_break_on_shader_change(false, "break_on_shader_change",
+                           "If true, each change of shader is a draw break", *this),
+  m_short_indices(false, "short_indices",
+                  "If true, PainterDraw indices are 16-bit values and "
+                  "attributes_per_buffer is clamped to 65536", *this),
+  m_compact_attributes(false, "compact_attributes",
+                       "If true, shaders that only read the primary attribute "
+                       "write 16-byte attributes", *this),
+  m_reorder_opaque_draws(false, "reorder_opaque_draws",
+                         "If true, enable PainterPacker::reorder_opaque_draws()", *this),
+  m_front_to_back_opaque_draws(false, "front_to_back_opaque_draws",
+                               "If true, enable PainterPacker::front_to_back_opaque_draws(), "
+                               "has effect only if reorder_opaque_draws is true", *this),
+  m_cache_clip_paths(true, "cache_clip_paths",
+                     "Value for Painter::cache_clip_paths()", *this),
+  m_intern_packed_state(true, "intern_packed_state",
+                        "Value for Painter::intern_packed_state()", *this),
+  m_async_tessellation_threads(-1, "async_tessellation_threads",
+                               "If non-negative, the Painter tessellates paths asynchronously "
+                               "with Painter::async_tessellation() on a ThreadPool with this "
+                               "many threads, ignored if record_threads is positive", *this),
+  m_next_invalidated_capture(0),
+  m_replay_us(0),
+  m_have_text(false),
+  m_document_bounds(nullptr),
+  m_document_height(0.0f),
+  m_layer_fragments_in_order(0),
+  m_layer_fragments_front_to_back(0)
+{}
+
+painter_headless::
+~painter_headless()
+{
+  if(m_document_bounds)
+    {
+      FASTUIDRAWdelete(m_document_bounds);
+    }
+}
+
+void
+painter_headless::
+construct_path(void)
+{
+  m_path << vec2(50.0f, 35.0f)
+         << Path::control_point(60.0f, 50.0f)
+         << vec2(70.0f, 35.0f)
+         << Path::arc_degrees(180.0, vec2(70.0f, -100.0f))
+         << Path::control_point(60.0f, -150.0f)
+         << Path::control_point(30.0f, -50.0f)
+         << vec2(0.0f, -100.0f)
+         << Path::contour_end_arc_degrees(90.0f)
+         << vec2(200.0f, 200.0f)
+         << vec2(400.0f, 200.0f)
+         << vec2(400.0f, 400.0f)
+         << vec2(200.0f, 400.0f)
+         << Path::contour_end()
+         << vec2(-50.0f, 100.0f)
+         << vec2(0.0f, 200.0f)
+         << vec2(100.0f, 300.0f)
+         << vec2(150.0f, 325.0f)
+         << vec2(150.0f, 100.0f)
+         << Path::contour_end()
+         << vec2(300.0f, 300.0f)
+         << Path::contour_end();
+
+  m_cell_line << vec2(-100.0f, 0.0f)
+              << vec2(100.0f, 0.0f)
+              << Path::contour_end();
+
+  vec2 cell_size, r;
+  cell_size = vec2(m_width.m_value, m_height.m_value)
+    / vec2(m_num_cells_x.m_value, m_num_cells_y.m_value);
+  r = 0.2f * cell_size;
+  m_cell_clip << vec2(r.x(), 0.0f)
+              << vec2(cell_size.x() - r.x(), 0.0f)
+              << Path::arc_degrees(90.0f, vec2(cell_size.x(), r.y()))
+              << vec2(cell_size.x(), cell_size.y() - r.y())
+              << Path::arc_degrees(90.0f, vec2(cell_size.x() - r.x(), cell_size.y()))
+              << vec2(r.x(), cell_size.y())
+              << Path::arc_degrees(90.0f, vec2(0.0f, cell_size.y() - r.y()))
+              << vec2(0.0f, r.y())
+              << Path::contour_end_arc_degrees(90.0f);
+}
+
+void
+painter_headless::
+construct_text(void)
+{
+  if(!m_draw_text.m_value || !m_text_font)
+    {
+      return;
+    }
+
+  std::istringstream str("Cell\nHeadless Benchmark\nFastUIDraw");
+  std::vector<Glyph> glyphs;
+  std::vector<vec2> positions;
+  std::vector<uint32_t> character_codes;
+
+  create_formatted_text(str, GlyphRender(curve_pair_glyph), m_pixel_size.m_value,
+                        m_text_font, m_glyph_selector, glyphs, positions, character_codes);
+  m_text.set_data(PainterAttributeDataFillerGlyphs(cast_c_array(positions),
+                                                   cast_c_array(glyphs),
+                                                   m_pixel_size.m_value));
+  m_have_text = true;
+}
+
+void
+painter_headless::
+construct_document(void)
+{
+  if(m_workload.m_value.m_value != document_workload || !m_text_font)
+    {
+      return;
+    }
+
+  std::ostringstream ostr;
+  for(int i = 0; i < m_document_lines.m_value; ++i)
+    {
+      ostr << "Line " << i << ": The quick brown fox jumps over the lazy dog\n";
+    }
+
+  std::istringstream str(ostr.str());
+  std::vector<Glyph> glyphs;
+  std::vector<vec2> positions;
+  std::vector<uint32_t> character_codes;
+
+  create_formatted_text(str, GlyphRender(curve_pair_glyph), m_pixel_size.m_value,
+                        m_text_font, m_glyph_selector, glyphs, positions, character_codes);
+  m_document.set_data(PainterAttributeDataFillerGlyphs(cast_c_array(positions),
+                                                       cast_c_array(glyphs),
+                                                       m_pixel_size.m_value));
+  m_document_bounds = FASTUIDRAWnew PainterGlyphRunBounds(m_document, t_max(1, m_glyphs_per_block.m_value));
+  m_document_height = positions.empty() ? 0.0f : positions.back().y();
+}
+
+void
+painter_headless::
+construct_layers(void)
+{
+  vec2 wh(m_width.m_value, m_height.m_value);
+  vec2 panel_size(wh * 0.6f), step;
+
+  if(m_workload.m_value.m_value != layers_workload || m_num_layers.m_value <= 0)
+    {
+      return;
+    }
+
+  /* each panel is an opaque background, an opaque title bar
+     and a translucent highlight; the panels are offset
+     diagonally so that each hides much of those below it.
+   */
+  step = (wh - panel_size) / static_cast<float>(t_max(1, m_num_layers.m_value - 1));
+  for(int i = 0; i < m_num_layers.m_value; ++i)
+    {
+      layer_rect panel, title, highlight;
+      float t;
+
+      t = static_cast<float>(i) / static_cast<float>(m_num_layers.m_value);
+
+      panel.m_min = step * static_cast<float>(i);
+      panel.m_size = panel_size;
+      panel.m_color = vec4(t, 0.5f, 1.0f - t, 1.0f);
+      m_layer_rects.push_back(panel);
+
+      title.m_min = panel.m_min;
+      title.m_size = vec2(panel_size.x(), panel_size.y() * 0.1f);
+      title.m_color = vec4(0.2f, 0.2f, 0.6f, 1.0f);
+      m_layer_rects.push_back(title);
+
+      highlight.m_min = panel.m_min + panel_size * 0.2f;
+      highlight.m_size = panel_size * 0.3f;
+      highlight.m_color = vec4(1.0f, 1.0f, 1.0f, m_opaque_brushes.m_value ? 1.0f : 0.5f);
+      m_layer_rects.push_back(highlight);
+    }
+
+  estimate_layer_fragments();
+}
+
+void
+painter_headless::
+estimate_layer_fragments(void)
+{
+  /* The headless backend does not rasterize, so the fragments
+     of the layers workload are counted here: drawn in order,
+     every pixel of every rectangle is shaded. With the opaque
+     rectangles drawn front to back and an early depth test,
+     a pixel is shaded only by the top-most opaque rectangle
+     that covers it and by the translucent rectangles above
+     that one.
+   */
+  int w(m_width.m_value), h(m_height.m_value);
+  std::vector<int> top_opaque(w * h, -1);
+
+  for(unsigned int r = 0; r < m_layer_rects.size(); ++r)
+    {
+      const layer_rect &R(m_layer_rects[r]);
+      int x0, y0, x1, y1;
+
+      x0 = t_max(0, static_cast<int>(R.m_min.x()));
+      y0 = t_max(0, static_cast<int>(R.m_min.y()));
+      x1 = t_min(w, static_cast<int>(R.m_min.x() + R.m_size.x()));
+      y1 = t_min(h, static_cast<int>(R.m_min.y() + R.m_size.y()));
+      for(int y = y0; y < y1; ++y)
+        {
+          for(int x = x0; x < x1; ++x)
+            {
+              ++m_layer_fragments_in_order;
+              if(R.m_color.w() >= 1.0f)
+                {
+                  top_opaque[x + y * w] = r;
+                }
+            }
+        }
+    }
+
+  for(unsigned int r = 0; r < m_layer_rects.size(); ++r)
+    {
+      const layer_rect &R(m_layer_rects[r]);
+      int x0, y0, x1, y1;
+
+      x0 = t_max(0, static_cast<int>(R.m_min.x()));
+      y0 = t_max(0, static_cast<int>(R.m_min.y()));
+      x1 = t_min(w, static_cast<int>(R.m_min.x() + R.m_size.x()));
+      y1 = t_min(h, static_cast<int>(R.m_min.y() + R.m_size.y()));
+      for(int y = y0; y < y1; ++y)
+        {
+          for(int x = x0; x < x1; ++x)
+            {
+              if(static_cast<int>(r) >= top_opaque[x + y * w])
+                {
+                  ++m_layer_fragments_front_to_back;
+                }
+            }
+        }
+    }
+}
+
+void
+painter_headless::
+init(void)
+{
+  headless::PainterBackendHeadless::ConfigurationHeadless config;
+
+  config
+    .attributes_per_buffer(m_attributes_per_buffer.m_value)
+    .indices_per_buffer(m_indices_per_buffer.m_value)
+    .data_blocks_per_store_buffer(m_data_blocks_per_store_buffer.m_value)
+    .data_blocks_per_persistent_store(m_data_blocks_per_persistent_store.m_value)
+    .break_on_shader_change(m_break_on_shader_change.m_value)
+    .short_indices(m_short_indices.m_value)
+    .compact_attributes(m_compact_attributes.m_value);
+
+  m_backend = FASTUIDRAWnew headless::PainterBackendHeadless(config, PainterBackend::ConfigurationBase());
+  m_painter = FASTUIDRAWnew Painter(m_backend);
+  m_painter->reorder_opaque_draws(m_reorder_opaque_draws.m_value);
+  m_painter->front_to_back_opaque_draws(m_front_to_back_opaque_draws.m_value);
+  m_painter->time_frame_stats(m_frame_stats.m_value);
+  m_painter->cache_clip_paths(m_cache_clip_paths.m_value);
+  m_painter->intern_packed_state(m_intern_packed_state.m_value);
+  if(m_async_tessellation_threads.m_value >= 0 && m_record_threads.m_value <= 0)
+    {
+      m_tessellation_pool = FASTUIDRAWnew ThreadPool(m_async_tessellation_threads.m_value);
+      m_painter->async_tessellation(m_tessellation_pool);
+    }
+  if(m_retained.m_value && m_record_threads.m_value <= 0)
+    {
+      m_draw_list = FASTUIDRAWnew PainterDrawList();
+    }
+  if(m_record_threads.m_value > 0)
+    {
+      m_packer = FASTUIDRAWnew PainterPacker(m_backend);
+      m_packer->reorder_opaque_draws(m_reorder_opaque_draws.m_value);
+      m_packer->front_to_back_opaque_draws(m_front_to_back_opaque_draws.m_value);
+      for(int i = 0; i < m_record_threads.m_value; ++i)
+        {
+          m_recording_painters.push_back(FASTUIDRAWnew Painter(m_backend));
+          m_recording_painters.back()->cache_clip_paths(m_cache_clip_paths.m_value);
+          m_recording_painters.back()->intern_packed_state(m_intern_packed_state.m_value);
+          m_recorders.push_back(FASTUIDRAWnew PainterPackerRecorder(m_backend->configuration_base().alignment()));
+        }
+    }
+  if(m_capture_cells.m_value && !m_draw_list && m_record_threads.m_value <= 0)
+    {
+      m_cell_captures.resize(m_num_cells_x.m_value * m_num_cells_y.m_value);
+      for(unsigned int i = 0; i < m_cell_captures.size(); ++i)
+        {
+          m_cell_captures[i] = FASTUIDRAWnew PainterDrawList();
+        }
+    }
+  m_glyph_cache = FASTUIDRAWnew GlyphCache(m_painter->glyph_atlas());
+  m_glyph_selector = FASTUIDRAWnew GlyphSelector(m_glyph_cache);
+  m_ft_lib = FASTUIDRAWnew FreetypeLib();
+
+  m_text_font = FontFreeType::create(m_font.m_value.c_str(), m_ft_lib, FontFreeType::RenderParams());
+  if(!m_text_font)
+    {
+      std::cout << "Unable to load font \"" << m_font.m_value << "\", text disabled\n";
+    }
+
+  construct_path();
+  if(m_lod_cache_kb.m_value >= 0 && m_record_threads.m_value <= 0)
+    {
+      m_lod_cache = FASTUIDRAWnew PathLODCache(static_cast<uint64_t>(m_lod_cache_kb.m_value) * 1024u);
+      m_path.tessellation_cache(m_lod_cache);
+    }
+  construct_text();
+  construct_document();
+  construct_layers();
+}
+
+void
+painter_headless::
+draw_cells(Painter &painter, int frame, range_type<int> rows)
+{
+  vec2 cell_size;
+  float angle;
+
+  std::vector<PainterPackedValue<PainterBrush> > packed_brushes;
+
+  cell_size = vec2(m_width.m_value, m_height.m_value)
+    / vec2(m_num_cells_x.m_value, m_num_cells_y.m_value);
+  angle = static_cast<float>(frame) * 0.01f;
+  if(m_packed_brushes.m_value)
+    {
+      packed_brushes.reserve(3 * m_num_cells_x.m_value * (rows.m_end - rows.m_begin));
+    }
+
+  for(int y = rows.m_begin; y < rows.m_end; ++y)
+    {
+      for(int x = 0; x < m_num_cells_x.m_value; ++x)
+        {
+          PainterBrush background, item, line;
+          float t;
+
+          t = static_cast<float>(x + y * m_num_cells_x.m_value)
+            / static_cast<float>(m_num_cells_x.m_value * m_num_cells_y.m_value);
+          background.pen(t, 1.0f - t, 0.5f, 1.0f);
+          item.pen(1.0f - t, 0.5f, t, m_opaque_brushes.m_value ? 1.0f : 0.8f);
+          line.pen(0.0f, 0.0f, 1.0f, m_opaque_brushes.m_value ? 1.0f : 0.5f);
+
+          PainterData::value<PainterBrush> background_value(&background);
+          PainterData::value<PainterBrush> item_value(&item), line_value(&line);
+          if(m_packed_brushes.m_value)
+            {
+              PainterPackedValuePool &pool(painter.packed_value_pool());
+
+              packed_brushes.push_back(pool.create_packed_value(background));
+              background_value = PainterData::value<PainterBrush>(packed_brushes.back());
+              packed_brushes.push_back(pool.create_packed_value(item));
+              item_value = PainterData::value<PainterBrush>(packed_brushes.back());
+              packed_brushes.push_back(pool.create_packed_value(line));
+              line_value = PainterData::value<PainterBrush>(packed_brushes.back());
+            }
+
+          if(!m_cell_captures.empty()
+             && !painter.begin_draw_capture(m_cell_captures[x + y * m_num_cells_x.m_value]))
+            {
+              continue;
+            }
+
+          painter.save();
+          painter.translate(cell_size * vec2(x, y));
+          if(m_clip_cells.m_value)
+            {
+              painter.clipInPath(m_cell_clip, PainterEnums::nonzero_fill_rule);
+            }
+          painter.draw_rect(PainterData(background_value), vec2(0.0f, 0.0f), cell_size, false);
+
+          painter.translate(cell_size * 0.5f);
+          painter.rotate(angle + t);
+
+          reference_counted_ptr<PainterPacker::DataCallBack> patch_point;
+          if(m_draw_list && x == 0 && y == 0)
+            {
+              patch_point = m_draw_list->patch_point(0);
+            }
+          painter.draw_rect(PainterData(item_value), cell_size * -0.25f, cell_size * 0.5f, true, patch_point);
+          if(m_have_text)
+            {
+              painter.draw_glyphs(PainterData(item_value), m_text);
+            }
+
+          if(m_draw_lines.m_value)
+            {
+              PainterStrokeParams st;
+              st.miter_limit(-1.0f);
+              st.width(m_stroke_width.m_value);
+              painter.stroke_path(PainterData(line_value, &st), m_cell_line,
+                                     true, PainterEnums::flat_caps,
+                                     PainterEnums::miter_clip_joins, m_anti_alias.m_value);
+            }
+          painter.restore();
+
+          if(!m_cell_captures.empty())
+            {
+              painter.end_draw_capture();
+            }
+        }
+    }
+}
+
+void
+painter_headless::
+draw_paths(Painter &painter, int frame, range_type<int> paths)
+{
+  for(int i = paths.m_begin; i < paths.m_end; ++i)
+    {
+      PainterBrush fill_brush, stroke_brush;
+      float t;
+
+      t = static_cast<float>(i) / static_cast<float>(m_num_paths.m_value);
+      fill_brush.pen(1.0f, t, 1.0f - t, 1.0f);
+      stroke_brush.pen(0.0f, 1.0f, t, m_opaque_brushes.m_value ? 1.0f : 0.8f);
+
+      painter.save();
+      painter.translate(vec2(m_width.m_value, m_height.m_value) * vec2(t, 0.5f));
+      if(m_path_perspective.m_value != 0.0f)
+        {
+          float3x3 m;
+          m(2, 1) = m_path_perspective.m_value;
+          painter.concat(m);
+        }
+      painter.rotate(static_cast<float>(frame) * 0.02f + t * static_cast<float>(M_PI));
+      painter.scale((0.5f + t) * (1.0f + m_path_zoom.m_value * static_cast<float>(frame)));
+
+      if(m_draw_fill.m_value)
+        {
+          painter.fill_path(PainterData(&fill_brush), m_path,
+                               PainterEnums::nonzero_fill_rule,
+                               m_anti_alias.m_value);
+        }
+
+      if(m_draw_stroke.m_value)
+        {
+          PainterStrokeParams st;
+          st.miter_limit(5.0f);
+          st.width(8.0f);
+          painter.stroke_path(PainterData(&stroke_brush, &st), m_path,
+                                 true, PainterEnums::rounded_caps,
+                                 PainterEnums::rounded_joins, m_anti_alias.m_value);
+        }
+      painter.restore();
+    }
+}
+
+void
+painter_headless::
+draw_document(Painter &painter, int frame)
+{
+  PainterBrush brush;
+  float scroll;
+
+  if(!m_document_bounds)
+    {
+      return;
+    }
+
+  /* scroll through the document, a line of text
+     every few frames
+   */
+  brush.pen(0.0f, 0.0f, 0.0f, 1.0f);
+  scroll = fmodf(static_cast<float>(frame) * 0.25f * m_pixel_size.m_value,
+                 t_max(1.0f, m_document_height));
+
+  painter.save();
+  painter.clipInRect(vec2(0.0f, 0.0f), vec2(m_width.m_value, m_height.m_value));
+  painter.translate(vec2(0.0f, -scroll));
+  if(m_cull_glyphs.m_value)
+    {
+      painter.draw_glyphs(PainterData(&brush), m_document, *m_document_bounds);
+    }
+  else
+    {
+      painter.draw_glyphs(PainterData(&brush), m_document);
+    }
+  painter.restore();
+}
+
+void
+painter_headless::
+draw_layers(Painter &painter, range_type<int> layers)
+{
+  for(int i = 3 * layers.m_begin; i < 3 * layers.m_end; ++i)
+    {
+      const layer_rect &R(m_layer_rects[i]);
+      PainterBrush brush;
+
+      brush.pen(R.m_color);
+      painter.draw_rect(PainterData(&brush), R.m_min, R.m_size, false);
+    }
+}
+
+void
+painter_headless::
+draw_content(Painter &painter, int frame, int slice, int num_slices)
+{
+  float3x3 proj(float_orthogonal_projection_params(0, m_width.m_value, m_height.m_value, 0));
+
+  painter.target_resolution(m_width.m_value, m_height.m_value);
+  painter.transformation(proj);
+
+  /* each slice draws a contiguous block of the rows of
+     cells and of the paths
+   */
+  if(m_workload.m_value.m_value == cells_workload
+     || m_workload.m_value.m_value == all_workload)
+    {
+      int N(m_num_cells_y.m_value);
+      draw_cells(painter, frame,
+                 range_type<int>((N * slice) / num_slices, (N * (slice + 1)) / num_slices));
+    }
+
+  if(m_workload.m_value.m_value == paths_workload
+     || m_workload.m_value.m_value == all_workload)
+    {
+      int N(m_num_paths.m_value);
+      draw_paths(painter, frame,
+                 range_type<int>((N * slice) / num_slices, (N * (slice + 1)) / num_slices));
+    }
+
+  /* the document is a single glyph run, it is drawn by the first slice */
+  if(m_workload.m_value.m_value == document_workload && slice == 0)
+    {
+      draw_document(painter, frame);
+    }
+
+  if(m_workload.m_value.m_value == layers_workload)
+    {
+      int N(m_layer_rects.size() / 3);
+      draw_layers(painter, range_type<int>((N * slice) / num_slices, (N * (slice + 1)) / num_slices));
+    }
+}
+
+void
+painter_headless::
+draw_frame(int frame)
+{
+  for(int i = 0, endi = m_cell_captures.empty() ? 0 : m_invalidate_captures.m_value; i < endi; ++i)
+    {
+      m_cell_captures[m_next_invalidated_capture]->clear();
+      m_next_invalidated_capture = (m_next_invalidated_capture + 1) % m_cell_captures.size();
+    }
+
+  if(!m_draw_list)
+    {
+      m_painter->begin();
+      draw_content(*m_painter, frame, 0, 1);
+      m_painter->end();
+    }
+  else if(frame == 0)
+    {
+      m_painter->begin(m_draw_list);
+      draw_content(*m_painter, frame, 0, 1);
+      m_painter->end();
+    }
+  else
+    {
+      PainterBrush brush;
+      float t;
+
+      t = static_cast<float>(frame % 64) / 64.0f;
+      brush.pen(t, 1.0f - t, 0.5f, 1.0f);
+      m_draw_list->patch_brush(0, brush);
+
+      m_painter->begin();
+      m_painter->draw_list(*m_draw_list);
+      m_painter->end();
+    }
+}
+
+void
+painter_headless::
+record_frame(int frame)
+{
+  std::vector<std::thread> threads;
+  std::vector<const PainterPackerRecorder*> recorders;
+  int num_threads(m_recording_painters.size());
+
+  for(int i = 0; i < num_threads; ++i)
+    {
+      threads.push_back(std::thread([this, frame, i, num_threads]()
+                                    {
+                                      m_recorders[i]->clear();
+                                      m_recording_painters[i]->begin(m_recorders[i]);
+                                      draw_content(*m_recording_painters[i], frame, i, num_threads);
+                                      m_recording_painters[i]->end();
+                                    }));
+      recorders.push_back(m_recorders[i].get());
+    }
+
+  for(int i = 0; i < num_threads; ++i)
+    {
+      threads[i].join();
+    }
+
+  simple_time replay_timer;
+  m_packer->target_resolution(m_width.m_value, m_height.m_value);
+  m_packer->begin();
+  PainterPackerRecorder::replay(cast_c_array(recorders), *m_packer, 1);
+  m_packer->end();
+  m_replay_us += replay_timer.elapsed_us();
+}
+
+unsigned int
+painter_headless::
+query_packer_stat(enum PainterPacker::stats_t st) const
+{
+  return (m_packer) ? m_packer->query_stat(st) : m_painter->query_stat(st);
+}
+
+int
+painter_headless::
+main(int argc, char **argv)
+{
+  typedef headless::PainterBackendHeadless B;
+
+  if(argc == 2 && (std::string(argv[1]) == "-help" || std::string(argv[1]) == "--help"))
+    {
+      std::cout << "\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  parse_command_line(argc, argv);
+  std::cout << "\n\n" << std::flush;
+  init();
+
+  if(!m_trace_file.m_value.empty() && !trace::start(m_trace_file.m_value.c_str()))
+    {
+      std::cout << "Unable to open \"" << m_trace_file.m_value << "\" for writing trace events\n";
+    }
+
+  /* the first frame includes one-time costs such as
+     tessellation of paths and realization of glyphs,
+     so it is not part of the measurement. It is always
+     drawn from one thread so that the recording threads
+     only read the tessellations of the paths.
+   */
+  draw_frame(0);
+
+  vecN<uint64_t, B::num_stats> totals(0);
+  uint64_t total_headers(0), total_headers_reused(0), total_breaks_avoided(0);
+  uint64_t total_compact_attributes(0);
+  simple_time timer;
+  int64_t total_us(0), max_us(0);
+  uint64_t total_heap_allocations(0);
+  PainterFrameStats total_frame_stats;
+
+  for(int frame = 1; frame <= m_num_frames.m_value; ++frame)
+    {
+      int64_t us;
+
+      uint64_t heap_allocations;
+
+      heap_allocations = number_heap_allocations();
+      timer.restart_us();
+      if(m_packer)
+        {
+          record_frame(frame);
+        }
+      else
+        {
+          draw_frame(frame);
+        }
+      us = timer.elapsed_us();
+      total_us += us;
+      max_us = t_max(max_us, us);
+      total_heap_allocations += number_heap_allocations() - heap_allocations;
+
+      for(unsigned int i = 0; i < B::num_stats; ++i)
+        {
+          totals[i] += m_backend->query_stat(static_cast<enum B::stats_t>(i));
+        }
+      total_headers += query_packer_stat(PainterPacker::num_headers);
+      total_headers_reused += query_packer_stat(PainterPacker::num_headers_reused);
+      total_breaks_avoided += query_packer_stat(PainterPacker::num_draw_breaks_avoided);
+      total_compact_attributes += query_packer_stat(PainterPacker::num_compact_attributes);
+      if(!m_packer)
+        {
+          const PainterFrameStats &stats(m_painter->frame_stats());
+
+          total_frame_stats.m_packer_stats += stats.m_packer_stats;
+          total_frame_stats.m_counters += stats.m_counters;
+          total_frame_stats.m_timers += stats.m_timers;
+        }
+
+      if(m_print_each_frame.m_value)
+        {
+          std::cout << "Frame " << frame << ": " << us << " us, "
+                    << m_backend->query_stat(B::num_bytes) << " bytes, "
+                    << m_backend->query_stat(B::num_draws) << " draws, "
+                    << m_backend->query_stat(B::num_draw_breaks) << " draw breaks\n";
+        }
+    }
+  trace::stop();
+
+  if(m_num_frames.m_value <= 0)
+    {
+      return 0;
+    }
+
+  double N(m_num_frames.m_value), secs(static_cast<double>(total_us) * 1e-6);
+  double packed_bytes;
+
+  /* the backend counts every attribute as a full PainterAttribute */
+  packed_bytes = static_cast<double>(totals[B::num_bytes])
+    - static_cast<double>(total_compact_attributes) * (sizeof(PainterAttribute) - sizeof(uvec4));
+
+  std::cout << std::fixed << std::setprecision(2)
+            << "Frames: " << m_num_frames.m_value << "\n"
+            << "Total time: " << static_cast<double>(total_us) * 1e-3 << " ms\n"
+            << "Time per frame: " << static_cast<double>(total_us) / N << " us\n"
+            << "Longest frame: " << max_us << " us\n"
+            << "Packed bytes per frame: " << packed_bytes / N << "\n"
+            << "Packed MB per second: " << packed_bytes / (secs * 1024.0 * 1024.0) << "\n"
+            << "Attributes per frame: " << static_cast<double>(totals[B::num_attributes]) / N << "\n"
+            << "Compact attributes per frame: " << static_cast<double>(total_compact_attributes) / N << "\n"
+            << "Indices per frame: " << static_cast<double>(totals[B::num_indices]) / N << "\n"
+            << "Generic data per frame: " << static_cast<double>(totals[B::num_generic_datas]) / N << "\n"
+            << "Persistent generic data per frame: " << static_cast<double>(totals[B::num_persistent_generic_datas]) / N << "\n"
+            << "Headers per frame: " << static_cast<double>(total_headers) / N << "\n"
+            << "Headers reused per frame: " << static_cast<double>(total_headers_reused) / N << "\n"
+            << "PainterDraws per frame: " << static_cast<double>(totals[B::num_draws]) / N << "\n"
+            << "Draw breaks per frame: " << static_cast<double>(totals[B::num_draw_breaks]) / N << "\n"
+            << "Draw breaks avoided per frame: " << static_cast<double>(total_breaks_avoided) / N << "\n"
+            << "Draws per frame: " << static_cast<double>(totals[B::num_draws] + totals[B::num_draw_breaks]) / N << "\n"
+            << "Heap allocations per frame: " << static_cast<double>(total_heap_allocations) / N << "\n"
+            << "Buffer allocations: " << m_backend->number_buffer_allocations() << "\n"
+            << "Path tessellation KB: "
+            << static_cast<double>(m_path.tessellation_memory_usage()) / 1024.0 << "\n";
+
+  if(m_lod_cache)
+    {
+      std::cout << "PathLODCache KB: "
+                << static_cast<double>(m_lod_cache->memory_usage()) / 1024.0 << "\n"
+                << "PathLODCache LODs: " << m_lod_cache->number_lods() << "\n"
+                << "PathLODCache LODs evicted: " << m_lod_cache->number_evicted() << "\n";
+    }
+
+  if(m_workload.m_value.m_value == layers_workload)
+    {
+      std::cout << "Estimated fragments per frame drawn in order: "
+                << m_layer_fragments_in_order << "\n"
+                << "Estimated fragments per frame drawn front to back: "
+                << m_layer_fragments_front_to_back << "\n";
+    }
+
+  if(m_packer)
+    {
+      std::cout << "Replay time per frame: " << static_cast<double>(m_replay_us) / N << " us\n";
+    }
+  else if(m_frame_stats.m_value)
+    {
+      std::cout << "PainterFrameStats averages:\n";
+      for(unsigned int i = 0; i < PainterPacker::num_stats; ++i)
+        {
+          enum PainterPacker::stats_t st(static_cast<enum PainterPacker::stats_t>(i));
+          std::cout << "\t" << PainterFrameStats::label(st) << ": "
+                    << static_cast<double>(total_frame_stats.m_packer_stats[st]) / N << "\n";
+        }
+      for(unsigned int i = 0; i < PainterFrameStats::number_counters; ++i)
+        {
+          enum PainterFrameStats::counter_t c(static_cast<enum PainterFrameStats::counter_t>(i));
+          std::cout << "\t" << PainterFrameStats::label(c) << ": "
+                    << static_cast<double>(total_frame_stats.m_counters[c]) / N << "\n";
+        }
+      for(unsigned int i = 0; i < PainterFrameStats::number_timers; ++i)
+        {
+          enum PainterFrameStats::timer_t t(static_cast<enum PainterFrameStats::timer_t>(i));
+          std::cout << "\t" << PainterFrameStats::label(t) << ": "
+                    << static_cast<double>(total_frame_stats.m_timers[t]) * 1e-3 / N << " us\n";
+        }
+    }
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  painter_headless P;
+  return P.main(argc, argv);
+}
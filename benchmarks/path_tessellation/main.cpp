@@ -0,0 +1,242 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/thread_pool.hpp>
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+
+#include "generic_command_line.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* path_tessellation measures the cost of the first tessellation
+   of a Path made of many small contours, as the paths of a map
+   or a chart are, with the contours tessellated serially and
+   with the contours tessellated in parallel by a ThreadPool,
+   see Path::tessellation_thread_pool(). It also checks that
+   both give exactly the same TessellatedPath. Lastly it measures
+   the cost of tessellating again after appending contours to
+   a Path that is already tessellated, where only the appended
+   contours are tessellated.
+ */
+class path_tessellation:public command_line_register
+{
+public:
+  path_tessellation(void);
+
+  int
+  main(int argc, char **argv);
+
+private:
+  void
+  construct_path(Path &path, int first_contour, int num_contours);
+
+  int64_t
+  run(const reference_counted_ptr<ThreadPool> &pool,
+      reference_counted_ptr<const TessellatedPath> *out_last);
+
+  int64_t
+  run_append(reference_counted_ptr<const TessellatedPath> *out_last);
+
+  static
+  bool
+  same_tessellation(const TessellatedPath &a, const TessellatedPath &b);
+
+  command_separator m_benchmark_options;
+  command_line_argument_value<int> m_num_contours;
+  command_line_argument_value<int> m_curves_per_contour;
+  command_line_argument_value<int> m_num_threads;
+  command_line_argument_value<int> m_num_iterations;
+  command_line_argument_value<float> m_thresh;
+  command_line_argument_value<int> m_num_append;
+};
+
+path_tessellation::
+path_tessellation(void):
+  m_benchmark_options("Benchmark Options", *this),
+  m_num_contours(4000, "num_contours", "Number of contours of the path", *this),
+  m_curves_per_contour(8, "curves_per_contour",
+                       "Number of curves of each contour, half are quadratic "
+                       "curves and half are arcs", *this),
+  m_num_threads(4, "num_threads",
+                "Number of threads of the ThreadPool, the calling thread also "
+                "tessellates contours", *this),
+  m_num_iterations(10, "num_iterations",
+                   "Number of times each mode tessellates a newly constructed path", *this),
+  m_thresh(0.05f, "thresh", "Value passed to Path::tessellation(float)", *this),
+  m_num_append(1, "num_append",
+               "Number of contours appended to the tessellated path before "
+               "it is tessellated again", *this)
+{}
+
+void
+path_tessellation::
+construct_path(Path &path, int first_contour, int num_contours)
+{
+  int side(static_cast<int>(std::ceil(std::sqrt(static_cast<float>(m_num_contours.m_value)))));
+
+  for(int c = first_contour, endc = first_contour + num_contours; c < endc; ++c)
+    {
+      vec2 center(100.0f * static_cast<float>(c % side), 100.0f * static_cast<float>(c / side));
+      int n(t_max(2, m_curves_per_contour.m_value));
+      float r(20.0f + static_cast<float>(c % 7) * 4.0f);
+
+      for(int i = 0; i < n; ++i)
+        {
+          float t(2.0f * static_cast<float>(M_PI) * static_cast<float>(i) / static_cast<float>(n));
+          float tm(2.0f * static_cast<float>(M_PI) * (static_cast<float>(i) + 0.5f) / static_cast<float>(n));
+          vec2 p(center + r * vec2(std::cos(t), std::sin(t)));
+          vec2 ct(center + 1.5f * r * vec2(std::cos(tm), std::sin(tm)));
+
+          if(i == 0)
+            {
+              path << p;
+            }
+          else if(i & 1)
+            {
+              path << Path::control_point(ct) << p;
+            }
+          else
+            {
+              path << Path::arc_degrees(30.0f, p);
+            }
+        }
+      path << Path::contour_end_arc_degrees(45.0f);
+    }
+}
+
+bool
+path_tessellation::
+same_tessellation(const TessellatedPath &a, const TessellatedPath &b)
+{
+  const_c_array<TessellatedPath::point> pa(a.point_data()), pb(b.point_data());
+
+  if(pa.size() != pb.size()
+     || a.number_contours() != b.number_contours()
+     || a.max_segments() != b.max_segments()
+     || a.effective_curve_distance_threshhold() != b.effective_curve_distance_threshhold()
+     || a.bounding_box_min() != b.bounding_box_min()
+     || a.bounding_box_max() != b.bounding_box_max()
+     || std::memcmp(pa.c_ptr(), pb.c_ptr(), pa.size() * sizeof(TessellatedPath::point)) != 0)
+    {
+      return false;
+    }
+
+  for(unsigned int c = 0; c < a.number_contours(); ++c)
+    {
+      if(a.number_edges(c) != b.number_edges(c))
+        {
+          return false;
+        }
+      for(unsigned int e = 0; e < a.number_edges(c); ++e)
+        {
+          if(a.edge_range(c, e).m_begin != b.edge_range(c, e).m_begin
+             || a.edge_range(c, e).m_end != b.edge_range(c, e).m_end)
+            {
+              return false;
+            }
+        }
+    }
+  return true;
+}
+
+int64_t
+path_tessellation::
+run(const reference_counted_ptr<ThreadPool> &pool,
+    reference_counted_ptr<const TessellatedPath> *out_last)
+{
+  simple_time timer;
+  int64_t us(0);
+
+  for(int i = 0; i < m_num_iterations.m_value; ++i)
+    {
+      Path path;
+
+      construct_path(path, 0, m_num_contours.m_value);
+      path.tessellation_thread_pool(pool);
+      timer.restart_us();
+      *out_last = path.tessellation(m_thresh.m_value);
+      us += timer.elapsed_us();
+    }
+  return us;
+}
+
+int64_t
+path_tessellation::
+run_append(reference_counted_ptr<const TessellatedPath> *out_last)
+{
+  simple_time timer;
+  int64_t us(0);
+
+  for(int i = 0; i < m_num_iterations.m_value; ++i)
+    {
+      Path path;
+
+      construct_path(path, 0, m_num_contours.m_value);
+      path.tessellation(m_thresh.m_value);
+      construct_path(path, m_num_contours.m_value, t_max(0, m_num_append.m_value));
+      timer.restart_us();
+      *out_last = path.tessellation(m_thresh.m_value);
+      us += timer.elapsed_us();
+    }
+  return us;
+}
+
+int
+path_tessellation::
+main(int argc, char **argv)
+{
+  if(argc == 2 && (std::string(argv[1]) == "-help" || std::string(argv[1]) == "--help"))
+    {
+      std::cout << "\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  parse_command_line(argc, argv);
+  std::cout << "\n\n" << std::flush;
+
+  reference_counted_ptr<ThreadPool> pool;
+  reference_counted_ptr<const TessellatedPath> serial_tess, pool_tess, append_tess;
+  int64_t serial_us, pool_us, append_us;
+  double N(static_cast<double>(t_max(1, m_num_iterations.m_value)));
+  bool same_pool, same_append;
+
+  pool = FASTUIDRAWnew ThreadPool(t_max(0, m_num_threads.m_value));
+  serial_us = run(reference_counted_ptr<ThreadPool>(), &serial_tess);
+  pool_us = run(pool, &pool_tess);
+  append_us = run_append(&append_tess);
+
+  Path appended;
+  construct_path(appended, 0, m_num_contours.m_value + t_max(0, m_num_append.m_value));
+  TessellatedPath full_tess(appended, append_tess->tessellation_parameters());
+
+  same_pool = same_tessellation(*serial_tess, *pool_tess);
+  same_append = same_tessellation(*append_tess, full_tess);
+
+  std::cout << std::fixed << std::setprecision(2)
+            << "Contours: " << m_num_contours.m_value << "\n"
+            << "Points per tessellation: " << serial_tess->point_data().size() << "\n"
+            << "Serial: " << static_cast<double>(serial_us) * 1e-3 / N << " ms\n"
+            << "ThreadPool(" << pool->number_threads() << "): "
+            << static_cast<double>(pool_us) * 1e-3 / N << " ms\n"
+            << "Identical output: " << (same_pool ? "yes" : "NO") << "\n"
+            << "Tessellate after appending " << t_max(0, m_num_append.m_value)
+            << " contours: " << static_cast<double>(append_us) * 1e-3 / N << " ms\n"
+            << "Identical to full tessellation: " << (same_append ? "yes" : "NO") << "\n";
+
+  return (same_pool && same_append) ? 0 : 1;
+}
+
+int
+main(int argc, char **argv)
+{
+  path_tessellation P;
+  return P.main(argc, argv);
+}
@@ -1,4 +1,5 @@
 #include <iomanip>
+#include <fastuidraw/util/trace.hpp>
 #include "sdl_benchmark.hpp"
 
 sdl_benchmark::
@@ -28,6 +29,11 @@ sdl_benchmark(const std::string &about_text, bool allow_fbo):
                       *this),
   m_print_each_time(false, "print_ms_each_frame",
                     "If true, print the number of ms between each frame", *this),
+  m_trace_file("", "trace_file",
+               "If non-empty, record the trace events of FastUIDraw and write them "
+               "as a Chrome trace JSON file to the named file (view with chrome://tracing "
+               "or ui.perfetto.dev); trace events are only present if FastUIDraw was "
+               "built with TRACE_EVENTS=1", *this),
 
   m_benchmark_label("Benchmark Options", *this),
 
@@ -44,6 +50,7 @@ sdl_benchmark(const std::string &about_text, bool allow_fbo):
 sdl_benchmark::
 ~sdl_benchmark()
 {
+  fastuidraw::trace::stop();
   unbind_and_delete_fbo();
 }
 
@@ -61,6 +68,11 @@ init_gl(int w, int h)
       glViewport(0, 0, w, h);
     }
 
+  if(!m_trace_file.m_value.empty() && !fastuidraw::trace::start(m_trace_file.m_value.c_str()))
+    {
+      std::cout << "\nUnable to open \"" << m_trace_file.m_value << "\" for writing trace events\n";
+    }
+
   m_time.restart();
 }
 
@@ -210,6 +222,7 @@ draw_frame(void)
                         << "\n";
             }
         }
+      fastuidraw::trace::stop();
       end_benchmark(0);
     }
   else if(m_frame==0)
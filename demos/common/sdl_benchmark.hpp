@@ -77,6 +77,7 @@ private:
   command_line_argument_value<bool> m_dry_run;
   command_line_argument_value<int> m_swap_buffer_extra;
   command_line_argument_value<bool> m_print_each_time;
+  command_line_argument_value<std::string> m_trace_file;
 
   command_separator m_benchmark_label;
 
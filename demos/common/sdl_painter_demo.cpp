@@ -172,6 +172,15 @@ sdl_painter_demo(const std::string &about_text,
                                    "painter_break_on_shader_change",
                                    "If true, different shadings are placed into different "
                                    "entries of a call to glMultiDrawElements", *this),
+  m_painter_short_indices(m_painter_params.short_indices(),
+                          "painter_short_indices",
+                          "If true, indices are 16-bit values; this clamps "
+                          "painter_attributes_per_buffer to 65536", *this),
+  m_painter_compact_attributes(m_painter_params.compact_attributes(),
+                               "painter_compact_attributes",
+                               "If true, shaders that only read the primary attribute "
+                               "(for example the fill shader) have 16-byte attributes "
+                               "in their own buffer object and VAO", *this),
   m_uber_vert_use_switch(m_painter_params.vert_shader_use_switch(),
                          "painter_uber_vert_use_switch",
                          "If true, use a switch statement in uber vertex shader dispatch",
@@ -214,6 +223,12 @@ sdl_painter_demo(const std::string &about_text,
                                    "painter_blocks_per_buffer",
                                    "Number of data blocks a single API draw can hold",
                                    *this),
+  m_painter_data_blocks_per_persistent_store(m_painter_params.data_blocks_per_persistent_store(),
+                                             "painter_blocks_per_persistent_store",
+                                             "Number of data blocks of the persistent data store "
+                                             "that holds the data of PainterPackedValue objects "
+                                             "once per frame, 0 means no persistent data store",
+                                             *this),
   m_data_store_backing(m_painter_params.data_store_backing(),
                        enumerated_string_type<data_store_backing_t>()
                        .add_entry("tbo",
@@ -350,8 +365,11 @@ init_gl(int w, int h)
     .attributes_per_buffer(m_painter_attributes_per_buffer.m_value)
     .indices_per_buffer(m_painter_indices_per_buffer.m_value)
     .data_blocks_per_store_buffer(m_painter_data_blocks_per_buffer.m_value)
+    .data_blocks_per_persistent_store(m_painter_data_blocks_per_persistent_store.m_value)
     .number_pools(m_painter_number_pools.m_value)
     .break_on_shader_change(m_painter_break_on_shader_change.m_value)
+    .short_indices(m_painter_short_indices.m_value)
+    .compact_attributes(m_painter_compact_attributes.m_value)
     .use_hw_clip_planes(m_use_hw_clip_planes.m_value)
     .vert_shader_use_switch(m_uber_vert_use_switch.m_value)
     .frag_shader_use_switch(m_uber_frag_use_switch.m_value)
@@ -384,6 +402,8 @@ init_gl(int w, int h)
       LAZY(indices_per_buffer);
       LAZY(number_pools);
       LAZY(break_on_shader_change);
+      LAZY(short_indices);
+      LAZY(compact_attributes);
       LAZY(vert_shader_use_switch);
       LAZY(frag_shader_use_switch);
       LAZY(blend_shader_use_switch);
@@ -392,6 +412,7 @@ init_gl(int w, int h)
       std::cout << "\n\nOptions affected by GL context\n";
       LAZY(use_hw_clip_planes);
       LAZY(data_blocks_per_store_buffer);
+      LAZY(data_blocks_per_persistent_store);
       LAZY(assign_layout_to_vertex_shader_inputs);
       LAZY(assign_layout_to_varyings);
       LAZY(use_ubo_for_uniforms);
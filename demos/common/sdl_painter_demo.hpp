@@ -93,6 +93,8 @@ private:
   command_line_argument_value<int> m_painter_indices_per_buffer;
   command_line_argument_value<int> m_painter_number_pools;
   command_line_argument_value<bool> m_painter_break_on_shader_change;
+  command_line_argument_value<bool> m_painter_short_indices;
+  command_line_argument_value<bool> m_painter_compact_attributes;
   command_line_argument_value<bool> m_uber_vert_use_switch;
   command_line_argument_value<bool> m_uber_frag_use_switch;
   command_line_argument_value<bool> m_uber_blend_use_switch;
@@ -106,6 +108,7 @@ private:
   command_line_argument_value<bool> m_use_hw_clip_planes;
   command_line_argument_value<int> m_painter_alignment;
   command_line_argument_value<int> m_painter_data_blocks_per_buffer;
+  command_line_argument_value<int> m_painter_data_blocks_per_persistent_store;
   enumerated_command_line_argument_value<data_store_backing_t> m_data_store_backing;
   command_line_argument_value<bool> m_assign_layout_to_vertex_shader_inputs;
   command_line_argument_value<bool> m_assign_layout_to_varyings;
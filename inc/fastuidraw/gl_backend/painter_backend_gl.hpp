@@ -192,6 +192,24 @@ namespace fastuidraw
         ConfigurationGL&
         data_blocks_per_store_buffer(unsigned int v);
 
+        /*!
+          Specifies the number of blocks of data of the persistent
+          data store (see PainterBackend::map_persistent_store()).
+          The persistent data store is realized in the same way
+          as the data store (see data_store_backing()) and is
+          subject to the same GL size limits. A value of 0
+          indicates to not have a persistent data store.
+          Initial value is 0.
+         */
+        unsigned int
+        data_blocks_per_persistent_store(void) const;
+
+        /*!
+          Set the value for data_blocks_per_persistent_store(void) const
+        */
+        ConfigurationGL&
+        data_blocks_per_persistent_store(unsigned int v);
+
         /*!
           Returns how the data store is realized. The GL implementation
           may impose size limits that will force that the size of the
@@ -298,6 +316,47 @@ namespace fastuidraw
         ConfigurationGL&
         break_on_shader_change(bool v);
 
+        /*!
+          If true, the index buffers hold 16-bit indices
+          (i.e. draws are with GL_UNSIGNED_SHORT) and the
+          PainterDraw objects returned by map_draw() use
+          PainterDraw::m_short_indices. This halves the
+          bandwidth of the indices at the cost of having
+          attributes_per_buffer() clamped to 65536.
+          Default value is false.
+         */
+        bool
+        short_indices(void) const;
+
+        /*!
+          Set the value for short_indices(void) const
+        */
+        ConfigurationGL&
+        short_indices(bool v);
+
+        /*!
+          If true, the PainterDraw objects returned by map_draw()
+          provide PainterDraw::m_compact_attributes; the attributes
+          of a PainterItemShader whose
+          PainterItemShader::attribute_layout() is
+          PainterItemShader::compact_attribute_layout are then
+          16 bytes (the primary attribute) instead of the size
+          of PainterAttribute, both for the copy to the buffer
+          object and for the vertex fetch. The compact attributes
+          are in their own buffer object with its own VAO,
+          draws with compact attributes are in separate draw
+          calls from the other draws.
+          Default value is false.
+         */
+        bool
+        compact_attributes(void) const;
+
+        /*!
+          Set the value for compact_attributes(void) const
+        */
+        ConfigurationGL&
+        compact_attributes(bool v);
+
         /*!
           If true, unpacks the brush and fragment shader specific data
           from the data buffer at the fragment shader. If false, unpacks
@@ -462,6 +521,14 @@ namespace fastuidraw
       reference_counted_ptr<const PainterDraw>
       map_draw(void);
 
+      virtual
+      c_array<generic_data>
+      map_persistent_store(void);
+
+      virtual
+      void
+      unmap_persistent_store(unsigned int data_store_written);
+
       /*!
         Return the specified Program use to draw
         with this PainterBackendGL.
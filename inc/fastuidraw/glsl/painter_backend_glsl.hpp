@@ -422,6 +422,42 @@ namespace fastuidraw
         BindingPoints&
         data_store_buffer_ubo(unsigned int);
 
+        /*!
+          Specifies the buffer binding point of the persistent
+          data store buffer (PainterBackend::map_persistent_store())
+          as a samplerBuffer. Only active if
+          UberShaderParams::data_store_backing() is \ref data_store_tbo
+          and UberShaderParams::data_blocks_per_persistent_store()
+          is positive.
+         */
+        unsigned int
+        persistent_data_store_buffer_tbo(void) const;
+
+        /*!
+          Set the value returned by persistent_data_store_buffer_tbo(void) const.
+          Default value is 8.
+         */
+        BindingPoints&
+        persistent_data_store_buffer_tbo(unsigned int);
+
+        /*!
+          Specifies the buffer binding point of the persistent
+          data store buffer (PainterBackend::map_persistent_store())
+          as a UBO. Only active if UberShaderParams::data_store_backing()
+          is \ref data_store_ubo and
+          UberShaderParams::data_blocks_per_persistent_store()
+          is positive.
+         */
+        unsigned int
+        persistent_data_store_buffer_ubo(void) const;
+
+        /*!
+          Set the value returned by persistent_data_store_buffer_ubo(void) const.
+          Default value is 2.
+         */
+        BindingPoints&
+        persistent_data_store_buffer_ubo(unsigned int);
+
       private:
         void *m_d;
       };
@@ -637,6 +673,23 @@ namespace fastuidraw
         UberShaderParams&
         data_blocks_per_store_buffer(int);
 
+        /*!
+          Gives the size in blocks of the persistent data store
+          (PainterBackend::map_persistent_store()). The persistent
+          data store is accessed with the same backing as
+          data_store_backing(void) const. A value of zero or
+          less indicates that there is no persistent data store.
+         */
+        int
+        data_blocks_per_persistent_store(void) const;
+
+        /*!
+          Set the value returned by data_blocks_per_persistent_store(void) const
+          Default value is 0.
+         */
+        UberShaderParams&
+        data_blocks_per_persistent_store(int);
+
         /*!
           Specifies how the glyph geometry data (GlyphAtlas::geometry_store())
           is accessed from the uber-shaders.
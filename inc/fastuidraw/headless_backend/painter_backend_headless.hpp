@@ -0,0 +1,395 @@
+/*!
+ * \file painter_backend_headless.hpp
+ * \brief file painter_backend_headless.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/glsl/painter_backend_glsl.hpp>
+
+namespace fastuidraw
+{
+  /*!
+    \brief Namespace to encapsulate the headless backend, a
+    backend that packs data into CPU memory and does not
+    issue any draw commands. Part of the main library
+    libFastUIDraw.
+   */
+  namespace headless
+  {
+/*!\addtogroup HeadlessBackend
+  @{
+ */
+    /*!
+      \brief
+      A PainterBackendHeadless implements PainterBackend
+      without any GPU API. The PainterDraw objects returned
+      by map_draw() are backed by heap memory and their
+      PainterDraw::draw() method only records statistics
+      of what was packed. The main use of PainterBackendHeadless
+      is to measure the CPU cost of Painter and PainterPacker
+      in isolation from any GPU driver.
+     */
+    class PainterBackendHeadless:public glsl::PainterBackendGLSL
+    {
+    public:
+      /*!
+        \brief
+        Enumeration to query the statistics of the last
+        flush of a PainterPacker (i.e. of the last
+        PainterBackend::on_pre_draw() / PainterBackend::on_post_draw()
+        pair).
+       */
+      enum stats_t
+        {
+          /*!
+            Number of PainterDraw objects drawn
+           */
+          num_draws,
+
+          /*!
+            Number of times PainterDraw::draw_break() was called
+            on the PainterDraw objects drawn
+           */
+          num_draw_breaks,
+
+          /*!
+            Number of attributes (and header attributes) written
+           */
+          num_attributes,
+
+          /*!
+            Number of indices written
+           */
+          num_indices,
+
+          /*!
+            Number of generic_data values written to
+            PainterDraw::m_store
+           */
+          num_generic_datas,
+
+          /*!
+            Number of generic_data values written to the
+            persistent data store, see
+            PainterBackend::map_persistent_store()
+           */
+          num_persistent_generic_datas,
+
+          /*!
+            Number of bytes written to the attribute, header
+            attribute, index, data store and persistent data
+            store buffers. The PainterDraw does not know which
+            attributes were written to PainterDraw::m_compact_attributes,
+            thus every attribute is counted as a PainterAttribute; see
+            PainterPacker::num_compact_attributes for how many
+            attributes were written compact.
+           */
+          num_bytes,
+
+          num_stats
+        };
+
+      /*!
+        \brief
+        A ConfigurationHeadless gives parameters how to contruct
+        a PainterBackendHeadless.
+       */
+      class ConfigurationHeadless
+      {
+      public:
+        /*!
+          Ctor.
+         */
+        ConfigurationHeadless(void);
+
+        /*!
+          Copy ctor.
+          \param obj value from which to copy
+         */
+        ConfigurationHeadless(const ConfigurationHeadless &obj);
+
+        ~ConfigurationHeadless();
+
+        /*!
+          Assignment operator
+          \param rhs value from which to copy
+         */
+        ConfigurationHeadless&
+        operator=(const ConfigurationHeadless &rhs);
+
+        /*!
+          Swap operation
+          \param obj object with which to swap
+        */
+        void
+        swap(ConfigurationHeadless &obj);
+
+        /*!
+          The ImageAtlas to be used by the painter. If nullptr,
+          the PainterBackendHeadless will create an ImageAtlas
+          whose backing stores discard their content.
+          Initial value is nullptr.
+         */
+        const reference_counted_ptr<ImageAtlas>&
+        image_atlas(void) const;
+
+        /*!
+          Set the value returned by image_atlas(void) const.
+         */
+        ConfigurationHeadless&
+        image_atlas(const reference_counted_ptr<ImageAtlas> &v);
+
+        /*!
+          The ColorStopAtlas to be used by the painter. If nullptr,
+          the PainterBackendHeadless will create a ColorStopAtlas
+          whose backing store discards its content.
+          Initial value is nullptr.
+         */
+        const reference_counted_ptr<ColorStopAtlas>&
+        colorstop_atlas(void) const;
+
+        /*!
+          Set the value returned by colorstop_atlas(void) const.
+         */
+        ConfigurationHeadless&
+        colorstop_atlas(const reference_counted_ptr<ColorStopAtlas> &v);
+
+        /*!
+          The GlyphAtlas to be used by the painter. If nullptr,
+          the PainterBackendHeadless will create a GlyphAtlas
+          whose backing stores discard their content.
+          Initial value is nullptr.
+         */
+        const reference_counted_ptr<GlyphAtlas>&
+        glyph_atlas(void) const;
+
+        /*!
+          Set the value returned by glyph_atlas(void) const.
+         */
+        ConfigurationHeadless&
+        glyph_atlas(const reference_counted_ptr<GlyphAtlas> &v);
+
+        /*!
+          Specifies the maximum number of attributes
+          a PainterDraw returned by
+          map_draw() may store, i.e. the size
+          of PainterDraw::m_attributes.
+          Initial value is 512 * 512.
+         */
+        unsigned int
+        attributes_per_buffer(void) const;
+
+        /*!
+          Set the value for attributes_per_buffer(void) const
+        */
+        ConfigurationHeadless&
+        attributes_per_buffer(unsigned int v);
+
+        /*!
+          Specifies the maximum number of indices
+          a PainterDraw returned by
+          map_draw() may store, i.e. the size
+          of PainterDraw::m_indices.
+          Initial value is 1.5 times the initial value
+          for attributes_per_buffer(void) const.
+         */
+        unsigned int
+        indices_per_buffer(void) const;
+
+        /*!
+          Set the value for indices_per_buffer(void) const
+        */
+        ConfigurationHeadless&
+        indices_per_buffer(unsigned int v);
+
+        /*!
+          Specifies the maximum number of blocks of
+          data a PainterDraw returned by
+          map_draw() may store. The size of
+          PainterDraw::m_store is given by
+          data_blocks_per_store_buffer() *
+          PainterBackend::ConfigurationBase::alignment(),
+          Initial value is 1024 * 64.
+         */
+        unsigned int
+        data_blocks_per_store_buffer(void) const;
+
+        /*!
+          Set the value for data_blocks_per_store_buffer(void) const
+        */
+        ConfigurationHeadless&
+        data_blocks_per_store_buffer(unsigned int v);
+
+        /*!
+          Specifies the number of blocks of data of the
+          persistent data store, see
+          PainterBackend::map_persistent_store(). A value
+          of 0 indicates to not have a persistent data store.
+          Initial value is 0.
+         */
+        unsigned int
+        data_blocks_per_persistent_store(void) const;
+
+        /*!
+          Set the value for data_blocks_per_persistent_store(void) const
+        */
+        ConfigurationHeadless&
+        data_blocks_per_persistent_store(unsigned int v);
+
+        /*!
+          If true, emulates the GL backend with
+          PainterBackendGL::ConfigurationGL::break_on_shader_change()
+          set to true, i.e. the shader group of each shader is its
+          ID so that each shader change induces a draw break.
+          Initial value is false.
+         */
+        bool
+        break_on_shader_change(void) const;
+
+        /*!
+          Set the value for break_on_shader_change(void) const
+         */
+        ConfigurationHeadless&
+        break_on_shader_change(bool v);
+
+        /*!
+          If true, the PainterDraw objects returned by map_draw()
+          take 16-bit indices, i.e. PainterDraw::m_short_indices
+          is used instead of PainterDraw::m_indices, and
+          attributes_per_buffer() is clamped to 65536. Emulates
+          PainterBackendGL::ConfigurationGL::short_indices().
+          Initial value is false.
+         */
+        bool
+        short_indices(void) const;
+
+        /*!
+          Set the value for short_indices(void) const
+         */
+        ConfigurationHeadless&
+        short_indices(bool v);
+
+        /*!
+          If true, the PainterDraw objects returned by map_draw()
+          provide PainterDraw::m_compact_attributes and the shaders
+          with PainterItemShader::compact_attribute_layout get their
+          own item group. Emulates
+          PainterBackendGL::ConfigurationGL::compact_attributes().
+          Initial value is false.
+         */
+        bool
+        compact_attributes(void) const;
+
+        /*!
+          Set the value for compact_attributes(void) const
+         */
+        ConfigurationHeadless&
+        compact_attributes(bool v);
+
+      private:
+        void *m_d;
+      };
+
+      /*!
+        Ctor.
+        \param config_headless ConfigurationHeadless providing configuration parameters
+        \param config_base ConfigurationBase parameters inherited from PainterBackend
+       */
+      PainterBackendHeadless(const ConfigurationHeadless &config_headless,
+                             const ConfigurationBase &config_base);
+
+      ~PainterBackendHeadless();
+
+      virtual
+      unsigned int
+      attribs_per_mapping(void) const;
+
+      virtual
+      unsigned int
+      indices_per_mapping(void) const;
+
+      virtual
+      void
+      on_pre_draw(void);
+
+      virtual
+      void
+      on_post_draw(void);
+
+      virtual
+      reference_counted_ptr<const PainterDraw>
+      map_draw(void);
+
+      virtual
+      c_array<generic_data>
+      map_persistent_store(void);
+
+      virtual
+      void
+      unmap_persistent_store(unsigned int data_store_written);
+
+      /*!
+        Returns the ConfigurationHeadless of the
+        PainterBackendHeadless with the atlases set
+        to those used by the PainterBackendHeadless.
+       */
+      const ConfigurationHeadless&
+      configuration_headless(void) const;
+
+      /*!
+        Returns a statistic of the last flush, i.e. of the
+        PainterDraw objects drawn between the last
+        on_pre_draw() / on_post_draw() pair.
+        \param st statistic to query
+       */
+      uint64_t
+      query_stat(enum stats_t st) const;
+
+      /*!
+        Returns the number of on_post_draw() calls since
+        construction.
+       */
+      unsigned int
+      number_flushes(void) const;
+
+      /*!
+        Returns the number of times map_draw() needed to
+        allocate new buffers instead of recycling the buffers
+        of a PainterDraw that had been released.
+       */
+      unsigned int
+      number_buffer_allocations(void) const;
+
+    protected:
+
+      virtual
+      uint32_t
+      compute_item_shader_group(PainterShader::Tag tag,
+                                const reference_counted_ptr<PainterItemShader> &shader);
+
+      virtual
+      uint32_t
+      compute_blend_shader_group(PainterShader::Tag tag,
+                                const reference_counted_ptr<PainterBlendShader> &shader);
+
+    private:
+      void *m_d;
+    };
+/*! @} */
+  }
+}
@@ -161,6 +161,16 @@ public:
   public:
     ScratchSpace(void);
     ~ScratchSpace();
+
+    /*!
+      Returns the number of Subset objects that the last call
+      to select_subsets() with this ScratchSpace rejected
+      because they were completely clipped. A rejected Subset
+      is counted once, its children are not visited.
+     */
+    unsigned int
+    number_culled(void) const;
+
   private:
     friend class FilledPath;
     void *m_d;
@@ -188,6 +198,16 @@ public:
   Subset
   subset(unsigned int I) const;
 
+  /*!
+    Returns the number of bytes of heap memory used by
+    the Subset objects of this FilledPath, this includes
+    the triangulation of those Subset objects whose
+    data was made and the points of those whose data
+    was not yet made.
+   */
+  uint64_t
+  memory_usage(void) const;
+
   /*!
     Fetch those Subset objects that have triangles that
     intersect a region specified by clip equations.
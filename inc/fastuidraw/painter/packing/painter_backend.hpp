@@ -144,6 +144,24 @@ namespace fastuidraw
       PerformanceHints&
       clipping_via_hw_clip_planes(bool v);
 
+      /*!
+        Returns true if the buffers of the PainterDraw objects
+        of the PainterBackend are write-combined memory, for
+        example a mapped GL buffer. When true, PainterPacker
+        copies attribute and index data into them with
+        non-temporal (streaming) stores.
+       */
+      bool
+      write_combined_buffers(void) const;
+
+      /*!
+        Set the value returned by
+        write_combined_buffers(void) const,
+        default value is false.
+       */
+      PerformanceHints&
+      write_combined_buffers(bool v);
+
     private:
       void *m_d;
     };
@@ -249,6 +267,35 @@ namespace fastuidraw
     reference_counted_ptr<const PainterDraw>
     map_draw(void) = 0;
 
+    /*!
+      To be optionally implemented by a derived class to "map" the
+      persistent data store for filling of data. The persistent data
+      store holds data that can be read by all PainterDraw objects
+      drawn in the next on_pre_draw()/on_post_draw() pair. A location
+      (see PainterHeader) into the persistent data store has the bit
+      PainterHeader::persistent_store_bit up. PainterPacker uses
+      the persistent data store for the values of PainterPackedValue
+      objects so that a value used by several PainterDraw objects is
+      packed only once. The default implementation returns an empty
+      array, i.e. the PainterBackend does not have a persistent data
+      store.
+     */
+    virtual
+    c_array<generic_data>
+    map_persistent_store(void);
+
+    /*!
+      To be optionally implemented by a derived class to "unmap" the
+      persistent data store returned by map_persistent_store(). Called
+      before on_pre_draw(). The default implementation does nothing.
+      \param data_store_written only the range [0, data_store_written)
+                                of the array returned by the last call
+                                to map_persistent_store() was written to
+     */
+    virtual
+    void
+    unmap_persistent_store(unsigned int data_store_written);
+
     /*!
       Registers a vertex shader for use. Must not be called within a
       on_pre_draw()/on_post_draw() pair.
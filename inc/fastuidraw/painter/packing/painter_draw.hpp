@@ -91,6 +91,26 @@ namespace fastuidraw
      */
     c_array<PainterAttribute> m_attributes;
 
+    /*!
+      Location to which to place the attribute data of items
+      drawn with a PainterItemShader whose
+      PainterItemShader::attribute_layout() is
+      PainterItemShader::compact_attribute_layout; only
+      PainterAttribute::m_attrib0 of such an attribute is
+      written, to the same location as it would have in
+      \ref m_attributes (whose element at that location
+      is then left unwritten). May be empty, in which case
+      all attributes are written to \ref m_attributes;
+      otherwise its size must be the same as the size of
+      \ref m_attributes. A PainterBackend that provides
+      \ref m_compact_attributes must give the compact
+      PainterItemShader objects item groups different from
+      the other PainterItemShader objects so that
+      draw_break() marks where the source of the attributes
+      changes. The store is understood to be write only.
+     */
+    c_array<uvec4> m_compact_attributes;
+
     /*!
       Location to which to place the attribute data
       storing the header locations. The size of
@@ -104,9 +124,23 @@ namespace fastuidraw
       Location to which to place index data. Values
       are indices into m_attributes,
       the store is understood to be write only.
+      Empty if the PainterDraw takes 16-bit indices,
+      see \ref m_short_indices.
      */
     c_array<PainterIndex> m_indices;
 
+    /*!
+      Location to which to place index data for a
+      PainterDraw that takes 16-bit indices; exactly
+      one of \ref m_indices and \ref m_short_indices
+      is non-empty. A PainterBackend that uses 16-bit
+      indices must not make \ref m_attributes larger
+      than 65536 elements. The PainterPacker converts
+      indices to 16-bit values when it writes them,
+      the store is understood to be write only.
+     */
+    c_array<PainterShortIndex> m_short_indices;
+
     /*!
       Generic store for data that is shared between
       vertices within an item and possibly between
@@ -117,8 +151,9 @@ namespace fastuidraw
 
     /*!
       Ctor, a derived class will set \ref m_attributes,
-      \ref m_header_attributes, \ref m_indices and
-      \ref m_store.
+      \ref m_compact_attributes (optionally),
+      \ref m_header_attributes, \ref m_indices (or
+      \ref m_short_indices) and \ref m_store.
      */
     PainterDraw(void);
 
@@ -156,7 +191,7 @@ namespace fastuidraw
       have been added with add_action() have been
       called.
       \param attributes_written number of elements written to m_attributes and m_header_attributes
-      \param indices_written number of elements written to m_indices
+      \param indices_written number of elements written to m_indices (or m_short_indices)
       \param data_store_written number of elements written to m_store
      */
     void
@@ -195,7 +230,8 @@ namespace fastuidraw
                                 m_attributes must be uploaded to
                                 3D API
       \param indices_written only the range [0,uints_written) of
-                             m_indices specify indices to use.
+                             m_indices (or m_short_indices) specify
+                             indices to use.
       \param data_store_written only the range [0,data_store_written) of
                                 m_store must be uploaded to 3D API
      */
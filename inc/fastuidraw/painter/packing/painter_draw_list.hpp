@@ -0,0 +1,160 @@
+/*!
+ * \file painter_draw_list.hpp
+ * \brief file painter_draw_list.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/painter/painter_brush.hpp>
+#include <fastuidraw/painter/painter_item_matrix.hpp>
+#include <fastuidraw/painter/packing/painter_packer.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup PainterPacking
+  @{
+ */
+
+  /*!
+    \brief
+    A PainterDrawList holds a copy of the attributes, indices,
+    header attributes, data store and draw breaks of each
+    PainterDraw filled by a PainterPacker within a begin()/end()
+    pair (see PainterPacker::begin(const reference_counted_ptr<PainterDrawList>&)).
+    The copy can be drawn again in later frames with
+    PainterPacker::draw_list(), which copies the data directly
+    into fresh PainterDraw objects; no tessellation selection and
+    no packing is performed.
+
+    Content that changes between frames can be patched on replay
+    without capturing again. Draws whose headers are to be patched
+    are passed, during the capture, the DataCallBack returned by
+    patch_point(); the headers added with that call back can then
+    be given a new item matrix, a new brush value or an additional
+    z-offset with patch_item_matrix(), patch_brush() and patch_z().
+    The patched values are packed into the unused room of the data
+    store of the PainterDraw, a patch that does not fit is not
+    applied (see PainterPacker::draw_list()).
+
+    The data of a PainterDrawList is only valid for the PainterBackend
+    that was used to capture it: the shader IDs, the atlas locations
+    of images, glyphs and color stops and the sizes of the buffers of
+    the PainterDraw objects are copied as-is. In addition, the
+    persistent data store (see PainterBackend::map_persistent_store())
+    is not used while capturing.
+   */
+  class PainterDrawList:
+    public reference_counted<PainterDrawList>::default_base
+  {
+  public:
+    /*!
+      Ctor.
+     */
+    PainterDrawList(void);
+
+    ~PainterDrawList();
+
+    /*!
+      Returns a DataCallBack to pass to draw calls during a
+      capture. The headers added with the returned object
+      are tagged with id and can be patched with
+      patch_item_matrix(), patch_brush() and patch_z().
+      \param id identifier of the patch point
+     */
+    reference_counted_ptr<PainterPacker::DataCallBack>
+    patch_point(unsigned int id);
+
+    /*!
+      Sets the item matrix of the headers tagged with an id,
+      applied by each later PainterPacker::draw_list().
+      \param id identifier passed to patch_point()
+      \param value new item matrix
+     */
+    void
+    patch_item_matrix(unsigned int id, const PainterItemMatrix &value);
+
+    /*!
+      Sets the brush of the headers tagged with an id, applied
+      by each later PainterPacker::draw_list(). The brush must
+      have the same value for PainterBrush::shader() as the brush
+      used in the capture; the patch is not applied to a header
+      whose brush shader differs.
+      \param id identifier passed to patch_point()
+      \param value new brush value
+     */
+    void
+    patch_brush(unsigned int id, const PainterBrush &value);
+
+    /*!
+      Sets the amount to add to the z-value of the headers tagged
+      with an id, applied by each later PainterPacker::draw_list()
+      in addition to the z-offset passed to it.
+      \param id identifier passed to patch_point()
+      \param z_offset amount to add to the z-values
+     */
+    void
+    patch_z(unsigned int id, int z_offset);
+
+    /*!
+      Removes all patches set with patch_item_matrix(),
+      patch_brush() and patch_z().
+     */
+    void
+    clear_patches(void);
+
+    /*!
+      Clears the captured data and all patches; captured()
+      returns false afterwards.
+     */
+    void
+    clear(void);
+
+    /*!
+      Returns true if a capture to this PainterDrawList has
+      ended since it was made or last cleared, i.e. if it holds
+      captured content. A capture during which nothing was
+      drawn is still a capture, for which number_draws() may
+      be zero.
+     */
+    bool
+    captured(void) const;
+
+    /*!
+      Returns the number of PainterDraw objects captured.
+     */
+    unsigned int
+    number_draws(void) const;
+
+    /*!
+      Returns the range of z-values of the captured headers,
+      range_type::m_begin is the smallest z-value and
+      range_type::m_end is one more than the largest z-value.
+      If nothing is captured, returns a range with m_begin
+      equal to m_end.
+     */
+    range_type<int>
+    z_range(void) const;
+
+  private:
+    friend class PainterPacker;
+    void *m_d;
+  };
+
+/*! @} */
+
+}
@@ -39,6 +39,8 @@
 
 namespace fastuidraw
 {
+  class PainterDrawList;
+
 /*!\addtogroup PainterPacking
   @{
  */
@@ -196,6 +198,107 @@ namespace fastuidraw
         */
         num_headers,
 
+        /*!
+          Offset to how many calls to PainterDraw::draw_break()
+          were avoided by reordering draws, see
+          reorder_opaque_draws().
+        */
+        num_draw_breaks_avoided,
+
+        /*!
+          Offset to how many generic_data values placed
+          onto the persistent data store, see
+          PainterBackend::map_persistent_store().
+        */
+        num_persistent_generic_datas,
+
+        /*!
+          Offset to how many draws reused the painter header
+          of the previous draw instead of packing a new one;
+          a header is reused when the previous draw of the same
+          PainterDraw has identical shaders, state locations and
+          z-value and neither draw has a DataCallBack.
+        */
+        num_headers_reused,
+
+        /*!
+          Offset to how many calls to PainterDraw::draw_break()
+          were made.
+        */
+        num_draw_breaks,
+
+        /*!
+          Offset to how many draw breaks were made because the
+          PainterItemShader::group() changed. A draw break can
+          have more than one reason, in which case it is counted
+          in each of num_draw_breaks_item_group,
+          num_draw_breaks_blend_group, num_draw_breaks_brush and
+          num_draw_breaks_blend_mode that apply.
+        */
+        num_draw_breaks_item_group,
+
+        /*!
+          Offset to how many draw breaks were made because the
+          PainterBlendShader::group() changed.
+        */
+        num_draw_breaks_blend_group,
+
+        /*!
+          Offset to how many draw breaks were made because the
+          brush shader changed in the bits of
+          PainterBackend::ConfigurationBase::brush_shader_mask().
+        */
+        num_draw_breaks_brush,
+
+        /*!
+          Offset to how many draw breaks were made because the
+          BlendMode changed.
+        */
+        num_draw_breaks_blend_mode,
+
+        /*!
+          Offset to how many generic_data values of clip
+          equations (PainterClipEquations) were placed onto
+          a store buffer or the persistent data store.
+        */
+        num_clip_generic_datas,
+
+        /*!
+          Offset to how many generic_data values of item
+          matrices (PainterItemMatrix) were placed onto a
+          store buffer or the persistent data store.
+        */
+        num_item_matrix_generic_datas,
+
+        /*!
+          Offset to how many generic_data values of brushes
+          (PainterBrush) were placed onto a store buffer or the
+          persistent data store.
+        */
+        num_brush_generic_datas,
+
+        /*!
+          Offset to how many generic_data values of item shader
+          data (PainterItemShaderData) were placed onto a store
+          buffer or the persistent data store.
+        */
+        num_item_shader_generic_datas,
+
+        /*!
+          Offset to how many generic_data values of blend
+          shader data (PainterBlendShaderData) were placed onto
+          a store buffer or the persistent data store.
+        */
+        num_blend_shader_generic_datas,
+
+        /*!
+          Offset to how many attributes were written to
+          PainterDraw::m_compact_attributes, see
+          PainterItemShader::compact_attribute_layout;
+          these attributes are also counted in num_attributes.
+        */
+        num_compact_attributes,
+
         /*!
           Number of stats.
          */
@@ -259,6 +362,55 @@ namespace fastuidraw
     blend_shader(const reference_counted_ptr<PainterBlendShader> &h,
                  BlendMode::packed_value packed_blend_mode);
 
+    /*!
+      If true, draws that are opaque are bucketed by their
+      shader state (see PainterShaderGroup) and the index data
+      of each bucket is emitted together so that fewer calls to
+      PainterDraw::draw_break() are made. A draw is opaque if
+      the blend shader is the default src-over or src blend
+      shader (see PainterShaderSet::blend_shaders()), the item
+      shader has PainterItemShader::full_coverage() as true, the
+      brush has PainterBrush::opaque() as true and there is no
+      DataCallBack. Only runs of consecutive opaque draws with
+      increasing z-values are reordered, so the depth test
+      (which is GEQUAL against the z-value of the header) gives
+      the same image as drawing in order. Default value is false.
+     */
+    bool
+    reorder_opaque_draws(void) const;
+
+    /*!
+      Set the value returned by reorder_opaque_draws(void) const.
+      \param v value to use
+     */
+    void
+    reorder_opaque_draws(bool v);
+
+    /*!
+      If true and reorder_opaque_draws() is true, the opaque
+      draws of a run of draws are drawn front to back (i.e. in
+      decreasing z-value) before the other draws of the run,
+      which are drawn in order, so that the depth test rejects
+      the fragments of opaque draws that are hidden by opaque
+      draws made after them. A run of draws is ended by a draw
+      with a DataCallBack, by an opaque draw whose z-value is not
+      larger than that of a draw of the run that is not opaque (or
+      is the same as that of an opaque draw with different shader
+      state) or when a new PainterDraw is started. Painter gives
+      each opaque item its own z-value when reorder_opaque_draws()
+      is true, so that the image is the same as drawing in order.
+      Default value is false.
+     */
+    bool
+    front_to_back_opaque_draws(void) const;
+
+    /*!
+      Set the value returned by front_to_back_opaque_draws(void) const.
+      \param v value to use
+     */
+    void
+    front_to_back_opaque_draws(bool v);
+
     /*!
       Indicate to start drawing. Commands are buffered and not
       set to the backend until end() or flush() is called.
@@ -267,6 +419,18 @@ namespace fastuidraw
     void
     begin(void);
 
+    /*!
+      Indicate to start drawing and to capture the content
+      drawn until end() into a PainterDrawList so that it can
+      be drawn again with draw_list(). The PainterDrawList is
+      cleared (including its patches) first. The persistent
+      data store (see PainterBackend::map_persistent_store())
+      is not used until end().
+      \param capture PainterDrawList to which to capture
+     */
+    void
+    begin(const reference_counted_ptr<PainterDrawList> &capture);
+
     /*!
       Indicate to end drawing. Commands are buffered and not
       sent to the backend until end() or flush() is called.
@@ -275,6 +439,28 @@ namespace fastuidraw
     void
     end(void);
 
+    /*!
+      Start to capture the content drawn until end_capture()
+      into a PainterDrawList while drawing it; the content
+      drawn before and after is drawn but not captured. Must
+      be called between begin() and end() and not while
+      capturing, i.e. not within begin(const reference_counted_ptr<PainterDrawList>&)
+      / end() or begin_capture() / end_capture(). The
+      PainterDrawList is cleared (including its patches) first.
+      The captured content starts and ends a PainterDraw and
+      the persistent data store (see PainterBackend::map_persistent_store())
+      is not used until end_capture().
+      \param capture PainterDrawList to which to capture
+     */
+    void
+    begin_capture(const reference_counted_ptr<PainterDrawList> &capture);
+
+    /*!
+      End the capture started by begin_capture().
+     */
+    void
+    end_capture(void);
+
     /*!
       Flush all buffered rendering commands.
      */
@@ -331,7 +517,12 @@ namespace fastuidraw
                  int z,
                  const reference_counted_ptr<DataCallBack> &call_back = reference_counted_ptr<DataCallBack>());
     /*!
-      Draw generic attribute data
+      Draw generic attribute data. An index chunk whose
+      attribute and index data cannot fit into a single
+      PainterDraw is split across several PainterDraw objects;
+      each piece gets the triangles that fit and a copy of
+      only the attributes those triangles reference. Such
+      an index chunk must be a list of triangles.
       \param shader shader with which to draw data
       \param data data for how to draw
       \param src DrawWriter to use to write attribute and index data
@@ -345,6 +536,24 @@ namespace fastuidraw
                  const DataWriter &src,
                  int z,
                  const reference_counted_ptr<DataCallBack> &call_back = reference_counted_ptr<DataCallBack>());
+
+    /*!
+      Draw the content captured in a PainterDrawList. Each
+      PainterDraw captured is copied to a new PainterDraw
+      with the patches of the PainterDrawList applied. Must
+      be called within a begin() / end() pair and may not be
+      called while capturing. The PainterDrawList must have
+      been captured with a PainterPacker using the same
+      PainterBackend.
+      \param list PainterDrawList to draw
+      \param z_offset amount to add to the z-value of each header
+      \returns the number of headers to which a patch could not
+               be applied because the data store of the PainterDraw
+               did not have room for the patched value or because
+               the brush shader of the patched brush differs
+     */
+    unsigned int
+    draw_list(const PainterDrawList &list, int z_offset);
     /*!
       Returns a stat on how much data the PainterPacker has
       handled since the last call to begin().
@@ -0,0 +1,238 @@
+/*!
+ * \file painter_packer_recorder.hpp
+ * \brief file painter_packer_recorder.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/painter/packing/painter_packer.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup PainterPacking
+  @{
+ */
+
+  /*!
+    \brief
+    A PainterPackerRecorder records the draw_generic() calls that
+    would go to a PainterPacker into a compact command list
+    so that they can be sent to a PainterPacker later with replay().
+
+    The purpose of PainterPackerRecorder is to allow for building
+    the content of a frame from multiple threads: each thread
+    records into its own PainterPackerRecorder (for example via a
+    Painter whose begin() was passed the recorder) and then a single
+    thread merges the recordings, in a defined order, into a
+    PainterPacker with replay(). The attribute and index data
+    is copied into the PainterPackerRecorder when recorded, thus
+    the only work done by replay() is the copy into the buffers
+    of the PainterDraw objects.
+
+    The z-values of the recorded commands are rebased on replay:
+    the smallest z-value recorded is mapped to the z-value passed
+    to replay() and the ordering of the z-values is preserved.
+
+    Replaying the recording of a single PainterPackerRecorder
+    packs the same data as drawing directly to the PainterPacker.
+    When a frame is split across several recorders, each packs
+    the values it is passed unpacked into its own pool, so state
+    that direct drawing would pack once (for example a clip) is
+    packed once per recorder that uses it.
+
+    A PainterPackerRecorder is NOT thread safe, i.e. a single
+    PainterPackerRecorder may only be used from one thread at a time.
+    Different PainterPackerRecorder objects can be used from different
+    threads at the same time provided that the PainterPackedValue
+    objects they are passed are not shared across threads (each
+    PainterPackerRecorder makes PainterPackedValue objects from
+    its own PainterPackedValuePool for values that are not already
+    packed, see packed_value_pool()).
+   */
+  class PainterPackerRecorder:
+    public reference_counted<PainterPackerRecorder>::default_base
+  {
+  public:
+    /*!
+      Ctor.
+      \param painter_alignment the alignment to create packed data, see
+                               PainterBackend::ConfigurationBase::alignment()
+     */
+    explicit
+    PainterPackerRecorder(int painter_alignment);
+
+    ~PainterPackerRecorder();
+
+    /*!
+      Returns the PainterPackedValuePool used by this
+      PainterPackerRecorder to pack values that are
+      passed unpacked to draw_generic().
+     */
+    PainterPackedValuePool&
+    packed_value_pool(void);
+
+    /*!
+      Returns the blend shader that will be used for
+      commands recorded after this call. Initial value
+      is nullptr which indicates to use the blend
+      shader of the PainterPacker on replay.
+     */
+    const reference_counted_ptr<PainterBlendShader>&
+    blend_shader(void) const;
+
+    /*!
+      Returns the 3D API blend mode packed as in BlendMode::packed()
+      that will be used for commands recorded after this call.
+     */
+    BlendMode::packed_value
+    blend_mode(void) const;
+
+    /*!
+      Sets the blend shader (and 3D API blend mode) to be used
+      by the commands recorded after this call.
+      \param h blend shader to use for blending.
+      \param packed_blend_mode 3D API blend mode packed via BlendMode::packed().
+     */
+    void
+    blend_shader(const reference_counted_ptr<PainterBlendShader> &h,
+                 BlendMode::packed_value packed_blend_mode);
+
+    /*!
+      Record a PainterPacker::draw_generic() call.
+      \param shader shader with which to draw data
+      \param data data for how to draw
+      \param attrib_chunks attribute data to draw
+      \param index_chunks the i'th element is index data into attrib_chunks[i]
+      \param index_adjusts the i'th element is the value by which to adjust all of index_chunks[i]
+      \param z z-value z value placed into the header
+      \param call_back if non-nullptr handle, call back called when attribute data
+                       is added on replay().
+     */
+    void
+    draw_generic(const reference_counted_ptr<PainterItemShader> &shader,
+                 const PainterPackerData &data,
+                 const_c_array<const_c_array<PainterAttribute> > attrib_chunks,
+                 const_c_array<const_c_array<PainterIndex> > index_chunks,
+                 const_c_array<int> index_adjusts,
+                 int z,
+                 const reference_counted_ptr<PainterPacker::DataCallBack> &call_back
+                 = reference_counted_ptr<PainterPacker::DataCallBack>());
+
+    /*!
+      Record a PainterPacker::draw_generic() call.
+      \param shader shader with which to draw data
+      \param data data for how to draw
+      \param attrib_chunks attribute data to draw
+      \param index_chunks the i'th element is index data into attrib_chunks[K]
+                          where K = attrib_chunk_selector[i]
+      \param index_adjusts the i'th element is the value by which to adjust all of index_chunks[i]
+      \param attrib_chunk_selector selects which attribute chunk to use for
+             each index chunk
+      \param z z-value z value placed into the header
+      \param call_back if non-nullptr handle, call back called when attribute data
+                       is added on replay().
+     */
+    void
+    draw_generic(const reference_counted_ptr<PainterItemShader> &shader,
+                 const PainterPackerData &data,
+                 const_c_array<const_c_array<PainterAttribute> > attrib_chunks,
+                 const_c_array<const_c_array<PainterIndex> > index_chunks,
+                 const_c_array<int> index_adjusts,
+                 const_c_array<unsigned int> attrib_chunk_selector,
+                 int z,
+                 const reference_counted_ptr<PainterPacker::DataCallBack> &call_back
+                 = reference_counted_ptr<PainterPacker::DataCallBack>());
+
+    /*!
+      Record a PainterPacker::draw_generic() call. The DataWriter
+      is called during the recording, not during replay().
+      \param shader shader with which to draw data
+      \param data data for how to draw
+      \param src DrawWriter to use to write attribute and index data
+      \param z z-value z value placed into the header
+      \param call_back if non-nullptr handle, call back called when attribute data
+                       is added on replay().
+     */
+    void
+    draw_generic(const reference_counted_ptr<PainterItemShader> &shader,
+                 const PainterPackerData &data,
+                 const PainterPacker::DataWriter &src,
+                 int z,
+                 const reference_counted_ptr<PainterPacker::DataCallBack> &call_back
+                 = reference_counted_ptr<PainterPacker::DataCallBack>());
+
+    /*!
+      Returns the number of commands recorded.
+     */
+    unsigned int
+    number_commands(void) const;
+
+    /*!
+      Returns the range of z-values recorded, range_type::m_begin
+      is the smallest z-value recorded and range_type::m_end is
+      one more than the largest z-value recorded. If no commands
+      are recorded, returns a range with m_begin equal to m_end.
+     */
+    range_type<int>
+    z_range(void) const;
+
+    /*!
+      Clears all recorded commands and resets the blend
+      shader to nullptr.
+     */
+    void
+    clear(void);
+
+    /*!
+      Send the recorded commands to a PainterPacker. Must be
+      called within a PainterPacker::begin() / PainterPacker::end()
+      pair. The blend shader of the PainterPacker is restored
+      after the commands are sent.
+      \param packer PainterPacker to which to send the commands
+      \param z z-value to which to map the smallest recorded z-value
+      \returns the z-value one past the largest rebased z-value,
+               i.e. z + z_range().difference()
+     */
+    int
+    replay(PainterPacker &packer, int z) const;
+
+    /*!
+      Merge the commands of a sequence of PainterPackerRecorder
+      objects into a PainterPacker. The recorders are replayed
+      in array order, the z-values of each recorder are rebased
+      to come after those of the previous recorder so that the
+      content of a later recorder is drawn above the content of
+      an earlier one.
+      \param recorders PainterPackerRecorder objects to replay
+      \param packer PainterPacker to which to send the commands
+      \param z z-value to which to map the smallest z-value
+               of the first recorder
+      \returns the z-value one past the largest rebased z-value
+     */
+    static
+    int
+    replay(const_c_array<const PainterPackerRecorder*> recorders,
+           PainterPacker &packer, int z);
+
+  private:
+    void *m_d;
+  };
+
+/*! @} */
+
+}
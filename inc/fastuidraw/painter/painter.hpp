@@ -23,12 +23,16 @@
 #include <fastuidraw/tessellated_path.hpp>
 #include <fastuidraw/painter/stroked_path.hpp>
 #include <fastuidraw/painter/filled_path.hpp>
+#include <fastuidraw/painter/painter_glyph_run_bounds.hpp>
 #include <fastuidraw/painter/fill_rule.hpp>
 #include <fastuidraw/painter/painter_brush.hpp>
 #include <fastuidraw/painter/painter_stroke_params.hpp>
 #include <fastuidraw/painter/painter_dashed_stroke_params.hpp>
 #include <fastuidraw/painter/painter_data.hpp>
 #include <fastuidraw/painter/packing/painter_packer.hpp>
+#include <fastuidraw/painter/painter_frame_stats.hpp>
+#include <fastuidraw/painter/packing/painter_packer_recorder.hpp>
+#include <fastuidraw/painter/packing/painter_draw_list.hpp>
 
 namespace fastuidraw
 {
@@ -191,6 +195,43 @@ namespace fastuidraw
     void
     begin(bool reset_z = true);
 
+    /*!
+      Indicate to start recording the drawing with methods of this
+      Painter to a PainterPackerRecorder instead of sending them
+      to the PainterPacker of this Painter. The PainterPacker of
+      the Painter is not begun and thus several Painter objects
+      (each with its own PainterPackerRecorder) can record from
+      different threads simultaneously; the recordings are then
+      merged from a single thread into a PainterPacker with
+      PainterPackerRecorder::replay(). Clipping (including the
+      occluders of clipOutPath() and clipInRect()) is fully resolved
+      at end(), so a recording can be replayed in any z-range.
+      Note that the Path objects drawn should be tessellated
+      before recording from different threads and that the
+      PainterPackedValue objects of a recording are made from
+      packed_value_pool() of this Painter, thus replay() should
+      not be run concurrently with further recording by this
+      Painter.
+      \param recorder PainterPackerRecorder to which to record
+      \param reset_z if true, reset the z-value to 1
+     */
+    void
+    begin(const reference_counted_ptr<PainterPackerRecorder> &recorder,
+          bool reset_z = true);
+
+    /*!
+      Indicate to start drawing with methods of this Painter and
+      to capture what is drawn until end() to a PainterDrawList,
+      see PainterPacker::begin(const reference_counted_ptr<PainterDrawList>&).
+      The captured content can be drawn in later frames with
+      draw_list() at the cost of a copy.
+      \param capture PainterDrawList to which to capture
+      \param reset_z if true, reset the z-value to 1
+     */
+    void
+    begin(const reference_counted_ptr<PainterDrawList> &capture,
+          bool reset_z = true);
+
     /*!
       Indicate to end drawing with methods of this Painter.
       Drawing commands sent to 3D hardware are buffered and not
@@ -200,6 +241,73 @@ namespace fastuidraw
     void
     end(void);
 
+    /*!
+      Draw the content captured to a PainterDrawList. The
+      z-values of the list are offset so that its content is
+      drawn above what was drawn before and current_z() is
+      incremented by the size of PainterDrawList::z_range().
+      The transformation, clipping and blend state of this
+      Painter are not applied to the content. May not be
+      called when recording to a PainterPackerRecorder.
+      \param list PainterDrawList to draw
+      \returns the number of headers to which a patch of
+               the PainterDrawList could not be applied,
+               see PainterPacker::draw_list()
+     */
+    unsigned int
+    draw_list(const PainterDrawList &list);
+
+    /*!
+      Capture to a PainterDrawList the packed draws of content
+      that is drawn the same way over many frames (for example
+      a panel that does not change), or replay them if they are
+      already captured. If PainterDrawList::captured() is true
+      (which is also the case when nothing was drawn during the
+      capture), the captured draws are drawn with draw_list()
+      and false is returned; the caller then does not draw the
+      content and does not call end_draw_capture(). Otherwise,
+      save() is called, what is drawn until end_draw_capture()
+      is drawn and captured to the PainterDrawList (see
+      PainterPacker::begin_capture()) and true is returned.
+      To capture the content again, call PainterDrawList::clear()
+      on it. Captures may not be nested and begin_draw_capture()
+      may not be called within a
+      begin(const reference_counted_ptr<PainterDrawList>&)
+      / end() pair or when recording to a PainterPackerRecorder.
+
+      Only the CPU work of drawing (tessellation selection,
+      attribute and index generation and packing) is saved by
+      a replay; the packed draws are sent to the backend again
+      and the GPU rasterizes them as on the frame they were
+      captured. The content is not rendered to an Image and
+      cannot be used as one. A replay is drawn exactly as it was
+      captured: the transformation and clipping that apply to it
+      are those of when it was captured, and changing them
+      before a later begin_draw_capture() does not move,
+      transform or clip it. To draw the content elsewhere, clear
+      the PainterDrawList so that it is captured again.
+      \code
+      if(painter->begin_draw_capture(list))
+        {
+          // draw the content
+          painter->end_draw_capture();
+        }
+      \endcode
+      \param list PainterDrawList to which to capture or from
+                  which to replay the draws
+      \returns true if the content is to be drawn and captured
+     */
+    bool
+    begin_draw_capture(const reference_counted_ptr<PainterDrawList> &list);
+
+    /*!
+      End the capture started by a begin_draw_capture() that
+      returned true; calls restore() to restore the state of
+      when begin_draw_capture() was called.
+     */
+    void
+    end_draw_capture(void);
+
     /*!
       Concats the current transformation matrix
       by a given matrix.
@@ -401,6 +509,43 @@ namespace fastuidraw
                 const PainterAttributeData &data, bool use_anistopic_antialias = false,
                 const reference_counted_ptr<PainterPacker::DataCallBack> &call_back = reference_counted_ptr<PainterPacker::DataCallBack>());
 
+    /*!
+      Draw those glyphs that are not completely clipped;
+      the clipping test is done against the blocks of glyphs
+      of a PainterGlyphRunBounds, so that a long glyph run
+      of which only a small portion is visible only sends
+      the visible portion to the PainterPacker.
+      \param shader with which to draw the glyphs
+      \param draw data for how to draw
+      \param data attribute and index data with which to draw the glyphs
+      \param bounds PainterGlyphRunBounds made from data
+      \param call_back if non-nullptr handle, call back called when attribute data
+                       is added.
+     */
+    void
+    draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
+                const PainterAttributeData &data,
+                const PainterGlyphRunBounds &bounds,
+                const reference_counted_ptr<PainterPacker::DataCallBack> &call_back = reference_counted_ptr<PainterPacker::DataCallBack>());
+
+    /*!
+      Draw those glyphs that are not completely clipped,
+      see the overload taking a PainterGlyphShader.
+      \param draw data for how to draw
+      \param data attribute and index data with which to draw the glyphs
+      \param bounds PainterGlyphRunBounds made from data
+      \param use_anistopic_antialias if true, use default_shaders().glyph_shader_anisotropic()
+                                     otherwise use default_shaders().glyph_shader()
+      \param call_back if non-nullptr handle, call back called when attribute data
+                       is added.
+     */
+    void
+    draw_glyphs(const PainterData &draw,
+                const PainterAttributeData &data,
+                const PainterGlyphRunBounds &bounds,
+                bool use_anistopic_antialias = false,
+                const reference_counted_ptr<PainterPacker::DataCallBack> &call_back = reference_counted_ptr<PainterPacker::DataCallBack>());
+
     /*!
       Stroke a path.
       \param shader shader with which to stroke the attribute data
@@ -846,6 +991,131 @@ namespace fastuidraw
     unsigned int
     query_stat(enum PainterPacker::stats_t st) const;
 
+    /*!
+      Returns the statistics of the frame most recently
+      ended by end(); the values are all zero before the
+      first call to end(). The returned reference stays valid
+      for the lifetime of the Painter and its values change
+      at each call to end().
+     */
+    const PainterFrameStats&
+    frame_stats(void) const;
+
+    /*!
+      Returns true if the timers of PainterFrameStats
+      are measured, see frame_stats(). Default value
+      is false.
+     */
+    bool
+    time_frame_stats(void) const;
+
+    /*!
+      Sets if the timers of PainterFrameStats are measured;
+      measuring adds the cost of reading a clock at each
+      draw and each path to the frame.
+      \param v value to use
+     */
+    void
+    time_frame_stats(bool v);
+
+    /*!
+      Returns true if the Painter caches what subsets of
+      the FilledPath of a Path are drawn as the occluder of
+      clipOutPath() and clipInPath() with a fill rule given by
+      a PainterEnums::fill_rule_t. A cached selection is reused
+      by a later clip with the same Path, fill rule, transformation
+      and clipping while the Path is not modified; a selection
+      that is not used during a frame is dropped at end(). Clipping
+      with a CustomFillRuleBase is never cached. Default value
+      is true.
+     */
+    bool
+    cache_clip_paths(void) const;
+
+    /*!
+      Sets if the Painter caches the occluders of clipOutPath()
+      and clipInPath(), see cache_clip_paths(void) const.
+      \param v value to use
+     */
+    void
+    cache_clip_paths(bool v);
+
+    /*!
+      Returns the ThreadPool with which the Painter tessellates
+      paths asynchronously. If non-null, when the tessellation
+      of a Path needed by stroke_path(), stroke_dashed_path(),
+      fill_path(), clipOutPath() or clipInPath() has not yet
+      been made, the Painter draws with the finest tessellation
+      already made and the needed one, together with its FilledPath
+      or StrokedPath, is made on the ThreadPool to be used by
+      a later draw, see Path::tessellation_async(). Since the
+      value is read at each of those calls, setting it before
+      a call and clearing it after opts in just that call.
+      Default value is null, i.e. tessellate synchronously.
+     */
+    const reference_counted_ptr<ThreadPool>&
+    async_tessellation(void) const;
+
+    /*!
+      Sets the ThreadPool with which the Painter tessellates
+      paths asynchronously, see async_tessellation(void) const.
+      \param v value to use
+     */
+    void
+    async_tessellation(const reference_counted_ptr<ThreadPool> &v);
+
+    /*!
+      Returns true if the Painter reuses the PainterPackedValue
+      of a recently used transformation or clip equations when
+      the transformation or clipping returns to that value. This
+      avoids creating and packing a new PainterPackedValue each
+      time a transformation is changed back, for example by
+      restore() or by translating back and forth. Default value
+      is true.
+     */
+    bool
+    intern_packed_state(void) const;
+
+    /*!
+      Sets if the Painter reuses the PainterPackedValue of
+      a recently used transformation or clip equations, see
+      intern_packed_state(void) const. Setting the value to
+      false releases the recently used values.
+      \param v value to use
+     */
+    void
+    intern_packed_state(bool v);
+
+    /*!
+      Returns PainterPacker::reorder_opaque_draws() of
+      the PainterPacker of this Painter.
+     */
+    bool
+    reorder_opaque_draws(void) const;
+
+    /*!
+      Sets PainterPacker::reorder_opaque_draws() of
+      the PainterPacker of this Painter.
+      \param v value to use
+     */
+    void
+    reorder_opaque_draws(bool v);
+
+    /*!
+      Returns PainterPacker::front_to_back_opaque_draws() of
+      the PainterPacker of this Painter.
+     */
+    bool
+    front_to_back_opaque_draws(void) const;
+
+    /*!
+      Sets PainterPacker::front_to_back_opaque_draws() of
+      the PainterPacker of this Painter.
+      \param v value to use
+     */
+    void
+    front_to_back_opaque_draws(bool v);
+
     /*!
       Return the z-depth value that the next item will have.
      */
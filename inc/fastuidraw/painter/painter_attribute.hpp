@@ -59,5 +59,12 @@ namespace fastuidraw
    */
   typedef uint32_t PainterIndex;
 
+  /*!
+    \brief
+    Typedef for the index type of a PainterDraw whose
+    indices are 16-bit values, see PainterDraw::m_short_indices
+   */
+  typedef uint16_t PainterShortIndex;
+
 /*! @} */
 }
@@ -136,6 +136,14 @@ namespace fastuidraw
     range_type<int>
     z_range(unsigned int i) const;
 
+    /*!
+      Returns the number of bytes of heap memory used
+      by the attribute, index and chunk data of this
+      PainterAttributeData.
+     */
+    uint64_t
+    memory_usage(void) const;
+
   private:
     void *m_d;
   };
@@ -772,6 +772,28 @@ namespace fastuidraw
     uint32_t
     shader(void) const;
 
+    /*!
+      Returns the pen color of the brush.
+     */
+    const vec4&
+    pen(void) const
+    {
+      return m_data.m_pen;
+    }
+
+    /*!
+      Returns true if the brush is known to produce only
+      opaque color, i.e. the pen color has alpha 1.0 and
+      neither an image nor a gradient is applied (an image
+      or color stop sequence may have transparent texels).
+     */
+    bool
+    opaque(void) const
+    {
+      return m_data.m_pen.w() >= 1.0f
+        && (shader() & (image_mask | gradient_mask)) == 0u;
+    }
+
     /*!
       Returns the value of the handle to the
       Image that the brush is set to use.
@@ -0,0 +1,237 @@
+/*!
+ * \file painter_frame_stats.hpp
+ * \brief file painter_frame_stats.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/painter/packing/painter_packer.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Painter
+  @{
+ */
+
+  /*!
+    \brief
+    A PainterFrameStats holds the statistics of one frame
+    of a Painter, i.e. of what was drawn between a begin()
+    and end() pair, see Painter::frame_stats().
+   */
+  class PainterFrameStats
+  {
+  public:
+    /*!
+      \brief
+      Enumeration of the counters of a PainterFrameStats
+      that are not stats of the PainterPacker.
+     */
+    enum counter_t
+      {
+        /*!
+          Number of FilledPath::Subset objects drawn by
+          Painter::fill_path().
+         */
+        fill_subsets_drawn,
+
+        /*!
+          Number of FilledPath::Subset objects that
+          Painter::fill_path() did not draw because they
+          were completely clipped, see
+          FilledPath::ScratchSpace::number_culled().
+         */
+        fill_subsets_culled,
+
+        /*!
+          Number of subsets of StrokedPath objects drawn
+          by Painter::stroke_path() and
+          Painter::stroke_dashed_path().
+         */
+        stroke_subsets_drawn,
+
+        /*!
+          Number of subsets of StrokedPath objects that
+          Painter::stroke_path() and Painter::stroke_dashed_path()
+          did not draw because they were completely clipped,
+          see StrokedPath::ScratchSpace::number_culled().
+         */
+        stroke_subsets_culled,
+
+        /*!
+          Number of items drawn to the depth buffer as
+          occluders by Painter::clipOutPath(),
+          Painter::clipInPath() and Painter::clipInRect().
+         */
+        occluders_drawn,
+
+        /*!
+          Number of occluders of Painter::clipOutPath() and
+          Painter::clipInPath() whose subsets were taken from
+          the cache of the Painter, see Painter::cache_clip_paths().
+         */
+        occluders_from_cache,
+
+        /*!
+          Number of glyphs drawn by the overloads of
+          Painter::draw_glyphs() taking a PainterGlyphRunBounds.
+         */
+        glyphs_drawn,
+
+        /*!
+          Number of glyphs that the overloads of
+          Painter::draw_glyphs() taking a PainterGlyphRunBounds
+          did not draw because they were completely clipped, see
+          PainterGlyphRunBounds::ScratchSpace::number_culled().
+         */
+        glyphs_culled,
+
+        /*!
+          Number of PainterPackedValue objects created by the
+          Painter for its transformation and clip equations.
+         */
+        packed_state_created,
+
+        /*!
+          Number of times the Painter reused the PainterPackedValue
+          of a recently used transformation or clip equations
+          instead of creating a new one, see
+          Painter::intern_packed_state().
+         */
+        packed_state_interned,
+
+        /*!
+          Number of paths stroked, filled or clipped with a
+          coarser tessellation than requested because the
+          requested one is being made asynchronously, see
+          Painter::async_tessellation().
+         */
+        coarse_tessellations_drawn,
+
+        /*!
+          Number of counters
+         */
+        number_counters
+      };
+
+    /*!
+      \brief
+      Enumeration of the timers of a PainterFrameStats.
+      The timers are only measured if Painter::time_frame_stats()
+      is true.
+     */
+    enum timer_t
+      {
+        /*!
+          Time spent by the Painter fetching (and creating
+          if necessary) the TessellatedPath, FilledPath and
+          StrokedPath of a Path.
+         */
+        tessellation_time,
+
+        /*!
+          Time spent by the Painter selecting what subsets of
+          a FilledPath or StrokedPath and what glyphs of a
+          PainterGlyphRunBounds to draw; this includes
+          triangulating subsets of a FilledPath when they are
+          selected for the first time.
+         */
+        subset_selection_time,
+
+        /*!
+          Time spent by the Painter sending attribute, index
+          and state data to its PainterPacker (or
+          PainterPackerRecorder).
+         */
+        packing_time,
+
+        /*!
+          Number of timers
+         */
+        number_timers
+      };
+
+    /*!
+      Ctor, initializes all values as zero.
+     */
+    PainterFrameStats(void):
+      m_packer_stats(0),
+      m_counters(0),
+      m_timers(0)
+    {}
+
+    /*!
+      Returns the number of bytes of the generic_data values
+      of a PainterPacker stat that counts generic_data values,
+      for example PainterPacker::num_brush_generic_datas.
+      \param st PainterPacker stat to query
+     */
+    uint64_t
+    bytes(enum PainterPacker::stats_t st) const
+    {
+      return static_cast<uint64_t>(m_packer_stats[st]) * sizeof(generic_data);
+    }
+
+    /*!
+      Returns a string label for a PainterPacker stat,
+      suitable for exporting the values.
+      \param st PainterPacker stat
+     */
+    static
+    const char*
+    label(enum PainterPacker::stats_t st);
+
+    /*!
+      Returns a string label for a counter.
+      \param c counter
+     */
+    static
+    const char*
+    label(enum counter_t c);
+
+    /*!
+      Returns a string label for a timer.
+      \param t timer
+     */
+    static
+    const char*
+    label(enum timer_t t);
+
+    /*!
+      Values of PainterPacker::query_stat() at the end of the
+      frame; these are all zero if the frame was recorded with
+      a PainterPackerRecorder since the packing is then done
+      when the recording is replayed.
+     */
+    vecN<unsigned int, PainterPacker::num_stats> m_packer_stats;
+
+    /*!
+      Values of the counters enumerated by counter_t.
+     */
+    vecN<unsigned int, number_counters> m_counters;
+
+    /*!
+      Values in nanoseconds of the timers enumerated by timer_t.
+     */
+    vecN<uint64_t, number_timers> m_timers;
+  };
+
+/*! @} */
+}
@@ -0,0 +1,152 @@
+/*!
+ * \file painter_glyph_run_bounds.hpp
+ * \brief file painter_glyph_run_bounds.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/fastuidraw_memory.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/matrix.hpp>
+#include <fastuidraw/painter/painter_attribute_data.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Painter
+  @{
+ */
+
+  /*!
+    \brief
+    A PainterGlyphRunBounds holds the bounding boxes of the
+    glyphs of a PainterAttributeData filled by a
+    PainterAttributeDataFillerGlyphs so that only those glyphs
+    that are not clipped need to be drawn, see
+    Painter::draw_glyphs().
+
+    The glyphs of each chunk are grouped into blocks of
+    consecutive glyphs; the bounding boxes of the blocks
+    are organized in a hierarchy where each level holds
+    the union of pairs of boxes of the level below. Since
+    text is laid out in order, consecutive glyphs are close
+    together and a block typically covers part of a line.
+    A PainterGlyphRunBounds does not reference the
+    PainterAttributeData from which it was made; it is
+    the caller's responsibility to only use it with that
+    PainterAttributeData.
+   */
+  class PainterGlyphRunBounds:noncopyable
+  {
+  public:
+    /*!
+      \brief
+      Opaque object to hold work room needed for functions
+      of PainterGlyphRunBounds that require scratch space.
+     */
+    class ScratchSpace:noncopyable
+    {
+    public:
+      ScratchSpace(void);
+      ~ScratchSpace();
+
+      /*!
+        Returns the number of glyphs that the last call
+        to select_glyphs() with this ScratchSpace rejected
+        because they were completely clipped.
+       */
+      unsigned int
+      number_culled(void) const;
+
+    private:
+      friend class PainterGlyphRunBounds;
+      void *m_d;
+    };
+
+    /*!
+      Ctor.
+      \param data PainterAttributeData filled by a
+                  PainterAttributeDataFillerGlyphs
+      \param glyphs_per_block number of glyphs in each block
+                              of the hierarchy, must be positive
+     */
+    explicit
+    PainterGlyphRunBounds(const PainterAttributeData &data,
+                          unsigned int glyphs_per_block = 16);
+
+    ~PainterGlyphRunBounds();
+
+    /*!
+      Returns the value of glyphs_per_block passed to the ctor.
+     */
+    unsigned int
+    glyphs_per_block(void) const;
+
+    /*!
+      Returns the number of chunks, this is the same value
+      as PainterAttributeData::attribute_data_chunks().size()
+      of the PainterAttributeData passed to the ctor.
+     */
+    unsigned int
+    number_chunks(void) const;
+
+    /*!
+      Returns the number of glyphs of a chunk.
+      \param chunk which chunk, i.e. which glyph_type
+     */
+    unsigned int
+    number_glyphs(unsigned int chunk) const;
+
+    /*!
+      Returns the number of blocks of a chunk, this
+      is the maximum number of ranges that
+      select_glyphs() writes for the chunk.
+      \param chunk which chunk, i.e. which glyph_type
+     */
+    unsigned int
+    number_blocks(unsigned int chunk) const;
+
+    /*!
+      Fetch the ranges of glyphs of a chunk whose blocks
+      intersect a region specified by clip equations. The
+      ranges are written in increasing order and adjacent
+      ranges are merged. Glyph i of a chunk has the
+      attributes [4i, 4i + 4) and the indices [6i, 6i + 6)
+      of the chunk.
+      \param scratch_space scratch space for computations.
+      \param clip_equations array of clip equations
+      \param clip_matrix_local 3x3 transformation from local (x, y, 1)
+                               coordinates to clip coordinates.
+      \param chunk which chunk, i.e. which glyph_type
+      \param[out] dst location to which to write the ranges,
+                      must be at least number_blocks(chunk)
+                      in size
+      \returns the number of ranges written to dst
+     */
+    unsigned int
+    select_glyphs(ScratchSpace &scratch_space,
+                  const_c_array<vec3> clip_equations,
+                  const float3x3 &clip_matrix_local,
+                  unsigned int chunk,
+                  c_array<range_type<unsigned int> > dst) const;
+
+  private:
+    void *m_d;
+  };
+
+/*! @} */
+}
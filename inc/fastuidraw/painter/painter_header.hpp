@@ -64,6 +64,28 @@ namespace fastuidraw
         blend_shader_bit0 = item_shader_num_bits,
       };
 
+    /*!
+      Bit encoding of the locations of a PainterHeader
+      (\ref m_clip_equations_location, \ref m_item_matrix_location,
+      \ref m_brush_shader_data_location, \ref m_item_shader_data_location
+      and \ref m_blend_shader_data_location).
+     */
+    enum location_encoding
+      {
+        /*!
+          If this bit is up in a location, then the location is
+          into the persistent data store of the PainterBackend
+          (see PainterBackend::map_persistent_store()) instead
+          of PainterDraw::m_store.
+         */
+        persistent_store_bit = 30,
+
+        /*!
+          Mask made from \ref persistent_store_bit
+         */
+        persistent_store_mask = 1u << persistent_store_bit,
+      };
+
     /*!
       Enumerations specifying how the contents of a PainterHeader
       are packed into a data store buffer (PainterDraw::m_store).
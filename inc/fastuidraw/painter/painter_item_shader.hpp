@@ -36,11 +36,35 @@ namespace fastuidraw
   class PainterItemShader:public PainterShader
   {
   public:
+    /*!
+      \brief
+      Enumeration to specify what fields of PainterAttribute
+      a PainterItemShader reads.
+     */
+    enum attribute_layout_t
+      {
+        /*!
+          The shader reads all of PainterAttribute.
+         */
+        full_attribute_layout,
+
+        /*!
+          The shader only reads PainterAttribute::m_attrib0;
+          PainterAttribute::m_attrib1 and PainterAttribute::m_attrib2
+          are read as zero. A PainterPacker writes the attributes
+          of such a shader to PainterDraw::m_compact_attributes
+          when the PainterDraw provides it.
+         */
+        compact_attribute_layout
+      };
+
     /*!
       Ctor for a PainterItemShader with no sub-shaders.
      */
     PainterItemShader(void):
-      PainterShader()
+      PainterShader(),
+      m_full_coverage(false),
+      m_attribute_layout(full_attribute_layout)
     {}
 
     /*!
@@ -53,7 +77,9 @@ namespace fastuidraw
      */
     explicit
     PainterItemShader(unsigned int num_sub_shaders):
-      PainterShader(num_sub_shaders)
+      PainterShader(num_sub_shaders),
+      m_full_coverage(false),
+      m_attribute_layout(full_attribute_layout)
     {}
 
     /*!
@@ -64,8 +90,64 @@ namespace fastuidraw
      */
     PainterItemShader(unsigned int sub_shader,
                       reference_counted_ptr<PainterItemShader> parent):
-      PainterShader(sub_shader, parent)
+      PainterShader(sub_shader, parent),
+      m_full_coverage(false),
+      m_attribute_layout(full_attribute_layout)
     {}
+
+    /*!
+      Returns true if the shader is hinted to emit every
+      fragment it covers with the full alpha of the brush,
+      i.e. the shader does not lower alpha to perform
+      anti-aliasing. A PainterPacker with
+      PainterPacker::reorder_opaque_draws() enabled uses
+      this hint to decide if a draw may be reordered.
+      Default value is false.
+     */
+    bool
+    full_coverage(void) const
+    {
+      return m_full_coverage;
+    }
+
+    /*!
+      Set the value returned by full_coverage(void) const.
+      \param v value to use
+     */
+    PainterItemShader&
+    full_coverage(bool v)
+    {
+      m_full_coverage = v;
+      return *this;
+    }
+
+    /*!
+      Returns what fields of PainterAttribute the shader
+      reads. Default value is \ref full_attribute_layout.
+     */
+    enum attribute_layout_t
+    attribute_layout(void) const
+    {
+      return m_attribute_layout;
+    }
+
+    /*!
+      Set the value returned by attribute_layout(void) const.
+      The value must be set before the shader is registered
+      to a PainterBackend because the backend uses it to
+      compute the group of the shader.
+      \param v value to use
+     */
+    PainterItemShader&
+    attribute_layout(enum attribute_layout_t v)
+    {
+      m_attribute_layout = v;
+      return *this;
+    }
+
+  private:
+    bool m_full_coverage;
+    enum attribute_layout_t m_attribute_layout;
   };
 
 /*! @} */
@@ -78,10 +78,16 @@ namespace fastuidraw
     already copied to PainterDraw::m_store.
 
     If already on a store, then rather than copying the data again, the data
-    is reused. The object behind the handle is NOT thread safe. In addition
-    the underlying reference count is not either. Hence any access
-    (even dtor, copy ctor and equality operator) on a fixed object cannot
-    be done from multiple threads simutaneously. A fixed
+    is reused. If the PainterPackedValuePool that created the object is not
+    thread safe (see PainterPackedValuePool::thread_safe()), then the object
+    behind the handle is NOT thread safe and neither is the underlying
+    reference count. Hence any access (even dtor, copy ctor and equality
+    operator) on a fixed object cannot be done from multiple threads
+    simutaneously. If the pool is thread safe, then the reference count
+    is atomic and handles to the same object can be copied and destroyed
+    from different threads at the same time; packing the value into a
+    PainterDraw (i.e. drawing with it) must still only be done from one
+    thread at a time. A fixed
     PainterPackedValue can be used by different Painter (and PainterPacker)
     objects subject to the condition that the data store alignment (see
     PainterPacker::Configuration::alignment()) is the same for each of these
@@ -134,7 +140,7 @@ namespace fastuidraw
     unsigned int
     alignment_packing(void) const
     {
-      return this->m_d->alignment_packing();
+      return PainterPackedValueBase::alignment_packing();
     }
 
     /*!
@@ -206,10 +212,16 @@ namespace fastuidraw
     A PainterPackedValuePool can be used to create PainterPackedValue
     objects.
 
-    Just like PainterPackedValue, PainterPackedValuePool is
-    NOT thread safe, as such it is not a safe operation to use the
-    same PainterPackedValuePool object from multiple threads at the
-    same time. A fixed PainterPackedValuePool can create PainterPackedValue
+    By default, a PainterPackedValuePool is NOT thread safe, as such
+    it is not a safe operation to use the same PainterPackedValuePool
+    object from multiple threads at the same time. A PainterPackedValuePool
+    constructed with thread_safe as true can be used to create
+    PainterPackedValue objects from multiple threads at the same time;
+    the slots of the pool are then taken and returned with atomic
+    operations without locks, and the PainterPackedValue objects it
+    creates have an atomic reference count. The dtor of the pool must
+    still not be called while another thread is using it.
+    A fixed PainterPackedValuePool can create PainterPackedValue
     objects used by different Painter (and PainterPacker) objects subject
     to the condition that the data store alignment (see
     PainterPacker::Configuration::alignment()) is the same for each of
@@ -222,12 +234,21 @@ namespace fastuidraw
       Ctor.
       \param painter_alignment the alignment to create packed data, see
                                 PainterPacker::Configuration::alignment()
+      \param thread_safe if true, the pool and the PainterPackedValue
+                         objects it creates can be used from multiple
+                         threads (see the class description)
      */
     explicit
-    PainterPackedValuePool(int painter_alignment);
+    PainterPackedValuePool(int painter_alignment, bool thread_safe = false);
 
     ~PainterPackedValuePool();
 
+    /*!
+      Returns true if the pool was constructed thread safe.
+     */
+    bool
+    thread_safe(void) const;
+
     /*!
       Create and return a PainterPackedValue<PainterBrush>
       object for the value of a PainterBrush object.
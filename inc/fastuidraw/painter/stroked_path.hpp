@@ -600,6 +600,24 @@ public:
   public:
     ScratchSpace(void);
     ~ScratchSpace();
+
+    /*!
+      Returns the number of subsets of the StrokedPath whose
+      chunks the last call to compute_chunks() with this
+      ScratchSpace added to its ChunkSet.
+     */
+    unsigned int
+    number_selected(void) const;
+
+    /*!
+      Returns the number of subsets of the StrokedPath that
+      the last call to compute_chunks() with this ScratchSpace
+      rejected because they were completely clipped. A rejected
+      subset is counted once, its children are not visited.
+     */
+    unsigned int
+    number_culled(void) const;
+
   private:
     friend class StrokedPath;
     void *m_d;
@@ -682,6 +700,15 @@ public:
   float
   effective_curve_distance_threshhold(void) const;
 
+  /*!
+    Returns the number of bytes of heap memory used by the
+    attribute and index data of this StrokedPath; the data
+    of joins and caps is made lazily and only that data
+    which was already made is counted.
+   */
+  uint64_t
+  memory_usage(void) const;
+
   /*!
     Given a set of clip equations in clip coordinates
     and a tranformation from local coordiante to clip
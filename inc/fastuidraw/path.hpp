@@ -107,6 +107,13 @@ public:
       filling the output array, the function shall return the number of
       points needed to perform the required tessellation.
 
+      When the Path has a tessellation_thread_pool() or is tessellated
+      by Path::tessellation_async(), this function is called from the
+      worker threads of a ThreadPool, concurrently for different edges
+      of the same Path (and of Path objects that share the interpolator
+      by copy). An implementation must therefore be thread safe: it may
+      only read the interpolator and write to its arguments.
+
       \param tess_params tessellation parameters
       \param out_data location to which to write the edge tessellated
       \param out_effective_curve_distance (output) location to which to write the
@@ -308,6 +315,25 @@ public:
     bool
     is_flat(void) const;
 
+    /*!
+      For quadratic and cubic curves, subdivides the curve as
+      interpolator_generic::produce_tessellation() does, but one
+      level of the subdivision at a time, evaluating all the
+      points of a level together with SIMD instructions when
+      the CPU has them (and by forward differencing without
+      them when every interval of a level is subdivided). The
+      subdivision decisions are the same as those of
+      interpolator_generic::produce_tessellation(). Curves of
+      other degrees are tessellated by
+      interpolator_generic::produce_tessellation().
+     */
+    virtual
+    unsigned int
+    produce_tessellation(const TessellatedPath::TessellationParams &tess_params,
+                         c_array<TessellatedPath::point> out_data,
+                         float *out_effective_curve_distance,
+                         float *out_effective_curvature) const;
+
     virtual
     void
     compute(float in_t, vec2 *outp, vec2 *outp_t, vec2 *outp_tt) const;
@@ -526,6 +552,115 @@ private:
   void *m_d;
 };
 
+/*!
+  \brief
+  A PathLODCache bounds the memory used by the TessellatedPath
+  objects, together with their FilledPath and StrokedPath, that
+  the Path objects sharing it keep, see Path::tessellation_cache().
+
+  When a Path makes a new TessellatedPath and the memory used by
+  all of the TessellatedPath objects of the Path objects of a
+  PathLODCache exceeds byte_budget(), the least recently used
+  TessellatedPath objects are released until the total is within
+  the budget; the coarsest TessellatedPath of each Path is never
+  released, nor is the TessellatedPath being returned. Releasing
+  the finest TessellatedPath of a Path makes it again on demand
+  and releasing one between two others makes a request for it
+  return the next finer one. Only the reference a Path holds is
+  released, i.e. a TessellatedPath referenced elsewhere is not
+  freed. A reference to a TessellatedPath returned by
+  Path::tessellation() is valid only until the next call to
+  Path::tessellation() or Path::tessellation_async() on any Path
+  of the same PathLODCache or to trim(); callers that keep a
+  TessellatedPath longer should copy the reference_counted_ptr.
+
+  The memory used by a TessellatedPath grows when its FilledPath
+  or StrokedPath is made; the size of a TessellatedPath is measured
+  each time a Path returns it, so that such growth is counted at
+  the next use of the TessellatedPath or at trim(). A PathLODCache
+  and all the Path objects that share it must be used from only
+  one thread.
+ */
+class PathLODCache:
+  public reference_counted<PathLODCache>::non_concurrent
+{
+public:
+  /*!
+    Ctor.
+    \param byte_budget initial value for byte_budget()
+   */
+  explicit
+  PathLODCache(uint64_t byte_budget);
+
+  ~PathLODCache();
+
+  /*!
+    Returns the number of bytes the TessellatedPath objects
+    of the Path objects of this PathLODCache may use before
+    the least recently used ones are released.
+   */
+  uint64_t
+  byte_budget(void) const;
+
+  /*!
+    Set the value returned by byte_budget(void) const. The
+    new value is applied the next time a Path makes a
+    TessellatedPath or by trim().
+    \param v value to use
+   */
+  void
+  byte_budget(uint64_t v);
+
+  /*!
+    Returns the number of bytes, as last measured, used by the
+    TessellatedPath objects of the Path objects of this
+    PathLODCache, including those that are never released.
+    A TessellatedPath shared by a Path and its copies is
+    counted once.
+   */
+  uint64_t
+  memory_usage(void) const;
+
+  /*!
+    Returns the number of bytes, as last measured, used by the
+    coarsest TessellatedPath of each Path of this PathLODCache;
+    these are never released, so the budget cannot be enforced
+    below this value.
+   */
+  uint64_t
+  coarsest_memory_usage(void) const;
+
+  /*!
+    Returns the number of distinct TessellatedPath objects
+    held by the Path objects of this PathLODCache.
+   */
+  unsigned int
+  number_lods(void) const;
+
+  /*!
+    Returns the number of TessellatedPath objects released
+    by this PathLODCache since it was created; a TessellatedPath
+    shared by several Path objects is released once the last of
+    them drops it.
+   */
+  unsigned int
+  number_evicted(void) const;
+
+  /*!
+    Measures again the size of each TessellatedPath of the
+    Path objects of this PathLODCache and releases the least
+    recently used ones until memory_usage() is no more than
+    byte_budget() or only the coarsest TessellatedPath of
+    each Path remains.
+   */
+  void
+  trim(void);
+
+private:
+  friend class Path;
+  void *m_d;
+};
+
 /*!
   \brief
   A Path represents a collection of PathContour
@@ -915,7 +1050,11 @@ public:
     level of detail. The TessellatedPath is constructed
     lazily. Additionally, if this Path changes its geometry,
     then a new TessellatedPath will be contructed on the
-    next call to tessellation().
+    next call to tessellation(). If contours were only
+    appended to this Path since the last tessellation, only
+    the appended contours are tessellated and the tessellation
+    of the other contours is copied from the previous
+    TessellatedPath objects.
     \param thresh the returned tessellated path will be so that
                   TessellatedPath::effective_curve_distance_threshhold()
                   is no more than thresh. A non-positive value
@@ -936,6 +1075,124 @@ public:
   const reference_counted_ptr<const TessellatedPath>&
   tessellation(void) const;
 
+  /*!
+    Enumeration to specify which of the derivatives of a
+    TessellatedPath tessellation_async() makes on the worker
+    thread together with the TessellatedPath.
+   */
+  enum derivative_bits_t
+    {
+      /*!
+        Make TessellatedPath::filled()
+       */
+      filled_derivative = 1,
+
+      /*!
+        Make TessellatedPath::stroked()
+       */
+      stroked_derivative = 2,
+    };
+
+  /*!
+    Asynchronous version of tessellation(float) const. If
+    the TessellatedPath for thresh has already been made,
+    returns it. Otherwise, returns the finest TessellatedPath
+    already made and posts to a ThreadPool the making of the
+    finer TessellatedPath objects up to thresh; they are added
+    to this Path by a later call to tessellation() or
+    tessellation_async() once they are ready. Only one such
+    request is pending at a time; while one is pending, a
+    request for a finer value of thresh just returns the
+    finest TessellatedPath made so far. The coarsest
+    TessellatedPath, i.e. tessellation(void) const, is
+    always made by the calling thread, as is every
+    TessellatedPath while the last contour of this Path
+    is not ended. Modifying this Path while a request is
+    pending drops the result of the request and destroying
+    this Path waits for the request to finish.
+    \param thresh requested value, see tessellation(float) const
+    \param pool ThreadPool on which to make the finer TessellatedPath
+                objects
+    \param derivatives bit mask of values of \ref derivative_bits_t
+                       specifying which derivatives to make for the
+                       finest TessellatedPath made by the request
+    \param[out] out_pending if non-null, location to which to write
+                            true if the returned TessellatedPath
+                            is coarser than requested because a
+                            finer one is being made
+   */
+  const reference_counted_ptr<const TessellatedPath>&
+  tessellation_async(float thresh, ThreadPool &pool,
+                     uint32_t derivatives = 0u,
+                     bool *out_pending = nullptr) const;
+
+  /*!
+    Returns the ThreadPool used to tessellate the contours
+    of this Path in parallel when tessellation() creates a
+    TessellatedPath; a null value indicates to tessellate the
+    contours serially on the calling thread. The value is
+    copied by the copy ctor and assignment operator. Default
+    value is null. When non-null, the interpolators of the
+    Path must satisfy the thread safety requirement of
+    PathContour::interpolator_base::produce_tessellation().
+   */
+  const reference_counted_ptr<ThreadPool>&
+  tessellation_thread_pool(void) const;
+
+  /*!
+    Set the ThreadPool used to tessellate the contours of
+    this Path, see tessellation_thread_pool(void) const.
+    Tessellations already made are not affected since the
+    result does not depend on the ThreadPool.
+    \param v value to use
+   */
+  void
+  tessellation_thread_pool(const reference_counted_ptr<ThreadPool> &v);
+
+  /*!
+    Returns the PathLODCache that bounds the memory used by
+    the TessellatedPath objects of this Path; a null value
+    indicates that every TessellatedPath made is kept until
+    this Path changes. The value is copied by the copy ctor
+    and assignment operator. Default value is null.
+   */
+  const reference_counted_ptr<PathLODCache>&
+  tessellation_cache(void) const;
+
+  /*!
+    Set the PathLODCache that bounds the memory used by the
+    TessellatedPath objects of this Path, see
+    tessellation_cache(void) const. The TessellatedPath objects
+    already made are moved from the previous PathLODCache, if
+    any, to the new one.
+    \param v value to use
+   */
+  void
+  tessellation_cache(const reference_counted_ptr<PathLODCache> &v);
+
+  /*!
+    Returns the number of bytes of memory currently used by the
+    TessellatedPath objects of this Path, see
+    TessellatedPath::memory_usage().
+   */
+  uint64_t
+  tessellation_memory_usage(void) const;
+
+  /*!
+    Returns a value that identifies the state of this Path
+    and of the TessellatedPath objects it holds. The value
+    changes each time this Path changes and each time a
+    TessellatedPath is added to or released by this Path,
+    including when its PathLODCache releases one; two Path
+    objects never return the same value. Hence, while the
+    value is unchanged, a TessellatedPath returned by
+    tessellation() or tessellation_async() is still held
+    by this Path and would be returned again for the same
+    request.
+   */
+  uint64_t
+  tessellation_stamp(void) const;
+
 private:
   void *m_d;
 };
@@ -24,11 +24,13 @@
 #include <fastuidraw/util/vecN.hpp>
 #include <fastuidraw/util/c_array.hpp>
 #include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/util/thread_pool.hpp>
 
 namespace fastuidraw  {
 
 ///@cond
 class Path;
+class PathContour;
 class StrokedPath;
 class FilledPath;
 ///@endcond
@@ -230,8 +232,59 @@ public:
     Ctor. Construct a TessellatedPath from a Path
     \param input source path to tessellate
     \param P parameters on how to tessellate the source Path
+    \param thread_pool if non-null and the Path has more than
+                       one contour, the contours are tessellated
+                       in parallel by the threads of thread_pool;
+                       the result is the same as tessellating them
+                       serially
    */
-  TessellatedPath(const Path &input, TessellationParams P);
+  TessellatedPath(const Path &input, TessellationParams P,
+                  const reference_counted_ptr<ThreadPool> &thread_pool =
+                  reference_counted_ptr<ThreadPool>());
+
+  /*!
+    Ctor. Construct a TessellatedPath from a sequence of
+    PathContour objects, the contours of the TessellatedPath
+    are in the same order as the contours array. This ctor
+    does not modify the reference counts of the PathContour
+    objects, so it can be called from a thread other than
+    the thread that owns them as long as the PathContour
+    objects are not modified nor released while it runs.
+    \param contours source contours to tessellate
+    \param P parameters on how to tessellate the contours
+    \param thread_pool if non-null and there is more than
+                       one contour, the contours are tessellated
+                       in parallel by the threads of thread_pool
+   */
+  TessellatedPath(const_c_array<reference_counted_ptr<const PathContour> > contours,
+                  TessellationParams P,
+                  const reference_counted_ptr<ThreadPool> &thread_pool =
+                  reference_counted_ptr<ThreadPool>());
+
+  /*!
+    Ctor. Construct a TessellatedPath whose contours are the
+    first number_contours contours of a TessellatedPath followed
+    by a sequence of PathContour objects tessellated with the
+    tessellation_parameters() of that TessellatedPath. The point
+    data of the contours taken from src is copied, not computed
+    again, and the result is the same as tessellating all of the
+    contours with those parameters. The StrokedPath and FilledPath
+    of src are not used. This ctor does not modify the reference
+    counts of the PathContour objects.
+    \param src TessellatedPath from which to take the first contours
+    \param number_contours number of contours to take from src,
+                           must be no more than src.number_contours()
+    \param contours source contours to tessellate and add after
+                    those taken from src
+    \param thread_pool if non-null and there is more than
+                       one contour to tessellate, the contours are
+                       tessellated in parallel by the threads of
+                       thread_pool
+   */
+  TessellatedPath(const TessellatedPath &src, unsigned int number_contours,
+                  const_c_array<reference_counted_ptr<const PathContour> > contours,
+                  const reference_counted_ptr<ThreadPool> &thread_pool =
+                  reference_counted_ptr<ThreadPool>());
 
   ~TessellatedPath();
 
@@ -410,6 +463,15 @@ public:
   const reference_counted_ptr<const FilledPath>&
   filled(void) const;
 
+  /*!
+    Returns the number of bytes of heap memory used by this
+    TessellatedPath together with the StrokedPath and
+    FilledPath objects made from it so far, see
+    StrokedPath::memory_usage() and FilledPath::memory_usage().
+   */
+  uint64_t
+  memory_usage(void) const;
+
 private:
   void *m_d;
 };
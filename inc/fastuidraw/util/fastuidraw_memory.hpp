@@ -24,6 +24,7 @@
  */
 
 #include <cstdlib>
+#include <stdint.h>
 #include <fastuidraw/util/checked_delete.hpp>
 #include <fastuidraw/util/fastuidraw_memory_private.hpp>
 
@@ -104,4 +105,21 @@
 #define FASTUIDRAWfree(ptr) \
   fastuidraw::memory::free_implement(ptr, __FILE__, __LINE__)
 
+namespace fastuidraw
+{
+  namespace memory
+  {
+    /*!
+      Returns the number of allocations made so far with
+      \ref FASTUIDRAWnew, \ref FASTUIDRAWmalloc, \ref FASTUIDRAWcalloc
+      and \ref FASTUIDRAWrealloc, in both release and debug builds.
+      Allocations made through the global operator new, such as
+      those of the containers of the standard library, are not
+      counted.
+     */
+    uint64_t
+    number_allocations(void);
+  }
+}
+
 /*! @} */
@@ -0,0 +1,157 @@
+/*!
+ * \file thread_pool.hpp
+ * \brief file thread_pool.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/reference_counted.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Utility
+  @{
+ */
+
+  /*!
+    \brief
+    A ThreadPool is a set of worker threads to which
+    FastUIDraw hands independent work items, for example
+    the contours of a Path to tessellate, see
+    Path::tessellation_thread_pool(). The threads of
+    a ThreadPool are created by its ctor and joined by
+    its dtor.
+   */
+  class ThreadPool:
+    public reference_counted<ThreadPool>::default_base
+  {
+  public:
+    /*!
+      \brief
+      A Task is the interface for the work run by a ThreadPool.
+     */
+    class Task
+    {
+    public:
+      virtual
+      ~Task()
+      {}
+
+      /*!
+        To be implemented by a derived class to perform
+        one work item. Different work items are run
+        concurrently from different threads.
+        \param idx index of the work item
+       */
+      virtual
+      void
+      run(unsigned int idx) const = 0;
+    };
+
+    /*!
+      \brief
+      An AsyncTask is work handed to a ThreadPool with post()
+      that runs on a worker thread while the thread that posted
+      it continues.
+     */
+    class AsyncTask:
+      public reference_counted<AsyncTask>::default_base
+    {
+    public:
+      AsyncTask(void);
+
+      virtual
+      ~AsyncTask();
+
+      /*!
+        To be implemented by a derived class to perform
+        the work of the AsyncTask.
+       */
+      virtual
+      void
+      run(void) = 0;
+
+      /*!
+        Returns true if run() has returned. Once done() returns
+        true, the values written by run() are visible to the
+        calling thread.
+       */
+      bool
+      done(void) const;
+
+      /*!
+        Blocks until done() returns true.
+       */
+      void
+      wait(void) const;
+
+    private:
+      friend class ThreadPool;
+      void *m_d;
+    };
+
+    /*!
+      Ctor.
+      \param number_threads number of worker threads to create;
+                            the thread calling run() also performs
+                            work items, so a ThreadPool with
+                            number_threads threads runs up to
+                            number_threads + 1 work items at once
+     */
+    explicit
+    ThreadPool(unsigned int number_threads);
+
+    ~ThreadPool();
+
+    /*!
+      Returns the number of worker threads of this ThreadPool.
+     */
+    unsigned int
+    number_threads(void) const;
+
+    /*!
+      Runs Task::run() for each work item index in the range
+      [0, count) and returns when all of them are done. The
+      calling thread performs work items as well. Calls to
+      run() from different threads are serialized.
+      \param task Task to run
+      \param count number of work items
+     */
+    void
+    run(const Task &task, unsigned int count);
+
+    /*!
+      Queue an AsyncTask to be run by one of the worker
+      threads; AsyncTask objects are run in the order they
+      are posted, after the work items of any run() in progress.
+      If the ThreadPool has no worker threads, the AsyncTask
+      is run by the calling thread before post() returns. An
+      AsyncTask not yet run when the ThreadPool is destroyed
+      is run by the dtor.
+      \param task AsyncTask to run, an AsyncTask must be
+                  posted at most once
+     */
+    void
+    post(const reference_counted_ptr<AsyncTask> &task);
+
+  private:
+    void *m_d;
+  };
+
+/*! @} */
+}
@@ -0,0 +1,141 @@
+/*!
+ * \file trace.hpp
+ * \brief file trace.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/util.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Utility
+  @{
+ */
+
+  /*!
+    \brief
+    Event tracing that is written as a Chrome trace
+    JSON file; the file can be viewed with chrome://tracing
+    or the Perfetto UI. Events are recorded to memory between
+    start() and stop(), each thread to its own buffer, and the
+    file is written by stop(). The instrumentation within
+    FastUIDraw uses the macro \ref FASTUIDRAWtrace_scope which
+    is compiled out unless FASTUIDRAW_TRACE_EVENTS is defined,
+    i.e. unless FastUIDraw is built with TRACE_EVENTS=1.
+   */
+  namespace trace
+  {
+    /*!
+      Start recording events. Returns false if events
+      are already being recorded or if the file cannot
+      be opened for writing.
+      \param filename name of file to which to write
+                      the events when stop() is called
+     */
+    bool
+    start(const char *filename);
+
+    /*!
+      Stop recording events and write the events
+      recorded since start() to the file. Does
+      nothing if events are not being recorded.
+     */
+    void
+    stop(void);
+
+    /*!
+      Returns true if events are being recorded, i.e.
+      if start() has been called without a matching
+      stop().
+     */
+    bool
+    active(void);
+
+    /*!
+      Record the beginning of an event on the calling
+      thread, does nothing if active() is false.
+      \param name name of the event, the pointer is saved
+                  and must stay valid until stop(), i.e.
+                  the name should be a string literal
+     */
+    void
+    begin_event(const char *name);
+
+    /*!
+      Record the end of the last event begun by the
+      calling thread, does nothing if active() is false.
+      \param name name of the event, must be the same
+                  value as passed to begin_event()
+     */
+    void
+    end_event(const char *name);
+
+    /*!
+      \brief
+      A scoped_event calls begin_event() on ctor
+      and end_event() on dtor.
+     */
+    class scoped_event:noncopyable
+    {
+    public:
+      /*!
+        Ctor.
+        \param name name of event, see begin_event()
+       */
+      explicit
+      scoped_event(const char *name):
+        m_name(name)
+      {
+        begin_event(m_name);
+      }
+
+      ~scoped_event()
+      {
+        end_event(m_name);
+      }
+
+    private:
+      const char *m_name;
+    };
+  }
+
+/*! @} */
+}
+
+/*!\addtogroup Utility
+  @{
+ */
+
+#define FASTUIDRAWtrace_join_implement(X, Y) X##Y
+#define FASTUIDRAWtrace_join(X, Y) FASTUIDRAWtrace_join_implement(X, Y)
+
+/*!\def FASTUIDRAWtrace_scope
+  If FASTUIDRAW_TRACE_EVENTS is defined, records an event,
+  see fastuidraw::trace::begin_event(), that lasts until
+  the end of the enclosing scope. If FASTUIDRAW_TRACE_EVENTS
+  is not defined, does nothing.
+  \param name name of event, must be a string literal
+ */
+#ifdef FASTUIDRAW_TRACE_EVENTS
+#define FASTUIDRAWtrace_scope(name) \
+  fastuidraw::trace::scoped_event FASTUIDRAWtrace_join(fastuidraw_trace_event_, __LINE__)(name)
+#else
+#define FASTUIDRAWtrace_scope(name) do {} while(0)
+#endif
+
+/*! @} */
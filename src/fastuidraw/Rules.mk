@@ -23,6 +23,9 @@ include $(dir)/Rules.mk
 dir := $(d)/gl_backend
 include $(dir)/Rules.mk
 
+dir := $(d)/headless_backend
+include $(dir)/Rules.mk
+
 LIBRARY_SOURCES += $(call filelist, image.cpp colorstop.cpp colorstop_atlas.cpp path.cpp tessellated_path.cpp)
 
 # Begin standard footer
@@ -19,6 +19,7 @@
 
 #include <vector>
 #include <fastuidraw/colorstop_atlas.hpp>
+#include <fastuidraw/util/trace.hpp>
 #include "private/interval_allocator.hpp"
 #include "private/util_private.hpp"
 
@@ -327,6 +328,7 @@ flush(void) const
   ColorStopAtlasPrivate *d;
   d = static_cast<ColorStopAtlasPrivate*>(m_d);
 
+  FASTUIDRAWtrace_scope("ColorStopAtlas::flush");
   autolock_mutex m(d->m_mutex);
   d->m_backing_store->flush();
 }
@@ -23,6 +23,7 @@
 #include <vector>
 #include <iostream>
 
+#include <fastuidraw/util/trace.hpp>
 #include <fastuidraw/gl_backend/painter_backend_gl.hpp>
 #include <fastuidraw/gl_backend/ngl_header.hpp>
 #include <fastuidraw/gl_backend/gl_program.hpp>
@@ -45,7 +46,9 @@ namespace
   enum
     {
       shader_group_discard_bit = 31u,
-      shader_group_discard_mask = (1u << 31u)
+      shader_group_discard_mask = (1u << 31u),
+      shader_group_compact_attributes_bit = 30u,
+      shader_group_compact_attributes_mask = (1u << 30u)
     };
 
   class painter_vao
@@ -53,7 +56,9 @@ namespace
   public:
     painter_vao(void):
       m_vao(0),
+      m_compact_vao(0),
       m_attribute_bo(0),
+      m_compact_attribute_bo(0),
       m_header_bo(0),
       m_index_bo(0),
       m_data_bo(0),
@@ -61,12 +66,30 @@ namespace
     {}
 
     GLuint m_vao;
-    GLuint m_attribute_bo, m_header_bo, m_index_bo, m_data_bo;
+
+    /* VAO sourcing the primary attribute from m_compact_attribute_bo,
+       the header and index buffers are shared with m_vao; 0 if
+       ConfigurationGL::compact_attributes() is false.
+     */
+    GLuint m_compact_vao;
+    GLuint m_attribute_bo, m_compact_attribute_bo, m_header_bo, m_index_bo, m_data_bo;
     GLuint m_data_tbo;
     enum fastuidraw::gl::PainterBackendGL::data_store_backing_t m_data_store_backing;
     unsigned int m_data_store_binding_point;
   };
 
+  class painter_persistent_store
+  {
+  public:
+    painter_persistent_store(void):
+      m_bo(0),
+      m_tbo(0)
+    {}
+
+    GLuint m_bo;
+    GLuint m_tbo;
+  };
+
   class painter_vao_pool:fastuidraw::noncopyable
   {
   public:
@@ -84,6 +107,12 @@ namespace
       return m_attribute_buffer_size;
     }
 
+    unsigned int
+    compact_attribute_buffer_size(void) const
+    {
+      return m_compact_attribute_buffer_size;
+    }
+
     unsigned int
     header_buffer_size(void) const
     {
@@ -102,9 +131,21 @@ namespace
       return m_data_buffer_size;
     }
 
+    unsigned int
+    persistent_buffer_size(void) const
+    {
+      return m_persistent_buffer_size;
+    }
+
     painter_vao
     request_vao(void);
 
+    /* returns the persistent data store of the current pool,
+       creating the buffer (and TBO) if necessary.
+     */
+    const painter_persistent_store&
+    request_persistent_store(void);
+
     void
     next_pool(void);
 
@@ -122,9 +163,11 @@ namespace
     generate_bo(GLenum bind_target, GLsizei psize);
 
     unsigned int m_attribute_buffer_size, m_header_buffer_size;
+    unsigned int m_compact_attribute_buffer_size;
     unsigned int m_index_buffer_size;
     int m_alignment, m_blocks_per_data_buffer;
     unsigned int m_data_buffer_size;
+    unsigned int m_persistent_buffer_size;
     enum fastuidraw::gl::PainterBackendGL::data_store_backing_t m_data_store_backing;
     enum fastuidraw::gl::detail::tex_buffer_support_t m_tex_buffer_support;
     fastuidraw::glsl::PainterBackendGLSL::BindingPoints m_binding_points;
@@ -132,6 +175,7 @@ namespace
     unsigned int m_current, m_pool;
     std::vector<std::vector<painter_vao> > m_vaos;
     std::vector<GLuint> m_ubos;
+    std::vector<painter_persistent_store> m_persistent_stores;
   };
 
   bool
@@ -221,6 +265,11 @@ namespace
     fastuidraw::c_array<fastuidraw::generic_data> m_uniform_values_ptr;
     painter_vao_pool *m_pool;
 
+    /* persistent data store mapped by map_persistent_store(),
+       is the store of the current pool of m_pool.
+     */
+    painter_persistent_store m_persistent_store;
+
     fastuidraw::gl::PainterBackendGL *m_p;
   };
 
@@ -229,16 +278,16 @@ namespace
   public:
     DrawEntry(const fastuidraw::BlendMode &mode,
               PainterBackendGLPrivate *pr,
-              unsigned int pz);
+              unsigned int pz, GLuint vao);
 
 
-    DrawEntry(const fastuidraw::BlendMode &mode);
+    DrawEntry(const fastuidraw::BlendMode &mode, GLuint vao);
 
     void
     add_entry(GLsizei count, const void *offset);
 
     void
-    draw(void) const;
+    draw(GLenum index_type) const;
 
   private:
 
@@ -255,6 +304,7 @@ namespace
     std::vector<const GLvoid*> m_indices;
     PainterBackendGLPrivate *m_private;
     unsigned int m_choice;
+    GLuint m_vao;
   };
 
   class DrawCommand:public fastuidraw::PainterDraw
@@ -294,6 +344,8 @@ namespace
 
     PainterBackendGLPrivate *m_pr;
     painter_vao m_vao;
+    GLenum m_index_type;
+    unsigned int m_index_size;
     mutable unsigned int m_attributes_written, m_indices_written;
     mutable std::list<DrawEntry> m_draws;
   };
@@ -305,9 +357,12 @@ namespace
       m_attributes_per_buffer(512 * 512),
       m_indices_per_buffer((m_attributes_per_buffer * 6) / 4),
       m_data_blocks_per_store_buffer(1024 * 64),
+      m_data_blocks_per_persistent_store(0),
       m_data_store_backing(fastuidraw::gl::PainterBackendGL::data_store_tbo),
       m_number_pools(3),
       m_break_on_shader_change(false),
+      m_short_indices(false),
+      m_compact_attributes(false),
       m_use_hw_clip_planes(true),
       /* on Mesa/i965 using switch statement gives much slower
          performance than using if/else chain.
@@ -328,9 +383,12 @@ namespace
     unsigned int m_attributes_per_buffer;
     unsigned int m_indices_per_buffer;
     unsigned int m_data_blocks_per_store_buffer;
+    unsigned int m_data_blocks_per_persistent_store;
     enum fastuidraw::gl::PainterBackendGL::data_store_backing_t m_data_store_backing;
     unsigned int m_number_pools;
     bool m_break_on_shader_change;
+    bool m_short_indices;
+    bool m_compact_attributes;
     fastuidraw::reference_counted_ptr<fastuidraw::gl::ImageAtlasGL> m_image_atlas;
     fastuidraw::reference_counted_ptr<fastuidraw::gl::ColorStopAtlasGL> m_colorstop_atlas;
     fastuidraw::reference_counted_ptr<fastuidraw::gl::GlyphAtlasGL> m_glyph_atlas;
@@ -359,17 +417,24 @@ painter_vao_pool(const fastuidraw::gl::PainterBackendGL::ConfigurationGL &params
                  const fastuidraw::glsl::PainterBackendGLSL::BindingPoints &binding_points):
   m_attribute_buffer_size(params.attributes_per_buffer() * sizeof(fastuidraw::PainterAttribute)),
   m_header_buffer_size(params.attributes_per_buffer() * sizeof(uint32_t)),
-  m_index_buffer_size(params.indices_per_buffer() * sizeof(fastuidraw::PainterIndex)),
+  m_compact_attribute_buffer_size(params.compact_attributes() ?
+                                  params.attributes_per_buffer() * sizeof(fastuidraw::uvec4) :
+                                  0),
+  m_index_buffer_size(params.indices_per_buffer() * (params.short_indices() ?
+                                                      sizeof(fastuidraw::PainterShortIndex) :
+                                                      sizeof(fastuidraw::PainterIndex))),
   m_alignment(params_base.alignment()),
   m_blocks_per_data_buffer(params.data_blocks_per_store_buffer()),
   m_data_buffer_size(m_blocks_per_data_buffer * m_alignment * sizeof(fastuidraw::generic_data)),
+  m_persistent_buffer_size(params.data_blocks_per_persistent_store() * m_alignment * sizeof(fastuidraw::generic_data)),
   m_data_store_backing(params.data_store_backing()),
   m_tex_buffer_support(tex_buffer_support),
   m_binding_points(binding_points),
   m_current(0),
   m_pool(0),
   m_vaos(params.number_pools()),
-  m_ubos(params.number_pools(), 0)
+  m_ubos(params.number_pools(), 0),
+  m_persistent_stores(params.number_pools())
 {}
 
 painter_vao_pool::
@@ -389,15 +454,66 @@ painter_vao_pool::
           glDeleteBuffers(1, &m_vaos[p][i].m_index_bo);
           glDeleteBuffers(1, &m_vaos[p][i].m_data_bo);
           glDeleteVertexArrays(1, &m_vaos[p][i].m_vao);
+          if(m_vaos[p][i].m_compact_vao != 0)
+            {
+              glDeleteBuffers(1, &m_vaos[p][i].m_compact_attribute_bo);
+              glDeleteVertexArrays(1, &m_vaos[p][i].m_compact_vao);
+            }
         }
 
       if(m_ubos[p] != 0)
         {
           glDeleteBuffers(1, &m_ubos[p]);
         }
+
+      if(m_persistent_stores[p].m_tbo != 0)
+        {
+          glDeleteTextures(1, &m_persistent_stores[p].m_tbo);
+        }
+
+      if(m_persistent_stores[p].m_bo != 0)
+        {
+          glDeleteBuffers(1, &m_persistent_stores[p].m_bo);
+        }
     }
 }
 
+const painter_persistent_store&
+painter_vao_pool::
+request_persistent_store(void)
+{
+  FASTUIDRAWassert(m_persistent_buffer_size > 0);
+  if(m_persistent_stores[m_pool].m_bo == 0)
+    {
+      switch(m_data_store_backing)
+        {
+        case fastuidraw::gl::PainterBackendGL::data_store_tbo:
+          {
+            const GLenum uint_fmts[4] =
+              {
+                GL_R32UI,
+                GL_RG32UI,
+                GL_RGB32UI,
+                GL_RGBA32UI,
+              };
+
+            m_persistent_stores[m_pool].m_bo = generate_bo(GL_TEXTURE_BUFFER, m_persistent_buffer_size);
+            m_persistent_stores[m_pool].m_tbo = generate_tbo(m_persistent_stores[m_pool].m_bo,
+                                                             uint_fmts[m_alignment - 1],
+                                                             m_binding_points.persistent_data_store_buffer_tbo());
+          }
+          break;
+
+        case fastuidraw::gl::PainterBackendGL::data_store_ubo:
+          {
+            m_persistent_stores[m_pool].m_bo = generate_bo(GL_ARRAY_BUFFER, m_persistent_buffer_size);
+          }
+          break;
+        }
+    }
+  return m_persistent_stores[m_pool];
+}
+
 GLuint
 painter_vao_pool::
 request_uniform_ubo(unsigned int sz, GLenum target)
@@ -484,6 +600,29 @@ request_vao(void)
       v = fastuidraw::gl::opengl_trait_values<uint32_t>();
       fastuidraw::gl::VertexAttribIPointer(fastuidraw::glsl::PainterBackendGLSL::header_attrib_slot, v);
 
+      if(m_compact_attribute_buffer_size > 0)
+        {
+          /* the secondary and uint attributes are not enabled,
+             the shader reads them from the current generic
+             vertex attribute values which on_pre_draw() sets
+             to zero.
+           */
+          glGenVertexArrays(1, &m_vaos[m_pool][m_current].m_compact_vao);
+          FASTUIDRAWassert(m_vaos[m_pool][m_current].m_compact_vao != 0);
+          glBindVertexArray(m_vaos[m_pool][m_current].m_compact_vao);
+
+          glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vaos[m_pool][m_current].m_index_bo);
+          m_vaos[m_pool][m_current].m_compact_attribute_bo = generate_bo(GL_ARRAY_BUFFER, m_compact_attribute_buffer_size);
+          glEnableVertexAttribArray(fastuidraw::glsl::PainterBackendGLSL::primary_attrib_slot);
+          v = fastuidraw::gl::opengl_trait_values<fastuidraw::uvec4>();
+          fastuidraw::gl::VertexAttribIPointer(fastuidraw::glsl::PainterBackendGLSL::primary_attrib_slot, v);
+
+          glBindBuffer(GL_ARRAY_BUFFER, m_vaos[m_pool][m_current].m_header_bo);
+          glEnableVertexAttribArray(fastuidraw::glsl::PainterBackendGLSL::header_attrib_slot);
+          v = fastuidraw::gl::opengl_trait_values<uint32_t>();
+          fastuidraw::gl::VertexAttribIPointer(fastuidraw::glsl::PainterBackendGLSL::header_attrib_slot, v);
+        }
+
       glBindVertexArray(0);
     }
 
@@ -555,18 +694,20 @@ generate_bo(GLenum bind_target, GLsizei psize)
 DrawEntry::
 DrawEntry(const fastuidraw::BlendMode &mode,
           PainterBackendGLPrivate *pr,
-          unsigned int pz):
+          unsigned int pz, GLuint vao):
   m_blend_mode(mode),
   m_private(pr),
-  m_choice(pz)
+  m_choice(pz),
+  m_vao(vao)
 {}
 
 
 DrawEntry::
-DrawEntry(const fastuidraw::BlendMode &mode):
+DrawEntry(const fastuidraw::BlendMode &mode, GLuint vao):
   m_blend_mode(mode),
   m_private(nullptr),
-  m_choice(fastuidraw::gl::PainterBackendGL::number_program_types)
+  m_choice(fastuidraw::gl::PainterBackendGL::number_program_types),
+  m_vao(vao)
 {}
 
 void
@@ -579,12 +720,13 @@ add_entry(GLsizei count, const void *offset)
 
 void
 DrawEntry::
-draw(void) const
+draw(GLenum index_type) const
 {
   if(m_private)
     {
       m_private->m_programs[m_choice]->use_program();
     }
+  glBindVertexArray(m_vao);
 
   if(m_blend_mode.blending_on())
     {
@@ -610,25 +752,21 @@ draw(void) const
   */
   #ifndef FASTUIDRAW_GL_USE_GLES
     {
-      glMultiDrawElements(GL_TRIANGLES, &m_counts[0],
-                          fastuidraw::gl::opengl_trait<fastuidraw::PainterIndex>::type,
+      glMultiDrawElements(GL_TRIANGLES, &m_counts[0], index_type,
                           &m_indices[0], m_counts.size());
     }
   #else
     {
       if(FASTUIDRAWglfunctionExists(glMultiDrawElementsEXT))
         {
-          glMultiDrawElementsEXT(GL_TRIANGLES, &m_counts[0],
-                                 fastuidraw::gl::opengl_trait<fastuidraw::PainterIndex>::type,
+          glMultiDrawElementsEXT(GL_TRIANGLES, &m_counts[0], index_type,
                                  &m_indices[0], m_counts.size());
         }
       else
         {
           for(unsigned int i = 0, endi = m_counts.size(); i < endi; ++i)
             {
-              glDrawElements(GL_TRIANGLES, m_counts[i],
-                             fastuidraw::gl::opengl_trait<fastuidraw::PainterIndex>::type,
-                             m_indices[i]);
+              glDrawElements(GL_TRIANGLES, m_counts[i], index_type, m_indices[i]);
             }
         }
     }
@@ -705,6 +843,12 @@ DrawCommand(painter_vao_pool *hnd,
             PainterBackendGLPrivate *pr):
   m_pr(pr),
   m_vao(hnd->request_vao()),
+  m_index_type(params.short_indices() ?
+               static_cast<GLenum>(fastuidraw::gl::opengl_trait<fastuidraw::PainterShortIndex>::type) :
+               static_cast<GLenum>(fastuidraw::gl::opengl_trait<fastuidraw::PainterIndex>::type)),
+  m_index_size(params.short_indices() ?
+               sizeof(fastuidraw::PainterShortIndex) :
+               sizeof(fastuidraw::PainterIndex)),
   m_attributes_written(0),
   m_indices_written(0)
 {
@@ -724,6 +868,17 @@ DrawCommand(painter_vao_pool *hnd,
   header_bo = glMapBufferRange(GL_ARRAY_BUFFER, 0, hnd->header_buffer_size(), flags);
   FASTUIDRAWassert(header_bo != nullptr);
 
+  if(m_vao.m_compact_attribute_bo != 0)
+    {
+      void *compact_attr_bo;
+
+      glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_compact_attribute_bo);
+      compact_attr_bo = glMapBufferRange(GL_ARRAY_BUFFER, 0, hnd->compact_attribute_buffer_size(), flags);
+      FASTUIDRAWassert(compact_attr_bo != nullptr);
+      m_compact_attributes = fastuidraw::c_array<fastuidraw::uvec4>(static_cast<fastuidraw::uvec4*>(compact_attr_bo),
+                                                                    params.attributes_per_buffer());
+    }
+
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vao.m_index_bo);
   index_bo = glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, hnd->index_buffer_size(), flags);
   FASTUIDRAWassert(index_bo != nullptr);
@@ -734,8 +889,16 @@ DrawCommand(painter_vao_pool *hnd,
 
   m_attributes = fastuidraw::c_array<fastuidraw::PainterAttribute>(static_cast<fastuidraw::PainterAttribute*>(attr_bo),
                                                                  params.attributes_per_buffer());
-  m_indices = fastuidraw::c_array<fastuidraw::PainterIndex>(static_cast<fastuidraw::PainterIndex*>(index_bo),
-                                                          params.indices_per_buffer());
+  if(params.short_indices())
+    {
+      m_short_indices = fastuidraw::c_array<fastuidraw::PainterShortIndex>(static_cast<fastuidraw::PainterShortIndex*>(index_bo),
+                                                                           params.indices_per_buffer());
+    }
+  else
+    {
+      m_indices = fastuidraw::c_array<fastuidraw::PainterIndex>(static_cast<fastuidraw::PainterIndex*>(index_bo),
+                                                              params.indices_per_buffer());
+    }
   m_store = fastuidraw::c_array<fastuidraw::generic_data>(static_cast<fastuidraw::generic_data*>(data_bo),
                                                           hnd->data_buffer_size() / sizeof(fastuidraw::generic_data));
 
@@ -755,7 +918,8 @@ draw_break(const fastuidraw::PainterShaderGroup &old_shaders,
   /* if the blend mode changes, then we need to start a new DrawEntry
    */
   fastuidraw::BlendMode::packed_value old_mode, new_mode;
-  uint32_t new_disc, old_disc;
+  uint32_t new_disc, old_disc, new_compact, old_compact;
+  GLuint vao;
 
   old_mode = old_shaders.packed_blend_mode();
   new_mode = new_shaders.packed_blend_mode();
@@ -763,6 +927,13 @@ draw_break(const fastuidraw::PainterShaderGroup &old_shaders,
   old_disc = old_shaders.item_group() & shader_group_discard_mask;
   new_disc = new_shaders.item_group() & shader_group_discard_mask;
 
+  /* the attributes of a shader with a compact attribute
+     layout are sourced from a different VAO
+   */
+  old_compact = old_shaders.item_group() & shader_group_compact_attributes_mask;
+  new_compact = new_shaders.item_group() & shader_group_compact_attributes_mask;
+  vao = (new_compact != 0u) ? m_vao.m_compact_vao : m_vao.m_vao;
+
   if(old_disc != new_disc)
     {
       unsigned int pz;
@@ -774,15 +945,15 @@ draw_break(const fastuidraw::PainterShaderGroup &old_shaders,
         {
           add_entry(indices_written);
         }
-      m_draws.push_back(DrawEntry(fastuidraw::BlendMode(new_mode), m_pr, pz));
+      m_draws.push_back(DrawEntry(fastuidraw::BlendMode(new_mode), m_pr, pz, vao));
     }
-  else if(old_mode != new_mode)
+  else if(old_mode != new_mode || old_compact != new_compact)
     {
       if(!m_draws.empty())
         {
           add_entry(indices_written);
         }
-      m_draws.push_back(fastuidraw::BlendMode(new_mode));
+      m_draws.push_back(DrawEntry(fastuidraw::BlendMode(new_mode), vao));
     }
   else
     {
@@ -799,7 +970,6 @@ void
 DrawCommand::
 draw(void) const
 {
-  glBindVertexArray(m_vao.m_vao);
   switch(m_vao.m_data_store_backing)
     {
     case fastuidraw::gl::PainterBackendGL::data_store_tbo:
@@ -827,7 +997,7 @@ draw(void) const
   for(std::list<DrawEntry>::const_iterator iter = m_draws.begin(),
         end = m_draws.end(); iter != end; ++iter)
     {
-      iter->draw();
+      iter->draw(m_index_type);
     }
   glBindVertexArray(0);
 }
@@ -846,12 +1016,19 @@ unmap_implement(unsigned int attributes_written,
   glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, attributes_written * sizeof(fastuidraw::PainterAttribute));
   glUnmapBuffer(GL_ARRAY_BUFFER);
 
+  if(m_vao.m_compact_attribute_bo != 0)
+    {
+      glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_compact_attribute_bo);
+      glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, attributes_written * sizeof(fastuidraw::uvec4));
+      glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+
   glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_header_bo);
   glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, attributes_written * sizeof(uint32_t));
   glUnmapBuffer(GL_ARRAY_BUFFER);
 
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vao.m_index_bo);
-  glFlushMappedBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indices_written * sizeof(fastuidraw::PainterIndex));
+  glFlushMappedBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indices_written * m_index_size);
   glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
 
   glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_data_bo);
@@ -864,15 +1041,15 @@ DrawCommand::
 add_entry(unsigned int indices_written) const
 {
   unsigned int count;
-  const fastuidraw::PainterIndex *offset(nullptr);
+  const uint8_t *offset(nullptr);
 
   if(m_draws.empty())
     {
-      m_draws.push_back(fastuidraw::BlendMode());
+      m_draws.push_back(DrawEntry(fastuidraw::BlendMode(), m_vao.m_vao));
     }
   FASTUIDRAWassert(indices_written >= m_indices_written);
   count = indices_written - m_indices_written;
-  offset += m_indices_written;
+  offset += m_indices_written * m_index_size;
   m_draws.back().add_entry(count, offset);
   m_indices_written = indices_written;
 }
@@ -970,6 +1147,12 @@ configure_backend(void)
       m_params.data_store_backing(fastuidraw::gl::PainterBackendGL::data_store_ubo);
     }
 
+  if(m_params.short_indices())
+    {
+      // 16-bit indices can only address 65536 attributes
+      m_params.attributes_per_buffer(fastuidraw::t_min(m_params.attributes_per_buffer(), 65536u));
+    }
+
   bool have_dual_src_blending, have_framebuffer_fetch;
 
   if(m_ctx_properties.is_es())
@@ -1007,6 +1190,8 @@ configure_backend(void)
         max_texture_buffer_size = fastuidraw::gl::context_get<GLint>(GL_MAX_TEXTURE_BUFFER_SIZE);
         m_params.data_blocks_per_store_buffer(fastuidraw::t_min(max_texture_buffer_size,
                                                                 m_params.data_blocks_per_store_buffer()));
+        m_params.data_blocks_per_persistent_store(fastuidraw::t_min(max_texture_buffer_size,
+                                                                    m_params.data_blocks_per_persistent_store()));
       }
       break;
 
@@ -1018,6 +1203,8 @@ configure_backend(void)
         max_num_blocks = max_ubo_size_bytes / block_size_bytes;
         m_params.data_blocks_per_store_buffer(fastuidraw::t_min(max_num_blocks,
                                                                 m_params.data_blocks_per_store_buffer()));
+        m_params.data_blocks_per_persistent_store(fastuidraw::t_min(max_num_blocks,
+                                                                    m_params.data_blocks_per_persistent_store()));
       }
     }
 
@@ -1118,6 +1305,7 @@ configure_backend(void)
     .unpack_header_and_brush_in_frag_shader(m_params.unpack_header_and_brush_in_frag_shader())
     .data_store_backing(m_params.data_store_backing())
     .data_blocks_per_store_buffer(m_params.data_blocks_per_store_buffer())
+    .data_blocks_per_persistent_store(m_params.data_blocks_per_persistent_store())
     .glyph_geometry_backing(m_params.glyph_atlas()->param_values().glyph_geometry_backing_store_type())
     .glyph_geometry_backing_log2_dims(m_params.glyph_atlas()->param_values().texture_2d_array_geometry_store_log2_dims())
     .have_float_glyph_texture_atlas(m_params.glyph_atlas()->texel_texture(false) != 0)
@@ -1174,6 +1362,26 @@ configure_source_front_matter(void)
           }
           break;
         }
+
+      if(m_uber_shader_builder_params.data_blocks_per_persistent_store() > 0)
+        {
+          switch(m_uber_shader_builder_params.data_store_backing())
+            {
+            case PainterBackendGLSL::data_store_tbo:
+              {
+                m_initializer.add_sampler_initializer("fastuidraw_painterPersistentStore_tbo",
+                                                      binding_points.persistent_data_store_buffer_tbo());
+              }
+              break;
+
+            case PainterBackendGLSL::data_store_ubo:
+              {
+                m_initializer.add_uniform_block_binding("fastuidraw_painterPersistentStore_ubo",
+                                                        binding_points.persistent_data_store_buffer_ubo());
+              }
+              break;
+            }
+        }
     }
 
   if(!m_uber_shader_builder_params.assign_layout_to_vertex_shader_inputs())
@@ -1407,8 +1615,11 @@ operator=(const ConfigurationGL &rhs)
 setget_implement(unsigned int, attributes_per_buffer)
 setget_implement(unsigned int, indices_per_buffer)
 setget_implement(unsigned int, data_blocks_per_store_buffer)
+setget_implement(unsigned int, data_blocks_per_persistent_store)
 setget_implement(unsigned int, number_pools)
 setget_implement(bool, break_on_shader_change)
+setget_implement(bool, short_indices)
+setget_implement(bool, compact_attributes)
 setget_implement(const fastuidraw::reference_counted_ptr<fastuidraw::gl::ImageAtlasGL>&, image_atlas)
 setget_implement(const fastuidraw::reference_counted_ptr<fastuidraw::gl::ColorStopAtlasGL>&, colorstop_atlas)
 setget_implement(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GlyphAtlasGL>&, glyph_atlas)
@@ -1440,6 +1651,9 @@ PainterBackendGL(const ConfigurationGL &config_gl,
                      PainterBackendGLPrivate::compute_base_config(config_gl, config_base))
 {
   m_d = FASTUIDRAWnew PainterBackendGLPrivate(config_gl, this);
+
+  /* the buffers of a PainterDraw are mapped with glMapBufferRange() */
+  set_hints().write_combined_buffers(true);
 }
 
 fastuidraw::gl::PainterBackendGL::
@@ -1490,6 +1704,12 @@ compute_item_shader_group(PainterShader::Tag tag,
           return_value |= shader_group_discard_mask;
         }
     }
+
+  if(configuration_gl().compact_attributes()
+     && shader->attribute_layout() == PainterItemShader::compact_attribute_layout)
+    {
+      return_value |= shader_group_compact_attributes_mask;
+    }
   return return_value;
 }
 
@@ -1525,6 +1745,8 @@ void
 fastuidraw::gl::PainterBackendGL::
 on_pre_draw(void)
 {
+  FASTUIDRAWtrace_scope("PainterBackendGL::on_pre_draw");
+
   PainterBackendGLPrivate *d;
   d = static_cast<PainterBackendGLPrivate*>(m_d);
 
@@ -1545,10 +1767,25 @@ on_pre_draw(void)
       glSamplerParameteri(d->m_linear_filter_sampler, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     }
 
+  /* the occluders of clipping and the opaque draws that
+     PainterPacker::front_to_back_opaque_draws() draws first
+     hide what is drawn after them only if depth is written.
+   */
   glEnable(GL_DEPTH_TEST);
   glDepthFunc(GL_GEQUAL);
+  glDepthMask(GL_TRUE);
   glDisable(GL_STENCIL_TEST);
 
+  if(d->m_params.compact_attributes())
+    {
+      /* the VAO of compact attributes does not enable these
+         attributes, the shader then reads the current values
+         of the attributes which must be integer zero.
+       */
+      glVertexAttribI4ui(glsl::PainterBackendGLSL::secondary_attrib_slot, 0u, 0u, 0u, 0u);
+      glVertexAttribI4ui(glsl::PainterBackendGLSL::uint_attrib_slot, 0u, 0u, 0u, 0u);
+    }
+
   if(d->m_number_clip_planes > 0)
     {
       glEnable(d->m_clip_plane0 + 0);
@@ -1606,6 +1843,27 @@ on_pre_draw(void)
   glBindSampler(binding_points.colorstop_atlas(), 0);
   glBindTexture(ColorStopAtlasGL::texture_bind_target(), color->texture());
 
+  if(d->m_persistent_store.m_bo != 0)
+    {
+      switch(d->m_params.data_store_backing())
+        {
+        case data_store_tbo:
+          {
+            glActiveTexture(GL_TEXTURE0 + binding_points.persistent_data_store_buffer_tbo());
+            glBindSampler(binding_points.persistent_data_store_buffer_tbo(), 0);
+            glBindTexture(GL_TEXTURE_BUFFER, d->m_persistent_store.m_tbo);
+          }
+          break;
+
+        case data_store_ubo:
+          {
+            glBindBufferBase(GL_UNIFORM_BUFFER, binding_points.persistent_data_store_buffer_ubo(),
+                             d->m_persistent_store.m_bo);
+          }
+          break;
+        }
+    }
+
   //grabbing the programs via programs() makes sure they
   //are built.
   const PainterBackendGLPrivate::program_set &prs(d->programs(shader_code_added()));
@@ -1661,6 +1919,8 @@ void
 fastuidraw::gl::PainterBackendGL::
 on_post_draw(void)
 {
+  FASTUIDRAWtrace_scope("PainterBackendGL::on_post_draw");
+
   PainterBackendGLPrivate *d;
   d = static_cast<PainterBackendGLPrivate*>(m_d);
 
@@ -1722,6 +1982,26 @@ on_post_draw(void)
     default:
       FASTUIDRAWassert(!"Bad value for m_params.data_store_backing()");
     }
+
+  if(d->m_persistent_store.m_bo != 0)
+    {
+      switch(d->m_params.data_store_backing())
+        {
+        case data_store_tbo:
+          {
+            glActiveTexture(GL_TEXTURE0 + binding_points.persistent_data_store_buffer_tbo());
+            glBindTexture(GL_TEXTURE_BUFFER, 0);
+          }
+          break;
+
+        case data_store_ubo:
+          {
+            glBindBufferBase(GL_UNIFORM_BUFFER, binding_points.persistent_data_store_buffer_ubo(), 0);
+          }
+          break;
+        }
+      d->m_persistent_store = painter_persistent_store();
+    }
   glBindBufferBase(GL_UNIFORM_BUFFER, binding_points.uniforms_ubo(), 0);
   d->m_pool->next_pool();
 }
@@ -1735,3 +2015,41 @@ map_draw(void)
 
   return FASTUIDRAWnew DrawCommand(d->m_pool, d->m_params, d);
 }
+
+fastuidraw::c_array<fastuidraw::generic_data>
+fastuidraw::gl::PainterBackendGL::
+map_persistent_store(void)
+{
+  PainterBackendGLPrivate *d;
+  void *data_bo;
+
+  d = static_cast<PainterBackendGLPrivate*>(m_d);
+  if(d->m_pool->persistent_buffer_size() == 0)
+    {
+      return c_array<generic_data>();
+    }
+
+  d->m_persistent_store = d->m_pool->request_persistent_store();
+  glBindBuffer(GL_ARRAY_BUFFER, d->m_persistent_store.m_bo);
+  data_bo = glMapBufferRange(GL_ARRAY_BUFFER, 0, d->m_pool->persistent_buffer_size(),
+                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+  FASTUIDRAWassert(data_bo != nullptr);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  return c_array<generic_data>(static_cast<generic_data*>(data_bo),
+                               d->m_pool->persistent_buffer_size() / sizeof(generic_data));
+}
+
+void
+fastuidraw::gl::PainterBackendGL::
+unmap_persistent_store(unsigned int data_store_written)
+{
+  PainterBackendGLPrivate *d;
+  d = static_cast<PainterBackendGLPrivate*>(m_d);
+
+  FASTUIDRAWassert(d->m_persistent_store.m_bo != 0);
+  glBindBuffer(GL_ARRAY_BUFFER, d->m_persistent_store.m_bo);
+  glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, data_store_written * sizeof(generic_data));
+  glUnmapBuffer(GL_ARRAY_BUFFER);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
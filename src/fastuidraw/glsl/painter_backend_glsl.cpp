@@ -93,7 +93,9 @@ namespace
       m_glyph_atlas_geometry_store(6),
       m_data_store_buffer_tbo(7),
       m_data_store_buffer_ubo(0),
-      m_uniforms_ubo(1)
+      m_uniforms_ubo(1),
+      m_persistent_data_store_buffer_tbo(8),
+      m_persistent_data_store_buffer_ubo(2)
     {}
 
     unsigned int m_colorstop_atlas;
@@ -106,6 +108,8 @@ namespace
     unsigned int m_data_store_buffer_tbo;
     unsigned int m_data_store_buffer_ubo;
     unsigned int m_uniforms_ubo;
+    unsigned int m_persistent_data_store_buffer_tbo;
+    unsigned int m_persistent_data_store_buffer_ubo;
   };
 
   class UberShaderParamsPrivate
@@ -123,6 +127,7 @@ namespace
       m_unpack_header_and_brush_in_frag_shader(false),
       m_data_store_backing(fastuidraw::glsl::PainterBackendGLSL::data_store_tbo),
       m_data_blocks_per_store_buffer(-1),
+      m_data_blocks_per_persistent_store(0),
       m_glyph_geometry_backing(fastuidraw::glsl::PainterBackendGLSL::glyph_geometry_tbo),
       m_glyph_geometry_backing_log2_dims(-1, -1),
       m_have_float_glyph_texture_atlas(true),
@@ -142,6 +147,7 @@ namespace
     bool m_unpack_header_and_brush_in_frag_shader;
     enum fastuidraw::glsl::PainterBackendGLSL::data_store_backing_t m_data_store_backing;
     int m_data_blocks_per_store_buffer;
+    int m_data_blocks_per_persistent_store;
     enum fastuidraw::glsl::PainterBackendGLSL::glyph_geometry_backing_t m_glyph_geometry_backing;
     fastuidraw::ivec2 m_glyph_geometry_backing_log2_dims;
     bool m_have_float_glyph_texture_atlas;
@@ -485,6 +491,7 @@ add_enums(fastuidraw::glsl::ShaderSource &src)
     .add_macro("fastuidraw_item_shader_num_bits", PainterHeader::item_shader_num_bits)
     .add_macro("fastuidraw_blend_shader_bit0", PainterHeader::blend_shader_bit0)
     .add_macro("fastuidraw_blend_shader_num_bits", PainterHeader::blend_shader_num_bits)
+    .add_macro("fastuidraw_persistent_store_mask", uint32_t(PainterHeader::persistent_store_mask))
 
     /* offset types for stroking.
      */
@@ -974,6 +981,17 @@ construct_shader(fastuidraw::glsl::ShaderSource &vert,
       FASTUIDRAWassert(!"Invalid data_store_backing() value");
     }
 
+  if(params.data_blocks_per_persistent_store() > 0)
+    {
+      vert
+        .add_macro("FASTUIDRAW_PAINTER_USE_PERSISTENT_STORE")
+        .add_macro("FASTUIDRAW_PAINTER_PERSISTENT_STORE_ARRAY_SIZE", params.data_blocks_per_persistent_store());
+
+      frag
+        .add_macro("FASTUIDRAW_PAINTER_USE_PERSISTENT_STORE")
+        .add_macro("FASTUIDRAW_PAINTER_PERSISTENT_STORE_ARRAY_SIZE", params.data_blocks_per_persistent_store());
+    }
+
   if(!params.have_float_glyph_texture_atlas())
     {
       vert.add_macro("FASTUIDRAW_PAINTER_EMULATE_GLYPH_TEXEL_STORE_FLOAT");
@@ -1017,6 +1035,8 @@ construct_shader(fastuidraw::glsl::ShaderSource &vert,
     .add_macro("FASTUIDRAW_GLYPH_GEOMETRY_STORE_BINDING", binding_params.glyph_atlas_geometry_store())
     .add_macro("FASTUIDRAW_PAINTER_STORE_TBO_BINDING", binding_params.data_store_buffer_tbo())
     .add_macro("FASTUIDRAW_PAINTER_STORE_UBO_BINDING", binding_params.data_store_buffer_ubo())
+    .add_macro("FASTUIDRAW_PAINTER_PERSISTENT_STORE_TBO_BINDING", binding_params.persistent_data_store_buffer_tbo())
+    .add_macro("FASTUIDRAW_PAINTER_PERSISTENT_STORE_UBO_BINDING", binding_params.persistent_data_store_buffer_ubo())
     .add_macro("fastuidraw_varying", "out")
     .add_source(declare_vertex_shader_ins.c_str(), ShaderSource::from_string)
     .add_source(declare_brush_varyings.c_str(), ShaderSource::from_string)
@@ -1087,6 +1107,8 @@ construct_shader(fastuidraw::glsl::ShaderSource &vert,
     .add_macro("FASTUIDRAW_GLYPH_GEOMETRY_STORE_BINDING", binding_params.glyph_atlas_geometry_store())
     .add_macro("FASTUIDRAW_PAINTER_STORE_TBO_BINDING", binding_params.data_store_buffer_tbo())
     .add_macro("FASTUIDRAW_PAINTER_STORE_UBO_BINDING", binding_params.data_store_buffer_ubo())
+    .add_macro("FASTUIDRAW_PAINTER_PERSISTENT_STORE_TBO_BINDING", binding_params.persistent_data_store_buffer_tbo())
+    .add_macro("FASTUIDRAW_PAINTER_PERSISTENT_STORE_UBO_BINDING", binding_params.persistent_data_store_buffer_ubo())
     .add_macro("fastuidraw_varying", "in")
     .add_source(declare_brush_varyings.c_str(), ShaderSource::from_string)
     .add_source(declare_main_varyings.c_str(), ShaderSource::from_string)
@@ -1271,6 +1293,8 @@ setget_implement(unsigned int, glyph_atlas_geometry_store)
 setget_implement(unsigned int, data_store_buffer_tbo)
 setget_implement(unsigned int, data_store_buffer_ubo)
 setget_implement(unsigned int, uniforms_ubo)
+setget_implement(unsigned int, persistent_data_store_buffer_tbo)
+setget_implement(unsigned int, persistent_data_store_buffer_ubo)
 
 #undef setget_implement
 
@@ -1344,6 +1368,7 @@ setget_implement(bool, blend_shader_use_switch)
 setget_implement(bool, unpack_header_and_brush_in_frag_shader)
 setget_implement(enum fastuidraw::glsl::PainterBackendGLSL::data_store_backing_t, data_store_backing)
 setget_implement(int, data_blocks_per_store_buffer)
+setget_implement(int, data_blocks_per_persistent_store)
 setget_implement(enum fastuidraw::glsl::PainterBackendGLSL::glyph_geometry_backing_t, glyph_geometry_backing)
 setget_implement(fastuidraw::ivec2, glyph_geometry_backing_log2_dims)
 setget_implement(bool, have_float_glyph_texture_atlas)
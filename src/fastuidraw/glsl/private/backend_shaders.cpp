@@ -310,6 +310,13 @@ create_glyph_shader(bool anisotropic)
     .add_uint_varying("fastuidraw_glyph_secondary_tex_coord_layer")
     .add_uint_varying("fastuidraw_glyph_geometry_data_location");
 
+  /* the glyph shaders keep the full attribute layout: a glyph
+     vertex has its position, the texel locations in the primary
+     and secondary atlases, the layers of both and the glyph
+     offset (see PainterAttributeDataFillerGlyphs), which do not
+     fit in the 16 bytes of PainterAttribute::m_attrib0 that
+     PainterItemShader::compact_attribute_layout keeps.
+   */
   return_value
     .shader(coverage_glyph,
             create_glyph_item_shader("fastuidraw_painter_glyph_coverage.vert.glsl.resource_string",
@@ -366,6 +373,10 @@ create_stroke_item_shader(enum PainterEnums::cap_style stroke_dash_style,
         | (uint32_t(pixel_width_stroking) << m_stroke_width_pixels_bit0);
       shader = FASTUIDRAWnew PainterItemShader(sub_shader, m_uber_dashed_stroke_shader);
     }
+
+  /* only the anti-aliasing pass lowers the alpha of fragments
+   */
+  shader->full_coverage(render_pass != uber_stroke_aa_pass);
   return shader;
 }
 
@@ -412,16 +423,25 @@ ShaderSetCreator::
 create_fill_shader(void)
 {
   PainterFillShader fill_shader;
+  reference_counted_ptr<PainterItemShader> item_shader;
+
+  item_shader = FASTUIDRAWnew PainterItemShaderGLSL(false,
+                                                    ShaderSource()
+                                                    .add_source("fastuidraw_painter_fill.vert.glsl.resource_string",
+                                                                ShaderSource::from_resource),
+                                                    ShaderSource()
+                                                    .add_source("fastuidraw_painter_fill.frag.glsl.resource_string",
+                                                                ShaderSource::from_resource),
+                                                    varying_list());
+  /* the fill shader only reads the position from the
+     primary attribute, see FilledPath::Subset.
+   */
+  item_shader
+    ->full_coverage(true)
+    .attribute_layout(PainterItemShader::compact_attribute_layout);
 
   fill_shader
-    .item_shader(FASTUIDRAWnew PainterItemShaderGLSL(false,
-                                                     ShaderSource()
-                                                     .add_source("fastuidraw_painter_fill.vert.glsl.resource_string",
-                                                                 ShaderSource::from_resource),
-                                                     ShaderSource()
-                                                     .add_source("fastuidraw_painter_fill.frag.glsl.resource_string",
-                                                                 ShaderSource::from_resource),
-                                                     varying_list()))
+    .item_shader(item_shader)
     .aa_fuzz_shader(FASTUIDRAWnew PainterItemShaderGLSL(false,
                                                         ShaderSource()
                                                         .add_source("fastuidraw_painter_fill_aa_fuzz.vert.glsl.resource_string",
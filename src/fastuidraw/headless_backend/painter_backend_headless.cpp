@@ -0,0 +1,722 @@
+/*!
+ * \file painter_backend_headless.cpp
+ * \brief file painter_backend_headless.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <vector>
+#include <fastuidraw/headless_backend/painter_backend_headless.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  /* same bit as the GL backend uses for the item group
+     of a shader with a compact attribute layout.
+   */
+  enum
+    {
+      shader_group_compact_attributes_mask = (1u << 30u)
+    };
+
+  /* Backing stores for the atlases that discard all of their
+     content; the headless backend never samples from them,
+     but the atlases still need a store to perform their
+     allocation book-keeping.
+   */
+  class NullColorBackingStore:public fastuidraw::AtlasColorBackingStoreBase
+  {
+  public:
+    NullColorBackingStore(void):
+      fastuidraw::AtlasColorBackingStoreBase(32 * 256, 32 * 256, 1, true)
+    {}
+
+    virtual
+    void
+    set_data(int, int, int, int, int, fastuidraw::const_c_array<fastuidraw::u8vec4>)
+    {}
+
+    virtual
+    void
+    flush(void)
+    {}
+
+  protected:
+    virtual
+    void
+    resize_implement(int)
+    {}
+  };
+
+  class NullIndexBackingStore:public fastuidraw::AtlasIndexBackingStoreBase
+  {
+  public:
+    NullIndexBackingStore(void):
+      fastuidraw::AtlasIndexBackingStoreBase(4 * 64, 4 * 64, 4, true)
+    {}
+
+    virtual
+    void
+    set_data(int, int, int, int, int,
+             fastuidraw::const_c_array<fastuidraw::ivec3>,
+             int, const fastuidraw::AtlasColorBackingStoreBase*, int)
+    {}
+
+    virtual
+    void
+    set_data(int, int, int, int, int,
+             fastuidraw::const_c_array<fastuidraw::ivec3>)
+    {}
+
+    virtual
+    void
+    flush(void)
+    {}
+
+  protected:
+    virtual
+    void
+    resize_implement(int)
+    {}
+  };
+
+  class NullColorStopBackingStore:public fastuidraw::ColorStopBackingStore
+  {
+  public:
+    NullColorStopBackingStore(void):
+      fastuidraw::ColorStopBackingStore(1024, 32, true)
+    {}
+
+    virtual
+    void
+    set_data(int, int, int, fastuidraw::const_c_array<fastuidraw::u8vec4>)
+    {}
+
+  protected:
+    virtual
+    void
+    resize_implement(int)
+    {}
+  };
+
+  class NullGlyphTexelBackingStore:public fastuidraw::GlyphAtlasTexelBackingStoreBase
+  {
+  public:
+    NullGlyphTexelBackingStore(void):
+      fastuidraw::GlyphAtlasTexelBackingStoreBase(1024, 1024, 16, true)
+    {}
+
+    virtual
+    void
+    set_data(int, int, int, int, int, fastuidraw::const_c_array<uint8_t>)
+    {}
+
+    virtual
+    void
+    flush(void)
+    {}
+
+  protected:
+    virtual
+    void
+    resize_implement(int)
+    {}
+  };
+
+  class NullGlyphGeometryBackingStore:public fastuidraw::GlyphAtlasGeometryBackingStoreBase
+  {
+  public:
+    NullGlyphGeometryBackingStore(void):
+      fastuidraw::GlyphAtlasGeometryBackingStoreBase(4, 1024 * 1024 / 4, true)
+    {}
+
+    virtual
+    void
+    set_values(unsigned int, fastuidraw::const_c_array<fastuidraw::generic_data>)
+    {}
+
+    virtual
+    void
+    flush(void)
+    {}
+
+  protected:
+    virtual
+    void
+    resize_implement(unsigned int)
+    {}
+  };
+
+  class ConfigurationHeadlessPrivate
+  {
+  public:
+    ConfigurationHeadlessPrivate(void):
+      m_attributes_per_buffer(512 * 512),
+      m_indices_per_buffer((m_attributes_per_buffer * 6) / 4),
+      m_data_blocks_per_store_buffer(1024 * 64),
+      m_data_blocks_per_persistent_store(0),
+      m_break_on_shader_change(false),
+      m_short_indices(false),
+      m_compact_attributes(false)
+    {}
+
+    unsigned int m_attributes_per_buffer;
+    unsigned int m_indices_per_buffer;
+    unsigned int m_data_blocks_per_store_buffer;
+    unsigned int m_data_blocks_per_persistent_store;
+    bool m_break_on_shader_change;
+    bool m_short_indices;
+    bool m_compact_attributes;
+    fastuidraw::reference_counted_ptr<fastuidraw::ImageAtlas> m_image_atlas;
+    fastuidraw::reference_counted_ptr<fastuidraw::ColorStopAtlas> m_colorstop_atlas;
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> m_glyph_atlas;
+  };
+
+  /* The heap memory backing a single PainterDraw; buffers
+     are recycled through a buffer_pool so that the cost
+     of map_draw() does not include heap allocation.
+   */
+  class buffer_set
+  {
+  public:
+    buffer_set(unsigned int num_attributes,
+               unsigned int num_indices,
+               unsigned int num_generic_datas,
+               bool short_indices,
+               bool compact_attributes):
+      m_attributes(num_attributes),
+      m_compact_attributes(compact_attributes ? num_attributes : 0),
+      m_header_attributes(num_attributes),
+      m_indices(short_indices ? 0 : num_indices),
+      m_short_indices(short_indices ? num_indices : 0),
+      m_store(num_generic_datas)
+    {}
+
+    std::vector<fastuidraw::PainterAttribute> m_attributes;
+    std::vector<fastuidraw::uvec4> m_compact_attributes;
+    std::vector<uint32_t> m_header_attributes;
+    std::vector<fastuidraw::PainterIndex> m_indices;
+    std::vector<fastuidraw::PainterShortIndex> m_short_indices;
+    std::vector<fastuidraw::generic_data> m_store;
+  };
+
+  class buffer_pool:public fastuidraw::reference_counted<buffer_pool>::non_concurrent
+  {
+  public:
+    buffer_pool(unsigned int num_attributes,
+                unsigned int num_indices,
+                unsigned int num_generic_datas,
+                bool short_indices,
+                bool compact_attributes):
+      m_num_attributes(num_attributes),
+      m_num_indices(num_indices),
+      m_num_generic_datas(num_generic_datas),
+      m_short_indices(short_indices),
+      m_compact_attributes(compact_attributes),
+      m_number_allocations(0)
+    {}
+
+    ~buffer_pool();
+
+    buffer_set*
+    request_buffers(void);
+
+    void
+    release_buffers(buffer_set *p)
+    {
+      m_free.push_back(p);
+    }
+
+    unsigned int
+    number_allocations(void) const
+    {
+      return m_number_allocations;
+    }
+
+  private:
+    unsigned int m_num_attributes;
+    unsigned int m_num_indices;
+    unsigned int m_num_generic_datas;
+    bool m_short_indices;
+    bool m_compact_attributes;
+    unsigned int m_number_allocations;
+    std::vector<buffer_set*> m_free;
+  };
+
+  class PainterBackendHeadlessPrivate
+  {
+  public:
+    PainterBackendHeadlessPrivate(const fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless &P,
+                                  fastuidraw::headless::PainterBackendHeadless *p);
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas>
+    compute_glyph_atlas(const fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless &P);
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::ImageAtlas>
+    compute_image_atlas(const fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless &P);
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::ColorStopAtlas>
+    compute_colorstop_atlas(const fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless &P);
+
+    fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless m_params;
+    fastuidraw::reference_counted_ptr<buffer_pool> m_pool;
+    fastuidraw::vecN<uint64_t, fastuidraw::headless::PainterBackendHeadless::num_stats> m_stats;
+    unsigned int m_number_flushes;
+
+    /* the persistent data store lives for the entire
+       object; it is only written to between a
+       map_persistent_store() / unmap_persistent_store()
+       pair.
+     */
+    std::vector<fastuidraw::generic_data> m_persistent_store;
+    unsigned int m_persistent_store_written;
+  };
+
+  class DrawCommand:public fastuidraw::PainterDraw
+  {
+  public:
+    explicit
+    DrawCommand(PainterBackendHeadlessPrivate *pr);
+
+    virtual
+    ~DrawCommand();
+
+    virtual
+    void
+    draw_break(const fastuidraw::PainterShaderGroup &old_shaders,
+               const fastuidraw::PainterShaderGroup &new_shaders,
+               unsigned int attributes_written, unsigned int indices_written) const;
+
+    virtual
+    void
+    draw(void) const;
+
+  protected:
+
+    virtual
+    void
+    unmap_implement(unsigned int attributes_written,
+                    unsigned int indices_written,
+                    unsigned int data_store_written) const;
+
+  private:
+    PainterBackendHeadlessPrivate *m_pr;
+    fastuidraw::reference_counted_ptr<buffer_pool> m_pool;
+    buffer_set *m_buffers;
+    mutable unsigned int m_attributes_written, m_indices_written;
+    mutable unsigned int m_data_store_written, m_draw_breaks;
+  };
+}
+
+///////////////////////////////////////////
+// buffer_pool methods
+buffer_pool::
+~buffer_pool()
+{
+  for(std::vector<buffer_set*>::iterator iter = m_free.begin(),
+        end = m_free.end(); iter != end; ++iter)
+    {
+      FASTUIDRAWdelete(*iter);
+    }
+}
+
+buffer_set*
+buffer_pool::
+request_buffers(void)
+{
+  buffer_set *return_value;
+
+  if(m_free.empty())
+    {
+      ++m_number_allocations;
+      return_value = FASTUIDRAWnew buffer_set(m_num_attributes, m_num_indices,
+                                              m_num_generic_datas, m_short_indices,
+                                              m_compact_attributes);
+    }
+  else
+    {
+      return_value = m_free.back();
+      m_free.pop_back();
+    }
+  return return_value;
+}
+
+///////////////////////////////////////////
+// DrawCommand methods
+DrawCommand::
+DrawCommand(PainterBackendHeadlessPrivate *pr):
+  m_pr(pr),
+  m_pool(pr->m_pool),
+  m_buffers(m_pool->request_buffers()),
+  m_attributes_written(0),
+  m_indices_written(0),
+  m_data_store_written(0),
+  m_draw_breaks(0)
+{
+  m_attributes = fastuidraw::c_array<fastuidraw::PainterAttribute>(&m_buffers->m_attributes[0],
+                                                                   m_buffers->m_attributes.size());
+  m_compact_attributes = fastuidraw::make_c_array(m_buffers->m_compact_attributes);
+  m_header_attributes = fastuidraw::c_array<uint32_t>(&m_buffers->m_header_attributes[0],
+                                                      m_buffers->m_header_attributes.size());
+  m_indices = fastuidraw::make_c_array(m_buffers->m_indices);
+  m_short_indices = fastuidraw::make_c_array(m_buffers->m_short_indices);
+  m_store = fastuidraw::c_array<fastuidraw::generic_data>(&m_buffers->m_store[0],
+                                                          m_buffers->m_store.size());
+}
+
+DrawCommand::
+~DrawCommand()
+{
+  m_pool->release_buffers(m_buffers);
+}
+
+void
+DrawCommand::
+draw_break(const fastuidraw::PainterShaderGroup &old_shaders,
+           const fastuidraw::PainterShaderGroup &new_shaders,
+           unsigned int attributes_written, unsigned int indices_written) const
+{
+  FASTUIDRAWunused(old_shaders);
+  FASTUIDRAWunused(new_shaders);
+  FASTUIDRAWunused(attributes_written);
+  FASTUIDRAWunused(indices_written);
+  ++m_draw_breaks;
+}
+
+void
+DrawCommand::
+unmap_implement(unsigned int attributes_written,
+                unsigned int indices_written,
+                unsigned int data_store_written) const
+{
+  m_attributes_written = attributes_written;
+  m_indices_written = indices_written;
+  m_data_store_written = data_store_written;
+}
+
+void
+DrawCommand::
+draw(void) const
+{
+  using namespace fastuidraw;
+  typedef headless::PainterBackendHeadless B;
+
+  m_pr->m_stats[B::num_draws] += 1u;
+  m_pr->m_stats[B::num_draw_breaks] += m_draw_breaks;
+  m_pr->m_stats[B::num_attributes] += m_attributes_written;
+  m_pr->m_stats[B::num_indices] += m_indices_written;
+  m_pr->m_stats[B::num_generic_datas] += m_data_store_written;
+  m_pr->m_stats[B::num_bytes] += m_attributes_written * (sizeof(PainterAttribute) + sizeof(uint32_t))
+    + m_indices_written * (m_indices.empty() ? sizeof(PainterShortIndex) : sizeof(PainterIndex))
+    + m_data_store_written * sizeof(generic_data);
+}
+
+///////////////////////////////////////////
+// PainterBackendHeadlessPrivate methods
+PainterBackendHeadlessPrivate::
+PainterBackendHeadlessPrivate(const fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless &P,
+                              fastuidraw::headless::PainterBackendHeadless *p):
+  m_params(P),
+  m_stats(0),
+  m_number_flushes(0),
+  m_persistent_store_written(0)
+{
+  unsigned int num_generic_datas;
+
+  m_params
+    .glyph_atlas(p->glyph_atlas())
+    .image_atlas(p->image_atlas())
+    .colorstop_atlas(p->colorstop_atlas());
+
+  if(m_params.short_indices())
+    {
+      m_params.attributes_per_buffer(fastuidraw::t_min(m_params.attributes_per_buffer(), 65536u));
+    }
+
+  num_generic_datas = m_params.data_blocks_per_store_buffer() * p->configuration_base().alignment();
+  m_pool = FASTUIDRAWnew buffer_pool(m_params.attributes_per_buffer(),
+                                     m_params.indices_per_buffer(),
+                                     num_generic_datas,
+                                     m_params.short_indices(),
+                                     m_params.compact_attributes());
+  m_persistent_store.resize(m_params.data_blocks_per_persistent_store() * p->configuration_base().alignment());
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas>
+PainterBackendHeadlessPrivate::
+compute_glyph_atlas(const fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless &P)
+{
+  if(P.glyph_atlas())
+    {
+      return P.glyph_atlas();
+    }
+  return FASTUIDRAWnew fastuidraw::GlyphAtlas(FASTUIDRAWnew NullGlyphTexelBackingStore(),
+                                              FASTUIDRAWnew NullGlyphGeometryBackingStore());
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::ImageAtlas>
+PainterBackendHeadlessPrivate::
+compute_image_atlas(const fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless &P)
+{
+  if(P.image_atlas())
+    {
+      return P.image_atlas();
+    }
+  return FASTUIDRAWnew fastuidraw::ImageAtlas(32, 4,
+                                              FASTUIDRAWnew NullColorBackingStore(),
+                                              FASTUIDRAWnew NullIndexBackingStore());
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::ColorStopAtlas>
+PainterBackendHeadlessPrivate::
+compute_colorstop_atlas(const fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless &P)
+{
+  if(P.colorstop_atlas())
+    {
+      return P.colorstop_atlas();
+    }
+  return FASTUIDRAWnew fastuidraw::ColorStopAtlas(FASTUIDRAWnew NullColorStopBackingStore());
+}
+
+///////////////////////////////////////////////
+// fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless methods
+fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless::
+ConfigurationHeadless(void)
+{
+  m_d = FASTUIDRAWnew ConfigurationHeadlessPrivate();
+}
+
+fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless::
+ConfigurationHeadless(const ConfigurationHeadless &obj)
+{
+  ConfigurationHeadlessPrivate *d;
+  d = static_cast<ConfigurationHeadlessPrivate*>(obj.m_d);
+  m_d = FASTUIDRAWnew ConfigurationHeadlessPrivate(*d);
+}
+
+fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless::
+~ConfigurationHeadless()
+{
+  ConfigurationHeadlessPrivate *d;
+  d = static_cast<ConfigurationHeadlessPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+void
+fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless::
+swap(ConfigurationHeadless &obj)
+{
+  std::swap(m_d, obj.m_d);
+}
+
+fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless&
+fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless::
+operator=(const ConfigurationHeadless &rhs)
+{
+  if(this != &rhs)
+    {
+      ConfigurationHeadless v(rhs);
+      swap(v);
+    }
+  return *this;
+}
+
+#define setget_implement(type, name)                                    \
+  fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless&  \
+  fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless:: \
+  name(type v)                                                          \
+  {                                                                     \
+    ConfigurationHeadlessPrivate *d;                                    \
+    d = static_cast<ConfigurationHeadlessPrivate*>(m_d);                \
+    d->m_##name = v;                                                    \
+    return *this;                                                       \
+  }                                                                     \
+                                                                        \
+  type                                                                  \
+  fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless:: \
+  name(void) const                                                      \
+  {                                                                     \
+    ConfigurationHeadlessPrivate *d;                                    \
+    d = static_cast<ConfigurationHeadlessPrivate*>(m_d);                \
+    return d->m_##name;                                                 \
+  }
+
+setget_implement(unsigned int, attributes_per_buffer)
+setget_implement(unsigned int, indices_per_buffer)
+setget_implement(unsigned int, data_blocks_per_store_buffer)
+setget_implement(unsigned int, data_blocks_per_persistent_store)
+setget_implement(bool, break_on_shader_change)
+setget_implement(bool, short_indices)
+setget_implement(bool, compact_attributes)
+setget_implement(const fastuidraw::reference_counted_ptr<fastuidraw::ImageAtlas>&, image_atlas)
+setget_implement(const fastuidraw::reference_counted_ptr<fastuidraw::ColorStopAtlas>&, colorstop_atlas)
+setget_implement(const fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas>&, glyph_atlas)
+
+#undef setget_implement
+
+///////////////////////////////////////////////
+// fastuidraw::headless::PainterBackendHeadless methods
+fastuidraw::headless::PainterBackendHeadless::
+PainterBackendHeadless(const ConfigurationHeadless &config_headless,
+                       const ConfigurationBase &config_base):
+  PainterBackendGLSL(PainterBackendHeadlessPrivate::compute_glyph_atlas(config_headless),
+                     PainterBackendHeadlessPrivate::compute_image_atlas(config_headless),
+                     PainterBackendHeadlessPrivate::compute_colorstop_atlas(config_headless),
+                     glsl::PainterBackendGLSL::ConfigurationGLSL(),
+                     config_base)
+{
+  m_d = FASTUIDRAWnew PainterBackendHeadlessPrivate(config_headless, this);
+}
+
+fastuidraw::headless::PainterBackendHeadless::
+~PainterBackendHeadless()
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+const fastuidraw::headless::PainterBackendHeadless::ConfigurationHeadless&
+fastuidraw::headless::PainterBackendHeadless::
+configuration_headless(void) const
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  return d->m_params;
+}
+
+uint64_t
+fastuidraw::headless::PainterBackendHeadless::
+query_stat(enum stats_t st) const
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  FASTUIDRAWassert(st < num_stats);
+  return d->m_stats[st];
+}
+
+unsigned int
+fastuidraw::headless::PainterBackendHeadless::
+number_flushes(void) const
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  return d->m_number_flushes;
+}
+
+unsigned int
+fastuidraw::headless::PainterBackendHeadless::
+number_buffer_allocations(void) const
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  return d->m_pool->number_allocations();
+}
+
+uint32_t
+fastuidraw::headless::PainterBackendHeadless::
+compute_item_shader_group(PainterShader::Tag tag,
+                          const reference_counted_ptr<PainterItemShader> &shader)
+{
+  uint32_t return_value;
+
+  return_value = (configuration_headless().break_on_shader_change()) ? tag.m_ID : 0u;
+  if(configuration_headless().compact_attributes()
+     && shader->attribute_layout() == PainterItemShader::compact_attribute_layout)
+    {
+      return_value |= shader_group_compact_attributes_mask;
+    }
+  return return_value;
+}
+
+uint32_t
+fastuidraw::headless::PainterBackendHeadless::
+compute_blend_shader_group(PainterShader::Tag tag,
+                           const reference_counted_ptr<PainterBlendShader> &shader)
+{
+  FASTUIDRAWunused(shader);
+  return (configuration_headless().break_on_shader_change()) ? tag.m_ID : 0u;
+}
+
+unsigned int
+fastuidraw::headless::PainterBackendHeadless::
+attribs_per_mapping(void) const
+{
+  return configuration_headless().attributes_per_buffer();
+}
+
+unsigned int
+fastuidraw::headless::PainterBackendHeadless::
+indices_per_mapping(void) const
+{
+  return configuration_headless().indices_per_buffer();
+}
+
+void
+fastuidraw::headless::PainterBackendHeadless::
+on_pre_draw(void)
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  d->m_stats = vecN<uint64_t, num_stats>(0);
+
+  /* unmap_persistent_store() is called before on_pre_draw()
+   */
+  d->m_stats[num_persistent_generic_datas] = d->m_persistent_store_written;
+  d->m_stats[num_bytes] = d->m_persistent_store_written * sizeof(generic_data);
+  d->m_persistent_store_written = 0;
+}
+
+void
+fastuidraw::headless::PainterBackendHeadless::
+on_post_draw(void)
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  ++d->m_number_flushes;
+}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw>
+fastuidraw::headless::PainterBackendHeadless::
+map_draw(void)
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  return FASTUIDRAWnew DrawCommand(d);
+}
+
+fastuidraw::c_array<fastuidraw::generic_data>
+fastuidraw::headless::PainterBackendHeadless::
+map_persistent_store(void)
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  return make_c_array(d->m_persistent_store);
+}
+
+void
+fastuidraw::headless::PainterBackendHeadless::
+unmap_persistent_store(unsigned int data_store_written)
+{
+  PainterBackendHeadlessPrivate *d;
+  d = static_cast<PainterBackendHeadlessPrivate*>(m_d);
+  FASTUIDRAWassert(data_store_written <= d->m_persistent_store.size());
+  d->m_persistent_store_written = data_store_written;
+}
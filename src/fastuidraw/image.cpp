@@ -20,6 +20,7 @@
 #include <list>
 #include <map>
 #include <fastuidraw/image.hpp>
+#include <fastuidraw/util/trace.hpp>
 #include "private/array3d.hpp"
 #include "private/util_private.hpp"
 
@@ -979,6 +980,7 @@ flush(void) const
 {
   ImageAtlasPrivate *d;
   d = static_cast<ImageAtlasPrivate*>(m_d);
+  FASTUIDRAWtrace_scope("ImageAtlas::flush");
   autolock_mutex M(d->m_mutex);
   d->m_index_store->flush();
   d->m_color_store->flush();
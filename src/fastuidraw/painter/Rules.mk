@@ -11,9 +11,10 @@ include $(dir)/Rules.mk
 LIBRARY_SOURCES += $(call filelist, fill_rule.cpp \
 	painter_attribute_data.cpp \
 	painter_attribute_data_filler_glyphs.cpp \
+	painter_glyph_run_bounds.cpp \
 	painter_brush.cpp painter_stroke_params.cpp \
 	painter_dashed_stroke_params.cpp \
-	painter.cpp painter_enums.cpp \
+	painter.cpp painter_enums.cpp painter_frame_stats.cpp \
 	painter_shader_data.cpp \
 	painter_clip_equations.cpp \
 	painter_item_matrix.cpp painter_header.cpp \
@@ -29,6 +29,7 @@
 #include <fastuidraw/path.hpp>
 #include <fastuidraw/painter/filled_path.hpp>
 #include <fastuidraw/painter/painter_attribute_data.hpp>
+#include <fastuidraw/util/trace.hpp>
 #include "../private/util_private.hpp"
 #include "../private/util_private_ostream.hpp"
 #include "../private/bounding_box.hpp"
@@ -1037,6 +1038,9 @@ namespace
 
     fastuidraw::vecN<std::vector<fastuidraw::vec2>, 2> m_clip_scratch_vec2s;
     std::vector<float> m_clip_scratch_floats;
+
+    /* number of subsets culled by the last select_subsets() */
+    unsigned int m_number_culled;
   };
 
   class SubsetPrivate
@@ -1055,6 +1059,9 @@ namespace
     void
     make_ready(void);
 
+    uint64_t
+    memory_usage(void) const;
+
     fastuidraw::const_c_array<int>
     winding_numbers(void)
     {
@@ -2631,6 +2638,7 @@ select_subsets(ScratchSpacePrivate &scratch,
       scratch.m_adjusted_clip_eqs[i] = clip_equations[i] * clip_matrix_local;
     }
 
+  scratch.m_number_culled = 0;
   select_subsets_implement(scratch, dst, max_attribute_cnt, max_index_cnt, return_value);
   return return_value;
 }
@@ -2658,6 +2666,7 @@ select_subsets_implement(ScratchSpacePrivate &scratch,
   //completely clipped
   if(scratch.m_clipped_rect.empty())
     {
+      ++scratch.m_number_culled;
       return;
     }
 
@@ -2898,6 +2907,32 @@ make_ready_from_sub_path(void)
 
 }
 
+uint64_t
+SubsetPrivate::
+memory_usage(void) const
+{
+  uint64_t return_value(sizeof(SubsetPrivate));
+
+  if(m_painter_data)
+    {
+      return_value += m_painter_data->memory_usage();
+    }
+  if(m_fuzz_painter_data)
+    {
+      return_value += m_fuzz_painter_data->memory_usage();
+    }
+  return_value += m_winding_numbers.capacity() * sizeof(int);
+  for(const std::vector<int> &w : m_winding_neighbors)
+    {
+      return_value += sizeof(std::vector<int>) + w.capacity() * sizeof(int);
+    }
+  if(m_sub_path)
+    {
+      return_value += m_sub_path->total_points() * sizeof(SubPath::SubContourPoint);
+    }
+  return return_value;
+}
+
 /////////////////////////////////
 // FilledPathPrivate methods
 FilledPathPrivate::
@@ -2919,7 +2954,11 @@ FilledPathPrivate::
 fastuidraw::FilledPath::ScratchSpace::
 ScratchSpace(void)
 {
-  m_d = FASTUIDRAWnew ScratchSpacePrivate();
+  ScratchSpacePrivate *d;
+
+  d = FASTUIDRAWnew ScratchSpacePrivate();
+  d->m_number_culled = 0;
+  m_d = d;
 }
 
 fastuidraw::FilledPath::ScratchSpace::
@@ -2931,6 +2970,15 @@ fastuidraw::FilledPath::ScratchSpace::
   m_d = nullptr;
 }
 
+unsigned int
+fastuidraw::FilledPath::ScratchSpace::
+number_culled(void) const
+{
+  ScratchSpacePrivate *d;
+  d = static_cast<ScratchSpacePrivate*>(m_d);
+  return d->m_number_culled;
+}
+
 /////////////////////////////////
 // fastuidraw::FilledPath::Subset methods
 fastuidraw::FilledPath::Subset::
@@ -3039,6 +3087,20 @@ number_subsets(void) const
   return d->m_subsets.size();
 }
 
+uint64_t
+fastuidraw::FilledPath::
+memory_usage(void) const
+{
+  FilledPathPrivate *d;
+  uint64_t return_value(0);
+
+  d = static_cast<FilledPathPrivate*>(m_d);
+  for(const SubsetPrivate *s : d->m_subsets)
+    {
+      return_value += s->memory_usage();
+    }
+  return return_value;
+}
 
 fastuidraw::FilledPath::Subset
 fastuidraw::FilledPath::
@@ -3064,6 +3126,8 @@ select_subsets(ScratchSpace &work_room,
                unsigned int max_index_cnt,
                c_array<unsigned int> dst) const
 {
+  FASTUIDRAWtrace_scope("FilledPath::select_subsets");
+
   FilledPathPrivate *d;
   unsigned int return_value;
 
@@ -25,10 +25,12 @@ namespace
   {
   public:
     PerformanceHintsPrivate(void):
-      m_clipping_via_hw_clip_planes(true)
+      m_clipping_via_hw_clip_planes(true),
+      m_write_combined_buffers(false)
     {}
 
     bool m_clipping_via_hw_clip_planes;
+    bool m_write_combined_buffers;
   };
 
   class PainterBackendPrivate
@@ -105,6 +107,25 @@ clipping_via_hw_clip_planes(bool v)
   return *this;
 }
 
+bool
+fastuidraw::PainterBackend::PerformanceHints::
+write_combined_buffers(void) const
+{
+  PerformanceHintsPrivate *d;
+  d = static_cast<PerformanceHintsPrivate*>(m_d);
+  return d->m_write_combined_buffers;
+}
+
+fastuidraw::PainterBackend::PerformanceHints&
+fastuidraw::PainterBackend::PerformanceHints::
+write_combined_buffers(bool v)
+{
+  PerformanceHintsPrivate *d;
+  d = static_cast<PerformanceHintsPrivate*>(m_d);
+  d->m_write_combined_buffers = v;
+  return *this;
+}
+
 ///////////////////////////////////////////////////
 // fastuidraw::PainterBackend::ConfigurationBase methods
 fastuidraw::PainterBackend::ConfigurationBase::
@@ -227,6 +248,20 @@ hints(void) const
   return d->m_hints;
 }
 
+fastuidraw::c_array<fastuidraw::generic_data>
+fastuidraw::PainterBackend::
+map_persistent_store(void)
+{
+  return c_array<generic_data>();
+}
+
+void
+fastuidraw::PainterBackend::
+unmap_persistent_store(unsigned int data_store_written)
+{
+  FASTUIDRAWunused(data_store_written);
+}
+
 void
 fastuidraw::PainterBackend::
 register_shader(const reference_counted_ptr<PainterItemShader> &shader)
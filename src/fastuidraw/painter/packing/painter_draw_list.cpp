@@ -0,0 +1,124 @@
+/*!
+ * \file painter_draw_list.cpp
+ * \brief file painter_draw_list.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <fastuidraw/painter/packing/painter_draw_list.hpp>
+#include "../../private/painter_draw_list_private.hpp"
+
+////////////////////////////////////////////
+// fastuidraw::PainterDrawList methods
+fastuidraw::PainterDrawList::
+PainterDrawList(void)
+{
+  m_d = FASTUIDRAWnew detail::PainterDrawListPrivate();
+}
+
+fastuidraw::PainterDrawList::
+~PainterDrawList()
+{
+  detail::PainterDrawListPrivate *d;
+  d = static_cast<detail::PainterDrawListPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack>
+fastuidraw::PainterDrawList::
+patch_point(unsigned int id)
+{
+  return FASTUIDRAWnew detail::PainterDrawListPrivate::PatchPoint(id);
+}
+
+void
+fastuidraw::PainterDrawList::
+patch_item_matrix(unsigned int id, const PainterItemMatrix &value)
+{
+  detail::PainterDrawListPrivate *d;
+  d = static_cast<detail::PainterDrawListPrivate*>(m_d);
+
+  detail::PainterDrawListPrivate::patch &p(d->m_patches[id]);
+  p.m_has_item_matrix = true;
+  p.m_item_matrix = value;
+}
+
+void
+fastuidraw::PainterDrawList::
+patch_brush(unsigned int id, const PainterBrush &value)
+{
+  detail::PainterDrawListPrivate *d;
+  d = static_cast<detail::PainterDrawListPrivate*>(m_d);
+
+  detail::PainterDrawListPrivate::patch &p(d->m_patches[id]);
+  p.m_has_brush = true;
+  p.m_brush = value;
+}
+
+void
+fastuidraw::PainterDrawList::
+patch_z(unsigned int id, int z_offset)
+{
+  detail::PainterDrawListPrivate *d;
+  d = static_cast<detail::PainterDrawListPrivate*>(m_d);
+  d->m_patches[id].m_z_offset = z_offset;
+}
+
+void
+fastuidraw::PainterDrawList::
+clear_patches(void)
+{
+  detail::PainterDrawListPrivate *d;
+  d = static_cast<detail::PainterDrawListPrivate*>(m_d);
+  d->m_patches.clear();
+}
+
+void
+fastuidraw::PainterDrawList::
+clear(void)
+{
+  detail::PainterDrawListPrivate *d;
+  d = static_cast<detail::PainterDrawListPrivate*>(m_d);
+  d->clear_capture();
+  d->m_patches.clear();
+}
+
+bool
+fastuidraw::PainterDrawList::
+captured(void) const
+{
+  detail::PainterDrawListPrivate *d;
+  d = static_cast<detail::PainterDrawListPrivate*>(m_d);
+  return d->m_captured;
+}
+
+unsigned int
+fastuidraw::PainterDrawList::
+number_draws(void) const
+{
+  detail::PainterDrawListPrivate *d;
+  d = static_cast<detail::PainterDrawListPrivate*>(m_d);
+  return d->m_draws.size();
+}
+
+fastuidraw::range_type<int>
+fastuidraw::PainterDrawList::
+z_range(void) const
+{
+  detail::PainterDrawListPrivate *d;
+  d = static_cast<detail::PainterDrawListPrivate*>(m_d);
+  return d->m_z_range;
+}
@@ -20,11 +20,18 @@
 
 #include <vector>
 #include <list>
+#include <map>
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 
 #include <fastuidraw/painter/packing/painter_packer.hpp>
 #include <fastuidraw/painter/painter_header.hpp>
+#include <fastuidraw/painter/packing/painter_draw_list.hpp>
+#include <fastuidraw/util/trace.hpp>
 #include "../../private/util_private.hpp"
+#include "../../private/painter_draw_list_private.hpp"
+#include "../../private/bulk_copy.hpp"
 
 namespace
 {
@@ -74,10 +81,135 @@ namespace
     }
   };
 
-  /* QUESTION
-      - does the reference count to a pool need to be thread safe?
+  PainterShaderGroupPrivate
+  compute_shader_group(uint32_t brush_shader,
+                       const fastuidraw::reference_counted_ptr<fastuidraw::PainterBlendShader> &blend_shader,
+                       uint64_t blend_mode,
+                       const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &item_shader)
+  {
+    PainterShaderGroupPrivate return_value;
+    fastuidraw::PainterShader::Tag blend;
+
+    if(blend_shader)
+      {
+        blend = blend_shader->tag();
+      }
+    return_value.m_item_group = item_shader->group();
+    return_value.m_brush = brush_shader;
+    return_value.m_blend_group = blend.m_group;
+    return_value.m_blend_mode = blend_mode;
+    return return_value;
+  }
+
+  bool
+  requires_draw_break(uint32_t brush_shader_mask,
+                      const PainterShaderGroupPrivate &a,
+                      const PainterShaderGroupPrivate &b)
+  {
+    return a.m_item_group != b.m_item_group
+      || a.m_blend_group != b.m_blend_group
+      || (brush_shader_mask & (a.m_brush ^ b.m_brush)) != 0u
+      || a.m_blend_mode != b.m_blend_mode;
+  }
+
+  fastuidraw::detail::PainterDrawListPrivate::shader_group
+  make_shader_group(const fastuidraw::PainterShaderGroup &v)
+  {
+    fastuidraw::detail::PainterDrawListPrivate::shader_group return_value;
+
+    return_value.m_item_group = v.item_group();
+    return_value.m_brush = v.brush();
+    return_value.m_blend_group = v.blend_group();
+    return_value.m_blend_mode = v.packed_blend_mode();
+    return return_value;
+  }
+
+  PainterShaderGroupPrivate
+  make_shader_group(const fastuidraw::detail::PainterDrawListPrivate::shader_group &v)
+  {
+    PainterShaderGroupPrivate return_value;
+
+    return_value.m_item_group = v.m_item_group;
+    return_value.m_brush = v.m_brush;
+    return_value.m_blend_group = v.m_blend_group;
+    return_value.m_blend_mode = v.m_blend_mode;
+    return return_value;
+  }
+
+  bool
+  same_header(const fastuidraw::PainterHeader &a,
+              const fastuidraw::PainterHeader &b)
+  {
+    return a.m_clip_equations_location == b.m_clip_equations_location
+      && a.m_item_matrix_location == b.m_item_matrix_location
+      && a.m_brush_shader_data_location == b.m_brush_shader_data_location
+      && a.m_item_shader_data_location == b.m_item_shader_data_location
+      && a.m_blend_shader_data_location == b.m_blend_shader_data_location
+      && a.m_item_shader == b.m_item_shader
+      && a.m_brush_shader == b.m_brush_shader
+      && a.m_blend_shader == b.m_blend_shader
+      && a.m_z == b.m_z;
+  }
+
+  /* A reference count whose operations are atomic only if
+     the pool it belongs to is thread safe; when not, the
+     count is updated with plain (relaxed) loads and stores,
+     which cost the same as non-atomic operations.
+   */
+  class PackedValueCounter:fastuidraw::noncopyable
+  {
+  public:
+    PackedValueCounter(void):
+      m_value(0)
+    {}
+
+    void
+    add_reference(bool thread_safe)
+    {
+      if(thread_safe)
+        {
+          m_value.fetch_add(1, std::memory_order_relaxed);
+        }
+      else
+        {
+          m_value.store(m_value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+
+    /* returns true if the count is zero after the decrement */
+    bool
+    remove_reference(bool thread_safe)
+    {
+      int v;
+      if(thread_safe)
+        {
+          v = m_value.fetch_sub(1, std::memory_order_release) - 1;
+          if(v == 0)
+            {
+              std::atomic_thread_fence(std::memory_order_acquire);
+            }
+        }
+      else
+        {
+          v = m_value.load(std::memory_order_relaxed) - 1;
+          m_value.store(v, std::memory_order_relaxed);
+        }
+      FASTUIDRAWassert(v >= 0);
+      return v == 0;
+    }
+
+  private:
+    std::atomic<int> m_value;
+  };
+
+  /* A PoolBase holds the free slots of a pool as a stack
+     linked through m_next_free. If the pool is thread safe,
+     the head of the stack is changed with compare-and-swap;
+     the head packs a tag that is incremented on each change
+     with the slot index so that a pop racing with a pop and
+     push of the same slot (the ABA problem) fails its swap.
    */
-  class PoolBase:public fastuidraw::reference_counted<PoolBase>::non_concurrent
+  class PoolBase:fastuidraw::noncopyable
   {
   public:
     enum
@@ -85,69 +217,164 @@ namespace
         pool_size = 1024
       };
 
-    PoolBase(void):
-      m_free_slots_back(pool_size - 1)
+    explicit
+    PoolBase(bool thread_safe):
+      m_thread_safe(thread_safe),
+      m_free_head(pack_head(0, pool_size - 1)),
+      m_number_free(pool_size)
     {
-      for(unsigned int i = 0; i < pool_size; ++i)
+      /* slot i links to slot i - 1 so that slots are
+         given in the order 1023, 1022, ..., 0
+       */
+      for(int i = 0; i < pool_size; ++i)
         {
-          m_free_slots[i] = pool_size - 1 - i;
+          m_next_free[i].store(i - 1, std::memory_order_relaxed);
         }
     }
 
+    virtual
     ~PoolBase()
     {
-      FASTUIDRAWassert(m_free_slots_back == pool_size - 1);
+      FASTUIDRAWassert(number_free() == pool_size);
+    }
+
+    static
+    void
+    add_reference(const PoolBase *p)
+    {
+      FASTUIDRAWassert(p);
+      p->m_counter.add_reference(p->m_thread_safe);
+    }
+
+    static
+    void
+    remove_reference(const PoolBase *p)
+    {
+      FASTUIDRAWassert(p);
+      if(p->m_counter.remove_reference(p->m_thread_safe))
+        {
+          FASTUIDRAWdelete(p);
+        }
+    }
+
+    bool
+    thread_safe(void) const
+    {
+      return m_thread_safe;
     }
 
     int
     aquire_slot(void)
     {
-      /* Should we make this thread safe? We can make it
-         thread safe by using atomic operation on m_free_slots_back.
-         The following code would make it thread safe.
+      uint64_t head, new_head;
+      int slot;
 
-         return_value = m_free_slots_back.fetch_sub(1, std::memory_order_aquire)
-         if(return_value < 0)
-           {
-              m_free_slots_back.fetch_add(1, std::memory_order_aquire);
-           }
-         return return_value;
-       */
-      int return_value(-1);
+      head = m_free_head.load(std::memory_order_acquire);
+      if(!m_thread_safe)
+        {
+          slot = head_slot(head);
+          if(slot >= 0)
+            {
+              new_head = pack_head(head_tag(head), m_next_free[slot].load(std::memory_order_relaxed));
+              m_free_head.store(new_head, std::memory_order_relaxed);
+              m_number_free.store(m_number_free.load(std::memory_order_relaxed) - 1,
+                                  std::memory_order_relaxed);
+            }
+          return slot;
+        }
 
-      if(m_free_slots_back >= 0)
+      do
         {
-          return_value = m_free_slots[m_free_slots_back];
-          --m_free_slots_back;
+          slot = head_slot(head);
+          if(slot < 0)
+            {
+              return -1;
+            }
+          new_head = pack_head(head_tag(head) + 1, m_next_free[slot].load(std::memory_order_relaxed));
         }
-      return return_value;
+      while(!m_free_head.compare_exchange_weak(head, new_head,
+                                               std::memory_order_acquire,
+                                               std::memory_order_acquire));
+      m_number_free.fetch_sub(1, std::memory_order_relaxed);
+      return slot;
     }
 
     void
     release_slot(int v)
     {
-      /* Should we make this thread safe? We can make it
-         thread safe by using atomic operation on m_free_slots_back.
-         The following code would make it thread safe.
+      uint64_t head, new_head;
 
-         int S;
-         S = m_free_slots_back.fetch_add(1, std::memory_order_release);
-         std::atomic_thread_fence(std::memory_order_acquire);
-         FASTUIDRAWassert(S < pool_size);
-         m_free_slots[S] = v;
-       */
       FASTUIDRAWassert(v >= 0);
       FASTUIDRAWassert(v < pool_size);
 
-      ++m_free_slots_back;
+      head = m_free_head.load(std::memory_order_relaxed);
+      if(!m_thread_safe)
+        {
+          m_next_free[v].store(head_slot(head), std::memory_order_relaxed);
+          m_free_head.store(pack_head(head_tag(head), v), std::memory_order_relaxed);
+          m_number_free.store(m_number_free.load(std::memory_order_relaxed) + 1,
+                              std::memory_order_relaxed);
+          return;
+        }
+
+      do
+        {
+          m_next_free[v].store(head_slot(head), std::memory_order_relaxed);
+          new_head = pack_head(head_tag(head) + 1, v);
+        }
+      while(!m_free_head.compare_exchange_weak(head, new_head,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+      m_number_free.fetch_add(1, std::memory_order_relaxed);
+    }
 
-      FASTUIDRAWassert(m_free_slots_back < pool_size);
-      m_free_slots[m_free_slots_back] = v;
+    /* number of free slots; only an estimate if the pool
+       is used by several threads.
+     */
+    int
+    approximate_number_free(void) const
+    {
+      return m_number_free.load(std::memory_order_relaxed);
     }
 
   private:
-    int m_free_slots_back;
-    fastuidraw::vecN<int, pool_size> m_free_slots;
+    static
+    uint64_t
+    pack_head(uint32_t tag, int slot)
+    {
+      return (uint64_t(tag) << 32u) | uint64_t(uint32_t(slot));
+    }
+
+    static
+    uint32_t
+    head_tag(uint64_t head)
+    {
+      return uint32_t(head >> 32u);
+    }
+
+    static
+    int
+    head_slot(uint64_t head)
+    {
+      return int(uint32_t(head & 0xFFFFFFFFu));
+    }
+
+    int
+    number_free(void) const
+    {
+      int return_value(0);
+      for(int s = head_slot(m_free_head.load()); s >= 0; s = m_next_free[s].load())
+        {
+          ++return_value;
+        }
+      return return_value;
+    }
+
+    bool m_thread_safe;
+    mutable PackedValueCounter m_counter;
+    std::atomic<uint64_t> m_free_head;
+    fastuidraw::vecN<std::atomic<int>, pool_size> m_next_free;
+    std::atomic<int> m_number_free;
   };
 
   class EntryBase
@@ -164,7 +391,7 @@ namespace
     {
       FASTUIDRAWassert(m_pool);
       FASTUIDRAWassert(m_pool_slot >= 0);
-      m_count.add_reference();
+      m_count.add_reference(m_pool->thread_safe());
     }
 
     void
@@ -172,11 +399,18 @@ namespace
     {
       FASTUIDRAWassert(m_pool);
       FASTUIDRAWassert(m_pool_slot >= 0);
-      if(m_count.remove_reference())
+      if(m_count.remove_reference(m_pool->thread_safe()))
         {
-          m_pool->release_slot(m_pool_slot);
+          /* the slot can be handed to another thread as soon
+             as it is released, so the entry must be reset
+             before calling release_slot().
+           */
+          fastuidraw::reference_counted_ptr<PoolBase> pool;
+          int slot(m_pool_slot);
+
+          pool.swap(m_pool);
           m_pool_slot = -1;
-          m_pool = nullptr;
+          pool->release_slot(slot);
         }
     }
 
@@ -190,10 +424,22 @@ namespace
        already packed into PainterDraw::m_store
      */
     const fastuidraw::PainterPacker *m_painter;
-    std::vector<fastuidraw::generic_data> m_data;
     int m_begin_id;
     unsigned int m_draw_command_id, m_offset;
 
+    /* To what painter and where in the persistent
+       data store already packed
+     */
+    const fastuidraw::PainterPacker *m_persistent_painter;
+    int m_persistent_begin_id;
+    unsigned int m_persistent_offset;
+
+    /* the packed data, points into the arena of the pool
+       or, if the data does not fit in the room the arena
+       has for each slot, into m_overflow_data.
+     */
+    fastuidraw::c_array<fastuidraw::generic_data> m_data;
+
     /* how m_data is aligned
      */
     unsigned int m_alignment;
@@ -209,11 +455,11 @@ namespace
     fastuidraw::reference_counted_ptr<PoolBase> m_pool;
     int m_pool_slot;
 
+    std::vector<fastuidraw::generic_data> m_overflow_data;
+
   private:
-    /* Entry reference count is not thread safe because
-       the objects themselves are not.
-    */
-    fastuidraw::reference_count_non_concurrent m_count;
+    /* atomic only if m_pool is thread safe */
+    PackedValueCounter m_count;
   };
 
   template<typename T>
@@ -226,8 +472,11 @@ namespace
     }
 
     void
-    set(const T &st, int alignment, PoolBase *p, int slot)
+    set(const T &st, int alignment, PoolBase *p, int slot,
+        fastuidraw::c_array<fastuidraw::generic_data> arena_room)
     {
+      unsigned int sz;
+
       FASTUIDRAWassert(p);
       FASTUIDRAWassert(slot >= 0);
 
@@ -239,22 +488,89 @@ namespace
       this->m_draw_command_id = 0;
       this->m_offset = 0;
       this->m_painter = nullptr;
+      this->m_persistent_begin_id = -1;
+      this->m_persistent_offset = 0;
+      this->m_persistent_painter = nullptr;
       this->m_alignment = alignment;
-      this->m_data.resize(m_state.data_size(alignment));
-      m_state.pack_data(alignment, fastuidraw::make_c_array(this->m_data));
+
+      sz = m_state.data_size(alignment);
+      if(sz <= arena_room.size())
+        {
+          this->m_data = arena_room.sub_array(0, sz);
+        }
+      else
+        {
+          this->m_overflow_data.resize(sz);
+          this->m_data = fastuidraw::make_c_array(this->m_overflow_data);
+        }
+      m_state.pack_data(alignment, this->m_data);
     }
 
     T m_state;
   };
 
+  /* Room, in generic_data, that the arena of a Pool has for
+     each slot: the largest size the packed data of a T can
+     be. The size of the data of the shader data types has no
+     bound, for those the arena gives room for the data of
+     a few blocks and larger data is held by the Entry.
+   */
+  template<typename T>
+  unsigned int
+  arena_room_per_slot(unsigned int alignment)
+  {
+    return T().data_size(alignment);
+  }
+
+  template<>
+  unsigned int
+  arena_room_per_slot<fastuidraw::PainterBrush>(unsigned int alignment)
+  {
+    typedef fastuidraw::PainterBrush B;
+    using namespace fastuidraw;
+
+    return round_up_to_multiple(B::pen_data_size, alignment)
+      + round_up_to_multiple(B::image_data_size, alignment)
+      + round_up_to_multiple(t_max(B::linear_gradient_data_size,
+                                   B::radial_gradient_data_size), alignment)
+      + round_up_to_multiple(B::repeat_window_data_size, alignment)
+      + round_up_to_multiple(B::transformation_translation_data_size, alignment)
+      + round_up_to_multiple(B::transformation_matrix_data_size, alignment);
+  }
+
+  template<>
+  unsigned int
+  arena_room_per_slot<fastuidraw::PainterItemShaderData>(unsigned int alignment)
+  {
+    return 4 * alignment;
+  }
+
+  template<>
+  unsigned int
+  arena_room_per_slot<fastuidraw::PainterBlendShaderData>(unsigned int alignment)
+  {
+    return 4 * alignment;
+  }
+
+  /* A Pool holds the packed data of all its slots in a
+     single array (the arena) that is allocated with the
+     pool, instead of one heap allocation per Entry.
+   */
   template<typename T>
   class Pool:public PoolBase
   {
   public:
+    Pool(unsigned int alignment, bool thread_safe):
+      PoolBase(thread_safe),
+      m_alignment(alignment),
+      m_arena_room(arena_room_per_slot<T>(alignment)),
+      m_arena(m_arena_room * PoolBase::pool_size)
+    {}
+
     /* Returning nullptr indicates no free entries left in the pool
      */
     Entry<T>*
-    allocate(const T &st, int alignment)
+    allocate(const T &st)
     {
       Entry<T> *return_value(nullptr);
       int slot;
@@ -262,55 +578,144 @@ namespace
       slot = this->aquire_slot();
       if(slot >= 0)
         {
+          fastuidraw::c_array<fastuidraw::generic_data> room;
+
+          room = fastuidraw::make_c_array(m_arena).sub_array(slot * m_arena_room, m_arena_room);
           return_value = &m_data[slot];
-          return_value->set(st, alignment, this, slot);
+          return_value->set(st, m_alignment, this, slot, room);
         }
       return return_value;
     }
 
+    /* the pool created before this pool; the pools of a
+       PoolSet form a list through m_next that only grows
+       at its head, so a pool of the list stays alive as
+       long as the PoolSet.
+     */
+    fastuidraw::reference_counted_ptr<Pool<T> > m_next;
+
   private:
+    unsigned int m_alignment, m_arena_room;
+    std::vector<fastuidraw::generic_data> m_arena;
     fastuidraw::vecN<Entry<T>, PoolBase::pool_size> m_data;
   };
 
+  /* A PoolSet allocates from its current pool. When that is
+     full, the current pool becomes, with compare and swap, a
+     pool of the PoolSet that has at least half of its slots
+     free or, if there is none, a new pool. Reusing drained
+     pools bounds the number of pools (and thus of arenas) by
+     the peak number of live values instead of letting it grow
+     each time the number of live values crosses the size of
+     the current pool.
+   */
   template<typename T>
   class PoolSet:fastuidraw::noncopyable
   {
   public:
+    PoolSet(unsigned int alignment, bool thread_safe):
+      m_alignment(alignment),
+      m_thread_safe(thread_safe)
+    {
+      Pool<T> *p;
+
+      p = FASTUIDRAWnew Pool<T>(m_alignment, m_thread_safe);
+      PoolBase::add_reference(p);
+      m_head.store(p, std::memory_order_relaxed);
+      m_current.store(p, std::memory_order_relaxed);
+    }
 
-    PoolSet(void)
+    ~PoolSet()
     {
-      m_pools.push_back(FASTUIDRAWnew Pool<T>());
+      PoolBase::remove_reference(m_head.load(std::memory_order_acquire));
     }
 
     Entry<T>*
-    allocate(const T &st, int alignment)
+    allocate(const T &st)
     {
-      Entry<T> *return_value;
+      Entry<T> *return_value(nullptr);
+      Pool<T> *current;
 
-      return_value = m_pools.back()->allocate(st, alignment);
-      if(!return_value)
+      current = m_current.load(std::memory_order_acquire);
+      while(!(return_value = current->allocate(st)))
         {
-          m_pools.push_back(FASTUIDRAWnew Pool<T>());
-          return_value = m_pools.back()->allocate(st, alignment);
-        }
+          Pool<T> *p;
 
-      FASTUIDRAWassert(return_value);
+          p = choose_pool(current);
+          if(!m_current.compare_exchange_strong(current, p,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire))
+            {
+              /* another thread changed the current pool,
+                 current is now that pool.
+               */
+              continue;
+            }
+          current = p;
+        }
       return return_value;
     }
 
   private:
-    std::vector<fastuidraw::reference_counted_ptr<Pool<T> > > m_pools;
+    Pool<T>*
+    choose_pool(Pool<T> *full)
+    {
+      Pool<T> *p, *head;
+
+      head = m_head.load(std::memory_order_acquire);
+      for(p = head; p; p = p->m_next.get())
+        {
+          if(p != full && p->approximate_number_free() >= PoolBase::pool_size / 2)
+            {
+              return p;
+            }
+        }
+
+      /* push a new pool onto the list, pools are never
+         removed from the list so there is no ABA problem.
+       */
+      p = FASTUIDRAWnew Pool<T>(m_alignment, m_thread_safe);
+      PoolBase::add_reference(p);
+      do
+        {
+          p->m_next = head;
+        }
+      while(!m_head.compare_exchange_weak(head, p,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire));
+
+      /* p->m_next now holds the reference to head
+         that m_head held.
+       */
+      PoolBase::remove_reference(head);
+      return p;
+    }
+
+    unsigned int m_alignment;
+    bool m_thread_safe;
+
+    /* m_head holds a reference to the newest pool, m_current
+       points to a pool of the list starting at m_head.
+     */
+    std::atomic<Pool<T>*> m_head;
+    std::atomic<Pool<T>*> m_current;
   };
 
   class PainterPackedValuePoolPrivate
   {
   public:
-    explicit
-    PainterPackedValuePoolPrivate(int d):
-      m_alignment(d)
+    PainterPackedValuePoolPrivate(int d, bool thread_safe):
+      m_alignment(d),
+      m_thread_safe(thread_safe),
+      m_brush_pool(d, thread_safe),
+      m_clip_equations_pool(d, thread_safe),
+      m_item_matrix_pool(d, thread_safe),
+      m_item_shader_data_pool(d, thread_safe),
+      m_blend_shader_data_pool(d, thread_safe)
     {}
 
     int m_alignment;
+    bool m_thread_safe;
 
     PoolSet<fastuidraw::PainterBrush> m_brush_pool;
     PoolSet<fastuidraw::PainterClipEquations> m_clip_equations_pool;
@@ -331,124 +736,554 @@ namespace
 
   class PainterPackerPrivate;
 
-  class per_draw_command
+  /* A reorder_window holds the index data of a run of
+     consecutive draws that PainterPacker::reorder_opaque_draws()
+     allows to be reordered. The index data is bucketed by the
+     shader state of the draws; when the window is closed, the
+     index data is written grouped by bucket so that the draws
+     of a bucket need only one draw break.
+
+     With PainterPacker::front_to_back_opaque_draws(), the window
+     also holds the draws that are not opaque (but have no call
+     back); their index data is written after that of the opaque
+     draws in the order the draws were made and the opaque draws
+     of each bucket are written in decreasing z-value.
+   */
+  class reorder_window
   {
   public:
-    per_draw_command(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> &r,
-                     const fastuidraw::PainterBackend::ConfigurationBase &config);
-
-    unsigned int
-    attribute_room(void)
+    class bucket
     {
-      FASTUIDRAWassert(m_attributes_written <= m_draw_command->m_attributes.size());
-      return m_draw_command->m_attributes.size() - m_attributes_written;
-    }
+    public:
+      explicit
+      bucket(const PainterShaderGroupPrivate &state):
+        m_state(state),
+        m_number_indices(0),
+        m_write_location(0)
+      {}
+
+      PainterShaderGroupPrivate m_state;
+
+      /* number of indices of the opaque draws of the bucket */
+      unsigned int m_number_indices;
+      unsigned int m_write_location;
+    };
 
-    unsigned int
-    index_room(void)
+    class chunk
     {
-      FASTUIDRAWassert(m_indices_written <= m_draw_command->m_indices.size());
-      return m_draw_command->m_indices.size() - m_indices_written;
-    }
+    public:
+      unsigned int m_bucket;
+      fastuidraw::range_type<unsigned int> m_indices;
+      int m_z;
+      bool m_blended;
+    };
 
-    unsigned int
-    store_room(void)
+    /* sorts opaque chunks by decreasing z-value; std::stable_sort
+       keeps the order of the chunks of the same z-value.
+     */
+    class front_to_back
     {
-      unsigned int s;
-      s = store_written();
-      FASTUIDRAWassert(s <= m_draw_command->m_store.size());
-      return m_draw_command->m_store.size() - s;
-    }
+    public:
+      explicit
+      front_to_back(const std::vector<chunk> &chunks):
+        m_chunks(chunks)
+      {}
+
+      bool
+      operator()(unsigned int lhs, unsigned int rhs) const
+      {
+        return m_chunks[lhs].m_z > m_chunks[rhs].m_z;
+      }
+
+    private:
+      const std::vector<chunk> &m_chunks;
+    };
+
+    reorder_window(void):
+      m_current_bucket(0),
+      m_current_z(0),
+      m_current_blended(false),
+      m_brush_shader_mask(0),
+      m_front_to_back(false),
+      m_have_blended(false),
+      m_max_blended_z(0),
+      m_unsorted_breaks(0)
+    {}
 
+    /* returns m_buckets.size() if no bucket matches
+     */
     unsigned int
-    store_written(void)
+    find_bucket(const PainterShaderGroupPrivate &state) const
     {
-      return current_block() * m_alignment;
+      for(unsigned int i = 0, endi = m_buckets.size(); i < endi; ++i)
+        {
+          if(!requires_draw_break(m_brush_shader_mask, m_buckets[i].m_state, state))
+            {
+              return i;
+            }
+        }
+      return m_buckets.size();
     }
 
-    void
-    unmap(void)
+    /* Draws of different z-values can be drawn in any order
+       since the depth test then gives the same result. Draws of
+       the same z-value rely on draw order, so a draw can be added
+       only if all draws of the window with the same z-value are in
+       the bucket the draw goes to (the draws in a bucket keep
+       their order). The draws that are not opaque are emitted
+       after the opaque draws, so an opaque draw can be added only
+       if its z-value is larger than that of each draw of the
+       window that is not opaque.
+     */
+    bool
+    can_add(int z, const PainterShaderGroupPrivate &state) const
     {
-      m_draw_command->unmap(m_attributes_written, m_indices_written, store_written());
-    }
-
-    void
-    pack_painter_state(const fastuidraw::PainterPackerData &state,
-                       PainterPackerPrivate *p, painter_state_location &out_data);
-
-    unsigned int
-    pack_header(unsigned int header_size,
-                uint32_t brush_shader,
-                const fastuidraw::reference_counted_ptr<fastuidraw::PainterBlendShader> &blend_shader,
-                uint64_t blend_mode,
-                const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &item_shader,
-                int z,
-                const painter_state_location &loc,
-                const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back);
+      std::map<int, unsigned int>::const_iterator iter;
 
-    fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> m_draw_command;
-    unsigned int m_attributes_written, m_indices_written;
+      if(m_have_blended && z <= m_max_blended_z)
+        {
+          return false;
+        }
 
-  private:
-    fastuidraw::c_array<fastuidraw::generic_data>
-    allocate_store(unsigned int num_elements);
+      iter = m_z_buckets.find(z);
+      return iter == m_z_buckets.end()
+        || iter->second == find_bucket(state);
+    }
 
-    unsigned int
-    current_block(void)
+    bool
+    empty(void) const
     {
-      return m_store_blocks_written;
+      return m_chunks.empty() && m_buckets.empty();
     }
 
     void
-    pack_state_data(PainterPackerPrivate *p, EntryBase *st_d, uint32_t &location);
-
-    template<typename T>
-    void
-    pack_state_data_from_value(const T &st, uint32_t &location)
+    clear(void)
     {
-      fastuidraw::c_array<fastuidraw::generic_data> dst;
-      unsigned int data_sz;
-
-      location = current_block();
-      data_sz = st.data_size(m_alignment);
-      dst = allocate_store(data_sz);
-      st.pack_data(m_alignment, dst);
+      m_buckets.clear();
+      m_chunks.clear();
+      m_indices.clear();
+      m_z_buckets.clear();
+      m_have_blended = false;
+      m_unsorted_breaks = 0;
     }
 
-    template<typename T>
-    void
-    pack_state_data(PainterPackerPrivate *p,
-                    const fastuidraw::PainterData::value<T> &obj,
-                    uint32_t &location)
+    fastuidraw::c_array<fastuidraw::PainterIndex>
+    add_chunk(unsigned int num_indices)
     {
-      if(obj.m_packed_value)
-        {
-          EntryBase *e;
-          e = static_cast<EntryBase*>(obj.m_packed_value.opaque_data());
-          pack_state_data(p, e, location);
-        }
-      else if(obj.m_value != nullptr)
+      unsigned int loc(m_indices.size());
+
+      FASTUIDRAWassert(m_current_bucket < m_buckets.size());
+      m_indices.resize(loc + num_indices);
+      m_chunks.push_back(chunk());
+      m_chunks.back().m_bucket = m_current_bucket;
+      m_chunks.back().m_indices = fastuidraw::range_type<unsigned int>(loc, loc + num_indices);
+      m_chunks.back().m_z = m_current_z;
+      m_chunks.back().m_blended = m_current_blended;
+      if(!m_current_blended)
         {
-          pack_state_data_from_value(*obj.m_value, location);
-        }
-      else
-        {
-          static T v;
-          pack_state_data_from_value(v, location);
+          m_buckets[m_current_bucket].m_number_indices += num_indices;
         }
+      return fastuidraw::c_array<fastuidraw::PainterIndex>(&m_indices[loc], num_indices);
     }
 
-    unsigned int m_store_blocks_written;
-    unsigned int m_alignment;
-    uint32_t m_brush_shader_mask;
-    PainterShaderGroupPrivate m_prev_state;
-    fastuidraw::BlendMode m_prev_blend_mode;
+    std::vector<bucket> m_buckets;
+    std::vector<chunk> m_chunks;
+    std::vector<fastuidraw::PainterIndex> m_indices;
+    std::vector<unsigned int> m_bucket_order;
+
+    /* indices into m_chunks of the opaque chunks in the
+       order they are written
+     */
+    std::vector<unsigned int> m_chunk_order;
+
+    /* bucket, z-value and opacity of the draw being added */
+    unsigned int m_current_bucket;
+    int m_current_z;
+    bool m_current_blended;
+
+    uint32_t m_brush_shader_mask;
+
+    /* from PainterPacker::front_to_back_opaque_draws() */
+    bool m_front_to_back;
+
+    /* bucket of the opaque draws of each z-value in the window */
+    std::map<int, unsigned int> m_z_buckets;
+
+    /* largest z-value of the draws of the window that are not opaque */
+    bool m_have_blended;
+    int m_max_blended_z;
+
+    /* shader state and number of draw breaks if the
+       draws of the window were emitted in order
+     */
+    PainterShaderGroupPrivate m_unsorted_state;
+    unsigned int m_unsorted_breaks;
+  };
+
+  /* Arrays of the size of the arrays of a PainterDraw to which
+     a CaptureDraw is written.
+   */
+  class CaptureBuffers:
+    public fastuidraw::reference_counted<CaptureBuffers>::default_base
+  {
+  public:
+    std::vector<fastuidraw::PainterAttribute> m_attributes;
+    std::vector<fastuidraw::uvec4> m_compact_attributes;
+    std::vector<uint32_t> m_header_attributes;
+    std::vector<fastuidraw::PainterIndex> m_indices;
+    std::vector<fastuidraw::generic_data> m_store;
+  };
+
+  /* A CaptureBufferPool recycles the CaptureBuffers of the
+     CaptureDraw objects of a PainterPacker so that a capture
+     (in particular a small one, see Painter::begin_draw_capture())
+     does not allocate and clear arrays as large as those of
+     a PainterDraw. A CaptureDraw releases its buffers when it
+     is unmapped, which happens on the thread of the PainterPacker.
+   */
+  class CaptureBufferPool:
+    public fastuidraw::reference_counted<CaptureBufferPool>::default_base
+  {
+  public:
+    fastuidraw::reference_counted_ptr<CaptureBuffers>
+    acquire(const fastuidraw::PainterDraw &dst)
+    {
+      fastuidraw::reference_counted_ptr<CaptureBuffers> R;
+
+      if(m_free.empty())
+        {
+          R = FASTUIDRAWnew CaptureBuffers();
+        }
+      else
+        {
+          R = m_free.back();
+          m_free.pop_back();
+        }
+
+      /* the sizes only change if the backend changes
+         the sizes of its PainterDraw objects.
+       */
+      R->m_attributes.resize(dst.m_attributes.size());
+      R->m_compact_attributes.resize(dst.m_compact_attributes.size());
+      R->m_header_attributes.resize(dst.m_header_attributes.size());
+      R->m_indices.resize(dst.m_indices.empty() ?
+                          dst.m_short_indices.size() :
+                          dst.m_indices.size());
+      R->m_store.resize(dst.m_store.size());
+      return R;
+    }
+
+    void
+    release(const fastuidraw::reference_counted_ptr<CaptureBuffers> &h)
+    {
+      m_free.push_back(h);
+    }
+
+  private:
+    std::vector<fastuidraw::reference_counted_ptr<CaptureBuffers> > m_free;
+  };
+
+  /* PainterDraw used while capturing to a PainterDrawList: the
+     PainterPacker (and the DelayedAction objects added by callers)
+     write to the CaptureBuffers of the CaptureDraw and the content
+     is copied to the PainterDraw of the backend and to the
+     captured draw when all actions are complete.
+   */
+  class CaptureDraw:public fastuidraw::PainterDraw
+  {
+  public:
+    CaptureDraw(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> &dst,
+                fastuidraw::detail::PainterDrawListPrivate *list,
+                const fastuidraw::reference_counted_ptr<CaptureBufferPool> &pool,
+                bool streaming_stores);
+
+    virtual
+    void
+    draw_break(const fastuidraw::PainterShaderGroup &old_groups,
+               const fastuidraw::PainterShaderGroup &new_groups,
+               unsigned int attributes_written,
+               unsigned int indices_written) const;
+
+    virtual
+    void
+    draw(void) const
+    {
+      m_dst->draw();
+    }
+
+    fastuidraw::detail::PainterDrawListPrivate *m_list;
+    fastuidraw::detail::PainterDrawListPrivate::draw *m_captured;
+
+  protected:
+    virtual
+    void
+    unmap_implement(unsigned int attributes_written,
+                    unsigned int indices_written,
+                    unsigned int data_store_written) const;
+
+  private:
+    fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> m_dst;
+    fastuidraw::reference_counted_ptr<CaptureBufferPool> m_pool;
+
+    /* released to m_pool by unmap_implement() */
+    mutable fastuidraw::reference_counted_ptr<CaptureBuffers> m_buffers;
+    bool m_streaming_stores;
+  };
+
+  typedef fastuidraw::vecN<unsigned int, fastuidraw::PainterPacker::num_stats> packer_stats;
+
+  class per_draw_command
+  {
+  public:
+    per_draw_command(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> &r,
+                     const fastuidraw::PainterBackend::ConfigurationBase &config,
+                     bool streaming_stores, packer_stats *stats);
+
+    unsigned int
+    attribute_room(void)
+    {
+      FASTUIDRAWassert(m_attributes_written <= m_draw_command->m_attributes.size());
+      return m_draw_command->m_attributes.size() - m_attributes_written;
+    }
+
+    unsigned int
+    index_room(void)
+    {
+      FASTUIDRAWassert(m_indices_written + m_indices_pending <= index_capacity());
+      return index_capacity() - m_indices_written - m_indices_pending;
+    }
+
+    unsigned int
+    index_capacity(void)
+    {
+      return (m_short_indices) ?
+        m_draw_command->m_short_indices.size() :
+        m_draw_command->m_indices.size();
+    }
+
+    /* copies src, with offset added to each index, to the
+       indices of m_draw_command starting at index loc,
+       converting to 16-bits if necessary.
+     */
+    void
+    write_indices(unsigned int loc,
+                  fastuidraw::const_c_array<fastuidraw::PainterIndex> src,
+                  int offset = 0)
+    {
+      if(m_short_indices)
+        {
+          fastuidraw::detail::rebase_indices(m_draw_command->m_short_indices.sub_array(loc, src.size()),
+                                             src, offset, m_streaming_stores);
+        }
+      else
+        {
+          fastuidraw::detail::rebase_indices(m_draw_command->m_indices.sub_array(loc, src.size()),
+                                             src, offset, m_streaming_stores);
+        }
+    }
+
+    bool
+    streaming_stores(void) const
+    {
+      return m_streaming_stores;
+    }
+
+    /* true if the attributes of an item drawn with shader
+       are to be written to PainterDraw::m_compact_attributes
+     */
+    bool
+    compact_attributes(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader) const
+    {
+      return !m_draw_command->m_compact_attributes.empty()
+        && shader->attribute_layout() == fastuidraw::PainterItemShader::compact_attribute_layout;
+    }
+
+    unsigned int
+    store_room(void)
+    {
+      unsigned int s;
+      s = store_written();
+      FASTUIDRAWassert(s <= m_draw_command->m_store.size());
+      return m_draw_command->m_store.size() - s;
+    }
+
+    unsigned int
+    store_written(void)
+    {
+      return current_block() * m_alignment;
+    }
+
+    void
+    unmap(void)
+    {
+      if(m_capture)
+        {
+          m_capture->m_captured->m_final_groups = make_shader_group(m_prev_state);
+          m_capture->m_captured->m_compact_attributes_written = m_compact_attributes_written;
+        }
+      m_draw_command->unmap(m_attributes_written, m_indices_written, store_written());
+    }
+
+    void
+    pack_painter_state(const fastuidraw::PainterPackerData &state,
+                       PainterPackerPrivate *p, painter_state_location &out_data);
+
+    unsigned int
+    pack_header(unsigned int header_size,
+                uint32_t brush_shader,
+                const fastuidraw::reference_counted_ptr<fastuidraw::PainterBlendShader> &blend_shader,
+                uint64_t blend_mode,
+                const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &item_shader,
+                int z,
+                const painter_state_location &loc,
+                const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back,
+                reorder_window *window, bool &header_reused);
+
+    /* writes the index data of a reorder_window and
+       returns the number of draw breaks avoided.
+     */
+    unsigned int
+    close_reorder_window(reorder_window &window);
+
+    /* copies a draw of a PainterDrawList, applying the patches
+       and z-offset, to this per_draw_command that must be empty;
+       returns the number of headers whose patch was not applied.
+     */
+    unsigned int
+    replay(const fastuidraw::detail::PainterDrawListPrivate::draw &src,
+           const std::map<unsigned int, fastuidraw::detail::PainterDrawListPrivate::patch> &patches,
+           int z_offset);
+
+    bool
+    empty(void)
+    {
+      return m_attributes_written == 0 && m_indices_written == 0
+        && m_indices_pending == 0 && m_store_blocks_written == 0;
+    }
+
+    fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> m_draw_command;
+    unsigned int m_attributes_written, m_indices_written;
+
+    /* number of the m_attributes_written attributes that
+       were written to PainterDraw::m_compact_attributes
+     */
+    unsigned int m_compact_attributes_written;
+
+    /* number of indices held in a reorder_window
+       that are to be written to m_draw_command
+     */
+    unsigned int m_indices_pending;
+
+    /* true if m_draw_command takes 16-bit indices,
+       see PainterDraw::m_short_indices.
+     */
+    bool m_short_indices;
+
+    /* non-null if capturing to a PainterDrawList, in which
+       case it is the same object as m_draw_command.
+     */
+    const CaptureDraw *m_capture;
+
+  private:
+    fastuidraw::c_array<fastuidraw::generic_data>
+    allocate_store(unsigned int num_elements);
+
+    unsigned int
+    current_block(void)
+    {
+      return m_store_blocks_written;
+    }
+
+    void
+    pack_state_data(PainterPackerPrivate *p, EntryBase *st_d, uint32_t &location);
+
+    template<typename T>
+    void
+    pack_state_data_from_value(const T &st, uint32_t &location)
+    {
+      fastuidraw::c_array<fastuidraw::generic_data> dst;
+      unsigned int data_sz;
+
+      location = current_block();
+      data_sz = st.data_size(m_alignment);
+      dst = allocate_store(data_sz);
+      st.pack_data(m_alignment, dst);
+    }
+
+    template<typename T>
+    void
+    pack_state_data(PainterPackerPrivate *p,
+                    const fastuidraw::PainterData::value<T> &obj,
+                    uint32_t &location);
+
+    /* as above, and adds the generic_data values written to stat st */
+    template<typename T>
+    void
+    pack_state_data(PainterPackerPrivate *p,
+                    const fastuidraw::PainterData::value<T> &obj,
+                    uint32_t &location,
+                    enum fastuidraw::PainterPacker::stats_t st);
+
+    /* calls PainterDraw::draw_break() and counts the
+       draw break and its reasons in m_stats.
+     */
+    void
+    draw_break(const PainterShaderGroupPrivate &old_groups,
+               const PainterShaderGroupPrivate &new_groups,
+               unsigned int attributes_written,
+               unsigned int indices_written);
+
+    unsigned int m_store_blocks_written;
+    unsigned int m_alignment;
+    uint32_t m_brush_shader_mask;
+    PainterShaderGroupPrivate m_prev_state;
+    fastuidraw::BlendMode m_prev_blend_mode;
+
+    /* the last header packed to m_draw_command, it can
+       be reused by the next draw if the values match;
+       headers passed to a DataCallBack are never reused
+       because the call back may modify them.
+     */
+    fastuidraw::PainterHeader m_last_header;
+    unsigned int m_last_header_location;
+    bool m_last_header_reusable;
+
+    /* true if the buffers of m_draw_command are write-combined */
+    bool m_streaming_stores;
+
+    /* stats of the PainterPacker */
+    packer_stats *m_stats;
   };
 
   class PainterPackerPrivateWorkroom
   {
   public:
     std::vector<unsigned int> m_attribs_loaded;
+    reorder_window m_reorder_window;
+
+    /* work room to split a chunk that does not fit
+       into a single PainterDraw.
+     */
+    std::vector<fastuidraw::PainterAttribute> m_split_attributes;
+    std::vector<fastuidraw::PainterIndex> m_split_indices;
+    std::vector<unsigned int> m_split_locations;
+
+    /* the attributes and indices of the piece of a split
+       chunk that goes to the current PainterDraw; the
+       indices are into m_split_piece_attributes.
+     */
+    std::vector<fastuidraw::PainterAttribute> m_split_piece_attributes;
+    std::vector<fastuidraw::PainterIndex> m_split_piece_indices;
+
+    /* indices of a source that can only write 32-bit
+       indices, for a PainterDraw that takes 16-bit indices.
+     */
+    std::vector<fastuidraw::PainterIndex> m_short_index_staging;
+
+    /* attributes of a source that can only write full
+       attributes, for a shader with a compact attribute layout.
+     */
+    std::vector<fastuidraw::PainterAttribute> m_compact_attribute_staging;
   };
 
   class AttributeIndexSrcFromArray
@@ -457,11 +1292,13 @@ namespace
     AttributeIndexSrcFromArray(fastuidraw::const_c_array<fastuidraw::const_c_array<fastuidraw::PainterAttribute> > attrib_chunks,
                                fastuidraw::const_c_array<fastuidraw::const_c_array<fastuidraw::PainterIndex> > index_chunks,
                                fastuidraw::const_c_array<int> index_adjusts,
-                               fastuidraw::const_c_array<unsigned int> attrib_chunk_selector):
+                               fastuidraw::const_c_array<unsigned int> attrib_chunk_selector,
+                               bool streaming_stores):
       m_attrib_chunks(attrib_chunks),
       m_index_chunks(index_chunks),
       m_index_adjusts(index_adjusts),
-      m_attrib_chunk_selector(attrib_chunk_selector)
+      m_attrib_chunk_selector(attrib_chunk_selector),
+      m_streaming_stores(streaming_stores)
     {
       FASTUIDRAWassert((m_attrib_chunk_selector.empty() && m_attrib_chunks.size() == m_index_chunks.size())
              || (m_attrib_chunk_selector.size() == m_index_chunks.size()) );
@@ -503,8 +1340,9 @@ namespace
         m_attrib_chunk_selector[index_chunk];
     }
 
+    template<typename I>
     void
-    write_indices(fastuidraw::c_array<fastuidraw::PainterIndex> dst,
+    write_indices(fastuidraw::c_array<I> dst,
                   unsigned int index_offset_value,
                   unsigned int index_chunk) const
     {
@@ -514,11 +1352,17 @@ namespace
       src = m_index_chunks[index_chunk];
 
       FASTUIDRAWassert(dst.size() == src.size());
-      for(unsigned int i = 0; i < dst.size(); ++i)
+      #ifdef FASTUIDRAW_DEBUG
         {
-          FASTUIDRAWassert(int(src[i]) + m_index_adjusts[index_chunk] >= 0);
-          dst[i] = int(src[i] + index_offset_value) + m_index_adjusts[index_chunk];
+          for(unsigned int i = 0; i < src.size(); ++i)
+            {
+              FASTUIDRAWassert(int(src[i]) + m_index_adjusts[index_chunk] >= 0);
+            }
         }
+      #endif
+      fastuidraw::detail::rebase_indices(dst, src,
+                                         int(index_offset_value) + m_index_adjusts[index_chunk],
+                                         m_streaming_stores);
     }
 
     void
@@ -531,15 +1375,88 @@ namespace
       src = m_attrib_chunks[attribute_chunk];
 
       FASTUIDRAWassert(dst.size() == src.size());
-      std::memcpy(dst.c_ptr(), src.c_ptr(), sizeof(fastuidraw::PainterAttribute) * dst.size());
+      fastuidraw::detail::copy_attributes(dst, src, m_streaming_stores);
+    }
+
+    void
+    write_compact_attributes(fastuidraw::c_array<fastuidraw::uvec4> dst,
+                             unsigned int attribute_chunk) const
+    {
+      FASTUIDRAWassert(attribute_chunk < m_attrib_chunks.size());
+      fastuidraw::detail::copy_compact_attributes(dst, m_attrib_chunks[attribute_chunk],
+                                                  m_streaming_stores);
     }
 
     fastuidraw::const_c_array<fastuidraw::const_c_array<fastuidraw::PainterAttribute> > m_attrib_chunks;
     fastuidraw::const_c_array<fastuidraw::const_c_array<fastuidraw::PainterIndex> > m_index_chunks;
     fastuidraw::const_c_array<int> m_index_adjusts;
     fastuidraw::const_c_array<unsigned int> m_attrib_chunk_selector;
+
+    /* true if dst of write_indices() and write_attributes()
+       is write-combined memory.
+     */
+    bool m_streaming_stores;
   };
 
+  /* writes the indices of an index chunk to a PainterDraw
+     that takes 16-bit indices; a source that can only write
+     32-bit indices writes them to work_room first.
+   */
+  template<typename T>
+  void
+  write_short_indices(const T &src,
+                      fastuidraw::c_array<fastuidraw::PainterShortIndex> dst,
+                      unsigned int index_offset_value, unsigned int index_chunk,
+                      std::vector<fastuidraw::PainterIndex> &work_room,
+                      bool streaming_stores)
+  {
+    work_room.resize(dst.size());
+    src.write_indices(fastuidraw::make_c_array(work_room), index_offset_value, index_chunk);
+    fastuidraw::detail::rebase_indices(dst, fastuidraw::make_c_array(work_room), 0, streaming_stores);
+  }
+
+  void
+  write_short_indices(const AttributeIndexSrcFromArray &src,
+                      fastuidraw::c_array<fastuidraw::PainterShortIndex> dst,
+                      unsigned int index_offset_value, unsigned int index_chunk,
+                      std::vector<fastuidraw::PainterIndex> &work_room,
+                      bool streaming_stores)
+  {
+    FASTUIDRAWunused(work_room);
+    FASTUIDRAWunused(streaming_stores);
+    src.write_indices(dst, index_offset_value, index_chunk);
+  }
+
+  /* writes the attributes of an attribute chunk to a
+     PainterDraw::m_compact_attributes; a source that can
+     only write full attributes writes them to work_room
+     first.
+   */
+  template<typename T>
+  void
+  write_compact_attributes(const T &src,
+                           fastuidraw::c_array<fastuidraw::uvec4> dst,
+                           unsigned int attribute_chunk,
+                           std::vector<fastuidraw::PainterAttribute> &work_room,
+                           bool streaming_stores)
+  {
+    work_room.resize(dst.size());
+    src.write_attributes(fastuidraw::make_c_array(work_room), attribute_chunk);
+    fastuidraw::detail::copy_compact_attributes(dst, fastuidraw::make_c_array(work_room), streaming_stores);
+  }
+
+  void
+  write_compact_attributes(const AttributeIndexSrcFromArray &src,
+                           fastuidraw::c_array<fastuidraw::uvec4> dst,
+                           unsigned int attribute_chunk,
+                           std::vector<fastuidraw::PainterAttribute> &work_room,
+                           bool streaming_stores)
+  {
+    FASTUIDRAWunused(work_room);
+    FASTUIDRAWunused(streaming_stores);
+    src.write_compact_attributes(dst, attribute_chunk);
+  }
+
   class PainterPackerPrivate
   {
   public:
@@ -550,23 +1467,78 @@ namespace
     void
     start_new_command(void);
 
+    void
+    close_reorder_window(void);
+
+    bool
+    can_reorder(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                const fastuidraw::PainterPackerData &draw,
+                const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back);
+
+    bool
+    can_defer(const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back);
+
     void
     upload_draw_state(const fastuidraw::PainterPackerData &draw_state);
 
     unsigned int
     compute_room_needed_for_packing(const fastuidraw::PainterPackerData &draw_state);
 
+    /* values used for the fields of a PainterPackerData
+       that are not set; they are packed so that draws that
+       leave a field unset share the same location for it.
+     */
+    const fastuidraw::PainterData::value<fastuidraw::PainterBrush>&
+    default_value(const fastuidraw::PainterData::value<fastuidraw::PainterBrush>&)
+    {
+      return m_default_values.m_brush;
+    }
+
+    const fastuidraw::PainterData::value<fastuidraw::PainterItemShaderData>&
+    default_value(const fastuidraw::PainterData::value<fastuidraw::PainterItemShaderData>&)
+    {
+      return m_default_values.m_item_shader_data;
+    }
+
+    const fastuidraw::PainterData::value<fastuidraw::PainterBlendShaderData>&
+    default_value(const fastuidraw::PainterData::value<fastuidraw::PainterBlendShaderData>&)
+    {
+      return m_default_values.m_blend_shader_data;
+    }
+
+    const fastuidraw::PainterData::value<fastuidraw::PainterClipEquations>&
+    default_value(const fastuidraw::PainterData::value<fastuidraw::PainterClipEquations>&)
+    {
+      return m_default_values.m_clip;
+    }
+
+    const fastuidraw::PainterData::value<fastuidraw::PainterItemMatrix>&
+    default_value(const fastuidraw::PainterData::value<fastuidraw::PainterItemMatrix>&)
+    {
+      return m_default_values.m_matrix;
+    }
+
+    /* persistent_room is the room left in the persistent data
+       store that the values of the same draw have not yet used.
+     */
     template<typename T>
     unsigned int
-    compute_room_needed_for_packing(const fastuidraw::PainterData::value<T> &obj)
+    compute_room_needed_for_packing(const fastuidraw::PainterData::value<T> &obj,
+                                    unsigned int &persistent_room)
     {
       if(obj.m_packed_value)
         {
           EntryBase *d;
           d = static_cast<EntryBase*>(obj.m_packed_value.opaque_data());
-          if(d->m_painter == m_p && d->m_begin_id == m_number_begins
-             && d->m_draw_command_id == m_accumulated_draws.size())
+          if(in_persistent_store(d)
+             || (d->m_painter == m_p && d->m_begin_id == m_number_begins
+                 && d->m_draw_command_id == m_accumulated_draws.size()))
+            {
+              return 0;
+            }
+          else if(d->m_data.size() <= persistent_room)
             {
+              persistent_room -= d->m_data.size();
               return 0;
             }
           else
@@ -580,11 +1552,35 @@ namespace
         }
       else
         {
-          static T v;
-          return v.data_size(m_alignment);
+          return compute_room_needed_for_packing(default_value(obj), persistent_room);
         }
     };
 
+    /* the headers of a capture cannot refer to the
+       persistent store since it does not outlive the
+       frame.
+     */
+    bool
+    in_persistent_store(const EntryBase *d) const
+    {
+      return !m_capture
+        && d->m_persistent_painter == m_p
+        && d->m_persistent_begin_id == m_number_begins;
+    }
+
+    /* Returns true if the data of d is in the persistent
+       data store, packing it there if there is room; on
+       true, location is set to the location of the data.
+     */
+    bool
+    pack_persistent_state_data(EntryBase *d, uint32_t &location);
+
+    void
+    map_persistent_store(void);
+
+    void
+    unmap_persistent_store(void);
+
     template<typename T>
     void
     draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
@@ -593,37 +1589,187 @@ namespace
                            int z,
                            const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back);
 
+    unsigned int
+    pack_header(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                const fastuidraw::PainterPackerData &data,
+                int z,
+                const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back,
+                reorder_window *window);
+
+    template<typename T>
+    void
+    draw_split_chunk(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                     const fastuidraw::PainterPackerData &data,
+                     const T &src, unsigned int chunk,
+                     int z,
+                     const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back);
+
+    void
+    write_split_piece(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                      unsigned int header_loc);
+
     fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> m_backend;
     fastuidraw::PainterShaderSet m_default_shaders;
     unsigned int m_alignment;
     unsigned int m_header_size;
 
+    fastuidraw::PainterPackedValuePool m_default_values_pool;
+    fastuidraw::PainterPackerData m_default_values;
+
     fastuidraw::reference_counted_ptr<fastuidraw::PainterBlendShader> m_blend_shader;
     uint64_t m_blend_mode;
+    bool m_blend_is_src_or_src_over;
+    bool m_reorder_opaque_draws;
+    bool m_front_to_back_opaque_draws;
+
+    /* from PainterBackend::PerformanceHints::write_combined_buffers() */
+    bool m_streaming_stores;
+
+    /* PainterDrawList being captured to, if any */
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterDrawList> m_capture;
+    fastuidraw::detail::PainterDrawListPrivate *m_capture_data;
+    fastuidraw::reference_counted_ptr<CaptureBufferPool> m_capture_buffers;
     painter_state_location m_painter_state_location;
     int m_number_begins;
 
+    /* persistent data store of the current begin()/end()
+       pair and the number of blocks written to it.
+     */
+    fastuidraw::c_array<fastuidraw::generic_data> m_persistent_store;
+    unsigned int m_persistent_store_blocks_written;
+
     std::vector<per_draw_command> m_accumulated_draws;
     fastuidraw::PainterPacker *m_p;
 
     PainterPackerPrivateWorkroom m_work_room;
-    fastuidraw::vecN<unsigned int, fastuidraw::PainterPacker::num_stats> m_stats;
+    packer_stats m_stats;
   };
 }
 
 
+//////////////////////////////////////////
+// CaptureDraw methods
+CaptureDraw::
+CaptureDraw(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> &dst,
+            fastuidraw::detail::PainterDrawListPrivate *list,
+            const fastuidraw::reference_counted_ptr<CaptureBufferPool> &pool,
+            bool streaming_stores):
+  m_list(list),
+  m_dst(dst),
+  m_pool(pool),
+  m_streaming_stores(streaming_stores)
+{
+  m_list->m_draws.push_back(fastuidraw::detail::PainterDrawListPrivate::draw());
+  m_captured = &m_list->m_draws.back();
+  m_captured->m_compact_attributes_written = 0;
+
+  m_buffers = m_pool->acquire(*m_dst);
+  m_attributes = fastuidraw::make_c_array(m_buffers->m_attributes);
+  m_compact_attributes = fastuidraw::make_c_array(m_buffers->m_compact_attributes);
+  m_header_attributes = fastuidraw::make_c_array(m_buffers->m_header_attributes);
+  m_indices = fastuidraw::make_c_array(m_buffers->m_indices);
+  m_store = fastuidraw::make_c_array(m_buffers->m_store);
+}
+
+void
+CaptureDraw::
+draw_break(const fastuidraw::PainterShaderGroup &old_groups,
+           const fastuidraw::PainterShaderGroup &new_groups,
+           unsigned int attributes_written,
+           unsigned int indices_written) const
+{
+  fastuidraw::detail::PainterDrawListPrivate::draw_break B;
+
+  B.m_old_groups = make_shader_group(old_groups);
+  B.m_new_groups = make_shader_group(new_groups);
+  B.m_attributes_written = attributes_written;
+  B.m_indices_written = indices_written;
+  m_captured->m_draw_breaks.push_back(B);
+
+  m_dst->draw_break(old_groups, new_groups, attributes_written, indices_written);
+}
+
+void
+CaptureDraw::
+unmap_implement(unsigned int attributes_written,
+                unsigned int indices_written,
+                unsigned int data_store_written) const
+{
+  fastuidraw::detail::PainterDrawListPrivate::draw &c(*m_captured);
+  const CaptureBuffers &b(*m_buffers);
+
+  /* the content is final, copy it to the PainterDraw of
+     the backend and keep what was written in the captured
+     draw.
+   */
+  fastuidraw::detail::copy_attributes(m_dst->m_attributes.sub_array(0, attributes_written),
+                                      fastuidraw::make_c_array(b.m_attributes).sub_array(0, attributes_written),
+                                      m_streaming_stores);
+  if(!b.m_compact_attributes.empty())
+    {
+      /* the capture does not track which locations are compact,
+         so both arrays are copied in full.
+       */
+      std::copy(b.m_compact_attributes.begin(), b.m_compact_attributes.begin() + attributes_written,
+                m_dst->m_compact_attributes.begin());
+    }
+  std::copy(b.m_header_attributes.begin(), b.m_header_attributes.begin() + attributes_written,
+            m_dst->m_header_attributes.begin());
+  if(m_dst->m_indices.empty())
+    {
+      fastuidraw::detail::rebase_indices(m_dst->m_short_indices.sub_array(0, indices_written),
+                                         fastuidraw::make_c_array(b.m_indices).sub_array(0, indices_written),
+                                         0, m_streaming_stores);
+    }
+  else
+    {
+      fastuidraw::detail::rebase_indices(m_dst->m_indices.sub_array(0, indices_written),
+                                         fastuidraw::make_c_array(b.m_indices).sub_array(0, indices_written),
+                                         0, m_streaming_stores);
+    }
+  std::copy(b.m_store.begin(), b.m_store.begin() + data_store_written,
+            m_dst->m_store.begin());
+  m_dst->unmap(attributes_written, indices_written, data_store_written);
+
+  c.m_attributes.assign(b.m_attributes.begin(), b.m_attributes.begin() + attributes_written);
+  if(!b.m_compact_attributes.empty())
+    {
+      c.m_compact_attributes.assign(b.m_compact_attributes.begin(),
+                                    b.m_compact_attributes.begin() + attributes_written);
+    }
+  c.m_header_attributes.assign(b.m_header_attributes.begin(), b.m_header_attributes.begin() + attributes_written);
+  c.m_indices.assign(b.m_indices.begin(), b.m_indices.begin() + indices_written);
+  c.m_store.assign(b.m_store.begin(), b.m_store.begin() + data_store_written);
+
+  m_pool->release(m_buffers);
+  m_buffers = fastuidraw::reference_counted_ptr<CaptureBuffers>();
+}
+
 //////////////////////////////////////////
 // per_draw_command methods
 per_draw_command::
 per_draw_command(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> &r,
-                 const fastuidraw::PainterBackend::ConfigurationBase &config):
+                 const fastuidraw::PainterBackend::ConfigurationBase &config,
+                 bool streaming_stores, packer_stats *stats):
   m_draw_command(r),
   m_attributes_written(0),
   m_indices_written(0),
+  m_compact_attributes_written(0),
+  m_indices_pending(0),
+  m_short_indices(r->m_indices.empty()),
+  m_capture(nullptr),
   m_store_blocks_written(0),
   m_alignment(config.alignment()),
-  m_brush_shader_mask(config.brush_shader_mask())
+  m_brush_shader_mask(config.brush_shader_mask()),
+  m_last_header(),
+  m_last_header_location(0),
+  m_last_header_reusable(false),
+  m_streaming_stores(streaming_stores),
+  m_stats(stats)
 {
+  FASTUIDRAWassert(r->m_indices.empty() != r->m_short_indices.empty());
+  FASTUIDRAWassert(r->m_compact_attributes.empty()
+                   || r->m_compact_attributes.size() == r->m_attributes.size());
   m_prev_state.m_item_group = 0;
   m_prev_state.m_brush = 0;
   m_prev_state.m_blend_group = 0;
@@ -654,6 +1800,11 @@ pack_state_data(PainterPackerPrivate *p,
       return;
     }
 
+  if(p->pack_persistent_state_data(d, location))
+    {
+      return;
+    }
+
   /* data not in current data store add
      it to the current store.
    */
@@ -661,7 +1812,7 @@ pack_state_data(PainterPackerPrivate *p,
   fastuidraw::c_array<fastuidraw::generic_data> dst;
 
   location = current_block();
-  src = fastuidraw::make_c_array(d->m_data);
+  src = d->m_data;
   dst = allocate_store(src.size());
   std::copy(src.begin(), src.end(), dst.begin());
 
@@ -671,16 +1822,93 @@ pack_state_data(PainterPackerPrivate *p,
   d->m_offset = location;
 }
 
+template<typename T>
+void
+per_draw_command::
+pack_state_data(PainterPackerPrivate *p,
+                const fastuidraw::PainterData::value<T> &obj,
+                uint32_t &location)
+{
+  if(obj.m_packed_value)
+    {
+      EntryBase *e;
+      e = static_cast<EntryBase*>(obj.m_packed_value.opaque_data());
+      pack_state_data(p, e, location);
+    }
+  else if(obj.m_value != nullptr)
+    {
+      pack_state_data_from_value(*obj.m_value, location);
+    }
+  else
+    {
+      pack_state_data(p, p->default_value(obj), location);
+    }
+}
+
+template<typename T>
+void
+per_draw_command::
+pack_state_data(PainterPackerPrivate *p,
+                const fastuidraw::PainterData::value<T> &obj,
+                uint32_t &location,
+                enum fastuidraw::PainterPacker::stats_t st)
+{
+  unsigned int start;
+
+  /* the value goes either to the store of m_draw_command
+     or to the persistent store, or nowhere if it is
+     already present in either.
+   */
+  start = store_written() + (*m_stats)[fastuidraw::PainterPacker::num_persistent_generic_datas];
+  pack_state_data(p, obj, location);
+  (*m_stats)[st] += store_written()
+    + (*m_stats)[fastuidraw::PainterPacker::num_persistent_generic_datas] - start;
+}
+
 void
 per_draw_command::
 pack_painter_state(const fastuidraw::PainterPackerData &state,
                    PainterPackerPrivate *p, painter_state_location &out_data)
 {
-  pack_state_data(p, state.m_clip, out_data.m_clipping_data_loc);
-  pack_state_data(p, state.m_matrix, out_data.m_item_matrix_data_loc);
-  pack_state_data(p, state.m_item_shader_data, out_data.m_item_shader_data_loc);
-  pack_state_data(p, state.m_blend_shader_data, out_data.m_blend_shader_data_loc);
-  pack_state_data(p, state.m_brush, out_data.m_brush_shader_data_loc);
+  pack_state_data(p, state.m_clip, out_data.m_clipping_data_loc,
+                  fastuidraw::PainterPacker::num_clip_generic_datas);
+  pack_state_data(p, state.m_matrix, out_data.m_item_matrix_data_loc,
+                  fastuidraw::PainterPacker::num_item_matrix_generic_datas);
+  pack_state_data(p, state.m_item_shader_data, out_data.m_item_shader_data_loc,
+                  fastuidraw::PainterPacker::num_item_shader_generic_datas);
+  pack_state_data(p, state.m_blend_shader_data, out_data.m_blend_shader_data_loc,
+                  fastuidraw::PainterPacker::num_blend_shader_generic_datas);
+  pack_state_data(p, state.m_brush, out_data.m_brush_shader_data_loc,
+                  fastuidraw::PainterPacker::num_brush_generic_datas);
+}
+
+void
+per_draw_command::
+draw_break(const PainterShaderGroupPrivate &old_groups,
+           const PainterShaderGroupPrivate &new_groups,
+           unsigned int attributes_written,
+           unsigned int indices_written)
+{
+  packer_stats &stats(*m_stats);
+
+  ++stats[fastuidraw::PainterPacker::num_draw_breaks];
+  if(old_groups.m_item_group != new_groups.m_item_group)
+    {
+      ++stats[fastuidraw::PainterPacker::num_draw_breaks_item_group];
+    }
+  if(old_groups.m_blend_group != new_groups.m_blend_group)
+    {
+      ++stats[fastuidraw::PainterPacker::num_draw_breaks_blend_group];
+    }
+  if((m_brush_shader_mask & (old_groups.m_brush ^ new_groups.m_brush)) != 0u)
+    {
+      ++stats[fastuidraw::PainterPacker::num_draw_breaks_brush];
+    }
+  if(old_groups.m_blend_mode != new_groups.m_blend_mode)
+    {
+      ++stats[fastuidraw::PainterPacker::num_draw_breaks_blend_mode];
+    }
+  m_draw_command->draw_break(old_groups, new_groups, attributes_written, indices_written);
 }
 
 unsigned int
@@ -692,20 +1920,12 @@ pack_header(unsigned int header_size,
             const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &item_shader,
             int z,
             const painter_state_location &loc,
-            const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back)
+            const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back,
+            reorder_window *window, bool &header_reused)
 {
   unsigned int return_value;
   fastuidraw::c_array<fastuidraw::generic_data> dst;
   fastuidraw::PainterHeader header;
-
-  return_value = current_block();
-  dst = allocate_store(header_size);
-
-  if(call_back)
-    {
-      call_back->current_draw(m_draw_command);
-    }
-
   PainterShaderGroupPrivate current;
   fastuidraw::PainterShader::Tag blend;
 
@@ -713,10 +1933,7 @@ pack_header(unsigned int header_size,
     {
       blend = blend_shader->tag();
     }
-  current.m_item_group = item_shader->group();
-  current.m_brush = brush_shader;
-  current.m_blend_group = blend.m_group;
-  current.m_blend_mode = blend_mode;
+  current = compute_shader_group(brush_shader, blend_shader, blend_mode, item_shader);
 
   header.m_clip_equations_location = loc.m_clipping_data_loc;
   header.m_item_matrix_location = loc.m_item_matrix_data_loc;
@@ -727,26 +1944,370 @@ pack_header(unsigned int header_size,
   header.m_brush_shader = current.m_brush;
   header.m_blend_shader = blend.m_ID;
   header.m_z = z;
-  header.pack_data(m_alignment, dst);
 
-  if(current.m_item_group != m_prev_state.m_item_group
-     || current.m_blend_group != m_prev_state.m_blend_group
-     || (m_brush_shader_mask & (current.m_brush ^ m_prev_state.m_brush)) != 0u
-     || current.m_blend_mode != m_prev_state.m_blend_mode)
+  header_reused = !call_back && m_last_header_reusable
+    && same_header(header, m_last_header);
+
+  if(header_reused)
+    {
+      return_value = m_last_header_location;
+    }
+  else
+    {
+      return_value = current_block();
+      dst = allocate_store(header_size);
+      header.pack_data(m_alignment, dst);
+
+      m_last_header = header;
+      m_last_header_location = return_value;
+      m_last_header_reusable = !call_back;
+
+      if(m_capture)
+        {
+          const fastuidraw::detail::PainterDrawListPrivate::PatchPoint *patch_point;
+
+          m_capture->m_captured->m_headers.push_back(return_value);
+          m_capture->m_list->add_z(z);
+
+          patch_point = dynamic_cast<const fastuidraw::detail::PainterDrawListPrivate::PatchPoint*>(call_back.get());
+          if(patch_point)
+            {
+              fastuidraw::detail::PainterDrawListPrivate::patch_header P;
+              P.m_id = patch_point->m_id;
+              P.m_location = return_value;
+              P.m_header = header;
+              m_capture->m_captured->m_patch_headers.push_back(P);
+            }
+        }
+    }
+
+  if(call_back)
+    {
+      call_back->current_draw(m_draw_command);
+    }
+
+  if(window)
+    {
+      /* the draw break is issued when the window is closed,
+         find (or create) the bucket for the draw and track
+         the draw breaks if the window were not reordered.
+       */
+      if(window->empty())
+        {
+          window->m_unsorted_state = m_prev_state;
+        }
+
+      if(requires_draw_break(m_brush_shader_mask, window->m_unsorted_state, current))
+        {
+          ++window->m_unsorted_breaks;
+        }
+      window->m_unsorted_state = current;
+
+      window->m_current_bucket = window->find_bucket(current);
+      if(window->m_current_bucket == window->m_buckets.size())
+        {
+          window->m_buckets.push_back(reorder_window::bucket(current));
+        }
+      window->m_current_z = z;
+      if(window->m_current_blended)
+        {
+          window->m_max_blended_z = (window->m_have_blended) ?
+            fastuidraw::t_max(window->m_max_blended_z, z) : z;
+          window->m_have_blended = true;
+        }
+      else
+        {
+          window->m_z_buckets[z] = window->m_current_bucket;
+        }
+    }
+  else
+    {
+      if(requires_draw_break(m_brush_shader_mask, m_prev_state, current))
+        {
+          draw_break(m_prev_state, current,
+                     m_attributes_written,
+                     m_indices_written);
+        }
+      m_prev_state = current;
+    }
+
+  if(call_back)
+    {
+      call_back->header_added(header, dst);
+    }
+
+  return return_value;
+}
+
+unsigned int
+per_draw_command::
+replay(const fastuidraw::detail::PainterDrawListPrivate::draw &src,
+       const std::map<unsigned int, fastuidraw::detail::PainterDrawListPrivate::patch> &patches,
+       int z_offset)
+{
+  typedef fastuidraw::detail::PainterDrawListPrivate::patch patch;
+  typedef fastuidraw::detail::PainterDrawListPrivate::patch_header patch_header;
+
+  unsigned int return_value(0);
+  fastuidraw::c_array<fastuidraw::generic_data> store;
+
+  FASTUIDRAWassert(empty());
+  if(src.m_attributes.size() > m_draw_command->m_attributes.size()
+     || src.m_compact_attributes.empty() != m_draw_command->m_compact_attributes.empty()
+     || src.m_indices.size() > index_capacity()
+     || src.m_store.size() > m_draw_command->m_store.size())
+    {
+      FASTUIDRAWassert(!"PainterDrawList captured with a PainterBackend with larger buffers");
+      return src.m_patch_headers.size();
+    }
+
+  fastuidraw::detail::copy_attributes(m_draw_command->m_attributes.sub_array(0, src.m_attributes.size()),
+                                      fastuidraw::make_c_array(src.m_attributes),
+                                      m_streaming_stores);
+  std::copy(src.m_compact_attributes.begin(), src.m_compact_attributes.end(), m_draw_command->m_compact_attributes.begin());
+  std::copy(src.m_header_attributes.begin(), src.m_header_attributes.end(), m_draw_command->m_header_attributes.begin());
+  write_indices(0, fastuidraw::make_c_array(src.m_indices));
+  std::copy(src.m_store.begin(), src.m_store.end(), m_draw_command->m_store.begin());
+  m_attributes_written = src.m_attributes.size();
+  m_compact_attributes_written = src.m_compact_attributes_written;
+  m_indices_written = src.m_indices.size();
+  m_store_blocks_written = src.m_store.size() / m_alignment;
+
+  for(const fastuidraw::detail::PainterDrawListPrivate::draw_break &B : src.m_draw_breaks)
+    {
+      draw_break(make_shader_group(B.m_old_groups),
+                 make_shader_group(B.m_new_groups),
+                 B.m_attributes_written,
+                 B.m_indices_written);
+    }
+  m_prev_state = make_shader_group(src.m_final_groups);
+
+  /* the headers are patched in place, thus none of them can be
+     reused by the draws that are packed after the replay.
+   */
+  m_last_header_reusable = false;
+
+  store = m_draw_command->m_store;
+  for(unsigned int loc : src.m_headers)
+    {
+      store[loc * m_alignment + fastuidraw::PainterHeader::z_offset].i += z_offset;
+    }
+
+  /* a patched value is packed at most once per draw */
+  std::map<unsigned int, uint32_t> item_matrix_locations, brush_locations;
+  for(const patch_header &P : src.m_patch_headers)
+    {
+      std::map<unsigned int, patch>::const_iterator iter;
+      fastuidraw::c_array<fastuidraw::generic_data> header;
+
+      iter = patches.find(P.m_id);
+      if(iter == patches.end())
+        {
+          continue;
+        }
+
+      const patch &value(iter->second);
+      header = store.sub_array(P.m_location * m_alignment,
+                               fastuidraw::PainterHeader::data_size(m_alignment));
+      header[fastuidraw::PainterHeader::z_offset].i += value.m_z_offset;
+
+      if(value.m_has_item_matrix)
+        {
+          std::map<unsigned int, uint32_t>::iterator loc;
+
+          loc = item_matrix_locations.find(P.m_id);
+          if(loc == item_matrix_locations.end()
+             && value.m_item_matrix.data_size(m_alignment) <= store_room())
+            {
+              uint32_t L;
+              pack_state_data_from_value(value.m_item_matrix, L);
+              loc = item_matrix_locations.insert(std::make_pair(P.m_id, L)).first;
+            }
+
+          if(loc != item_matrix_locations.end())
+            {
+              header[fastuidraw::PainterHeader::item_matrix_location_offset].u = loc->second;
+            }
+          else
+            {
+              ++return_value;
+            }
+        }
+
+      if(value.m_has_brush)
+        {
+          std::map<unsigned int, uint32_t>::iterator loc;
+
+          loc = brush_locations.find(P.m_id);
+          if(value.m_brush.shader() != P.m_header.m_brush_shader)
+            {
+              loc = brush_locations.end();
+            }
+          else if(loc == brush_locations.end()
+                  && value.m_brush.data_size(m_alignment) <= store_room())
+            {
+              uint32_t L;
+              pack_state_data_from_value(value.m_brush, L);
+              loc = brush_locations.insert(std::make_pair(P.m_id, L)).first;
+            }
+
+          if(loc != brush_locations.end())
+            {
+              header[fastuidraw::PainterHeader::brush_shader_data_location_offset].u = loc->second;
+            }
+          else
+            {
+              ++return_value;
+            }
+        }
+    }
+  return return_value;
+}
+
+unsigned int
+per_draw_command::
+close_reorder_window(reorder_window &window)
+{
+  unsigned int sorted_breaks(0), loc(m_indices_written);
+  bool have_blended(false);
+
+  FASTUIDRAWassert(m_indices_pending == window.m_indices.size());
+
+  /* the opaque chunks in the order they are written: in the
+     order they were added or, for front to back, in decreasing
+     z-value.
+   */
+  window.m_chunk_order.clear();
+  for(unsigned int i = 0, endi = window.m_chunks.size(); i < endi; ++i)
+    {
+      if(window.m_chunks[i].m_blended)
+        {
+          have_blended = true;
+        }
+      else
+        {
+          window.m_chunk_order.push_back(i);
+        }
+    }
+
+  if(window.m_front_to_back)
+    {
+      std::stable_sort(window.m_chunk_order.begin(), window.m_chunk_order.end(),
+                       reorder_window::front_to_back(window.m_chunks));
+    }
+
+  /* emit last the bucket of the state that follows the opaque
+     draws, i.e. of the first draw that is not opaque or of the
+     last draw, so that fewer draw breaks are needed after the
+     opaque draws; emit first the bucket that needs no draw break
+     from the current state; the rest in order of first appearance.
+   */
+  unsigned int first_bucket, last_bucket;
+
+  if(have_blended)
+    {
+      last_bucket = window.m_buckets.size();
+      for(unsigned int i = 0, endi = window.m_chunks.size(); i < endi && last_bucket == window.m_buckets.size(); ++i)
+        {
+          if(window.m_chunks[i].m_blended)
+            {
+              last_bucket = window.m_chunks[i].m_bucket;
+            }
+        }
+    }
+  else
+    {
+      last_bucket = window.find_bucket(window.m_unsorted_state);
+    }
+  first_bucket = window.find_bucket(m_prev_state);
+  FASTUIDRAWassert(last_bucket < window.m_buckets.size());
+
+  window.m_bucket_order.clear();
+  if(first_bucket != last_bucket && first_bucket < window.m_buckets.size())
+    {
+      window.m_bucket_order.push_back(first_bucket);
+    }
+  for(unsigned int i = 0, endi = window.m_buckets.size(); i < endi; ++i)
+    {
+      if(i != last_bucket && (window.m_bucket_order.empty() || window.m_bucket_order.front() != i))
+        {
+          window.m_bucket_order.push_back(i);
+        }
+    }
+  window.m_bucket_order.push_back(last_bucket);
+
+  for(unsigned int i = 0, endi = window.m_bucket_order.size(); i < endi; ++i)
+    {
+      reorder_window::bucket &b(window.m_buckets[window.m_bucket_order[i]]);
+
+      /* a bucket made only by draws that are not opaque
+         has no indices in the opaque stream.
+       */
+      b.m_write_location = loc;
+      if(b.m_number_indices == 0)
+        {
+          continue;
+        }
+
+      if(requires_draw_break(m_brush_shader_mask, m_prev_state, b.m_state))
+        {
+          draw_break(m_prev_state, b.m_state,
+                     m_attributes_written, loc);
+          ++sorted_breaks;
+        }
+      m_prev_state = b.m_state;
+      loc += b.m_number_indices;
+    }
+
+  for(std::vector<unsigned int>::const_iterator iter = window.m_chunk_order.begin(),
+        end = window.m_chunk_order.end(); iter != end; ++iter)
+    {
+      const reorder_window::chunk &c(window.m_chunks[*iter]);
+      reorder_window::bucket &b(window.m_buckets[c.m_bucket]);
+      unsigned int sz(c.m_indices.difference());
+
+      write_indices(b.m_write_location,
+                    fastuidraw::make_c_array(window.m_indices).sub_array(c.m_indices));
+      b.m_write_location += sz;
+    }
+
+  /* the draws that are not opaque are written after all opaque
+     draws in the order they were added.
+   */
+  if(have_blended)
     {
-      m_draw_command->draw_break(m_prev_state, current,
-                                 m_attributes_written,
-                                 m_indices_written);
-    }
+      for(std::vector<reorder_window::chunk>::const_iterator iter = window.m_chunks.begin(),
+            end = window.m_chunks.end(); iter != end; ++iter)
+        {
+          if(!iter->m_blended)
+            {
+              continue;
+            }
 
-  m_prev_state = current;
+          const PainterShaderGroupPrivate &state(window.m_buckets[iter->m_bucket].m_state);
+          if(requires_draw_break(m_brush_shader_mask, m_prev_state, state))
+            {
+              draw_break(m_prev_state, state,
+                         m_attributes_written, loc);
+              ++sorted_breaks;
+            }
+          m_prev_state = state;
 
-  if(call_back)
-    {
-      call_back->header_added(header, dst);
+          write_indices(loc, fastuidraw::make_c_array(window.m_indices).sub_array(iter->m_indices));
+          loc += iter->m_indices.difference();
+        }
     }
 
-  return return_value;
+  m_indices_written = loc;
+  m_indices_pending = 0;
+
+  /* emitting the draws that are not opaque after the opaque
+     draws can take more draw breaks than drawing in order.
+   */
+  FASTUIDRAWassert(have_blended || sorted_breaks <= window.m_unsorted_breaks);
+  return (sorted_breaks <= window.m_unsorted_breaks) ?
+    window.m_unsorted_breaks - sorted_breaks :
+    0u;
 }
 
 ///////////////////////////////////////////
@@ -755,9 +2316,15 @@ PainterPackerPrivate::
 PainterPackerPrivate(fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> backend,
                      fastuidraw::PainterPacker *p):
   m_backend(backend),
+  m_default_values_pool(backend->configuration_base().alignment()),
   m_p(p)
 {
   m_alignment = m_backend->configuration_base().alignment();
+  m_default_values.m_brush = m_default_values_pool.create_packed_value(fastuidraw::PainterBrush());
+  m_default_values.m_item_shader_data = m_default_values_pool.create_packed_value(fastuidraw::PainterItemShaderData());
+  m_default_values.m_blend_shader_data = m_default_values_pool.create_packed_value(fastuidraw::PainterBlendShaderData());
+  m_default_values.m_clip = m_default_values_pool.create_packed_value(fastuidraw::PainterClipEquations());
+  m_default_values.m_matrix = m_default_values_pool.create_packed_value(fastuidraw::PainterItemMatrix());
   m_header_size = fastuidraw::PainterHeader::data_size(m_alignment);
   // By calling PainterBackend::default_shaders(), we make the shaders
   // registered. By setting m_default_shaders to its return value,
@@ -766,17 +2333,129 @@ PainterPackerPrivate(fastuidraw::reference_counted_ptr<fastuidraw::PainterBacken
   // the shaders as well.
   m_default_shaders = m_backend->default_shaders();
   m_number_begins = 0;
+  m_persistent_store_blocks_written = 0;
+  m_capture_data = nullptr;
+  m_capture_buffers = FASTUIDRAWnew CaptureBufferPool();
+  m_blend_is_src_or_src_over = false;
+  m_reorder_opaque_draws = false;
+  m_front_to_back_opaque_draws = false;
+  m_streaming_stores = m_backend->hints().write_combined_buffers();
+  m_work_room.m_reorder_window.m_brush_shader_mask = m_backend->configuration_base().brush_shader_mask();
+}
+
+bool
+PainterPackerPrivate::
+pack_persistent_state_data(EntryBase *d, uint32_t &location)
+{
+  if(m_capture)
+    {
+      return false;
+    }
+
+  if(!in_persistent_store(d))
+    {
+      unsigned int written;
+
+      written = m_persistent_store_blocks_written * m_alignment;
+      if(written + d->m_data.size() > m_persistent_store.size())
+        {
+          return false;
+        }
+
+      std::copy(d->m_data.begin(), d->m_data.end(), m_persistent_store.begin() + written);
+      d->m_persistent_painter = m_p;
+      d->m_persistent_begin_id = m_number_begins;
+      d->m_persistent_offset = m_persistent_store_blocks_written;
+      m_persistent_store_blocks_written += d->m_data.size() / m_alignment;
+      m_stats[fastuidraw::PainterPacker::num_persistent_generic_datas] += d->m_data.size();
+    }
+
+  FASTUIDRAWassert((d->m_persistent_offset & fastuidraw::PainterHeader::persistent_store_mask) == 0u);
+  location = d->m_persistent_offset | fastuidraw::PainterHeader::persistent_store_mask;
+  return true;
+}
+
+void
+PainterPackerPrivate::
+map_persistent_store(void)
+{
+  m_persistent_store = m_backend->map_persistent_store();
+  m_persistent_store_blocks_written = 0;
+}
+
+void
+PainterPackerPrivate::
+unmap_persistent_store(void)
+{
+  if(!m_persistent_store.empty())
+    {
+      m_backend->unmap_persistent_store(m_persistent_store_blocks_written * m_alignment);
+      m_persistent_store = fastuidraw::c_array<fastuidraw::generic_data>();
+    }
+  m_persistent_store_blocks_written = 0;
+}
+
+void
+PainterPackerPrivate::
+close_reorder_window(void)
+{
+  reorder_window &window(m_work_room.m_reorder_window);
+
+  if(!window.empty())
+    {
+      FASTUIDRAWassert(!m_accumulated_draws.empty());
+      m_stats[fastuidraw::PainterPacker::num_draw_breaks_avoided]
+        += m_accumulated_draws.back().close_reorder_window(window);
+      window.clear();
+    }
+}
+
+bool
+PainterPackerPrivate::
+can_reorder(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+            const fastuidraw::PainterPackerData &draw,
+            const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back)
+{
+  /* A draw can be drawn out of order if it writes opaque
+     color everywhere it covers: then the depth test alone
+     gives the correct result. We do not reorder draws with
+     a call back since the call back may expect the order
+     of the headers.
+   */
+  return m_reorder_opaque_draws
+    && m_blend_is_src_or_src_over
+    && !call_back
+    && shader->full_coverage()
+    && fetch_value(draw.m_brush).opaque();
+}
+
+bool
+PainterPackerPrivate::
+can_defer(const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back)
+{
+  /* A draw that is not opaque can be held in the window and
+     drawn after the opaque draws of the window when they are
+     drawn front to back: the depth test then hides it where
+     an opaque draw of larger z-value covers it and it blends
+     over the opaque draws of smaller z-value as if drawn in
+     order.
+   */
+  return m_reorder_opaque_draws
+    && m_front_to_back_opaque_draws
+    && !call_back;
 }
 
 void
 PainterPackerPrivate::
 start_new_command(void)
 {
+  close_reorder_window();
   if(!m_accumulated_draws.empty())
     {
       per_draw_command &c(m_accumulated_draws.back());
 
       m_stats[fastuidraw::PainterPacker::num_attributes] += c.m_attributes_written;
+      m_stats[fastuidraw::PainterPacker::num_compact_attributes] += c.m_compact_attributes_written;
       m_stats[fastuidraw::PainterPacker::num_indices] += c.m_indices_written;
       m_stats[fastuidraw::PainterPacker::num_generic_datas] += c.store_written();
       m_stats[fastuidraw::PainterPacker::num_draws] += 1u;
@@ -785,20 +2464,34 @@ start_new_command(void)
     }
 
   fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> r;
+  const CaptureDraw *capture(nullptr);
+
   r = m_backend->map_draw();
-  m_accumulated_draws.push_back(per_draw_command(r, m_backend->configuration_base()));
+  if(m_capture)
+    {
+      capture = FASTUIDRAWnew CaptureDraw(r, m_capture_data, m_capture_buffers, m_streaming_stores);
+      r = capture;
+    }
+  m_accumulated_draws.push_back(per_draw_command(r, m_backend->configuration_base(),
+                                                 m_streaming_stores && !capture,
+                                                 &m_stats));
+  m_accumulated_draws.back().m_capture = capture;
 }
 
 unsigned int
 PainterPackerPrivate::
 compute_room_needed_for_packing(const fastuidraw::PainterPackerData &draw_state)
 {
-  unsigned int R(0);
-  R += compute_room_needed_for_packing(draw_state.m_clip);
-  R += compute_room_needed_for_packing(draw_state.m_matrix);
-  R += compute_room_needed_for_packing(draw_state.m_brush);
-  R += compute_room_needed_for_packing(draw_state.m_item_shader_data);
-  R += compute_room_needed_for_packing(draw_state.m_blend_shader_data);
+  unsigned int R(0), P;
+
+  P = (m_capture) ?
+    0u :
+    m_persistent_store.size() - m_persistent_store_blocks_written * m_alignment;
+  R += compute_room_needed_for_packing(draw_state.m_clip, P);
+  R += compute_room_needed_for_packing(draw_state.m_matrix, P);
+  R += compute_room_needed_for_packing(draw_state.m_brush, P);
+  R += compute_room_needed_for_packing(draw_state.m_item_shader_data, P);
+  R += compute_room_needed_for_packing(draw_state.m_blend_shader_data, P);
   return R;
 }
 
@@ -846,6 +2539,30 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
 
   FASTUIDRAWassert(shader);
 
+  /* draws with the same z-value rely on draw order, see
+     reorder_window::can_add().
+   */
+  reorder_window *window(nullptr);
+  if(can_reorder(shader, draw, call_back))
+    {
+      window = &m_work_room.m_reorder_window;
+      if(!window->can_add(z, compute_shader_group(fetch_value(draw.m_brush).shader(),
+                                                  m_blend_shader, m_blend_mode, shader)))
+        {
+          close_reorder_window();
+        }
+      window->m_current_blended = false;
+    }
+  else if(can_defer(call_back))
+    {
+      window = &m_work_room.m_reorder_window;
+      window->m_current_blended = true;
+    }
+  else
+    {
+      close_reorder_window();
+    }
+
   upload_draw_state(draw);
   allocate_header = true;
 
@@ -890,7 +2607,15 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
 
           if(attrib_room < needed_attrib_room || index_room < num_indices)
             {
-              FASTUIDRAWassert(!"Unable to fit chunk into freshly allocated draw command, not good!");
+              /* the chunk is larger than a PainterDraw, draw it
+                 in pieces; the pieces are not reordered and
+                 the attributes loaded are no longer in the
+                 current PainterDraw.
+               */
+              draw_split_chunk(shader, draw, src, chunk, z, call_back);
+              std::fill(m_work_room.m_attribs_loaded.begin(), m_work_room.m_attribs_loaded.end(), NOT_LOADED);
+              allocate_header = true;
+              window = nullptr;
               continue;
             }
 
@@ -900,15 +2625,8 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
       per_draw_command &cmd(m_accumulated_draws.back());
       if(allocate_header)
         {
-          ++m_stats[fastuidraw::PainterPacker::num_headers];
           allocate_header = false;
-          header_loc = cmd.pack_header(m_header_size,
-                                       fetch_value(draw.m_brush).shader(),
-                                       m_blend_shader,
-                                       m_blend_mode,
-                                       shader,
-                                       z, m_painter_state_location,
-                                       call_back);
+          header_loc = pack_header(shader, draw, z, call_back, window);
         }
 
       /* copy attribute data and get offset into attribute buffer
@@ -918,20 +2636,27 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
 
       if(needed_attrib_room > 0)
         {
-          fastuidraw::c_array<fastuidraw::PainterAttribute> attrib_dst_ptr;
           fastuidraw::c_array<uint32_t> header_dst_ptr;
 
-          attrib_dst_ptr = cmd.m_draw_command->m_attributes.sub_array(cmd.m_attributes_written, num_attribs);
+          if(cmd.compact_attributes(shader))
+            {
+              write_compact_attributes(src, cmd.m_draw_command->m_compact_attributes.sub_array(cmd.m_attributes_written, num_attribs),
+                                       attrib_src, m_work_room.m_compact_attribute_staging, cmd.streaming_stores());
+              cmd.m_compact_attributes_written += num_attribs;
+            }
+          else
+            {
+              src.write_attributes(cmd.m_draw_command->m_attributes.sub_array(cmd.m_attributes_written, num_attribs),
+                                   attrib_src);
+            }
           header_dst_ptr = cmd.m_draw_command->m_header_attributes.sub_array(cmd.m_attributes_written, num_attribs);
-
-          src.write_attributes(attrib_dst_ptr, attrib_src);
           std::fill(header_dst_ptr.begin(), header_dst_ptr.end(), header_loc);
 
           FASTUIDRAWassert(m_work_room.m_attribs_loaded[attrib_src] == NOT_LOADED);
           m_work_room.m_attribs_loaded[attrib_src] = cmd.m_attributes_written;
 
           attrib_offset = cmd.m_attributes_written;
-          cmd.m_attributes_written += attrib_dst_ptr.size();
+          cmd.m_attributes_written += num_attribs;
         }
       else
         {
@@ -943,10 +2668,211 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
        */
       fastuidraw::c_array<fastuidraw::PainterIndex> index_dst_ptr;
 
-      index_dst_ptr = cmd.m_draw_command->m_indices.sub_array(cmd.m_indices_written, num_indices);
-      src.write_indices(index_dst_ptr, attrib_offset, chunk);
-      cmd.m_indices_written += index_dst_ptr.size();
+      if(window)
+        {
+          index_dst_ptr = window->add_chunk(num_indices);
+          src.write_indices(index_dst_ptr, attrib_offset, chunk);
+          cmd.m_indices_pending += index_dst_ptr.size();
+        }
+      else if(cmd.m_short_indices)
+        {
+          write_short_indices(src, cmd.m_draw_command->m_short_indices.sub_array(cmd.m_indices_written, num_indices),
+                              attrib_offset, chunk, m_work_room.m_short_index_staging, cmd.streaming_stores());
+          cmd.m_indices_written += num_indices;
+        }
+      else
+        {
+          index_dst_ptr = cmd.m_draw_command->m_indices.sub_array(cmd.m_indices_written, num_indices);
+          src.write_indices(index_dst_ptr, attrib_offset, chunk);
+          cmd.m_indices_written += index_dst_ptr.size();
+        }
+    }
+}
+
+unsigned int
+PainterPackerPrivate::
+pack_header(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+            const fastuidraw::PainterPackerData &draw,
+            int z,
+            const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back,
+            reorder_window *window)
+{
+  unsigned int return_value;
+  bool header_reused;
+
+  return_value = m_accumulated_draws.back().pack_header(m_header_size,
+                                                        fetch_value(draw.m_brush).shader(),
+                                                        m_blend_shader,
+                                                        m_blend_mode,
+                                                        shader,
+                                                        z, m_painter_state_location,
+                                                        call_back, window, header_reused);
+  if(header_reused)
+    {
+      ++m_stats[fastuidraw::PainterPacker::num_headers_reused];
+    }
+  else
+    {
+      ++m_stats[fastuidraw::PainterPacker::num_headers];
+    }
+  return return_value;
+}
+
+template<typename T>
+void
+PainterPackerPrivate::
+draw_split_chunk(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                 const fastuidraw::PainterPackerData &draw,
+                 const T &src, unsigned int chunk,
+                 int z,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back)
+{
+  /* The chunk is a triangle list; it is walked one triangle at a
+     time, each PainterDraw gets the triangles that fit into it
+     and a copy of only the attributes those triangles use. The
+     piece of each PainterDraw is gathered in work room and then
+     copied by write_split_piece().
+   */
+  const unsigned int NOT_LOADED = ~0u;
+  std::vector<fastuidraw::PainterAttribute> &attribs(m_work_room.m_split_attributes);
+  std::vector<fastuidraw::PainterIndex> &indices(m_work_room.m_split_indices);
+  std::vector<unsigned int> &locations(m_work_room.m_split_locations);
+  std::vector<fastuidraw::PainterAttribute> &piece_attribs(m_work_room.m_split_piece_attributes);
+  std::vector<fastuidraw::PainterIndex> &piece_indices(m_work_room.m_split_piece_indices);
+  unsigned int attrib_src, header_loc(0);
+
+  /* the caller has just started a PainterDraw, if it cannot
+     hold a single triangle then no PainterDraw can.
+   */
+  if(m_accumulated_draws.back().attribute_room() < 3
+     || m_accumulated_draws.back().index_room() < 3
+     || m_accumulated_draws.back().store_room() < m_header_size)
+    {
+      FASTUIDRAWassert(!"Unable to fit a triangle into freshly allocated draw command, not good!");
+      return;
+    }
+
+  attrib_src = src.attribute_chunk_selection(chunk);
+  attribs.resize(src.number_attributes(attrib_src));
+  indices.resize(src.number_indices(chunk));
+
+  /* with an offset of 0, the indices written are indices
+     into the attribute chunk.
+   */
+  src.write_attributes(fastuidraw::make_c_array(attribs), attrib_src);
+  src.write_indices(fastuidraw::make_c_array(indices), 0, chunk);
+
+  FASTUIDRAWassert(indices.size() % 3 == 0);
+  locations.clear();
+  locations.resize(attribs.size(), NOT_LOADED);
+  piece_attribs.clear();
+  piece_indices.clear();
+
+  /* the current PainterDraw has neither room for the chunk
+     nor a header for this draw.
+   */
+  bool need_header(true);
+  for(unsigned int tri = 0; tri + 3 <= indices.size(); tri += 3)
+    {
+      unsigned int needed_attribs(0);
+
+      for(unsigned int k = 0; k < 3; ++k)
+        {
+          fastuidraw::PainterIndex v(indices[tri + k]);
+          bool first_use(locations[v] == NOT_LOADED);
+
+          FASTUIDRAWassert(v < attribs.size());
+          for(unsigned int j = 0; j < k && first_use; ++j)
+            {
+              first_use = (indices[tri + j] != v);
+            }
+          needed_attribs += (first_use) ? 1u : 0u;
+        }
+
+      if(m_accumulated_draws.back().attribute_room() < piece_attribs.size() + needed_attribs
+         || m_accumulated_draws.back().index_room() < piece_indices.size() + 3
+         || (need_header && m_accumulated_draws.back().store_room() < m_header_size))
+        {
+          write_split_piece(shader, header_loc);
+          start_new_command();
+          upload_draw_state(draw);
+          std::fill(locations.begin(), locations.end(), NOT_LOADED);
+          need_header = true;
+
+          if(m_accumulated_draws.back().attribute_room() < needed_attribs
+             || m_accumulated_draws.back().index_room() < 3
+             || m_accumulated_draws.back().store_room() < m_header_size)
+            {
+              FASTUIDRAWassert(!"Unable to fit a triangle into freshly allocated draw command, not good!");
+              return;
+            }
+        }
+
+      if(need_header)
+        {
+          need_header = false;
+          header_loc = pack_header(shader, draw, z, call_back, nullptr);
+        }
+
+      for(unsigned int k = 0; k < 3; ++k)
+        {
+          fastuidraw::PainterIndex v(indices[tri + k]);
+
+          if(locations[v] == NOT_LOADED)
+            {
+              locations[v] = piece_attribs.size();
+              piece_attribs.push_back(attribs[v]);
+            }
+          piece_indices.push_back(locations[v]);
+        }
+    }
+  write_split_piece(shader, header_loc);
+}
+
+void
+PainterPackerPrivate::
+write_split_piece(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                  unsigned int header_loc)
+{
+  std::vector<fastuidraw::PainterAttribute> &attribs(m_work_room.m_split_piece_attributes);
+  std::vector<fastuidraw::PainterIndex> &indices(m_work_room.m_split_piece_indices);
+  per_draw_command &cmd(m_accumulated_draws.back());
+  fastuidraw::c_array<uint32_t> header_dst_ptr;
+  unsigned int attrib_offset;
+
+  if(indices.empty())
+    {
+      FASTUIDRAWassert(attribs.empty());
+      return;
+    }
+
+  FASTUIDRAWassert(attribs.size() <= cmd.attribute_room());
+  FASTUIDRAWassert(indices.size() <= cmd.index_room());
+
+  attrib_offset = cmd.m_attributes_written;
+  if(cmd.compact_attributes(shader))
+    {
+      fastuidraw::detail::copy_compact_attributes(cmd.m_draw_command->m_compact_attributes.sub_array(attrib_offset, attribs.size()),
+                                                  fastuidraw::make_c_array(attribs), cmd.streaming_stores());
+      cmd.m_compact_attributes_written += attribs.size();
+    }
+  else
+    {
+      fastuidraw::detail::copy_attributes(cmd.m_draw_command->m_attributes.sub_array(attrib_offset, attribs.size()),
+                                          fastuidraw::make_c_array(attribs), cmd.streaming_stores());
     }
+  header_dst_ptr = cmd.m_draw_command->m_header_attributes.sub_array(attrib_offset, attribs.size());
+  std::fill(header_dst_ptr.begin(), header_dst_ptr.end(), header_loc);
+  cmd.m_attributes_written += attribs.size();
+
+  /* the indices of the piece are into attribs, which
+     is now at attrib_offset.
+   */
+  cmd.write_indices(cmd.m_indices_written, fastuidraw::make_c_array(indices), attrib_offset);
+  cmd.m_indices_written += indices.size();
+
+  attribs.clear();
+  indices.clear();
 }
 
 /////////////////////////////////////////
@@ -1018,6 +2944,30 @@ begin(void)
   std::fill(d->m_stats.begin(), d->m_stats.end(), 0u);
   d->start_new_command();
   ++d->m_number_begins;
+  d->map_persistent_store();
+}
+
+void
+fastuidraw::PainterPacker::
+begin(const reference_counted_ptr<PainterDrawList> &capture)
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+
+  FASTUIDRAWassert(capture);
+  FASTUIDRAWassert(d->m_accumulated_draws.empty());
+  capture->clear();
+  d->m_capture = capture;
+  d->m_capture_data = static_cast<detail::PainterDrawListPrivate*>(capture->m_d);
+  d->m_backend->image_atlas()->delay_tile_freeing();
+  d->m_backend->colorstop_atlas()->delay_interval_freeing();
+  std::fill(d->m_stats.begin(), d->m_stats.end(), 0u);
+  d->start_new_command();
+  ++d->m_number_begins;
+
+  /* the captured headers cannot refer to the persistent
+     store because it does not outlive the frame.
+   */
 }
 
 unsigned int
@@ -1032,6 +2982,7 @@ query_stat(enum stats_t st) const
     {
       per_draw_command &c(d->m_accumulated_draws.back());
       tmp[num_attributes] = c.m_attributes_written;
+      tmp[num_compact_attributes] = c.m_compact_attributes_written;
       tmp[num_indices] = c.m_indices_written;
       tmp[num_generic_datas] = c.store_written();
       tmp[num_draws] = 1u;
@@ -1043,13 +2994,17 @@ void
 fastuidraw::PainterPacker::
 flush(void)
 {
+  FASTUIDRAWtrace_scope("PainterPacker::flush");
+
   PainterPackerPrivate *d;
   d = static_cast<PainterPackerPrivate*>(m_d);
+  d->close_reorder_window();
   if(!d->m_accumulated_draws.empty())
     {
       per_draw_command &c(d->m_accumulated_draws.back());
 
       d->m_stats[fastuidraw::PainterPacker::num_attributes] += c.m_attributes_written;
+      d->m_stats[fastuidraw::PainterPacker::num_compact_attributes] += c.m_compact_attributes_written;
       d->m_stats[fastuidraw::PainterPacker::num_indices] += c.m_indices_written;
       d->m_stats[fastuidraw::PainterPacker::num_generic_datas] += c.store_written();
       d->m_stats[fastuidraw::PainterPacker::num_draws] += 1u;
@@ -1057,10 +3012,12 @@ flush(void)
       c.unmap();
     }
 
+  d->unmap_persistent_store();
   d->m_backend->on_pre_draw();
   for(std::vector<per_draw_command>::iterator iter = d->m_accumulated_draws.begin(),
         end = d->m_accumulated_draws.end(); iter != end; ++iter)
     {
+      FASTUIDRAWtrace_scope("PainterDraw::draw");
       FASTUIDRAWassert(iter->m_draw_command->unmapped());
       iter->m_draw_command->draw();
     }
@@ -1072,11 +3029,85 @@ void
 fastuidraw::PainterPacker::
 end(void)
 {
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+
   flush();
+  if(d->m_capture_data)
+    {
+      d->m_capture_data->m_captured = true;
+    }
+  d->m_capture = reference_counted_ptr<PainterDrawList>();
+  d->m_capture_data = nullptr;
   image_atlas()->undelay_tile_freeing();
   colorstop_atlas()->undelay_interval_freeing();
 }
 
+void
+fastuidraw::PainterPacker::
+begin_capture(const reference_counted_ptr<PainterDrawList> &capture)
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+
+  FASTUIDRAWassert(capture);
+  FASTUIDRAWassert(!d->m_capture);
+  FASTUIDRAWassert(!d->m_accumulated_draws.empty());
+  capture->clear();
+  d->m_capture = capture;
+  d->m_capture_data = static_cast<detail::PainterDrawListPrivate*>(capture->m_d);
+
+  /* the content before the capture ends with the
+     current PainterDraw.
+   */
+  d->start_new_command();
+}
+
+void
+fastuidraw::PainterPacker::
+end_capture(void)
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+
+  FASTUIDRAWassert(d->m_capture);
+  d->close_reorder_window();
+  d->m_capture_data->m_captured = true;
+  d->m_capture = reference_counted_ptr<PainterDrawList>();
+  d->m_capture_data = nullptr;
+
+  /* the CaptureDraw keeps what it needs to copy its
+     content to the PainterDraw of the backend when it
+     is unmapped.
+   */
+  d->start_new_command();
+}
+
+unsigned int
+fastuidraw::PainterPacker::
+draw_list(const PainterDrawList &list, int z_offset)
+{
+  PainterPackerPrivate *d;
+  const detail::PainterDrawListPrivate *src;
+  unsigned int return_value(0);
+
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  src = static_cast<const detail::PainterDrawListPrivate*>(list.m_d);
+
+  FASTUIDRAWassert(!d->m_capture);
+  FASTUIDRAWassert(!d->m_accumulated_draws.empty());
+  d->close_reorder_window();
+  for(const detail::PainterDrawListPrivate::draw &draw : src->m_draws)
+    {
+      if(!d->m_accumulated_draws.back().empty())
+        {
+          d->start_new_command();
+        }
+      return_value += d->m_accumulated_draws.back().replay(draw, src->m_patches, z_offset);
+    }
+  return return_value;
+}
+
 void
 fastuidraw::PainterPacker::
 draw_generic(const reference_counted_ptr<PainterItemShader> &shader,
@@ -1106,7 +3137,11 @@ draw_generic(const reference_counted_ptr<PainterItemShader> &shader,
   PainterPackerPrivate *d;
   d = static_cast<PainterPackerPrivate*>(m_d);
 
-  AttributeIndexSrcFromArray src(attrib_chunks, index_chunks, index_adjusts, attrib_chunk_selector);
+  /* when capturing, the data is written to the PainterDrawList
+     and copied to the buffers of the backend on unmap.
+   */
+  AttributeIndexSrcFromArray src(attrib_chunks, index_chunks, index_adjusts, attrib_chunk_selector,
+                                 d->m_streaming_stores && !d->m_capture);
   d->draw_generic_implement(shader, draw, src, z, call_back);
 }
 
@@ -1178,6 +3213,58 @@ blend_shader(const fastuidraw::reference_counted_ptr<PainterBlendShader> &h,
   FASTUIDRAWassert(h);
   d->m_blend_shader = h;
   d->m_blend_mode = pblend_mode;
+
+  const PainterBlendShaderSet &blend_shaders(d->m_default_shaders.blend_shaders());
+  d->m_blend_is_src_or_src_over =
+    (h == blend_shaders.shader(PainterEnums::blend_porter_duff_src_over)
+     && pblend_mode == blend_shaders.blend_mode(PainterEnums::blend_porter_duff_src_over))
+    || (h == blend_shaders.shader(PainterEnums::blend_porter_duff_src)
+        && pblend_mode == blend_shaders.blend_mode(PainterEnums::blend_porter_duff_src));
+}
+
+bool
+fastuidraw::PainterPacker::
+reorder_opaque_draws(void) const
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  return d->m_reorder_opaque_draws;
+}
+
+void
+fastuidraw::PainterPacker::
+reorder_opaque_draws(bool v)
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  if(v != d->m_reorder_opaque_draws)
+    {
+      d->close_reorder_window();
+      d->m_reorder_opaque_draws = v;
+    }
+}
+
+bool
+fastuidraw::PainterPacker::
+front_to_back_opaque_draws(void) const
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  return d->m_front_to_back_opaque_draws;
+}
+
+void
+fastuidraw::PainterPacker::
+front_to_back_opaque_draws(bool v)
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  if(v != d->m_front_to_back_opaque_draws)
+    {
+      d->close_reorder_window();
+      d->m_front_to_back_opaque_draws = v;
+      d->m_work_room.m_reorder_window.m_front_to_back = v;
+    }
 }
 
 const fastuidraw::PainterShaderSet&
@@ -1357,9 +3444,9 @@ raw_value(void) const
 /////////////////////////////////////////////////////
 // PainterPackedValuePool methods
 fastuidraw::PainterPackedValuePool::
-PainterPackedValuePool(int alignment)
+PainterPackedValuePool(int alignment, bool thread_safe)
 {
-  m_d = FASTUIDRAWnew PainterPackedValuePoolPrivate(alignment);
+  m_d = FASTUIDRAWnew PainterPackedValuePoolPrivate(alignment, thread_safe);
 }
 
 fastuidraw::PainterPackedValuePool::
@@ -1371,6 +3458,15 @@ fastuidraw::PainterPackedValuePool::
   m_d = nullptr;
 }
 
+bool
+fastuidraw::PainterPackedValuePool::
+thread_safe(void) const
+{
+  PainterPackedValuePoolPrivate *d;
+  d = static_cast<PainterPackedValuePoolPrivate*>(m_d);
+  return d->m_thread_safe;
+}
+
 fastuidraw::PainterPackedValue<fastuidraw::PainterBrush>
 fastuidraw::PainterPackedValuePool::
 create_packed_value(const PainterBrush &value)
@@ -1379,7 +3475,7 @@ create_packed_value(const PainterBrush &value)
   Entry<PainterBrush> *e;
 
   d = static_cast<PainterPackedValuePoolPrivate*>(m_d);
-  e = d->m_brush_pool.allocate(value, d->m_alignment);
+  e = d->m_brush_pool.allocate(value);
   return fastuidraw::PainterPackedValue<PainterBrush>(e);
 }
 
@@ -1391,7 +3487,7 @@ create_packed_value(const PainterClipEquations &value)
   Entry<PainterClipEquations> *e;
 
   d = static_cast<PainterPackedValuePoolPrivate*>(m_d);
-  e = d->m_clip_equations_pool.allocate(value, d->m_alignment);
+  e = d->m_clip_equations_pool.allocate(value);
   return fastuidraw::PainterPackedValue<PainterClipEquations>(e);
 }
 
@@ -1403,7 +3499,7 @@ create_packed_value(const PainterItemMatrix &value)
   Entry<PainterItemMatrix> *e;
 
   d = static_cast<PainterPackedValuePoolPrivate*>(m_d);
-  e = d->m_item_matrix_pool.allocate(value, d->m_alignment);
+  e = d->m_item_matrix_pool.allocate(value);
   return fastuidraw::PainterPackedValue<PainterItemMatrix>(e);
 }
 
@@ -1415,7 +3511,7 @@ create_packed_value(const PainterItemShaderData &value)
   Entry<PainterItemShaderData> *e;
 
   d = static_cast<PainterPackedValuePoolPrivate*>(m_d);
-  e = d->m_item_shader_data_pool.allocate(value, d->m_alignment);
+  e = d->m_item_shader_data_pool.allocate(value);
   return fastuidraw::PainterPackedValue<PainterItemShaderData>(e);
 }
 
@@ -1427,6 +3523,6 @@ create_packed_value(const PainterBlendShaderData &value)
   Entry<PainterBlendShaderData> *e;
 
   d = static_cast<PainterPackedValuePoolPrivate*>(m_d);
-  e = d->m_blend_shader_data_pool.allocate(value, d->m_alignment);
+  e = d->m_blend_shader_data_pool.allocate(value);
   return fastuidraw::PainterPackedValue<PainterBlendShaderData>(e);
 }
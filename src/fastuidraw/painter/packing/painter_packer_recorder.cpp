@@ -0,0 +1,516 @@
+/*!
+ * \file painter_packer_recorder.cpp
+ * \brief file painter_packer_recorder.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <vector>
+#include <algorithm>
+
+#include <fastuidraw/painter/packing/painter_packer_recorder.hpp>
+
+namespace
+{
+  class recorded_index_chunk
+  {
+  public:
+    fastuidraw::range_type<unsigned int> m_indices;
+    int m_adjust;
+    unsigned int m_attribute_chunk;
+  };
+
+  class recorded_command
+  {
+  public:
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> m_shader;
+    fastuidraw::PainterPackerData m_data;
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterBlendShader> m_blend_shader;
+    fastuidraw::BlendMode::packed_value m_blend_mode;
+
+    /* range into PainterPackerRecorderPrivate::m_attribute_chunks
+     */
+    fastuidraw::range_type<unsigned int> m_attribute_chunks;
+
+    /* range into PainterPackerRecorderPrivate::m_index_chunks
+     */
+    fastuidraw::range_type<unsigned int> m_index_chunks;
+
+    int m_z;
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> m_call_back;
+  };
+
+  class PainterPackerRecorderPrivate
+  {
+  public:
+    explicit
+    PainterPackerRecorderPrivate(int painter_alignment):
+      m_pool(painter_alignment),
+      m_blend_mode(0),
+      m_z_range(0, 0)
+    {}
+
+    recorded_command&
+    add_command(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                const fastuidraw::PainterPackerData &data, int z,
+                const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back);
+
+    unsigned int
+    add_attributes(unsigned int cnt);
+
+    void
+    add_attributes(fastuidraw::const_c_array<fastuidraw::PainterAttribute> src);
+
+    unsigned int
+    add_indices(unsigned int cnt);
+
+    void
+    add_indices(fastuidraw::const_c_array<fastuidraw::PainterIndex> src,
+                int adjust, unsigned int attribute_chunk);
+
+    /* m_pool is declared before m_commands so that the
+       packed values of the commands are released before
+       the pool that made them.
+     */
+    fastuidraw::PainterPackedValuePool m_pool;
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterBlendShader> m_blend_shader;
+    fastuidraw::BlendMode::packed_value m_blend_mode;
+
+    std::vector<fastuidraw::PainterAttribute> m_attributes;
+    std::vector<fastuidraw::PainterIndex> m_indices;
+    std::vector<fastuidraw::range_type<unsigned int> > m_attribute_chunks;
+    std::vector<recorded_index_chunk> m_index_chunks;
+    std::vector<recorded_command> m_commands;
+    fastuidraw::range_type<int> m_z_range;
+  };
+
+  class RecordedCommandWriter:public fastuidraw::PainterPacker::DataWriter
+  {
+  public:
+    RecordedCommandWriter(const PainterPackerRecorderPrivate *d,
+                          const recorded_command &cmd):
+      m_d(d),
+      m_cmd(cmd)
+    {}
+
+    virtual
+    unsigned int
+    number_attribute_chunks(void) const
+    {
+      return m_cmd.m_attribute_chunks.difference();
+    }
+
+    virtual
+    unsigned int
+    number_attributes(unsigned int attribute_chunk) const
+    {
+      return attribute_range(attribute_chunk).difference();
+    }
+
+    virtual
+    unsigned int
+    number_index_chunks(void) const
+    {
+      return m_cmd.m_index_chunks.difference();
+    }
+
+    virtual
+    unsigned int
+    number_indices(unsigned int index_chunk) const
+    {
+      return index_chunk_data(index_chunk).m_indices.difference();
+    }
+
+    virtual
+    unsigned int
+    attribute_chunk_selection(unsigned int index_chunk) const
+    {
+      return index_chunk_data(index_chunk).m_attribute_chunk;
+    }
+
+    virtual
+    void
+    write_indices(fastuidraw::c_array<fastuidraw::PainterIndex> dst,
+                  unsigned int index_offset_value,
+                  unsigned int index_chunk) const
+    {
+      const recorded_index_chunk &chunk(index_chunk_data(index_chunk));
+      const fastuidraw::PainterIndex *src(&m_d->m_indices[chunk.m_indices.m_begin]);
+      int adjust(chunk.m_adjust + static_cast<int>(index_offset_value));
+
+      FASTUIDRAWassert(dst.size() == chunk.m_indices.difference());
+      for(unsigned int i = 0; i < dst.size(); ++i)
+        {
+          dst[i] = static_cast<int>(src[i]) + adjust;
+        }
+    }
+
+    virtual
+    void
+    write_attributes(fastuidraw::c_array<fastuidraw::PainterAttribute> dst,
+                     unsigned int attribute_chunk) const
+    {
+      fastuidraw::range_type<unsigned int> R(attribute_range(attribute_chunk));
+
+      FASTUIDRAWassert(dst.size() == R.difference());
+      std::copy(m_d->m_attributes.begin() + R.m_begin,
+                m_d->m_attributes.begin() + R.m_end,
+                dst.begin());
+    }
+
+  private:
+    fastuidraw::range_type<unsigned int>
+    attribute_range(unsigned int attribute_chunk) const
+    {
+      FASTUIDRAWassert(attribute_chunk < m_cmd.m_attribute_chunks.difference());
+      return m_d->m_attribute_chunks[m_cmd.m_attribute_chunks.m_begin + attribute_chunk];
+    }
+
+    const recorded_index_chunk&
+    index_chunk_data(unsigned int index_chunk) const
+    {
+      FASTUIDRAWassert(index_chunk < m_cmd.m_index_chunks.difference());
+      return m_d->m_index_chunks[m_cmd.m_index_chunks.m_begin + index_chunk];
+    }
+
+    const PainterPackerRecorderPrivate *m_d;
+    const recorded_command &m_cmd;
+  };
+}
+
+//////////////////////////////////////////////
+// PainterPackerRecorderPrivate methods
+recorded_command&
+PainterPackerRecorderPrivate::
+add_command(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+            const fastuidraw::PainterPackerData &data, int z,
+            const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back)
+{
+  if(m_commands.empty())
+    {
+      m_z_range.m_begin = z;
+      m_z_range.m_end = z + 1;
+    }
+  else
+    {
+      m_z_range.m_begin = fastuidraw::t_min(m_z_range.m_begin, z);
+      m_z_range.m_end = fastuidraw::t_max(m_z_range.m_end, z + 1);
+    }
+
+  m_commands.push_back(recorded_command());
+
+  recorded_command &cmd(m_commands.back());
+  cmd.m_shader = shader;
+  cmd.m_data = data;
+  cmd.m_blend_shader = m_blend_shader;
+  cmd.m_blend_mode = m_blend_mode;
+  cmd.m_z = z;
+  cmd.m_call_back = call_back;
+  cmd.m_attribute_chunks.m_begin = cmd.m_attribute_chunks.m_end = m_attribute_chunks.size();
+  cmd.m_index_chunks.m_begin = cmd.m_index_chunks.m_end = m_index_chunks.size();
+
+  /* the values pointed to by the unpacked fields are owned by
+     the caller and will not be alive on replay, so pack them.
+   */
+  cmd.m_data.make_packed(m_pool);
+  cmd.m_data.m_clip.make_packed(m_pool);
+  cmd.m_data.m_matrix.make_packed(m_pool);
+
+  return cmd;
+}
+
+unsigned int
+PainterPackerRecorderPrivate::
+add_attributes(unsigned int cnt)
+{
+  unsigned int return_value(m_attributes.size());
+
+  m_attributes.resize(return_value + cnt);
+  m_attribute_chunks.push_back(fastuidraw::range_type<unsigned int>(return_value, return_value + cnt));
+  return return_value;
+}
+
+void
+PainterPackerRecorderPrivate::
+add_attributes(fastuidraw::const_c_array<fastuidraw::PainterAttribute> src)
+{
+  unsigned int loc(m_attributes.size());
+
+  m_attributes.insert(m_attributes.end(), src.begin(), src.end());
+  m_attribute_chunks.push_back(fastuidraw::range_type<unsigned int>(loc, loc + src.size()));
+}
+
+void
+PainterPackerRecorderPrivate::
+add_indices(fastuidraw::const_c_array<fastuidraw::PainterIndex> src,
+            int adjust, unsigned int attribute_chunk)
+{
+  unsigned int loc(m_indices.size());
+
+  m_indices.insert(m_indices.end(), src.begin(), src.end());
+  m_index_chunks.push_back(recorded_index_chunk());
+  m_index_chunks.back().m_indices = fastuidraw::range_type<unsigned int>(loc, loc + src.size());
+  m_index_chunks.back().m_adjust = adjust;
+  m_index_chunks.back().m_attribute_chunk = attribute_chunk;
+}
+
+unsigned int
+PainterPackerRecorderPrivate::
+add_indices(unsigned int cnt)
+{
+  unsigned int return_value(m_indices.size());
+
+  m_indices.resize(return_value + cnt);
+  m_index_chunks.push_back(recorded_index_chunk());
+  m_index_chunks.back().m_indices = fastuidraw::range_type<unsigned int>(return_value, return_value + cnt);
+  m_index_chunks.back().m_adjust = 0;
+  m_index_chunks.back().m_attribute_chunk = 0;
+  return return_value;
+}
+
+//////////////////////////////////////////////
+// fastuidraw::PainterPackerRecorder methods
+fastuidraw::PainterPackerRecorder::
+PainterPackerRecorder(int painter_alignment)
+{
+  m_d = FASTUIDRAWnew PainterPackerRecorderPrivate(painter_alignment);
+}
+
+fastuidraw::PainterPackerRecorder::
+~PainterPackerRecorder()
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::PainterPackedValuePool&
+fastuidraw::PainterPackerRecorder::
+packed_value_pool(void)
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+  return d->m_pool;
+}
+
+const fastuidraw::reference_counted_ptr<fastuidraw::PainterBlendShader>&
+fastuidraw::PainterPackerRecorder::
+blend_shader(void) const
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+  return d->m_blend_shader;
+}
+
+fastuidraw::BlendMode::packed_value
+fastuidraw::PainterPackerRecorder::
+blend_mode(void) const
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+  return d->m_blend_mode;
+}
+
+void
+fastuidraw::PainterPackerRecorder::
+blend_shader(const reference_counted_ptr<PainterBlendShader> &h,
+             BlendMode::packed_value packed_blend_mode)
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+  FASTUIDRAWassert(h);
+  d->m_blend_shader = h;
+  d->m_blend_mode = packed_blend_mode;
+}
+
+void
+fastuidraw::PainterPackerRecorder::
+draw_generic(const reference_counted_ptr<PainterItemShader> &shader,
+             const PainterPackerData &data,
+             const_c_array<const_c_array<PainterAttribute> > attrib_chunks,
+             const_c_array<const_c_array<PainterIndex> > index_chunks,
+             const_c_array<int> index_adjusts,
+             int z,
+             const reference_counted_ptr<PainterPacker::DataCallBack> &call_back)
+{
+  draw_generic(shader, data, attrib_chunks, index_chunks,
+               index_adjusts, const_c_array<unsigned int>(),
+               z, call_back);
+}
+
+void
+fastuidraw::PainterPackerRecorder::
+draw_generic(const reference_counted_ptr<PainterItemShader> &shader,
+             const PainterPackerData &data,
+             const_c_array<const_c_array<PainterAttribute> > attrib_chunks,
+             const_c_array<const_c_array<PainterIndex> > index_chunks,
+             const_c_array<int> index_adjusts,
+             const_c_array<unsigned int> attrib_chunk_selector,
+             int z,
+             const reference_counted_ptr<PainterPacker::DataCallBack> &call_back)
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+
+  FASTUIDRAWassert((attrib_chunk_selector.empty() && attrib_chunks.size() == index_chunks.size())
+                   || (attrib_chunk_selector.size() == index_chunks.size()));
+  FASTUIDRAWassert(index_adjusts.size() == index_chunks.size());
+
+  recorded_command &cmd(d->add_command(shader, data, z, call_back));
+  for(unsigned int i = 0; i < attrib_chunks.size(); ++i)
+    {
+      d->add_attributes(attrib_chunks[i]);
+    }
+  cmd.m_attribute_chunks.m_end = d->m_attribute_chunks.size();
+
+  for(unsigned int i = 0; i < index_chunks.size(); ++i)
+    {
+      d->add_indices(index_chunks[i], index_adjusts[i],
+                     attrib_chunk_selector.empty() ? i : attrib_chunk_selector[i]);
+    }
+  cmd.m_index_chunks.m_end = d->m_index_chunks.size();
+}
+
+void
+fastuidraw::PainterPackerRecorder::
+draw_generic(const reference_counted_ptr<PainterItemShader> &shader,
+             const PainterPackerData &data,
+             const PainterPacker::DataWriter &src,
+             int z,
+             const reference_counted_ptr<PainterPacker::DataCallBack> &call_back)
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+
+  recorded_command &cmd(d->add_command(shader, data, z, call_back));
+  for(unsigned int i = 0, endi = src.number_attribute_chunks(); i < endi; ++i)
+    {
+      unsigned int loc, cnt;
+
+      cnt = src.number_attributes(i);
+      loc = d->add_attributes(cnt);
+      if(cnt > 0)
+        {
+          src.write_attributes(c_array<PainterAttribute>(&d->m_attributes[loc], cnt), i);
+        }
+    }
+  cmd.m_attribute_chunks.m_end = d->m_attribute_chunks.size();
+
+  for(unsigned int i = 0, endi = src.number_index_chunks(); i < endi; ++i)
+    {
+      unsigned int loc, cnt;
+
+      cnt = src.number_indices(i);
+      loc = d->add_indices(cnt);
+      if(cnt > 0)
+        {
+          src.write_indices(c_array<PainterIndex>(&d->m_indices[loc], cnt), 0, i);
+        }
+      d->m_index_chunks.back().m_attribute_chunk = src.attribute_chunk_selection(i);
+    }
+  cmd.m_index_chunks.m_end = d->m_index_chunks.size();
+}
+
+unsigned int
+fastuidraw::PainterPackerRecorder::
+number_commands(void) const
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+  return d->m_commands.size();
+}
+
+fastuidraw::range_type<int>
+fastuidraw::PainterPackerRecorder::
+z_range(void) const
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+  return d->m_z_range;
+}
+
+void
+fastuidraw::PainterPackerRecorder::
+clear(void)
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+
+  /* clear() on std::vector keeps the capacity, so a
+     recorder reused frame after frame stops allocating.
+   */
+  d->m_commands.clear();
+  d->m_attributes.clear();
+  d->m_indices.clear();
+  d->m_attribute_chunks.clear();
+  d->m_index_chunks.clear();
+  d->m_blend_shader = reference_counted_ptr<PainterBlendShader>();
+  d->m_blend_mode = 0;
+  d->m_z_range = range_type<int>(0, 0);
+}
+
+int
+fastuidraw::PainterPackerRecorder::
+replay(PainterPacker &packer, int z) const
+{
+  PainterPackerRecorderPrivate *d;
+  d = static_cast<PainterPackerRecorderPrivate*>(m_d);
+
+  if(d->m_commands.empty())
+    {
+      return z;
+    }
+
+  reference_counted_ptr<PainterBlendShader> old_blend(packer.blend_shader());
+  BlendMode::packed_value old_blend_mode(packer.blend_mode());
+  int z_offset(z - d->m_z_range.m_begin);
+
+  for(std::vector<recorded_command>::const_iterator iter = d->m_commands.begin(),
+        end = d->m_commands.end(); iter != end; ++iter)
+    {
+      const reference_counted_ptr<PainterBlendShader> &blend(iter->m_blend_shader ? iter->m_blend_shader : old_blend);
+      BlendMode::packed_value blend_mode(iter->m_blend_shader ? iter->m_blend_mode : old_blend_mode);
+
+      if(blend && (blend != packer.blend_shader() || blend_mode != packer.blend_mode()))
+        {
+          packer.blend_shader(blend, blend_mode);
+        }
+
+      RecordedCommandWriter writer(d, *iter);
+      packer.draw_generic(iter->m_shader, iter->m_data, writer,
+                          iter->m_z + z_offset, iter->m_call_back);
+    }
+
+  if(old_blend && (old_blend != packer.blend_shader() || old_blend_mode != packer.blend_mode()))
+    {
+      packer.blend_shader(old_blend, old_blend_mode);
+    }
+
+  return z + d->m_z_range.difference();
+}
+
+int
+fastuidraw::PainterPackerRecorder::
+replay(const_c_array<const PainterPackerRecorder*> recorders,
+       PainterPacker &packer, int z)
+{
+  for(unsigned int i = 0; i < recorders.size(); ++i)
+    {
+      FASTUIDRAWassert(recorders[i] != nullptr);
+      z = recorders[i]->replay(packer, z);
+    }
+  return z;
+}
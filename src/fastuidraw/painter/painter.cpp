@@ -19,6 +19,9 @@
 
 #include <vector>
 #include <bitset>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 
 #include <fastuidraw/util/math.hpp>
 #include <fastuidraw/painter/painter_header.hpp>
@@ -31,6 +34,7 @@
 namespace
 {
   class ZDelayedAction;
+  class ZDelayedActionPool;
   class ZDataCallBack;
   class PainterPrivate;
 
@@ -162,21 +166,75 @@ namespace
 
   private:
     friend class ZDataCallBack;
+    friend class ZDelayedActionPool;
     int32_t m_z_to_write;
     std::vector<change_header_z> m_dests;
   };
 
+  /* A ZDelayedActionPool recycles the ZDelayedAction objects
+     of the ZDataCallBack objects of a Painter. An action is
+     released to the pool once its ZDataCallBack is finalized,
+     at which point its PainterDraw no longer references it.
+     Actions are only acquired before finalizing, i.e. while
+     the Painter is between begin() and end(), so the pool is
+     only accessed from the thread of the Painter.
+   */
+  class ZDelayedActionPool:
+    public fastuidraw::reference_counted<ZDelayedActionPool>::default_base
+  {
+  public:
+    fastuidraw::reference_counted_ptr<ZDelayedAction>
+    acquire(void)
+    {
+      fastuidraw::reference_counted_ptr<ZDelayedAction> R;
+
+      if(m_free.empty())
+        {
+          R = FASTUIDRAWnew ZDelayedAction();
+        }
+      else
+        {
+          R = m_free.back();
+          m_free.pop_back();
+        }
+      return R;
+    }
+
+    void
+    release(const fastuidraw::reference_counted_ptr<ZDelayedAction> &h)
+    {
+      /* clear() keeps the capacity of m_dests */
+      h->m_dests.clear();
+      m_free.push_back(h);
+    }
+
+  private:
+    std::vector<fastuidraw::reference_counted_ptr<ZDelayedAction> > m_free;
+  };
+
   class ZDataCallBack:public fastuidraw::PainterPacker::DataCallBack
   {
   public:
+    /* z is the z-value with which the occluders are drawn;
+       it is needed to rebase the final z-value of occluders
+       whose data is added after finalize_z(), which happens
+       when the Painter records to a PainterPackerRecorder.
+     */
+    ZDataCallBack(int z, const fastuidraw::reference_counted_ptr<ZDelayedActionPool> &pool):
+      m_draw_z(z),
+      m_final_z(z),
+      m_finalized(false),
+      m_pool(pool)
+    {}
+
     virtual
     void
     current_draw(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> &h)
     {
-      if(h != m_cmd)
+      if(!m_finalized && h != m_cmd)
         {
           m_cmd = h;
-          m_current = FASTUIDRAWnew ZDelayedAction();
+          m_current = m_pool->acquire();
           m_actions.push_back(m_current);
           m_cmd->add_action(m_current);
         }
@@ -187,12 +245,42 @@ namespace
     header_added(const fastuidraw::PainterHeader &original_value,
                  fastuidraw::c_array<fastuidraw::generic_data> mapped_location)
     {
-      m_current->m_dests.push_back(change_header_z(original_value, mapped_location));
+      if(m_finalized)
+        {
+          /* the header is added after the occluder was popped,
+             thus the z-value is known and can be written directly;
+             original_value.m_z carries any z-rebasing done
+             by PainterPackerRecorder::replay().
+           */
+          mapped_location[fastuidraw::PainterHeader::z_offset].i = original_value.m_z + m_final_z - m_draw_z;
+        }
+      else
+        {
+          m_current->m_dests.push_back(change_header_z(original_value, mapped_location));
+        }
     }
 
-    std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw::DelayedAction> > m_actions;
+    void
+    finalize_z(int z)
+    {
+      FASTUIDRAWassert(!m_finalized);
+      m_finalized = true;
+      m_final_z = z;
+      for(unsigned int i = 0, endi = m_actions.size(); i < endi; ++i)
+        {
+          m_actions[i]->finalize_z(z);
+          m_pool->release(m_actions[i]);
+        }
+      m_actions.clear();
+      m_current = fastuidraw::reference_counted_ptr<ZDelayedAction>();
+      m_cmd = fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw>();
+    }
 
   private:
+    int m_draw_z, m_final_z;
+    bool m_finalized;
+    fastuidraw::reference_counted_ptr<ZDelayedActionPool> m_pool;
+    std::vector<fastuidraw::reference_counted_ptr<ZDelayedAction> > m_actions;
     fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> m_cmd;
     fastuidraw::reference_counted_ptr<ZDelayedAction> m_current;
   };
@@ -346,6 +434,171 @@ namespace
     fastuidraw::vec2 m_min, m_max;
   };
 
+  uint32_t
+  hash_floats(const float *v, unsigned int cnt)
+  {
+    /* FNV-1a on the bits of the floats; values that compare
+       equal but have different bits (0.0 and -0.0) just land
+       in different entries.
+     */
+    uint32_t h(2166136261u);
+    for(unsigned int i = 0; i < cnt; ++i)
+      {
+        uint32_t b;
+        std::memcpy(&b, &v[i], sizeof(b));
+        h = (h ^ b) * 16777619u;
+      }
+    return h;
+  }
+
+  uint32_t
+  intern_hash(const fastuidraw::PainterItemMatrix &v)
+  {
+    return hash_floats(v.m_item_matrix.raw_data().c_ptr(), 9);
+  }
+
+  bool
+  intern_equal(const fastuidraw::PainterItemMatrix &a,
+               const fastuidraw::PainterItemMatrix &b)
+  {
+    return a.m_item_matrix.raw_data() == b.m_item_matrix.raw_data();
+  }
+
+  uint32_t
+  intern_hash(const fastuidraw::PainterClipEquations &v)
+  {
+    uint32_t h(0u);
+    for(unsigned int i = 0; i < 4; ++i)
+      {
+        h = 31u * h + hash_floats(v.m_clip_equations[i].c_ptr(), 3);
+      }
+    return h;
+  }
+
+  bool
+  intern_equal(const fastuidraw::PainterClipEquations &a,
+               const fastuidraw::PainterClipEquations &b)
+  {
+    return a.m_clip_equations == b.m_clip_equations;
+  }
+
+  /* A PackedStateCache maps recently packed values to their
+     PainterPackedValue so that a Painter moving between a
+     handful of transformations (or clip equations) reuses
+     the same PainterPackedValue instead of creating and
+     packing a new one at each change. The table is direct
+     mapped by a hash of the value; a colliding value just
+     replaces the entry.
+   */
+  template<typename T, unsigned int N>
+  class PackedStateCache
+  {
+  public:
+    fastuidraw::PainterPackedValue<T>
+    fetch(const T &v, fastuidraw::PainterPackedValuePool &pool,
+          bool *reused)
+    {
+      fastuidraw::PainterPackedValue<T> &e(m_entries[intern_hash(v) % N]);
+
+      *reused = e && intern_equal(e.value(), v);
+      if(!*reused)
+        {
+          e = pool.create_packed_value(v);
+        }
+      return e;
+    }
+
+    void
+    clear(void)
+    {
+      for(unsigned int i = 0; i < N; ++i)
+        {
+          m_entries[i] = fastuidraw::PainterPackedValue<T>();
+        }
+    }
+
+  private:
+    fastuidraw::vecN<fastuidraw::PainterPackedValue<T>, N> m_entries;
+  };
+
+  /* Creates the PainterPackedValue objects of the item matrix
+     and clip equations of a Painter, interning them through
+     PackedStateCache objects when m_enabled is true.
+   */
+  class PackedStateInterner:fastuidraw::noncopyable
+  {
+  public:
+    PackedStateInterner(fastuidraw::PainterPackedValuePool &pool,
+                        fastuidraw::PainterFrameStats &stats):
+      m_enabled(true),
+      m_pool(pool),
+      m_stats(stats)
+    {}
+
+    template<typename T>
+    fastuidraw::PainterPackedValue<T>
+    create(const T &v)
+    {
+      fastuidraw::PainterPackedValue<T> return_value;
+      bool reused(false);
+
+      if(m_enabled)
+        {
+          return_value = cache(v).fetch(v, m_pool, &reused);
+        }
+      else
+        {
+          return_value = m_pool.create_packed_value(v);
+        }
+
+      if(reused)
+        {
+          ++m_stats.m_counters[fastuidraw::PainterFrameStats::packed_state_interned];
+        }
+      else
+        {
+          ++m_stats.m_counters[fastuidraw::PainterFrameStats::packed_state_created];
+        }
+      return return_value;
+    }
+
+    void
+    enabled(bool v)
+    {
+      m_enabled = v;
+      if(!m_enabled)
+        {
+          m_item_matrices.clear();
+          m_clip_equations.clear();
+        }
+    }
+
+    bool
+    enabled(void) const
+    {
+      return m_enabled;
+    }
+
+  private:
+    PackedStateCache<fastuidraw::PainterItemMatrix, 256>&
+    cache(const fastuidraw::PainterItemMatrix&)
+    {
+      return m_item_matrices;
+    }
+
+    PackedStateCache<fastuidraw::PainterClipEquations, 64>&
+    cache(const fastuidraw::PainterClipEquations&)
+    {
+      return m_clip_equations;
+    }
+
+    bool m_enabled;
+    fastuidraw::PainterPackedValuePool &m_pool;
+    fastuidraw::PainterFrameStats &m_stats;
+    PackedStateCache<fastuidraw::PainterItemMatrix, 256> m_item_matrices;
+    PackedStateCache<fastuidraw::PainterClipEquations, 64> m_clip_equations;
+  };
+
   /* Tracks the most recent clipping rect:
      - the 4 clip equations in clip-coordinates
      - the current transformation from item coordinates
@@ -424,11 +677,11 @@ namespace
     }
 
     const fastuidraw::PainterPackedValue<fastuidraw::PainterItemMatrix>&
-    current_item_marix_state(fastuidraw::PainterPackedValuePool &pool)
+    current_item_marix_state(PackedStateInterner &interner)
     {
       if(!m_item_matrix_state)
         {
-          m_item_matrix_state = pool.create_packed_value(m_item_matrix);
+          m_item_matrix_state = interner.create(m_item_matrix);
         }
       return m_item_matrix_state;
     }
@@ -444,11 +697,11 @@ namespace
     }
 
     const fastuidraw::PainterPackedValue<fastuidraw::PainterClipEquations>&
-    clip_equations_state(fastuidraw::PainterPackedValuePool &pool)
+    clip_equations_state(PackedStateInterner &interner)
     {
       if(!m_clip_equations_state)
         {
-          m_clip_equations_state = pool.create_packed_value(m_clip_equations);
+          m_clip_equations_state = interner.create(m_clip_equations);
         }
       return m_clip_equations_state;
     }
@@ -492,21 +745,18 @@ namespace
   class occluder_stack_entry
   {
   public:
-    /* steals the data it does.
-     */
     explicit
-    occluder_stack_entry(std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw::DelayedAction> > &pz)
-    {
-      m_set_occluder_z.swap(pz);
-    }
+    occluder_stack_entry(const fastuidraw::reference_counted_ptr<ZDataCallBack> &pz):
+      m_set_occluder_z(pz)
+    {}
 
     void
     on_pop(fastuidraw::Painter *p);
 
   private:
-    /* action to execute on popping.
+    /* finalizes the z-value of the occluders on popping.
      */
-    std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw::DelayedAction> > m_set_occluder_z;
+    fastuidraw::reference_counted_ptr<ZDataCallBack> m_set_occluder_z;
   };
 
   class state_stack_entry
@@ -619,6 +869,39 @@ namespace
     std::vector<fastuidraw::vec3> m_current;
   };
 
+  /* adds the time from its construction to its destruction
+     to a timer of a PainterFrameStats, does nothing if the
+     timer is nullptr.
+   */
+  class frame_timer:fastuidraw::noncopyable
+  {
+  public:
+    explicit
+    frame_timer(uint64_t *dst):
+      m_dst(dst)
+    {
+      if(m_dst)
+        {
+          m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~frame_timer()
+    {
+      if(m_dst)
+        {
+          std::chrono::steady_clock::duration d;
+
+          d = std::chrono::steady_clock::now() - m_start;
+          *m_dst += std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+        }
+    }
+
+  private:
+    uint64_t *m_dst;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
   class PainterWorkRoom
   {
   public:
@@ -644,6 +927,62 @@ namespace
     std::vector<int> m_fill_aa_fuzz_index_adjusts;
     fastuidraw::StrokedPath::ScratchSpace m_stroked_path_scratch;
     fastuidraw::FilledPath::ScratchSpace m_filled_path_scratch;
+    fastuidraw::PainterGlyphRunBounds::ScratchSpace m_glyph_run_scratch;
+    std::vector<fastuidraw::range_type<unsigned int> > m_glyph_ranges;
+    std::vector<fastuidraw::const_c_array<fastuidraw::PainterAttribute> > m_glyph_attrib_chunks;
+    std::vector<fastuidraw::const_c_array<fastuidraw::PainterIndex> > m_glyph_index_chunks;
+    std::vector<int> m_glyph_index_adjusts;
+  };
+
+  /* A ClipPathCacheEntry holds the subsets of a FilledPath
+     selected for drawing the occluder of a clipOutPath() or
+     clipInPath() together with what determined the selection,
+     so that the selection can be reused by a later clip by the
+     same path without choosing a threshhold or getting a
+     tessellation. The entry is keyed by the Path and by
+     Path::tessellation_stamp(), together with what the choice
+     of the threshhold depends on. The TessellatedPath is not
+     held: while the stamp is unchanged, the Path still holds
+     it and so the attribute and index data of the chunks are
+     alive. Hence an entry does not keep a TessellatedPath
+     released by the PathLODCache of the Path; such an entry
+     no longer matches and is dropped at the next end().
+   */
+  class ClipPathCacheEntry
+  {
+  public:
+    bool
+    matches(const fastuidraw::Path *path, uint64_t stamp,
+            enum fastuidraw::PainterEnums::fill_rule_t fill_rule,
+            const fastuidraw::float3x3 &item_matrix,
+            fastuidraw::const_c_array<fastuidraw::vec3> clip_equations,
+            const fastuidraw::vec2 &resolution, float curve_flatness) const
+    {
+      return m_path == path
+        && m_stamp == stamp
+        && m_fill_rule == fill_rule
+        && m_item_matrix.raw_data() == item_matrix.raw_data()
+        && m_clip_equations.size() == clip_equations.size()
+        && std::equal(clip_equations.begin(), clip_equations.end(), m_clip_equations.begin())
+        && m_resolution == resolution
+        && m_curve_flatness == curve_flatness;
+    }
+
+    const fastuidraw::Path *m_path;
+    uint64_t m_stamp;
+    enum fastuidraw::PainterEnums::fill_rule_t m_fill_rule;
+    fastuidraw::float3x3 m_item_matrix;
+    std::vector<fastuidraw::vec3> m_clip_equations;
+    fastuidraw::vec2 m_resolution;
+    float m_curve_flatness;
+
+    std::vector<fastuidraw::const_c_array<fastuidraw::PainterAttribute> > m_attrib_chunks;
+    std::vector<fastuidraw::const_c_array<fastuidraw::PainterIndex> > m_index_chunks;
+    std::vector<int> m_index_adjusts;
+    unsigned int m_number_culled;
+
+    /* true if used since the last Painter::end() */
+    bool m_used;
   };
 
   class PainterPrivate
@@ -669,6 +1008,21 @@ namespace
                  int z,
                  const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back);
 
+    /* draws the occluder of clipOutPath(), taking the
+       subsets to draw from m_clip_path_cache.
+     */
+    void
+    draw_cached_occluder(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                         const fastuidraw::Path &path,
+                         enum fastuidraw::PainterEnums::fill_rule_t fill_rule,
+                         const fastuidraw::reference_counted_ptr<ZDataCallBack> &callback);
+
+    /* removes the entries of m_clip_path_cache not
+       used since the last call.
+     */
+    void
+    retire_clip_path_cache(void);
+
     void
     draw_anti_alias_fuzz(const fastuidraw::PainterFillShader &shader, const fastuidraw::PainterData &draw,
                          const fastuidraw::FilledPath &filled_path, fastuidraw::const_c_array<unsigned int> subsets,
@@ -679,6 +1033,32 @@ namespace
     update_clip_equation_series(const fastuidraw::vec2 &pmin,
                                 const fastuidraw::vec2 &pmax);
 
+    const fastuidraw::reference_counted_ptr<fastuidraw::PainterBlendShader>&
+    current_blend_shader(void) const
+    {
+      return (m_recorder) ? m_recorder->blend_shader() : m_core->blend_shader();
+    }
+
+    fastuidraw::BlendMode::packed_value
+    current_blend_mode(void) const
+    {
+      return (m_recorder) ? m_recorder->blend_mode() : m_core->blend_mode();
+    }
+
+    void
+    current_blend_shader(const fastuidraw::reference_counted_ptr<fastuidraw::PainterBlendShader> &h,
+                         fastuidraw::BlendMode::packed_value mode)
+    {
+      if(m_recorder)
+        {
+          m_recorder->blend_shader(h, mode);
+        }
+      else
+        {
+          m_core->blend_shader(h, mode);
+        }
+    }
+
     float
     select_path_thresh(const fastuidraw::Path &path);
 
@@ -688,6 +1068,35 @@ namespace
     float
     select_path_thresh_perspective(const fastuidraw::Path &path);
 
+    /* returns the tessellation of path for thresh, asynchronously
+       if m_async_tessellation is non-null; derivatives and
+       out_pending are passed to Path::tessellation_async().
+     */
+    const fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath>&
+    tessellation(const fastuidraw::Path &path, float thresh, uint32_t derivatives,
+                 bool *out_pending = nullptr);
+
+    const fastuidraw::FilledPath&
+    filled_path(const fastuidraw::Path &path, float thresh);
+
+    const fastuidraw::StrokedPath&
+    stroked_path(const fastuidraw::Path &path, float thresh);
+
+    /* returns the timer of m_current_frame_stats to
+       which to add time or nullptr if not timing.
+     */
+    uint64_t*
+    timer(enum fastuidraw::PainterFrameStats::timer_t t)
+    {
+      return (m_time_frame_stats) ? &m_current_frame_stats.m_timers[t] : nullptr;
+    }
+
+    void
+    start_frame_stats(void)
+    {
+      m_current_frame_stats = fastuidraw::PainterFrameStats();
+    }
+
     fastuidraw::vec2 m_resolution;
     fastuidraw::vec2 m_one_pixel_width;
     float m_curve_flatness;
@@ -696,13 +1105,42 @@ namespace
     std::vector<occluder_stack_entry> m_occluder_stack;
     std::vector<state_stack_entry> m_state_stack;
     fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker> m_core;
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterPackerRecorder> m_recorder;
+
+    /* capture in progress, see Painter::begin_draw_capture() */
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterDrawList> m_draw_capture;
     fastuidraw::PainterPackedValuePool m_pool;
     fastuidraw::PainterPackedValue<fastuidraw::PainterBrush> m_reset_brush, m_black_brush;
     fastuidraw::PainterPackedValue<fastuidraw::PainterItemMatrix> m_identiy_matrix;
     ClipEquationStore m_clip_store;
     PainterWorkRoom m_work_room;
     unsigned int m_max_attribs_per_block, m_max_indices_per_block;
+
+    /* stats of the last frame ended and of the current frame */
+    fastuidraw::PainterFrameStats m_frame_stats, m_current_frame_stats;
+    bool m_time_frame_stats;
+
+    /* creates the packed values of the item matrix and clip
+       equations, see Painter::intern_packed_state()
+     */
+    PackedStateInterner m_packed_state;
+
+    /* see Painter::async_tessellation() */
+    fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> m_async_tessellation;
+
+    fastuidraw::reference_counted_ptr<ZDelayedActionPool> m_z_action_pool;
+    bool m_cache_clip_paths;
+    std::vector<ClipPathCacheEntry> m_clip_path_cache;
+    unsigned int m_clip_path_cache_cursor;
+
+    /* used for a selection that is not cached, i.e. when
+       m_clip_path_cache is full or the tessellation is pending
+     */
+    ClipPathCacheEntry m_clip_path_scratch_entry;
   };
+
+  /* maximum number of clip paths cached across frames */
+  const unsigned int clip_path_cache_size = 256;
 }
 
 //////////////////////////////////////////
@@ -768,13 +1206,7 @@ on_pop(fastuidraw::Painter *p)
      is drawn below them.
    */
   p->increment_z();
-  for(unsigned int i = 0, endi = m_set_occluder_z.size(); i < endi; ++i)
-    {
-      ZDelayedAction *ptr;
-      FASTUIDRAWassert(dynamic_cast<ZDelayedAction*>(m_set_occluder_z[i].get()) != nullptr);
-      ptr = static_cast<ZDelayedAction*>(m_set_occluder_z[i].get());
-      ptr->finalize_z(p->current_z());
-    }
+  m_set_occluder_z->finalize_z(p->current_z());
 }
 
 ///////////////////////////////////////////////
@@ -967,7 +1399,8 @@ PainterPrivate(fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> bac
   m_resolution(1.0f, 1.0f),
   m_one_pixel_width(1.0f, 1.0f),
   m_curve_flatness(1.0f),
-  m_pool(backend->configuration_base().alignment())
+  m_pool(backend->configuration_base().alignment()),
+  m_packed_state(m_pool, m_current_frame_stats)
 {
   m_core = FASTUIDRAWnew fastuidraw::PainterPacker(backend);
   m_reset_brush = m_pool.create_packed_value(fastuidraw::PainterBrush());
@@ -977,6 +1410,10 @@ PainterPrivate(fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> bac
   m_current_z = 1;
   m_max_attribs_per_block = backend->attribs_per_mapping();
   m_max_indices_per_block = backend->indices_per_mapping();
+  m_time_frame_stats = false;
+  m_z_action_pool = FASTUIDRAWnew ZDelayedActionPool();
+  m_cache_clip_paths = true;
+  m_clip_path_cache_cursor = 0;
 }
 
 bool
@@ -1134,46 +1571,45 @@ select_path_thresh_perspective(const fastuidraw::Path &path)
       return -1.0f;
     }
 
-  /* Get the area of the polygon in item coordinates
-     and in pixel coodinates. The square root of that
-     ratio of the area is what we are going to use as
-     our "d". Bad things happen if the clipped polygon
-     still has points where w == 0.0.
-
-     TODO: is using area wise? With perpsective, different
-     portions of the path will be zoomed in more than
-     others. The area represents a kind of average. Perhaps
-     we should take at each point the distortion of the
-     transformation at the point and take the worse of
-     the bunch.
+  /* Different portions of the path are magnified by
+     different amounts under perspective. For the projective
+     map (x, y) --> (X / W, Y / W) where (X, Y, W) = m * (x, y, 1),
+     the area distortion at a point is |det(m)| / |W|^3. Since
+     W is an affine function of (x, y) and the clipped polygon
+     is convex, the largest magnification over the visible
+     portion of the path is realized at a vertex of the clipped
+     polygon: the vertex closest to the camera. We take that
+     worst case (instead of the average over the polygon) so
+     that the portion of the path closest to the camera is not
+     under-tessellated; portions that are clipped do not
+     contribute at all. The multiplier 0.25 is the same as in
+     select_path_thresh_non_perspective(), so that the two
+     agree when m has no perspective.
   */
-  float area_local_coords(0.0f), area_pixel_coords(0.0f), ratio;
-  for(unsigned int i = 0, endi = poly.size(); i < endi; ++i)
-    {
-      unsigned int next_i;
-      next_i = (i == endi - 1) ? 0 : i + 1u;
-
-      fastuidraw::vec2 p(poly[i]);
-      fastuidraw::vec2 q(poly[next_i]);
-      area_local_coords += p.x() * q.y() - q.x() * p.y();
-
-      fastuidraw::vec3 c_p, c_q;
-      c_p = m * fastuidraw::vec3(p.x(), p.y(), 1.0f);
-      c_q = m * fastuidraw::vec3(q.x(), q.y(), 1.0f);
+  float min_w, det, d;
 
-      p = m_resolution * fastuidraw::vec2(c_p.x(), c_p.y()) / c_p.z();
-      q = m_resolution * fastuidraw::vec2(c_q.x(), c_q.y()) / c_q.z();
-      area_pixel_coords += p.x() * q.y() - q.x() * p.y();
+  min_w = fastuidraw::t_abs(m(2, 0) * poly[0].x() + m(2, 1) * poly[0].y() + m(2, 2));
+  for(unsigned int i = 1, endi = poly.size(); i < endi; ++i)
+    {
+      float w;
+      w = fastuidraw::t_abs(m(2, 0) * poly[i].x() + m(2, 1) * poly[i].y() + m(2, 2));
+      min_w = fastuidraw::t_min(min_w, w);
     }
 
-  area_local_coords = fastuidraw::t_abs(area_local_coords);
-  area_pixel_coords = fastuidraw::t_abs(area_pixel_coords);
-  if(area_local_coords <= 0.0f || area_pixel_coords <= 0.0f)
+  det = fastuidraw::t_abs(m.determinate());
+  if(min_w <= 0.0f || det <= 0.0f)
     {
+      /* Bad things happen if the clipped polygon still
+         has points where w == 0.0.
+      */
       return -1.0f;
     }
-  ratio = area_local_coords / area_pixel_coords;
-  return m_curve_flatness * fastuidraw::t_sqrt(ratio);
+
+  d = det / (min_w * min_w * min_w);
+  d *= 0.25f * m_resolution.x() * m_resolution.y();
+  d = fastuidraw::t_sqrt(d);
+
+  return m_curve_flatness / d;
 }
 
 float
@@ -1205,25 +1641,237 @@ draw_generic(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShad
              int z,
              const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back)
 {
+  frame_timer ft(timer(fastuidraw::PainterFrameStats::packing_time));
   fastuidraw::PainterPackerData p(draw);
 
-  p.m_clip = m_clip_rect_state.clip_equations_state(m_pool);
-  p.m_matrix = m_clip_rect_state.current_item_marix_state(m_pool);
-  m_core->draw_generic(shader, p, attrib_chunks, index_chunks, index_adjusts, attrib_chunk_selector, z, call_back);
+  p.m_clip = m_clip_rect_state.clip_equations_state(m_packed_state);
+  p.m_matrix = m_clip_rect_state.current_item_marix_state(m_packed_state);
+  if(m_recorder)
+    {
+      m_recorder->draw_generic(shader, p, attrib_chunks, index_chunks, index_adjusts, attrib_chunk_selector, z, call_back);
+    }
+  else
+    {
+      m_core->draw_generic(shader, p, attrib_chunks, index_chunks, index_adjusts, attrib_chunk_selector, z, call_back);
+    }
+}
+
+void
+PainterPrivate::
+draw_generic(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+             const fastuidraw::PainterData &draw,
+             const fastuidraw::PainterPacker::DataWriter &src,
+             int z,
+             const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back)
+{
+  frame_timer ft(timer(fastuidraw::PainterFrameStats::packing_time));
+  fastuidraw::PainterPackerData p(draw);
+
+  p.m_clip = m_clip_rect_state.clip_equations_state(m_packed_state);
+  p.m_matrix = m_clip_rect_state.current_item_marix_state(m_packed_state);
+  if(m_recorder)
+    {
+      m_recorder->draw_generic(shader, p, src, z, call_back);
+    }
+  else
+    {
+      m_core->draw_generic(shader, p, src, z, call_back);
+    }
+}
+
+const fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath>&
+PainterPrivate::
+tessellation(const fastuidraw::Path &path, float thresh, uint32_t derivatives,
+             bool *out_pending)
+{
+  if(out_pending)
+    {
+      *out_pending = false;
+    }
+
+  if(m_async_tessellation)
+    {
+      bool pending(false);
+      const fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> &tess
+        (path.tessellation_async(thresh, *m_async_tessellation, derivatives, &pending));
+
+      if(pending)
+        {
+          ++m_current_frame_stats.m_counters[fastuidraw::PainterFrameStats::coarse_tessellations_drawn];
+        }
+      if(out_pending)
+        {
+          *out_pending = pending;
+        }
+      return tess;
+    }
+  return path.tessellation(thresh);
+}
+
+const fastuidraw::FilledPath&
+PainterPrivate::
+filled_path(const fastuidraw::Path &path, float thresh)
+{
+  frame_timer ft(timer(fastuidraw::PainterFrameStats::tessellation_time));
+  return *tessellation(path, thresh, fastuidraw::Path::filled_derivative)->filled();
+}
+
+const fastuidraw::StrokedPath&
+PainterPrivate::
+stroked_path(const fastuidraw::Path &path, float thresh)
+{
+  frame_timer ft(timer(fastuidraw::PainterFrameStats::tessellation_time));
+  return *tessellation(path, thresh, fastuidraw::Path::stroked_derivative)->stroked();
+}
+
+void
+PainterPrivate::
+draw_cached_occluder(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                     const fastuidraw::Path &path,
+                     enum fastuidraw::PainterEnums::fill_rule_t fill_rule,
+                     const fastuidraw::reference_counted_ptr<ZDataCallBack> &callback)
+{
+  using namespace fastuidraw;
+
+  const float3x3 &item_matrix(m_clip_rect_state.item_matrix());
+  const_c_array<vec3> clip_equations(m_clip_store.current());
+  ClipPathCacheEntry *entry(nullptr);
+
+  /* a frame typically clips in the same order as the previous
+     frame, so start the search after the entry last used.
+   */
+  for(unsigned int n = 0, endn = m_clip_path_cache.size(); n < endn && !entry; ++n)
+    {
+      unsigned int i;
+
+      i = (m_clip_path_cache_cursor + n) % endn;
+      if(m_clip_path_cache[i].matches(&path, path.tessellation_stamp(), fill_rule,
+                                      item_matrix, clip_equations,
+                                      m_resolution, m_curve_flatness))
+        {
+          entry = &m_clip_path_cache[i];
+          m_clip_path_cache_cursor = i + 1;
+          ++m_current_frame_stats.m_counters[PainterFrameStats::occluders_from_cache];
+        }
+    }
+
+  /* the TessellatedPath is held until the occluder is
+     drawn, for the case where entry is not kept.
+   */
+  reference_counted_ptr<const TessellatedPath> tess;
+  if(!entry)
+    {
+      const FilledPath *filled_path;
+      unsigned int idx_chunk, num_subsets;
+      bool pending;
+      float thresh;
+
+      thresh = select_path_thresh(path);
+      {
+        frame_timer ft(timer(PainterFrameStats::tessellation_time));
+        tess = tessellation(path, thresh, Path::filled_derivative, &pending);
+      }
+
+      /* a coarser tessellation drawn while a finer one is made
+         is not cached: the hits would keep drawing it since the
+         finer one is only added to the Path by a later call to
+         tessellation().
+       */
+      if(m_clip_path_cache.size() < clip_path_cache_size && !pending)
+        {
+          m_clip_path_cache.push_back(ClipPathCacheEntry());
+          entry = &m_clip_path_cache.back();
+          m_clip_path_cache_cursor = m_clip_path_cache.size();
+        }
+      else
+        {
+          entry = &m_clip_path_scratch_entry;
+        }
+
+      {
+        frame_timer ft(timer(PainterFrameStats::tessellation_time));
+        filled_path = tess->filled().get();
+      }
+
+      /* the stamp is read after tessellation(), which may
+         make or release tessellations of path.
+       */
+      entry->m_path = &path;
+      entry->m_stamp = path.tessellation_stamp();
+      entry->m_fill_rule = fill_rule;
+      entry->m_item_matrix = item_matrix;
+      entry->m_clip_equations.resize(clip_equations.size());
+      std::copy(clip_equations.begin(), clip_equations.end(), entry->m_clip_equations.begin());
+      entry->m_resolution = m_resolution;
+      entry->m_curve_flatness = m_curve_flatness;
+
+      m_work_room.m_fill_subset_selector.resize(filled_path->number_subsets());
+      {
+        frame_timer ft(timer(PainterFrameStats::subset_selection_time));
+        num_subsets = filled_path->select_subsets(m_work_room.m_filled_path_scratch,
+                                                  clip_equations, item_matrix,
+                                                  m_max_attribs_per_block,
+                                                  m_max_indices_per_block,
+                                                  make_c_array(m_work_room.m_fill_subset_selector));
+      }
+      entry->m_number_culled = m_work_room.m_filled_path_scratch.number_culled();
+
+      idx_chunk = FilledPath::Subset::chunk_from_fill_rule(fill_rule);
+      entry->m_attrib_chunks.clear();
+      entry->m_index_chunks.clear();
+      entry->m_index_adjusts.clear();
+      for(unsigned int i = 0; i < num_subsets; ++i)
+        {
+          FilledPath::Subset subset(filled_path->subset(m_work_room.m_fill_subset_selector[i]));
+          const PainterAttributeData &data(subset.painter_data());
+
+          entry->m_attrib_chunks.push_back(data.attribute_data_chunk(0));
+          entry->m_index_chunks.push_back(data.index_data_chunk(idx_chunk));
+          entry->m_index_adjusts.push_back(data.index_adjust_chunk(idx_chunk));
+        }
+    }
+
+  entry->m_used = true;
+  m_current_frame_stats.m_counters[PainterFrameStats::fill_subsets_drawn] += entry->m_attrib_chunks.size();
+  m_current_frame_stats.m_counters[PainterFrameStats::fill_subsets_culled] += entry->m_number_culled;
+  if(entry->m_attrib_chunks.empty())
+    {
+      return;
+    }
+
+  /* same as Painter::fill_path() without anti-aliasing */
+  draw_generic(shader, PainterData(m_black_brush),
+               make_c_array(entry->m_attrib_chunks),
+               make_c_array(entry->m_index_chunks),
+               make_c_array(entry->m_index_adjusts),
+               const_c_array<unsigned int>(),
+               m_current_z, callback);
+  if(m_core->reorder_opaque_draws())
+    {
+      ++m_current_z;
+    }
 }
 
 void
 PainterPrivate::
-draw_generic(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
-             const fastuidraw::PainterData &draw,
-             const fastuidraw::PainterPacker::DataWriter &src,
-             int z,
-             const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back)
+retire_clip_path_cache(void)
 {
-  fastuidraw::PainterPackerData p(draw);
-  p.m_clip = m_clip_rect_state.clip_equations_state(m_pool);
-  p.m_matrix = m_clip_rect_state.current_item_marix_state(m_pool);
-  m_core->draw_generic(shader, p, src, z, call_back);
+  unsigned int num_kept(0);
+
+  for(unsigned int i = 0, endi = m_clip_path_cache.size(); i < endi; ++i)
+    {
+      if(m_clip_path_cache[i].m_used)
+        {
+          m_clip_path_cache[i].m_used = false;
+          if(num_kept != i)
+            {
+              std::swap(m_clip_path_cache[num_kept], m_clip_path_cache[i]);
+            }
+          ++num_kept;
+        }
+    }
+  m_clip_path_cache.resize(num_kept);
+  m_clip_path_cache_cursor = 0;
 }
 
 void
@@ -1335,6 +1983,7 @@ begin(bool reset_z)
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
 
+  FASTUIDRAWassert(!d->m_recorder);
   d->m_core->begin();
 
   if(reset_z)
@@ -1343,6 +1992,48 @@ begin(bool reset_z)
     }
   d->m_clip_rect_state.reset();
   d->m_clip_store.set_current(d->m_clip_rect_state.clip_equations().m_clip_equations);
+  d->start_frame_stats();
+  blend_shader(PainterEnums::blend_porter_duff_src_over);
+}
+
+void
+fastuidraw::Painter::
+begin(const reference_counted_ptr<PainterPackerRecorder> &recorder, bool reset_z)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  FASTUIDRAWassert(recorder);
+  FASTUIDRAWassert(!d->m_recorder);
+  d->m_recorder = recorder;
+
+  if(reset_z)
+    {
+      d->m_current_z = 1;
+    }
+  d->m_clip_rect_state.reset();
+  d->m_clip_store.set_current(d->m_clip_rect_state.clip_equations().m_clip_equations);
+  d->start_frame_stats();
+  blend_shader(PainterEnums::blend_porter_duff_src_over);
+}
+
+void
+fastuidraw::Painter::
+begin(const reference_counted_ptr<PainterDrawList> &capture, bool reset_z)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  FASTUIDRAWassert(!d->m_recorder);
+  d->m_core->begin(capture);
+
+  if(reset_z)
+    {
+      d->m_current_z = 1;
+    }
+  d->m_clip_rect_state.reset();
+  d->m_clip_store.set_current(d->m_clip_rect_state.clip_equations().m_clip_equations);
+  d->start_frame_stats();
   blend_shader(PainterEnums::blend_porter_duff_src_over);
 }
 
@@ -1353,6 +2044,8 @@ end(void)
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
 
+  FASTUIDRAWassert(!d->m_draw_capture);
+
   /* pop m_clip_stack to perform necessary writes
    */
   while(!d->m_occluder_stack.empty())
@@ -1364,7 +2057,80 @@ end(void)
    */
   d->m_clip_store.clear();
   d->m_state_stack.clear();
-  d->m_core->end();
+  d->retire_clip_path_cache();
+  if(d->m_recorder)
+    {
+      d->m_recorder = reference_counted_ptr<PainterPackerRecorder>();
+    }
+  else
+    {
+      d->m_core->end();
+      for(unsigned int i = 0; i < PainterPacker::num_stats; ++i)
+        {
+          enum PainterPacker::stats_t st;
+
+          st = static_cast<enum PainterPacker::stats_t>(i);
+          d->m_current_frame_stats.m_packer_stats[st] = d->m_core->query_stat(st);
+        }
+    }
+  d->m_frame_stats = d->m_current_frame_stats;
+}
+
+unsigned int
+fastuidraw::Painter::
+draw_list(const PainterDrawList &list)
+{
+  PainterPrivate *d;
+  range_type<int> R(list.z_range());
+  unsigned int return_value;
+
+  d = static_cast<PainterPrivate*>(m_d);
+  FASTUIDRAWassert(!d->m_recorder);
+  {
+    frame_timer ft(d->timer(PainterFrameStats::packing_time));
+    return_value = d->m_core->draw_list(list, d->m_current_z - R.m_begin);
+  }
+  d->m_current_z += R.difference();
+  return return_value;
+}
+
+bool
+fastuidraw::Painter::
+begin_draw_capture(const reference_counted_ptr<PainterDrawList> &list)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  FASTUIDRAWassert(list);
+  FASTUIDRAWassert(!d->m_recorder);
+  FASTUIDRAWassert(!d->m_draw_capture);
+  if(list->captured())
+    {
+      draw_list(*list);
+      return false;
+    }
+
+  /* save() so that end_draw_capture() pops the clipping of
+     the captured content, whose occluders then get their
+     z-value during the capture.
+   */
+  save();
+  d->m_draw_capture = list;
+  d->m_core->begin_capture(list);
+  return true;
+}
+
+void
+fastuidraw::Painter::
+end_draw_capture(void)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  FASTUIDRAWassert(d->m_draw_capture);
+  restore();
+  d->m_core->end_capture();
+  d->m_draw_capture = reference_counted_ptr<PainterDrawList>();
 }
 
 void
@@ -1522,6 +2288,13 @@ draw_convex_polygon(const PainterFillShader &shader,
 		      call_back);
       ++d->m_current_z;
     }
+  else if(d->m_core->reorder_opaque_draws())
+    {
+      /* give the next item a larger z-value so that
+         PainterPacker can reorder it with this item.
+       */
+      ++d->m_current_z;
+    }
 }
 
 void
@@ -1824,18 +2597,25 @@ stroke_path_common(const PainterStrokeShader &shader, const PainterData &draw,
 
   float pixels_additional_room(0.0f), item_space_additional_room(0.0f);
   shader.stroking_data_selector()->stroking_distances(raw_data, &pixels_additional_room, &item_space_additional_room);
-  path.compute_chunks(d->m_work_room.m_stroked_path_scratch,
-                      dash_evaluator, draw.m_item_shader_data.data().data_base(),
-                      d->m_clip_store.current(),
-                      d->m_clip_rect_state.item_matrix(),
-                      d->m_one_pixel_width,
-                      pixels_additional_room,
-                      item_space_additional_room,
-                      close_contours,
-                      d->m_max_attribs_per_block,
-                      d->m_max_indices_per_block,
-                      is_miter_join,
-                      d->m_work_room.m_stroke_chunk_set);
+  {
+    frame_timer ft(d->timer(PainterFrameStats::subset_selection_time));
+    path.compute_chunks(d->m_work_room.m_stroked_path_scratch,
+                        dash_evaluator, draw.m_item_shader_data.data().data_base(),
+                        d->m_clip_store.current(),
+                        d->m_clip_rect_state.item_matrix(),
+                        d->m_one_pixel_width,
+                        pixels_additional_room,
+                        item_space_additional_room,
+                        close_contours,
+                        d->m_max_attribs_per_block,
+                        d->m_max_indices_per_block,
+                        is_miter_join,
+                        d->m_work_room.m_stroke_chunk_set);
+  }
+  d->m_current_frame_stats.m_counters[PainterFrameStats::stroke_subsets_drawn]
+    += d->m_work_room.m_stroked_path_scratch.number_selected();
+  d->m_current_frame_stats.m_counters[PainterFrameStats::stroke_subsets_culled]
+    += d->m_work_room.m_stroked_path_scratch.number_culled();
 
   stroke_path(shader, draw,
               edge_data, d->m_work_room.m_stroke_chunk_set.edge_chunks(),
@@ -1871,7 +2651,7 @@ stroke_path(const PainterStrokeShader &shader, const PainterData &draw, const Pa
 
   d = static_cast<PainterPrivate*>(m_d);
   thresh = d->select_path_thresh(path);
-  stroke_path(shader, draw, *path.tessellation(thresh)->stroked(), thresh,
+  stroke_path(shader, draw, d->stroked_path(path, thresh), thresh,
               close_contours, cp, js, with_anti_aliasing, call_back);
 }
 
@@ -1926,7 +2706,7 @@ stroke_dashed_path(const PainterDashedStrokeShaderSet &shader, const PainterData
 
   d = static_cast<PainterPrivate*>(m_d);
   thresh = d->select_path_thresh(path);
-  stroke_dashed_path(shader, draw, *path.tessellation(thresh)->stroked(), thresh,
+  stroke_dashed_path(shader, draw, d->stroked_path(path, thresh), thresh,
                      close_contours, cp, js, with_anti_aliasing, call_back);
 }
 
@@ -1972,12 +2752,18 @@ fill_path(const PainterFillShader &shader, const PainterData &draw,
   atr_chunk = 0;
 
   d->m_work_room.m_fill_subset_selector.resize(filled_path.number_subsets());
-  num_subsets = filled_path.select_subsets(d->m_work_room.m_filled_path_scratch,
-                                           d->m_clip_store.current(),
-                                           d->m_clip_rect_state.item_matrix(),
-                                           d->m_max_attribs_per_block,
-                                           d->m_max_indices_per_block,
-                                           make_c_array(d->m_work_room.m_fill_subset_selector));
+  {
+    frame_timer ft(d->timer(PainterFrameStats::subset_selection_time));
+    num_subsets = filled_path.select_subsets(d->m_work_room.m_filled_path_scratch,
+                                             d->m_clip_store.current(),
+                                             d->m_clip_rect_state.item_matrix(),
+                                             d->m_max_attribs_per_block,
+                                             d->m_max_indices_per_block,
+                                             make_c_array(d->m_work_room.m_fill_subset_selector));
+  }
+  d->m_current_frame_stats.m_counters[PainterFrameStats::fill_subsets_drawn] += num_subsets;
+  d->m_current_frame_stats.m_counters[PainterFrameStats::fill_subsets_culled]
+    += d->m_work_room.m_filled_path_scratch.number_culled();
 
   if(num_subsets == 0)
     {
@@ -2021,6 +2807,13 @@ fill_path(const PainterFillShader &shader, const PainterData &draw,
                               call_back);
       ++d->m_current_z;
     }
+  else if(d->m_core->reorder_opaque_draws())
+    {
+      /* give the next item a larger z-value so that
+         PainterPacker can reorder it with this item.
+       */
+      ++d->m_current_z;
+    }
 }
 
 void
@@ -2035,7 +2828,7 @@ fill_path(const PainterFillShader &shader, const PainterData &draw,
 
   d = static_cast<PainterPrivate*>(m_d);
   thresh = d->select_path_thresh(path);
-  fill_path(shader, draw, *path.tessellation(thresh)->filled(), fill_rule,
+  fill_path(shader, draw, d->filled_path(path, thresh), fill_rule,
             with_anti_aliasing, call_back);
 }
 
@@ -2066,12 +2859,18 @@ fill_path(const PainterFillShader &shader, const PainterData &draw,
     }
 
   d->m_work_room.m_fill_subset_selector.resize(filled_path.number_subsets());
-  num_subsets = filled_path.select_subsets(d->m_work_room.m_filled_path_scratch,
-                                           d->m_clip_store.current(),
-                                           d->m_clip_rect_state.item_matrix(),
-                                           d->m_max_attribs_per_block,
-                                           d->m_max_indices_per_block,
-                                           make_c_array(d->m_work_room.m_fill_subset_selector));
+  {
+    frame_timer ft(d->timer(PainterFrameStats::subset_selection_time));
+    num_subsets = filled_path.select_subsets(d->m_work_room.m_filled_path_scratch,
+                                             d->m_clip_store.current(),
+                                             d->m_clip_rect_state.item_matrix(),
+                                             d->m_max_attribs_per_block,
+                                             d->m_max_indices_per_block,
+                                             make_c_array(d->m_work_room.m_fill_subset_selector));
+  }
+  d->m_current_frame_stats.m_counters[PainterFrameStats::fill_subsets_drawn] += num_subsets;
+  d->m_current_frame_stats.m_counters[PainterFrameStats::fill_subsets_culled]
+    += d->m_work_room.m_filled_path_scratch.number_culled();
 
   if(num_subsets == 0)
     {
@@ -2147,6 +2946,10 @@ fill_path(const PainterFillShader &shader, const PainterData &draw,
                                   call_back);
           ++d->m_current_z;
         }
+      else if(d->m_core->reorder_opaque_draws())
+        {
+          ++d->m_current_z;
+        }
     }
 }
 
@@ -2162,7 +2965,7 @@ fill_path(const PainterFillShader &shader,
 
   d = static_cast<PainterPrivate*>(m_d);
   thresh = d->select_path_thresh(path);
-  fill_path(shader, draw, *path.tessellation(thresh)->filled(), fill_rule,
+  fill_path(shader, draw, d->filled_path(path, thresh), fill_rule,
             with_anti_aliasing, call_back);
 }
 
@@ -2220,6 +3023,95 @@ draw_glyphs(const PainterData &draw,
     }
 }
 
+void
+fastuidraw::Painter::
+draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
+            const PainterAttributeData &data,
+            const PainterGlyphRunBounds &bounds,
+            const reference_counted_ptr<PainterPacker::DataCallBack> &call_back)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  if(d->m_clip_rect_state.m_all_content_culled)
+    {
+      return;
+    }
+
+  FASTUIDRAWassert(bounds.number_chunks() == data.attribute_data_chunks().size());
+  const_c_array<unsigned int> chks(data.non_empty_index_data_chunks());
+  for(unsigned int i = 0; i < chks.size(); ++i)
+    {
+      unsigned int k, num_ranges;
+      const_c_array<PainterAttribute> attribs;
+      const_c_array<PainterIndex> indices;
+      int index_adjust;
+
+      k = chks[i];
+      d->m_work_room.m_glyph_ranges.resize(bounds.number_blocks(k));
+      {
+        frame_timer ft(d->timer(PainterFrameStats::subset_selection_time));
+        num_ranges = bounds.select_glyphs(d->m_work_room.m_glyph_run_scratch,
+                                          d->m_clip_store.current(),
+                                          d->m_clip_rect_state.item_matrix(),
+                                          k, make_c_array(d->m_work_room.m_glyph_ranges));
+      }
+      d->m_current_frame_stats.m_counters[PainterFrameStats::glyphs_culled]
+        += d->m_work_room.m_glyph_run_scratch.number_culled();
+
+      if(num_ranges == 0)
+        {
+          continue;
+        }
+
+      /* glyph j of the chunk has the attributes [4j, 4j + 4)
+         and the indices [6j, 6j + 6) whose values are relative
+         to the start of the chunk; a range [B, E) of glyphs
+         is then the sub-arrays starting at 4B and 6B with
+         the index adjust decremented by 4B.
+       */
+      attribs = data.attribute_data_chunk(k);
+      indices = data.index_data_chunk(k);
+      index_adjust = data.index_adjust_chunk(k);
+      d->m_work_room.m_glyph_attrib_chunks.clear();
+      d->m_work_room.m_glyph_index_chunks.clear();
+      d->m_work_room.m_glyph_index_adjusts.clear();
+      for(unsigned int r = 0; r < num_ranges; ++r)
+        {
+          range_type<unsigned int> R(d->m_work_room.m_glyph_ranges[r]);
+
+          d->m_work_room.m_glyph_attrib_chunks.push_back(attribs.sub_array(4 * R.m_begin, 4 * (R.m_end - R.m_begin)));
+          d->m_work_room.m_glyph_index_chunks.push_back(indices.sub_array(6 * R.m_begin, 6 * (R.m_end - R.m_begin)));
+          d->m_work_room.m_glyph_index_adjusts.push_back(index_adjust - 4 * static_cast<int>(R.m_begin));
+          d->m_current_frame_stats.m_counters[PainterFrameStats::glyphs_drawn] += R.m_end - R.m_begin;
+        }
+
+      draw_generic(shader.shader(static_cast<enum glyph_type>(k)), draw,
+                   make_c_array(d->m_work_room.m_glyph_attrib_chunks),
+                   make_c_array(d->m_work_room.m_glyph_index_chunks),
+                   make_c_array(d->m_work_room.m_glyph_index_adjusts),
+                   call_back);
+    }
+}
+
+void
+fastuidraw::Painter::
+draw_glyphs(const PainterData &draw,
+            const PainterAttributeData &data,
+            const PainterGlyphRunBounds &bounds,
+            bool use_anistopic_antialias,
+            const reference_counted_ptr<PainterPacker::DataCallBack> &call_back)
+{
+  if(use_anistopic_antialias)
+    {
+      draw_glyphs(default_shaders().glyph_shader_anisotropic(), draw, data, bounds, call_back);
+    }
+  else
+    {
+      draw_glyphs(default_shaders().glyph_shader(), draw, data, bounds, call_back);
+    }
+}
+
 const fastuidraw::PainterItemMatrix&
 fastuidraw::Painter::
 transformation(void)
@@ -2244,7 +3136,7 @@ transformation_state(void)
 {
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
-  return d->m_clip_rect_state.current_item_marix_state(d->m_pool);
+  return d->m_clip_rect_state.current_item_marix_state(d->m_packed_state);
 }
 
 void
@@ -2370,8 +3262,8 @@ save(void)
 
   state_stack_entry st;
   st.m_occluder_stack_position = d->m_occluder_stack.size();
-  st.m_blend = d->m_core->blend_shader();
-  st.m_blend_mode = d->m_core->blend_mode();
+  st.m_blend = d->current_blend_shader();
+  st.m_blend_mode = d->current_blend_mode();
   st.m_clip_rect_state = d->m_clip_rect_state;
   st.m_curve_flatness = d->m_curve_flatness;
 
@@ -2390,7 +3282,7 @@ restore(void)
   const state_stack_entry &st(d->m_state_stack.back());
 
   d->m_clip_rect_state = st.m_clip_rect_state;
-  d->m_core->blend_shader(st.m_blend, st.m_blend_mode);
+  d->current_blend_shader(st.m_blend, st.m_blend_mode);
   d->m_curve_flatness = st.m_curve_flatness;
   while(d->m_occluder_stack.size() > st.m_occluder_stack_position)
     {
@@ -2445,19 +3337,28 @@ clipOutPath(const Path &path, enum PainterEnums::fill_rule_t fill_rule)
   reference_counted_ptr<ZDataCallBack> zdatacallback;
 
   /* zdatacallback generates a list of PainterDraw::DelayedAction
-     objects (held in m_actions) who's action is to write the correct
+     objects who's action is to write the correct
      z-value to occlude elements drawn after clipOut but not after
      the next time m_occluder_stack is popped.
    */
-  zdatacallback = FASTUIDRAWnew ZDataCallBack();
+  zdatacallback = FASTUIDRAWnew ZDataCallBack(d->m_current_z, d->m_z_action_pool);
   old_blend = blend_shader();
   old_blend_mode = blend_mode();
 
   blend_shader(PainterEnums::blend_porter_duff_dst);
-  fill_path(PainterData(d->m_black_brush), path, fill_rule, false, zdatacallback);
+  if(d->m_cache_clip_paths)
+    {
+      d->draw_cached_occluder(default_shaders().fill_shader().item_shader(),
+                              path, fill_rule, zdatacallback);
+    }
+  else
+    {
+      fill_path(PainterData(d->m_black_brush), path, fill_rule, false, zdatacallback);
+    }
   blend_shader(old_blend, old_blend_mode);
+  ++d->m_current_frame_stats.m_counters[PainterFrameStats::occluders_drawn];
 
-  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback));
 }
 
 void
@@ -2479,19 +3380,20 @@ clipOutPath(const Path &path, const CustomFillRuleBase &fill_rule)
   reference_counted_ptr<ZDataCallBack> zdatacallback;
 
   /* zdatacallback generates a list of PainterDraw::DelayedAction
-     objects (held in m_actions) who's action is to write the correct
+     objects who's action is to write the correct
      z-value to occlude elements drawn after clipOut but not after
      the next time m_occluder_stack is popped.
    */
-  zdatacallback = FASTUIDRAWnew ZDataCallBack();
+  zdatacallback = FASTUIDRAWnew ZDataCallBack(d->m_current_z, d->m_z_action_pool);
   old_blend = blend_shader();
   old_blend_mode = blend_mode();
 
   blend_shader(PainterEnums::blend_porter_duff_dst);
   fill_path(PainterData(d->m_black_brush), path, fill_rule, false, zdatacallback);
   blend_shader(old_blend, old_blend_mode);
+  ++d->m_current_frame_stats.m_counters[PainterFrameStats::occluders_drawn];
 
-  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback));
 }
 
 void
@@ -2593,14 +3495,14 @@ clipInRect(const vec2 &pmin, const vec2 &wh)
    */
   PainterPackedValue<PainterClipEquations> prev_clip, current_clip;
 
-  prev_clip = d->m_clip_rect_state.clip_equations_state(d->m_pool);
+  prev_clip = d->m_clip_rect_state.clip_equations_state(d->m_packed_state);
   FASTUIDRAWassert(prev_clip);
 
   d->m_clip_rect_state.m_clip_rect = clip_rect(pmin, pmax);
 
   std::bitset<4> skip_occluder;
   skip_occluder = d->m_clip_rect_state.set_clip_equations_to_clip_rect(prev_clip);
-  current_clip = d->m_clip_rect_state.clip_equations_state(d->m_pool);
+  current_clip = d->m_clip_rect_state.clip_equations_state(d->m_packed_state);
 
   if(d->m_clip_rect_state.m_all_content_culled)
     {
@@ -2627,12 +3529,12 @@ clipInRect(const vec2 &pmin, const vec2 &wh)
      state from being marked as dirty.
    */
   PainterPackedValue<PainterItemMatrix> matrix_state;
-  matrix_state = d->m_clip_rect_state.current_item_marix_state(d->m_pool);
+  matrix_state = d->m_clip_rect_state.current_item_marix_state(d->m_packed_state);
   FASTUIDRAWassert(matrix_state);
   d->m_clip_rect_state.item_matrix_state(d->m_identiy_matrix, false);
 
   reference_counted_ptr<ZDataCallBack> zdatacallback;
-  zdatacallback = FASTUIDRAWnew ZDataCallBack();
+  zdatacallback = FASTUIDRAWnew ZDataCallBack(d->m_current_z, d->m_z_action_pool);
 
   fastuidraw::reference_counted_ptr<PainterBlendShader> old_blend;
   BlendMode::packed_value old_blend_mode;
@@ -2664,6 +3566,7 @@ clipInRect(const vec2 &pmin, const vec2 &wh)
         {
           draw_half_plane_complement(PainterData(d->m_black_brush), this,
                                      prev_clip.value().m_clip_equations[i], zdatacallback);
+          ++d->m_current_frame_stats.m_counters[PainterFrameStats::occluders_drawn];
         }
     }
 
@@ -2671,7 +3574,7 @@ clipInRect(const vec2 &pmin, const vec2 &wh)
 
   /* add to occluder stack.
    */
-  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback));
 
   d->m_clip_rect_state.item_matrix_state(matrix_state, false);
   blend_shader(old_blend, old_blend_mode);
@@ -2710,7 +3613,7 @@ blend_shader(void) const
 {
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
-  return d->m_core->blend_shader();
+  return d->current_blend_shader();
 }
 
 fastuidraw::BlendMode::packed_value
@@ -2719,7 +3622,7 @@ blend_mode(void) const
 {
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
-  return d->m_core->blend_mode();
+  return d->current_blend_mode();
 }
 
 void
@@ -2729,7 +3632,7 @@ blend_shader(const fastuidraw::reference_counted_ptr<PainterBlendShader> &h,
 {
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
-  d->m_core->blend_shader(h, mode);
+  d->current_blend_shader(h, mode);
 }
 
 const fastuidraw::PainterShaderSet&
@@ -2750,6 +3653,128 @@ query_stat(enum PainterPacker::stats_t st) const
   return d->m_core->query_stat(st);
 }
 
+const fastuidraw::PainterFrameStats&
+fastuidraw::Painter::
+frame_stats(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_frame_stats;
+}
+
+bool
+fastuidraw::Painter::
+time_frame_stats(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_time_frame_stats;
+}
+
+void
+fastuidraw::Painter::
+time_frame_stats(bool v)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_time_frame_stats = v;
+}
+
+bool
+fastuidraw::Painter::
+cache_clip_paths(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_cache_clip_paths;
+}
+
+void
+fastuidraw::Painter::
+cache_clip_paths(bool v)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_cache_clip_paths = v;
+  if(!v)
+    {
+      d->m_clip_path_cache.clear();
+      d->m_clip_path_cache_cursor = 0;
+    }
+}
+
+const fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool>&
+fastuidraw::Painter::
+async_tessellation(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_async_tessellation;
+}
+
+void
+fastuidraw::Painter::
+async_tessellation(const reference_counted_ptr<ThreadPool> &v)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_async_tessellation = v;
+}
+
+bool
+fastuidraw::Painter::
+intern_packed_state(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_packed_state.enabled();
+}
+
+void
+fastuidraw::Painter::
+intern_packed_state(bool v)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_packed_state.enabled(v);
+}
+
+bool
+fastuidraw::Painter::
+reorder_opaque_draws(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_core->reorder_opaque_draws();
+}
+
+void
+fastuidraw::Painter::
+reorder_opaque_draws(bool v)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_core->reorder_opaque_draws(v);
+}
+
+bool
+fastuidraw::Painter::
+front_to_back_opaque_draws(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_core->front_to_back_opaque_draws();
+}
+
+void
+fastuidraw::Painter::
+front_to_back_opaque_draws(bool v)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_core->front_to_back_opaque_draws(v);
+}
+
 int
 fastuidraw::Painter::
 current_z(void) const
@@ -198,3 +198,21 @@ non_empty_index_data_chunks(void) const
   d = static_cast<PainterAttributeDataPrivate*>(m_d);
   return make_c_array(d->m_non_empty_index_data_chunks);
 }
+
+uint64_t
+fastuidraw::PainterAttributeData::
+memory_usage(void) const
+{
+  PainterAttributeDataPrivate *d;
+  uint64_t return_value(0);
+
+  d = static_cast<PainterAttributeDataPrivate*>(m_d);
+  return_value += d->m_attribute_data.capacity() * sizeof(PainterAttribute);
+  return_value += d->m_index_data.capacity() * sizeof(PainterIndex);
+  return_value += d->m_attribute_chunks.capacity() * sizeof(const_c_array<PainterAttribute>);
+  return_value += d->m_index_chunks.capacity() * sizeof(const_c_array<PainterIndex>);
+  return_value += d->m_z_ranges.capacity() * sizeof(range_type<int>);
+  return_value += d->m_non_empty_index_data_chunks.capacity() * sizeof(unsigned int);
+  return_value += d->m_index_adjust_chunks.capacity() * sizeof(int);
+  return return_value;
+}
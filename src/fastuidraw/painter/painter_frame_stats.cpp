@@ -0,0 +1,98 @@
+/*!
+ * \file painter_frame_stats.cpp
+ * \brief file painter_frame_stats.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <fastuidraw/painter/painter_frame_stats.hpp>
+
+const char*
+fastuidraw::PainterFrameStats::
+label(enum PainterPacker::stats_t st)
+{
+  #define CASE(X) case PainterPacker::X: return #X
+
+  switch(st)
+    {
+      CASE(num_attributes);
+      CASE(num_indices);
+      CASE(num_generic_datas);
+      CASE(num_draws);
+      CASE(num_headers);
+      CASE(num_draw_breaks_avoided);
+      CASE(num_persistent_generic_datas);
+      CASE(num_headers_reused);
+      CASE(num_draw_breaks);
+      CASE(num_draw_breaks_item_group);
+      CASE(num_draw_breaks_blend_group);
+      CASE(num_draw_breaks_brush);
+      CASE(num_draw_breaks_blend_mode);
+      CASE(num_clip_generic_datas);
+      CASE(num_item_matrix_generic_datas);
+      CASE(num_brush_generic_datas);
+      CASE(num_item_shader_generic_datas);
+      CASE(num_blend_shader_generic_datas);
+      CASE(num_compact_attributes);
+    default:
+      return "invalid_stat";
+    }
+
+  #undef CASE
+}
+
+const char*
+fastuidraw::PainterFrameStats::
+label(enum counter_t c)
+{
+  #define CASE(X) case X: return #X
+
+  switch(c)
+    {
+      CASE(fill_subsets_drawn);
+      CASE(fill_subsets_culled);
+      CASE(stroke_subsets_drawn);
+      CASE(stroke_subsets_culled);
+      CASE(occluders_drawn);
+      CASE(occluders_from_cache);
+      CASE(glyphs_drawn);
+      CASE(glyphs_culled);
+      CASE(packed_state_created);
+      CASE(packed_state_interned);
+      CASE(coarse_tessellations_drawn);
+    default:
+      return "invalid_counter";
+    }
+
+  #undef CASE
+}
+
+const char*
+fastuidraw::PainterFrameStats::
+label(enum timer_t t)
+{
+  #define CASE(X) case X: return #X
+
+  switch(t)
+    {
+      CASE(tessellation_time);
+      CASE(subset_selection_time);
+      CASE(packing_time);
+    default:
+      return "invalid_timer";
+    }
+
+  #undef CASE
+}
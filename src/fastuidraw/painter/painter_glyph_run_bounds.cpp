@@ -0,0 +1,347 @@
+/*!
+ * \file painter_glyph_run_bounds.cpp
+ * \brief file painter_glyph_run_bounds.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <vector>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/painter/painter_glyph_run_bounds.hpp>
+#include "../private/util_private.hpp"
+#include "../private/bounding_box.hpp"
+
+namespace
+{
+  enum box_test_t
+    {
+      box_culled,
+      box_unclipped,
+      box_partially_clipped,
+    };
+
+  class ScratchSpacePrivate
+  {
+  public:
+    std::vector<fastuidraw::vec3> m_adjusted_clip_eqs;
+
+    /* number of glyphs culled by the last select_glyphs() */
+    unsigned int m_number_culled;
+  };
+
+  class ChunkBounds
+  {
+  public:
+    typedef fastuidraw::BoundingBox<float> box;
+
+    ChunkBounds(fastuidraw::const_c_array<fastuidraw::PainterAttribute> attribs,
+                unsigned int glyphs_per_block);
+
+    void
+    select_glyphs(ScratchSpacePrivate &scratch,
+                  fastuidraw::c_array<fastuidraw::range_type<unsigned int> > dst,
+                  unsigned int &current) const;
+
+    unsigned int
+    number_blocks(void) const
+    {
+      return m_levels.empty() ? 0u : m_levels[0].size();
+    }
+
+    unsigned int m_glyphs_per_block;
+    unsigned int m_number_glyphs;
+
+    /* m_levels[0][i] is the bounding box of the glyphs of
+       block i, m_levels[L + 1][i] is the union of the
+       m_levels[L][2 * i] and m_levels[L][2 * i + 1]; the
+       last level has a single box.
+     */
+    std::vector<std::vector<box> > m_levels;
+
+  private:
+    void
+    select_glyphs_implement(ScratchSpacePrivate &scratch,
+                            unsigned int level, unsigned int idx,
+                            fastuidraw::c_array<fastuidraw::range_type<unsigned int> > dst,
+                            unsigned int &current) const;
+  };
+
+  class GlyphRunBoundsPrivate
+  {
+  public:
+    unsigned int m_glyphs_per_block;
+    std::vector<ChunkBounds> m_chunks;
+  };
+
+  /* A box is culled if all of its corners are on the
+     wrong side of any one of the clip equations. It is
+     tested by its corners only, so a box near a corner
+     of the clip region might be kept even though it
+     is outside the region; that is fine since the GPU
+     clips what remains.
+   */
+  enum box_test_t
+  test_box(fastuidraw::const_c_array<fastuidraw::vec3> clip_eqs,
+           const fastuidraw::BoundingBox<float> &box)
+  {
+    fastuidraw::vecN<fastuidraw::vec2, 4> pts;
+    bool unclipped(true);
+
+    box.inflated_polygon(pts, 0.0f);
+    for(unsigned int i = 0; i < clip_eqs.size(); ++i)
+      {
+        unsigned int num_inside(0);
+
+        for(unsigned int k = 0; k < 4; ++k)
+          {
+            fastuidraw::vec3 p(pts[k].x(), pts[k].y(), 1.0f);
+            if(fastuidraw::dot(clip_eqs[i], p) >= 0.0f)
+              {
+                ++num_inside;
+              }
+          }
+
+        if(num_inside == 0)
+          {
+            return box_culled;
+          }
+        unclipped = unclipped && (num_inside == 4);
+      }
+    return unclipped ? box_unclipped : box_partially_clipped;
+  }
+}
+
+//////////////////////////////////
+// ChunkBounds methods
+ChunkBounds::
+ChunkBounds(fastuidraw::const_c_array<fastuidraw::PainterAttribute> attribs,
+            unsigned int glyphs_per_block):
+  m_glyphs_per_block(glyphs_per_block),
+  m_number_glyphs(attribs.size() / 4)
+{
+  unsigned int num_blocks;
+
+  FASTUIDRAWassert(attribs.size() % 4 == 0);
+  if(m_number_glyphs == 0)
+    {
+      return;
+    }
+
+  num_blocks = (m_number_glyphs + m_glyphs_per_block - 1) / m_glyphs_per_block;
+  m_levels.push_back(std::vector<box>(num_blocks));
+  for(unsigned int a = 0, endi = attribs.size(); a < endi; ++a)
+    {
+      const fastuidraw::uvec4 &v(attribs[a].m_attrib1);
+      fastuidraw::vec2 p(fastuidraw::unpack_float(v.x()), fastuidraw::unpack_float(v.y()));
+
+      m_levels[0][(a / 4) / m_glyphs_per_block].union_point(p);
+    }
+
+  while(m_levels.back().size() > 1)
+    {
+      unsigned int L(m_levels.size() - 1);
+      unsigned int sz((m_levels[L].size() + 1) / 2);
+
+      m_levels.push_back(std::vector<box>(sz));
+      for(unsigned int i = 0, endi = m_levels[L].size(); i < endi; ++i)
+        {
+          m_levels[L + 1][i / 2].union_box(m_levels[L][i]);
+        }
+    }
+}
+
+void
+ChunkBounds::
+select_glyphs(ScratchSpacePrivate &scratch,
+              fastuidraw::c_array<fastuidraw::range_type<unsigned int> > dst,
+              unsigned int &current) const
+{
+  if(!m_levels.empty())
+    {
+      FASTUIDRAWassert(m_levels.back().size() == 1);
+      select_glyphs_implement(scratch, m_levels.size() - 1, 0, dst, current);
+    }
+}
+
+void
+ChunkBounds::
+select_glyphs_implement(ScratchSpacePrivate &scratch,
+                        unsigned int level, unsigned int idx,
+                        fastuidraw::c_array<fastuidraw::range_type<unsigned int> > dst,
+                        unsigned int &current) const
+{
+  enum box_test_t R;
+  unsigned int begin_glyph, end_glyph;
+
+  R = test_box(fastuidraw::make_c_array(scratch.m_adjusted_clip_eqs), m_levels[level][idx]);
+  begin_glyph = (idx << level) * m_glyphs_per_block;
+  end_glyph = fastuidraw::t_min(((idx + 1) << level) * m_glyphs_per_block, m_number_glyphs);
+
+  if(R == box_culled)
+    {
+      scratch.m_number_culled += end_glyph - begin_glyph;
+      return;
+    }
+
+  if(R == box_unclipped || level == 0)
+    {
+      if(current > 0 && dst[current - 1].m_end == begin_glyph)
+        {
+          dst[current - 1].m_end = end_glyph;
+        }
+      else
+        {
+          dst[current] = fastuidraw::range_type<unsigned int>(begin_glyph, end_glyph);
+          ++current;
+        }
+      return;
+    }
+
+  select_glyphs_implement(scratch, level - 1, 2 * idx, dst, current);
+  if(2 * idx + 1 < m_levels[level - 1].size())
+    {
+      select_glyphs_implement(scratch, level - 1, 2 * idx + 1, dst, current);
+    }
+}
+
+////////////////////////////////////////////////////
+// fastuidraw::PainterGlyphRunBounds::ScratchSpace methods
+fastuidraw::PainterGlyphRunBounds::ScratchSpace::
+ScratchSpace(void)
+{
+  ScratchSpacePrivate *d;
+
+  d = FASTUIDRAWnew ScratchSpacePrivate();
+  d->m_number_culled = 0;
+  m_d = d;
+}
+
+fastuidraw::PainterGlyphRunBounds::ScratchSpace::
+~ScratchSpace(void)
+{
+  ScratchSpacePrivate *d;
+  d = static_cast<ScratchSpacePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+unsigned int
+fastuidraw::PainterGlyphRunBounds::ScratchSpace::
+number_culled(void) const
+{
+  ScratchSpacePrivate *d;
+  d = static_cast<ScratchSpacePrivate*>(m_d);
+  return d->m_number_culled;
+}
+
+////////////////////////////////////////////////////
+// fastuidraw::PainterGlyphRunBounds methods
+fastuidraw::PainterGlyphRunBounds::
+PainterGlyphRunBounds(const PainterAttributeData &data,
+                      unsigned int glyphs_per_block)
+{
+  GlyphRunBoundsPrivate *d;
+  const_c_array<const_c_array<PainterAttribute> > chunks(data.attribute_data_chunks());
+
+  FASTUIDRAWassert(glyphs_per_block > 0);
+  d = FASTUIDRAWnew GlyphRunBoundsPrivate();
+  d->m_glyphs_per_block = t_max(1u, glyphs_per_block);
+  d->m_chunks.reserve(chunks.size());
+  for(unsigned int i = 0; i < chunks.size(); ++i)
+    {
+      FASTUIDRAWassert(data.index_data_chunk(i).size() == 6 * (chunks[i].size() / 4));
+      d->m_chunks.push_back(ChunkBounds(chunks[i], d->m_glyphs_per_block));
+    }
+  m_d = d;
+}
+
+fastuidraw::PainterGlyphRunBounds::
+~PainterGlyphRunBounds()
+{
+  GlyphRunBoundsPrivate *d;
+  d = static_cast<GlyphRunBoundsPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+unsigned int
+fastuidraw::PainterGlyphRunBounds::
+glyphs_per_block(void) const
+{
+  GlyphRunBoundsPrivate *d;
+  d = static_cast<GlyphRunBoundsPrivate*>(m_d);
+  return d->m_glyphs_per_block;
+}
+
+unsigned int
+fastuidraw::PainterGlyphRunBounds::
+number_chunks(void) const
+{
+  GlyphRunBoundsPrivate *d;
+  d = static_cast<GlyphRunBoundsPrivate*>(m_d);
+  return d->m_chunks.size();
+}
+
+unsigned int
+fastuidraw::PainterGlyphRunBounds::
+number_glyphs(unsigned int chunk) const
+{
+  GlyphRunBoundsPrivate *d;
+  d = static_cast<GlyphRunBoundsPrivate*>(m_d);
+  return (chunk < d->m_chunks.size()) ? d->m_chunks[chunk].m_number_glyphs : 0u;
+}
+
+unsigned int
+fastuidraw::PainterGlyphRunBounds::
+number_blocks(unsigned int chunk) const
+{
+  GlyphRunBoundsPrivate *d;
+  d = static_cast<GlyphRunBoundsPrivate*>(m_d);
+  return (chunk < d->m_chunks.size()) ? d->m_chunks[chunk].number_blocks() : 0u;
+}
+
+unsigned int
+fastuidraw::PainterGlyphRunBounds::
+select_glyphs(ScratchSpace &scratch_space,
+              const_c_array<vec3> clip_equations,
+              const float3x3 &clip_matrix_local,
+              unsigned int chunk,
+              c_array<range_type<unsigned int> > dst) const
+{
+  GlyphRunBoundsPrivate *d;
+  ScratchSpacePrivate *scratch;
+  unsigned int return_value(0u);
+
+  d = static_cast<GlyphRunBoundsPrivate*>(m_d);
+  scratch = static_cast<ScratchSpacePrivate*>(scratch_space.m_d);
+  scratch->m_number_culled = 0;
+  if(chunk >= d->m_chunks.size())
+    {
+      return 0;
+    }
+
+  FASTUIDRAWassert(dst.size() >= d->m_chunks[chunk].number_blocks());
+  scratch->m_adjusted_clip_eqs.resize(clip_equations.size());
+  for(unsigned int i = 0; i < clip_equations.size(); ++i)
+    {
+      /* transform clip equations from clip coordinates to
+         local coordinates.
+       */
+      scratch->m_adjusted_clip_eqs[i] = clip_equations[i] * clip_matrix_local;
+    }
+
+  d->m_chunks[chunk].select_glyphs(*scratch, dst, return_value);
+  return return_value;
+}
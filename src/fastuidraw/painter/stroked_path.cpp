@@ -26,6 +26,7 @@
 #include <fastuidraw/painter/painter_attribute_data.hpp>
 #include <fastuidraw/painter/painter_attribute_data_filler.hpp>
 #include <fastuidraw/painter/painter_dashed_stroke_shader_set.hpp>
+#include <fastuidraw/util/trace.hpp>
 #include "../private/util_private.hpp"
 #include "../private/bounding_box.hpp"
 #include "../private/path_util_private.hpp"
@@ -478,6 +479,11 @@ namespace
 
     fastuidraw::vecN<std::vector<fastuidraw::vec2>, 2> m_clip_scratch_vec2s;
     std::vector<float> m_clip_scratch_floats;
+
+    /* number of subsets selected and culled by the
+       last compute_chunks()
+     */
+    unsigned int m_number_selected, m_number_culled;
   };
 
   class EdgeRanges
@@ -748,6 +754,7 @@ namespace
 
     void
     compute_chunks_take_all(bool include_closing_edge,
+                            ScratchSpacePrivate &scratch,
                             unsigned int max_attribute_cnt,
                             unsigned int max_index_cnt,
                             ChunkSetPrivate &dst);
@@ -1343,6 +1350,12 @@ namespace
       return m_data;
     }
 
+    uint64_t
+    memory_usage(void) const
+    {
+      return m_ready ? m_data.memory_usage() : 0u;
+    }
+
   private:
     fastuidraw::PainterAttributeData m_data;
     bool m_ready;
@@ -2074,6 +2087,8 @@ compute_chunks(bool include_closing_edge,
     }
 
   dst.reset();
+  scratch.m_number_selected = 0;
+  scratch.m_number_culled = 0;
   if(take_joins_outside_of_region)
     {
       dst.add_join_chunk(m_non_closing_joins);
@@ -2091,6 +2106,7 @@ compute_chunks(bool include_closing_edge,
 void
 StrokedPathSubset::
 compute_chunks_take_all(bool include_closing_edge,
+                        ScratchSpacePrivate &scratch,
                         unsigned int max_attribute_cnt,
                         unsigned int max_index_cnt,
                         ChunkSetPrivate &dst)
@@ -2103,6 +2119,7 @@ compute_chunks_take_all(bool include_closing_edge,
   if(m_non_closing_edges.chunk_fits(max_attribute_cnt, max_index_cnt)
      && (!include_closing_edge || m_closing_edges.chunk_fits(max_attribute_cnt, max_index_cnt)))
     {
+      ++scratch.m_number_selected;
       dst.add_edge_chunk(m_non_closing_edges);
       dst.add_join_chunk(m_non_closing_joins);
 
@@ -2120,8 +2137,8 @@ compute_chunks_take_all(bool include_closing_edge,
     {
       FASTUIDRAWassert(m_children[0] != nullptr);
       FASTUIDRAWassert(m_children[1] != nullptr);
-      m_children[0]->compute_chunks_take_all(include_closing_edge, max_attribute_cnt, max_index_cnt, dst);
-      m_children[1]->compute_chunks_take_all(include_closing_edge, max_attribute_cnt, max_index_cnt, dst);
+      m_children[0]->compute_chunks_take_all(include_closing_edge, scratch, max_attribute_cnt, max_index_cnt, dst);
+      m_children[1]->compute_chunks_take_all(include_closing_edge, scratch, max_attribute_cnt, max_index_cnt, dst);
     }
   else
     {
@@ -2159,13 +2176,14 @@ compute_chunks_implement(bool include_closing_edge,
   //completely unclipped.
   if(unclipped)
     {
-      compute_chunks_take_all(include_closing_edge, max_attribute_cnt, max_index_cnt, dst);
+      compute_chunks_take_all(include_closing_edge, scratch, max_attribute_cnt, max_index_cnt, dst);
       return;
     }
 
   //completely clipped
   if(scratch.m_clipped_rect.empty())
     {
+      ++scratch.m_number_culled;
       return;
     }
 
@@ -2185,6 +2203,7 @@ compute_chunks_implement(bool include_closing_edge,
   else
     {
       FASTUIDRAWassert(m_non_closing_edges.chunk_fits(max_attribute_cnt, max_index_cnt));
+      ++scratch.m_number_selected;
       dst.add_edge_chunk(m_non_closing_edges);
       dst.add_join_chunk(m_non_closing_joins);
 
@@ -4105,7 +4124,12 @@ miter_distance(void) const
 fastuidraw::StrokedPath::ScratchSpace::
 ScratchSpace(void)
 {
-  m_d = FASTUIDRAWnew ScratchSpacePrivate();
+  ScratchSpacePrivate *d;
+
+  d = FASTUIDRAWnew ScratchSpacePrivate();
+  d->m_number_selected = 0;
+  d->m_number_culled = 0;
+  m_d = d;
 }
 
 fastuidraw::StrokedPath::ScratchSpace::
@@ -4117,6 +4141,24 @@ fastuidraw::StrokedPath::ScratchSpace::
   m_d = nullptr;
 }
 
+unsigned int
+fastuidraw::StrokedPath::ScratchSpace::
+number_selected(void) const
+{
+  ScratchSpacePrivate *d;
+  d = static_cast<ScratchSpacePrivate*>(m_d);
+  return d->m_number_selected;
+}
+
+unsigned int
+fastuidraw::StrokedPath::ScratchSpace::
+number_culled(void) const
+{
+  ScratchSpacePrivate *d;
+  d = static_cast<ScratchSpacePrivate*>(m_d);
+  return d->m_number_culled;
+}
+
 ///////////////////////////////////////
 // ChunkSetPrivate methods
 void
@@ -4253,6 +4295,33 @@ effective_curve_distance_threshhold(void) const
   return d->m_effective_curve_distance_threshhold;
 }
 
+uint64_t
+fastuidraw::StrokedPath::
+memory_usage(void) const
+{
+  StrokedPathPrivate *d;
+  uint64_t return_value;
+
+  d = static_cast<StrokedPathPrivate*>(m_d);
+  return_value = d->m_edges.memory_usage()
+    + d->m_bevel_joins.memory_usage()
+    + d->m_miter_clip_joins.memory_usage()
+    + d->m_miter_joins.memory_usage()
+    + d->m_miter_bevel_joins.memory_usage()
+    + d->m_square_caps.memory_usage()
+    + d->m_adjustable_caps.memory_usage();
+
+  for(const ThreshWithData &v : d->m_rounded_joins)
+    {
+      return_value += v.m_data->memory_usage();
+    }
+  for(const ThreshWithData &v : d->m_rounded_caps)
+    {
+      return_value += v.m_data->memory_usage();
+    }
+  return return_value;
+}
+
 void
 fastuidraw::StrokedPath::
 compute_chunks(ScratchSpace &scratch_space,
@@ -4269,6 +4338,8 @@ compute_chunks(ScratchSpace &scratch_space,
                bool take_joins_outside_of_region,
                ChunkSet &dst) const
 {
+  FASTUIDRAWtrace_scope("StrokedPath::compute_chunks");
+
   StrokedPathPrivate *d;
   ScratchSpacePrivate *scratch_space_ptr;
   ChunkSetPrivate *chunk_set_ptr;
@@ -4280,6 +4351,8 @@ compute_chunks(ScratchSpace &scratch_space,
   if(d->m_empty_path)
     {
       chunk_set_ptr->reset();
+      scratch_space_ptr->m_number_selected = 0;
+      scratch_space_ptr->m_number_culled = 0;
       return;
     }
 
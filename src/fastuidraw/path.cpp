@@ -18,13 +18,18 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <list>
+#include <map>
 #include <vector>
 #include <iostream>
 #include <fastuidraw/path.hpp>
 #include <fastuidraw/tessellated_path.hpp>
+#include <fastuidraw/util/trace.hpp>
 #include "private/util_private.hpp"
 #include "private/path_util_private.hpp"
+#include "private/bezier_batch.hpp"
 
 namespace
 {
@@ -118,6 +123,53 @@ namespace
     return fastuidraw::t_sqrt(fastuidraw::t_max(0.0f, a_p_mag_sq - d_sq / b_a_mag_sq));
   }
 
+  /* Compute the maximum distance between the points of a
+     bezier curve and the line segment between its start
+     and end point. The curve is contained within the convex
+     hull of the points, so this computation is fast,
+     conservative value for getting the curve_distance.
+   */
+  inline
+  float
+  compute_curve_distance(const fastuidraw::vec2 *pts, unsigned int count)
+  {
+    float return_value(0.0f);
+    for(unsigned int i = 1; i + 1 < count; ++i)
+      {
+        float v;
+        v = compute_distance(pts[0], pts[i], pts[count - 1]);
+        return_value = fastuidraw::t_max(return_value, v);
+      }
+    return return_value;
+  }
+
+  /* Split a bezier curve of at most 4 points at t = 0.5 by
+     De Casteljau's algorithm with the same operations as
+     PathContour::bezier::tessellate(); the points of the
+     first half are written to A and the second half to B.
+   */
+  void
+  split_bezier_in_half(const fastuidraw::vec2 *src, unsigned int count,
+                       fastuidraw::vec2 *A, fastuidraw::vec2 *B)
+  {
+    fastuidraw::vecN<fastuidraw::vec2, 4> work;
+
+    FASTUIDRAWassert(count >= 1 && count <= 4);
+    std::copy(src, src + count, work.begin());
+    A[0] = work[0];
+    B[count - 1] = work[count - 1];
+    for(unsigned int level = 1; level < count; ++level)
+      {
+        unsigned int sz(count - level);
+        for(unsigned int j = 0; j < sz; ++j)
+          {
+            work[j] = 0.5f * work[j] + 0.5f * work[j + 1];
+          }
+        A[level] = work[0];
+        B[sz - 1] = work[sz - 1];
+      }
+  }
+
   class TessellatorBase:fastuidraw::noncopyable
   {
   public:
@@ -199,6 +251,151 @@ namespace
               float *out_effective_curve_distance, float *out_effective_curvature);
   };
 
+  /* Work room of the batched tessellators. Each thread has
+     one that is reused so that, once its vectors have grown,
+     tessellating a curve does not allocate memory.
+   */
+  class BatchTessellatorScratch
+  {
+  public:
+    class interval
+    {
+    public:
+      interval(unsigned int idx_start, unsigned int idx_end):
+        m_idx_start(idx_start),
+        m_idx_end(idx_end),
+        m_idx_mid(0)
+      {}
+
+      /* true once the interval is not to be split; the
+         point in its middle is then m_idx_mid.
+       */
+      bool
+      done(void) const
+      {
+        return m_idx_mid != 0;
+      }
+
+      unsigned int m_idx_start, m_idx_end, m_idx_mid;
+    };
+
+    typedef fastuidraw::vecN<fastuidraw::vec2, 4> control_points;
+
+    static
+    BatchTessellatorScratch&
+    get(void)
+    {
+      static thread_local BatchTessellatorScratch R;
+      return R;
+    }
+
+    void
+    clear(void);
+
+    std::vector<analytic_point_data> m_data;
+    std::vector<interval> m_current, m_next;
+    std::vector<control_points> m_current_pts, m_next_pts;
+    std::vector<float> m_t;
+    std::vector<fastuidraw::vec2> m_p, m_p_t, m_p_tt;
+  };
+
+  /* The batched tessellators make the same tessellation of a
+     quadratic or cubic bezier as TessellatorCurvature and
+     TessellatorDistance, but go through the recursion one level
+     at a time: the points of a level are all evaluated by one
+     call to BezierBatch::evaluate(), or by forward differencing
+     if every interval of the previous level was split.
+   */
+  class BatchTessellatorBase:public TessellatorBase
+  {
+  public:
+    BatchTessellatorBase(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                         const fastuidraw::PathContour::interpolator_generic *h,
+                         fastuidraw::const_c_array<fastuidraw::vec2> pts);
+
+    ~BatchTessellatorBase();
+
+  protected:
+    typedef BatchTessellatorScratch::interval interval;
+    typedef BatchTessellatorScratch::control_points control_points;
+
+    /* m_current holds the intervals, ordered by time, that
+       cover [0, 1]; those not done are of the given recursion
+       level. Sets m_t[i] to the middle of the i'th interval
+       that is not done and sets m_p[i], m_p_t[i] and m_p_tt[i]
+       to the values of the curve there.
+     */
+    void
+    evaluate_midpoints(unsigned int level);
+
+    /* Writes the points ordered by time from the intervals
+       of m_current, which must all be done; because the
+       intervals are ordered, no sorting is needed.
+     */
+    unsigned int
+    copy_data(fastuidraw::c_array<fastuidraw::TessellatedPath::point> out_data);
+
+    unsigned int m_num_active;
+
+    fastuidraw::detail::BezierBatch m_batch;
+    BatchTessellatorScratch &m_scratch;
+    std::vector<analytic_point_data> &m_data;
+    std::vector<interval> &m_current, &m_next;
+    std::vector<float> &m_t;
+    std::vector<fastuidraw::vec2> &m_p, &m_p_t, &m_p_tt;
+  };
+
+  class BatchTessellatorCurvature:public BatchTessellatorBase
+  {
+  public:
+    BatchTessellatorCurvature(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                              const fastuidraw::PathContour::interpolator_generic *h,
+                              fastuidraw::const_c_array<fastuidraw::vec2> pts):
+      BatchTessellatorBase(tess_params, h, pts)
+    {
+      FASTUIDRAWassert(tess_params.m_curvature_tessellation);
+    }
+
+  private:
+    virtual
+    unsigned int
+    fill_data(fastuidraw::c_array<fastuidraw::TessellatedPath::point> out_data,
+              float *out_effective_curve_distance, float *out_effective_curvature);
+  };
+
+  class BatchTessellatorDistance:public BatchTessellatorBase
+  {
+  public:
+    BatchTessellatorDistance(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                             const fastuidraw::PathContour::interpolator_generic *h,
+                             fastuidraw::const_c_array<fastuidraw::vec2> pts):
+      BatchTessellatorBase(tess_params, h, pts),
+      m_num_pts(pts.size()),
+      m_current_pts(m_scratch.m_current_pts),
+      m_next_pts(m_scratch.m_next_pts)
+    {
+      FASTUIDRAWassert(!tess_params.m_curvature_tessellation);
+      FASTUIDRAWassert(m_num_pts <= 4);
+      control_points p(fastuidraw::vec2(0.0f, 0.0f));
+      std::copy(pts.begin(), pts.end(), p.begin());
+      m_current_pts.push_back(p);
+    }
+
+  private:
+    virtual
+    unsigned int
+    fill_data(fastuidraw::c_array<fastuidraw::TessellatedPath::point> out_data,
+              float *out_effective_curve_distance, float *out_effective_curvature);
+
+    unsigned int m_num_pts;
+
+    /* m_current_pts[i] are the control points of the curve
+       restricted to the i'th interval of m_current that
+       is not done.
+     */
+    std::vector<control_points> &m_current_pts, &m_next_pts;
+  };
+
   class InterpolatorBasePrivate
   {
   public:
@@ -239,21 +436,7 @@ namespace
     float
     compute_curve_distance(void)
     {
-      /* Compute the maximum distance between the points
-         of a BezierTessRegion and the line segment between
-         the start and  end point of the BezierTessRegion.
-         The curve is contained within the convex hull of the
-         points, so this computation is fast, conservative
-         value for getting the curve_distance.
-       */
-      float return_value(0.0f);
-      for(unsigned int i = 1, endi = m_pts.size(); i + 1 < endi; ++i)
-        {
-          float v;
-          v = compute_distance(m_pts.front(), m_pts[i], m_pts.back());
-          return_value = fastuidraw::t_max(return_value, v);
-        }
-      return return_value;
+      return ::compute_curve_distance(&m_pts[0], m_pts.size());
     }
 
     std::vector<fastuidraw::vec2> m_pts;
@@ -299,35 +482,400 @@ namespace
     bool m_is_flat;
   };
 
+  typedef fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> tessellated_path_ref;
+  typedef fastuidraw::reference_counted_ptr<const fastuidraw::PathContour> const_contour_ref;
+
+  /* Appends to dst successively finer tessellations of contours,
+     starting from the parameters of a tessellation whose effective
+     curve distance threshhold is start_thresh, until one is no
+     more than thresh. Returns true if the last tessellation
+     made is no better than the one before it, i.e. no finer
+     tessellation is possible.
+   */
+  bool
+  refine_tessellation(fastuidraw::const_c_array<const_contour_ref> contours,
+                      float start_thresh, unsigned int start_max_segments,
+                      float thresh,
+                      const fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> &thread_pool,
+                      const std::atomic<bool> *cancel,
+                      std::vector<tessellated_path_ref> &dst)
+  {
+    fastuidraw::TessellatedPath::TessellationParams params;
+    float current_thresh(start_thresh);
+    bool tessellation_done(false);
+
+    params
+      .max_segments(2 * start_max_segments)
+      .curve_distance_tessellate(start_thresh);
+
+    while(!tessellation_done && current_thresh > thresh
+          && (cancel == nullptr || !cancel->load()))
+      {
+        tessellated_path_ref ref;
+        float last_tess;
+
+        params.m_threshhold *= 0.5f;
+        last_tess = current_thresh;
+        ref = FASTUIDRAWnew fastuidraw::TessellatedPath(contours, params, thread_pool);
+        current_thresh = ref->effective_curve_distance_threshhold();
+        tessellation_done = (last_tess <= current_thresh);
+
+        while(!tessellation_done && current_thresh > params.m_threshhold)
+          {
+            params.m_max_segments *= 2;
+            last_tess = current_thresh;
+            ref = FASTUIDRAWnew fastuidraw::TessellatedPath(contours, params, thread_pool);
+            current_thresh = ref->effective_curve_distance_threshhold();
+            tessellation_done = (last_tess <= current_thresh);
+          }
+        dst.push_back(ref);
+      }
+    return tessellation_done;
+  }
+
+  /* An AsyncTessellation makes the finer tessellations of a Path
+     on a worker thread of a ThreadPool. Its fields are set by
+     the thread of the Path and the worker only reads the contours
+     and writes m_results and m_tessellation_done, so that every
+     reference count change of objects shared with the Path happens
+     on the thread of the Path; in particular the AsyncTessellation
+     is released by the thread of the Path once it is done.
+   */
+  class AsyncTessellation:public fastuidraw::ThreadPool::AsyncTask
+  {
+  public:
+    AsyncTessellation(void):
+      m_cancel(false),
+      m_tessellation_done(false)
+    {}
+
+    virtual
+    void
+    run(void)
+    {
+      FASTUIDRAWtrace_scope("Path::tessellation_async");
+      m_tessellation_done = refine_tessellation(fastuidraw::make_c_array(m_contours),
+                                                m_start_thresh, m_start_max_segments,
+                                                m_thresh, m_thread_pool, &m_cancel,
+                                                m_results);
+      if(!m_results.empty() && !m_cancel.load())
+        {
+          if(m_derivatives & fastuidraw::Path::filled_derivative)
+            {
+              m_results.back()->filled();
+            }
+          if(m_derivatives & fastuidraw::Path::stroked_derivative)
+            {
+              m_results.back()->stroked();
+            }
+        }
+    }
+
+    std::vector<const_contour_ref> m_contours;
+    float m_start_thresh;
+    unsigned int m_start_max_segments;
+    float m_thresh;
+    uint32_t m_derivatives;
+    fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> m_thread_pool;
+
+    /* value of PathPrivate::m_generation when posted */
+    unsigned int m_generation;
+
+    /* set by the thread of the Path to have the worker stop early */
+    std::atomic<bool> m_cancel;
+
+    std::vector<tessellated_path_ref> m_results;
+    bool m_tessellation_done;
+  };
+
+  class PathPrivate;
+
+  /* returns a new value for PathPrivate::m_stamp; the values
+     are shared by all Path objects so that two Path objects
+     never have the same value.
+   */
+  uint64_t
+  next_path_stamp(void)
+  {
+    static std::atomic<uint64_t> counter(0);
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  /* an entry of a PathLODCache for one TessellatedPath of a Path */
+  class LODCacheEntry
+  {
+  public:
+    PathPrivate *m_path;
+    const fastuidraw::TessellatedPath *m_lod;
+
+    /* true if coarser TessellatedPath objects that came
+       right before m_lod in the sequence of refinements were
+       released, in which case m_gap_thresh is the smallest
+       effective curve distance threshhold of those.
+     */
+    bool m_gap_before;
+    float m_gap_thresh;
+
+    /* true if in PathLODCachePrivate::m_coarsest */
+    bool m_coarsest;
+  };
+
+  /* A copy of a Path shares the TessellatedPath objects of the
+     Path, so several entries of a PathLODCache can be for the
+     same TessellatedPath. Its memory is counted once, while
+     at least one entry is for it.
+   */
+  class LODCacheShared
+  {
+  public:
+    LODCacheShared(void):
+      m_number_entries(0),
+      m_number_coarsest_entries(0),
+      m_bytes(0)
+    {}
+
+    unsigned int m_number_entries, m_number_coarsest_entries;
+    uint64_t m_bytes;
+  };
+
+  class PathLODCachePrivate
+  {
+  public:
+    typedef std::list<LODCacheEntry> entry_list;
+    typedef std::map<const fastuidraw::TessellatedPath*, LODCacheShared> shared_map;
+
+    explicit
+    PathLODCachePrivate(uint64_t byte_budget):
+      m_byte_budget(byte_budget),
+      m_bytes(0),
+      m_coarsest_bytes(0),
+      m_number_evicted(0),
+      m_last_used(nullptr)
+    {}
+
+    /* measure again the size of the TessellatedPath of an entry */
+    void
+    measure(LODCacheEntry &entry)
+    {
+      shared_map::iterator iter(m_shared.find(entry.m_lod));
+      uint64_t bytes(entry.m_lod->memory_usage());
+
+      FASTUIDRAWassert(iter != m_shared.end());
+      m_bytes += bytes - iter->second.m_bytes;
+      if(iter->second.m_number_coarsest_entries > 0)
+        {
+          m_coarsest_bytes += bytes - iter->second.m_bytes;
+        }
+      iter->second.m_bytes = bytes;
+    }
+
+    /* adds entry to m_coarsest or m_lru, returns where */
+    entry_list::iterator
+    insert(const LODCacheEntry &entry)
+    {
+      entry_list &list(entry.m_coarsest ? m_coarsest : m_lru);
+      LODCacheShared &shared(m_shared[entry.m_lod]);
+
+      if(shared.m_number_entries == 0)
+        {
+          shared.m_bytes = entry.m_lod->memory_usage();
+          m_bytes += shared.m_bytes;
+        }
+      if(entry.m_coarsest && shared.m_number_coarsest_entries == 0)
+        {
+          m_coarsest_bytes += shared.m_bytes;
+        }
+      ++shared.m_number_entries;
+      if(entry.m_coarsest)
+        {
+          ++shared.m_number_coarsest_entries;
+        }
+      list.push_front(entry);
+      return list.begin();
+    }
+
+    /* removes an entry, returns true if it was the last
+       entry for its TessellatedPath.
+     */
+    bool
+    erase(entry_list::iterator entry)
+    {
+      shared_map::iterator iter(m_shared.find(entry->m_lod));
+      bool last;
+
+      FASTUIDRAWassert(iter != m_shared.end());
+      if(entry->m_coarsest && --iter->second.m_number_coarsest_entries == 0)
+        {
+          m_coarsest_bytes -= iter->second.m_bytes;
+        }
+      last = (--iter->second.m_number_entries == 0);
+      if(last)
+        {
+          m_bytes -= iter->second.m_bytes;
+          m_shared.erase(iter);
+        }
+      if(m_last_used == &*entry)
+        {
+          m_last_used = nullptr;
+        }
+      (entry->m_coarsest ? m_coarsest : m_lru).erase(entry);
+      return last;
+    }
+
+    /* Release the least recently used entries of m_lru until
+       m_bytes is within the budget; if keep_mru is true, the
+       most recently used entry is not released.
+     */
+    void
+    evict(bool keep_mru);
+
+    uint64_t m_byte_budget;
+    uint64_t m_bytes, m_coarsest_bytes;
+    unsigned int m_number_evicted;
+
+    /* entries of the coarsest TessellatedPath of each Path,
+       these are never released
+     */
+    entry_list m_coarsest;
+
+    /* the other entries, most recently used first */
+    entry_list m_lru;
+
+    /* the TessellatedPath objects of the entries */
+    shared_map m_shared;
+
+    /* the entry of the TessellatedPath a Path returned last,
+       the derivatives of which are likely made after the
+       TessellatedPath was returned.
+     */
+    LODCacheEntry *m_last_used;
+  };
+
   class PathPrivate
   {
   public:
     typedef fastuidraw::TessellatedPath TessellatedPath;
-    typedef fastuidraw::reference_counted_ptr<const TessellatedPath> tessellated_path_ref;
+    typedef ::tessellated_path_ref tessellated_path_ref;
 
     PathPrivate(void):
       m_tessellation_done(false),
+      m_generation(0),
+      m_stamp(next_path_stamp()),
+      m_valid_contours(0),
       m_start_check_bb(0),
-      m_is_flat(true)
+      m_is_flat(true),
+      m_cache_d(nullptr)
     {}
 
     PathPrivate(const PathPrivate &obj);
 
+    ~PathPrivate();
+
     const fastuidraw::reference_counted_ptr<fastuidraw::PathContour>&
     current_contour(void)
     {
       FASTUIDRAWassert(!m_contours.empty());
+      invalidate_tessellation(m_contours.size() - 1);
+      return m_contours.back();
+    }
+
+    void
+    clear_tessellation(void)
+    {
+      cache_remove_all();
       m_tessellation.clear();
+      invalidate_tessellation(0);
+    }
+
+    /* mark that the contours starting at first_changed are
+       changed or added; the tessellations are updated by
+       update_tessellation().
+     */
+    void
+    invalidate_tessellation(unsigned int first_changed)
+    {
+      m_valid_contours = fastuidraw::t_min(m_valid_contours, first_changed);
       m_tessellation_done = false;
-      return m_contours.back();
+      ++m_generation;
+      m_stamp = next_path_stamp();
+      if(m_pending)
+        {
+          m_pending->m_cancel = true;
+        }
+    }
+
+    /* replace each element of m_tessellation by one that
+       reuses the tessellation of the first m_valid_contours
+       contours and tessellates the others.
+     */
+    void
+    update_tessellation(void);
+
+    /* the value of m_valid_contours when the contours
+       of a Path are changed so that the contour that
+       was last is not last anymore.
+     */
+    unsigned int
+    first_changed_on_insert(void) const
+    {
+      return (m_contours.empty() || m_contours.back()->ended()) ?
+        m_contours.size() :
+        m_contours.size() - 1;
     }
 
+    /* if the AsyncTessellation is done, take its results
+       if they still apply and release it.
+     */
+    void
+    collect_async_tessellation(void);
+
+    void
+    post_async_tessellation(float thresh, fastuidraw::ThreadPool &pool,
+                            uint32_t derivatives);
+
+    const tessellated_path_ref&
+    tessellation(float thresh);
+
+    /* returns the element of m_tessellation that holds
+       the same TessellatedPath as ref after marking it
+       as used in m_cache and releasing what m_cache
+       needs to release to stay within its budget.
+     */
+    const tessellated_path_ref&
+    use_tessellation(const tessellated_path_ref &ref);
+
+    /* add to m_cache the elements of m_tessellation
+       not yet in it.
+     */
+    void
+    cache_add_new(void);
+
+    /* create the entry in m_cache for m_tessellation[i] */
+    PathLODCachePrivate::entry_list::iterator
+    cache_create_entry(unsigned int i);
+
+    /* remake the tessellations before m_tessellation[idx]
+       released by m_cache and needed for thresh, returns
+       the index of the element for thresh.
+     */
+    unsigned int
+    fill_gap(unsigned int idx, float thresh);
+
+    void
+    cache_remove_all(void);
+
+    /* called by PathLODCachePrivate to release an element
+       of m_tessellation, other than the first one; returns
+       true if no other Path of the PathLODCache holds it.
+     */
+    bool
+    evict(PathLODCachePrivate::entry_list::iterator entry);
+
     void
     move_common(const fastuidraw::vec2 &pt)
     {
       bool last_contour_flat;
-      m_tessellation.clear();
-      m_tessellation_done = false;
+      invalidate_tessellation(m_contours.size());
 
       last_contour_flat = m_contours.empty() || m_contours.back()->is_flat();
       m_is_flat = m_is_flat && last_contour_flat;
@@ -342,6 +890,23 @@ namespace
     std::vector<tessellated_path_ref> m_tessellation;
     bool m_tessellation_done;
 
+    /* incremented each time the contours change */
+    unsigned int m_generation;
+
+    /* changed each time the contours or the elements of
+       m_tessellation change, see Path::tessellation_stamp()
+     */
+    uint64_t m_stamp;
+
+    /* number of the first contours of m_contours that are
+       unchanged since the elements of m_tessellation
+       were made.
+     */
+    unsigned int m_valid_contours;
+
+    /* finer tessellation being made, see Path::tessellation_async() */
+    fastuidraw::reference_counted_ptr<AsyncTessellation> m_pending;
+
     /* m_start_check_bb gives the index into m_contours that
        have not had their bounding box absorbed into
        m_max_bb and m_min_bb.
@@ -349,6 +914,19 @@ namespace
     unsigned int m_start_check_bb;
     fastuidraw::vec2 m_max_bb, m_min_bb;
     bool m_is_flat;
+
+    /* if non-null, used to tessellate the contours in parallel */
+    fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> m_thread_pool;
+
+    /* if non-null, bounds the memory of m_tessellation; the
+       elements of m_cache_entries are the entries of the first
+       elements of m_tessellation; the entry of the first
+       element is in PathLODCachePrivate::m_coarsest and the
+       others are in PathLODCachePrivate::m_lru.
+     */
+    fastuidraw::reference_counted_ptr<fastuidraw::PathLODCache> m_cache;
+    PathLODCachePrivate *m_cache_d;
+    std::vector<PathLODCachePrivate::entry_list::iterator> m_cache_entries;
   };
 
   inline
@@ -709,46 +1287,305 @@ tessellation_worker(unsigned int idx_start, unsigned int idx_end,
     }
 }
 
-////////////////////////////////////////
-// BezierPrivate methods
+/////////////////////////////////////
+// BatchTessellatorScratch methods
 void
-BezierPrivate::
-init(void)
+BatchTessellatorScratch::
+clear(void)
 {
-  /* TODO: silly to recompute the binomial coefficients
-     every time a bezier object is created since creation
-     of it is O(n^2) where as once it is made, the creation
-     of bezier is O(n)
+  /* do not keep the room of an unusually fine
+     tessellation around for the life of the thread
    */
-  FASTUIDRAWassert(!m_poly.empty());
-  unsigned int degree = m_poly.size() - 1;
-  binomial_coeff BC(degree);
+  const size_t max_kept(4096);
 
-  m_min_bb = m_max_bb = m_poly[0];
-  for(unsigned int i = 1, endi = m_poly.size(); i < endi; ++i)
+  if(m_data.capacity() > max_kept)
     {
-      m_min_bb.x() = fastuidraw::t_min(m_min_bb.x(), m_poly[i].x());
-      m_min_bb.y() = fastuidraw::t_min(m_min_bb.y(), m_poly[i].y());
-
-      m_max_bb.x() = fastuidraw::t_max(m_max_bb.x(), m_poly[i].x());
-      m_max_bb.y() = fastuidraw::t_max(m_max_bb.y(), m_poly[i].y());
+      *this = BatchTessellatorScratch();
     }
-  m_start_region.m_pts = m_poly; //original region uses original points.
-
-  //compute derivatives in Bernstein basis
-  poly::compute_bernstein_derivative(m_poly, m_poly_prime);
-  poly::compute_bernstein_derivative(m_poly_prime, m_poly_prime_prime);
-
-  //pre-mulitple by binomial coefficients.
-  BC.prepare_bernstein(m_poly);
-  BC.prepare_bernstein(m_poly_prime);
-  BC.prepare_bernstein(m_poly_prime_prime);
-
-  m_work_room[0].resize(m_poly.size());
-  m_work_room[1].resize(m_poly.size());
+  m_data.clear();
+  m_current.clear();
+  m_next.clear();
+  m_current_pts.clear();
+  m_next_pts.clear();
 }
 
-////////////////////////////////////////////
+/////////////////////////////////////
+// BatchTessellatorBase methods
+BatchTessellatorBase::
+BatchTessellatorBase(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                     const fastuidraw::PathContour::interpolator_generic *h,
+                     fastuidraw::const_c_array<fastuidraw::vec2> pts):
+  TessellatorBase(tess_params, h),
+  m_num_active(1),
+  m_batch(pts),
+  m_scratch(BatchTessellatorScratch::get()),
+  m_data(m_scratch.m_data),
+  m_current(m_scratch.m_current),
+  m_next(m_scratch.m_next),
+  m_t(m_scratch.m_t),
+  m_p(m_scratch.m_p),
+  m_p_t(m_scratch.m_p_t),
+  m_p_tt(m_scratch.m_p_tt)
+{
+  m_scratch.clear();
+
+  /* initialize m_data with start and end point data.
+   */
+  m_data.push_back(analytic_point_data(0.0f, m_h));
+  m_data.push_back(analytic_point_data(1.0f, m_h));
+  m_current.push_back(interval(0, 1));
+}
+
+BatchTessellatorBase::
+~BatchTessellatorBase()
+{
+  m_scratch.clear();
+}
+
+void
+BatchTessellatorBase::
+evaluate_midpoints(unsigned int level)
+{
+  /* Forward differencing needs to evaluate the curve
+     degree + 1 times to start, which is only worth it
+     for enough points. It is also only faster than the
+     scalar evaluation; the SIMD evaluations are faster
+     still and give exactly the values of the recursive
+     tessellators, so they are preferred when present.
+     Without them, the points of a level made by forward
+     differencing differ from those of the recursive
+     tessellators by rounding, see BezierBatch.
+   */
+  const unsigned int forward_difference_min_count(16);
+  static const bool use_forward_difference(fastuidraw::detail::bezier_batch_best_impl()
+                                           == fastuidraw::detail::bezier_batch_scalar);
+
+  m_t.clear();
+  for(const interval &I : m_current)
+    {
+      if(!I.done())
+        {
+          m_t.push_back(0.5f * (m_data[I.m_idx_end].m_time + m_data[I.m_idx_start].m_time));
+        }
+    }
+
+  FASTUIDRAWassert(m_t.size() == m_num_active);
+  m_p.resize(m_num_active);
+  m_p_t.resize(m_num_active);
+  m_p_tt.resize(m_num_active);
+  if(use_forward_difference
+     && m_num_active >= forward_difference_min_count
+     && level < 32u && m_num_active == (1u << level))
+    {
+      /* every interval was split, so the midpoints are
+         evenly spaced.
+       */
+      float dt(1.0f / static_cast<float>(m_num_active));
+      m_batch.evaluate_uniform(m_t[0], dt,
+                               fastuidraw::make_c_array(m_p),
+                               fastuidraw::make_c_array(m_p_t),
+                               fastuidraw::make_c_array(m_p_tt));
+    }
+  else
+    {
+      m_batch.evaluate(fastuidraw::make_c_array(m_t),
+                       fastuidraw::make_c_array(m_p),
+                       fastuidraw::make_c_array(m_p_t),
+                       fastuidraw::make_c_array(m_p_tt));
+    }
+}
+
+unsigned int
+BatchTessellatorBase::
+copy_data(fastuidraw::c_array<fastuidraw::TessellatedPath::point> out_data)
+{
+  unsigned int return_value(0);
+
+  FASTUIDRAWassert(m_data.size() <= out_data.size());
+  FASTUIDRAWassert(2 * m_current.size() + 1 == m_data.size());
+  for(const interval &I : m_current)
+    {
+      FASTUIDRAWassert(I.done());
+      out_data[return_value++] = m_data[I.m_idx_start];
+      out_data[return_value++] = m_data[I.m_idx_mid];
+    }
+  out_data[return_value++] = m_data[1];
+  return return_value;
+}
+
+/////////////////////////////////////
+// BatchTessellatorCurvature methods
+unsigned int
+BatchTessellatorCurvature::
+fill_data(fastuidraw::c_array<fastuidraw::TessellatedPath::point> out_data,
+          float *out_effective_curve_distance, float *out_effective_curvature)
+{
+  for(unsigned int level = 0; m_num_active > 0; ++level)
+    {
+      unsigned int k(0);
+
+      evaluate_midpoints(level);
+      m_next.clear();
+      m_num_active = 0;
+      for(const interval &I : m_current)
+        {
+          unsigned int idx_mid(m_data.size());
+          float delta_t, curvature;
+          bool recurse;
+
+          if(I.done())
+            {
+              m_next.push_back(I);
+              continue;
+            }
+
+          m_data.push_back(analytic_point_data(m_t[k], m_p[k], m_p_t[k], m_p_tt[k]));
+          ++k;
+
+          delta_t = m_data[I.m_idx_end].m_time - m_data[I.m_idx_start].m_time;
+          curvature = analytic_point_data::compute_approximate_curvature(delta_t,
+                                                                         m_data[I.m_idx_start],
+                                                                         m_data[idx_mid],
+                                                                         m_data[I.m_idx_end]);
+          recurse = (curvature > m_thresh) || (level == 0u);
+
+          if(level + 1u < m_max_recursion && recurse)
+            {
+              m_next.push_back(interval(I.m_idx_start, idx_mid));
+              m_next.push_back(interval(idx_mid, I.m_idx_end));
+              m_num_active += 2;
+            }
+          else
+            {
+              m_next.push_back(I);
+              m_next.back().m_idx_mid = idx_mid;
+              if(I.m_idx_end == 1)
+                {
+                  /* TessellatorCurvature reports the values of
+                     the last interval it does not split, which
+                     is the one that ends at t = 1.
+                   */
+                  *out_effective_curvature = curvature;
+                  *out_effective_curve_distance = compute_distance(m_data[I.m_idx_start].m_p,
+                                                                   m_data[idx_mid].m_p,
+                                                                   m_data[I.m_idx_end].m_p);
+                }
+            }
+        }
+      m_current.swap(m_next);
+    }
+
+  return copy_data(out_data);
+}
+
+/////////////////////////////////////
+// BatchTessellatorDistance methods
+unsigned int
+BatchTessellatorDistance::
+fill_data(fastuidraw::c_array<fastuidraw::TessellatedPath::point> out_data,
+          float *out_effective_curve_distance, float *out_effective_curvature)
+{
+  for(unsigned int level = 0; m_num_active > 0; ++level)
+    {
+      unsigned int k(0);
+
+      /* the positions are from De Casteljau's algorithm,
+         only the derivatives of the evaluation are used.
+       */
+      evaluate_midpoints(level);
+      m_next.clear();
+      m_next_pts.clear();
+      m_num_active = 0;
+      for(const interval &I : m_current)
+        {
+          unsigned int idx_mid(m_data.size());
+          control_points A, B;
+          float out_tess;
+
+          if(I.done())
+            {
+              m_next.push_back(I);
+              continue;
+            }
+
+          split_bezier_in_half(m_current_pts[k].c_ptr(), m_num_pts, A.c_ptr(), B.c_ptr());
+          out_tess = fastuidraw::t_max(compute_curve_distance(A.c_ptr(), m_num_pts),
+                                       compute_curve_distance(B.c_ptr(), m_num_pts));
+          m_data.push_back(analytic_point_data(m_t[k], A[m_num_pts - 1], m_p_t[k], m_p_tt[k]));
+          ++k;
+
+          if(level + 1u < m_max_recursion && out_tess > m_thresh)
+            {
+              m_next.push_back(interval(I.m_idx_start, idx_mid));
+              m_next.push_back(interval(idx_mid, I.m_idx_end));
+              m_next_pts.push_back(A);
+              m_next_pts.push_back(B);
+              m_num_active += 2;
+            }
+          else
+            {
+              float v, delta_t;
+
+              m_next.push_back(I);
+              m_next.back().m_idx_mid = idx_mid;
+
+              delta_t = m_data[I.m_idx_end].m_time - m_data[I.m_idx_start].m_time;
+              v = analytic_point_data::compute_approximate_curvature(delta_t,
+                                                                     m_data[I.m_idx_start],
+                                                                     m_data[idx_mid],
+                                                                     m_data[I.m_idx_end]);
+
+              *out_effective_curve_distance = fastuidraw::t_max(*out_effective_curve_distance, out_tess);
+              *out_effective_curvature = fastuidraw::t_max(*out_effective_curvature, v);
+            }
+        }
+      m_current.swap(m_next);
+      m_current_pts.swap(m_next_pts);
+    }
+
+  return copy_data(out_data);
+}
+
+////////////////////////////////////////
+// BezierPrivate methods
+void
+BezierPrivate::
+init(void)
+{
+  /* TODO: silly to recompute the binomial coefficients
+     every time a bezier object is created since creation
+     of it is O(n^2) where as once it is made, the creation
+     of bezier is O(n)
+   */
+  FASTUIDRAWassert(!m_poly.empty());
+  unsigned int degree = m_poly.size() - 1;
+  binomial_coeff BC(degree);
+
+  m_min_bb = m_max_bb = m_poly[0];
+  for(unsigned int i = 1, endi = m_poly.size(); i < endi; ++i)
+    {
+      m_min_bb.x() = fastuidraw::t_min(m_min_bb.x(), m_poly[i].x());
+      m_min_bb.y() = fastuidraw::t_min(m_min_bb.y(), m_poly[i].y());
+
+      m_max_bb.x() = fastuidraw::t_max(m_max_bb.x(), m_poly[i].x());
+      m_max_bb.y() = fastuidraw::t_max(m_max_bb.y(), m_poly[i].y());
+    }
+  m_start_region.m_pts = m_poly; //original region uses original points.
+
+  //compute derivatives in Bernstein basis
+  poly::compute_bernstein_derivative(m_poly, m_poly_prime);
+  poly::compute_bernstein_derivative(m_poly_prime, m_poly_prime_prime);
+
+  //pre-mulitple by binomial coefficients.
+  BC.prepare_bernstein(m_poly);
+  BC.prepare_bernstein(m_poly_prime);
+  BC.prepare_bernstein(m_poly_prime_prime);
+
+  m_work_room[0].resize(m_poly.size());
+  m_work_room[1].resize(m_poly.size());
+}
+
+////////////////////////////////////////////
 // fastuidraw::PathContour::interpolator_base methods
 fastuidraw::PathContour::interpolator_base::
 interpolator_base(const reference_counted_ptr<const interpolator_base> &prev, const vec2 &end)
@@ -984,6 +1821,39 @@ tessellate(tessellated_region *in_region,
   *out_effective_curve_distance = fastuidraw::t_max(newA->compute_curve_distance(), newB->compute_curve_distance());
 }
 
+unsigned int
+fastuidraw::PathContour::bezier::
+produce_tessellation(const TessellatedPath::TessellationParams &tess_params,
+                     c_array<TessellatedPath::point> out_data,
+                     float *out_effective_curve_distance,
+                     float *out_effective_curvature) const
+{
+  BezierPrivate *d;
+  const_c_array<vec2> pts;
+  unsigned int return_value;
+
+  d = static_cast<BezierPrivate*>(m_d);
+  pts = make_c_array(d->m_start_region.m_pts);
+  if(pts.size() != 3 && pts.size() != 4)
+    {
+      return interpolator_generic::produce_tessellation(tess_params, out_data,
+                                                        out_effective_curve_distance,
+                                                        out_effective_curvature);
+    }
+
+  if(tess_params.m_curvature_tessellation)
+    {
+      BatchTessellatorCurvature tesser(tess_params, this, pts);
+      return_value = tesser.dump(out_data, out_effective_curve_distance, out_effective_curvature);
+    }
+  else
+    {
+      BatchTessellatorDistance tesser(tess_params, this, pts);
+      return_value = tesser.dump(out_data, out_effective_curve_distance, out_effective_curvature);
+    }
+  return return_value;
+}
+
 fastuidraw::PathContour::interpolator_base*
 fastuidraw::PathContour::bezier::
 deep_copy(const reference_counted_ptr<const interpolator_base> &prev) const
@@ -1508,10 +2378,16 @@ PathPrivate(const PathPrivate &obj):
   m_contours(obj.m_contours),
   m_tessellation(obj.m_tessellation),
   m_tessellation_done(obj.m_tessellation_done),
+  m_generation(0),
+  m_stamp(next_path_stamp()),
+  m_valid_contours(obj.m_valid_contours),
   m_start_check_bb(obj.m_start_check_bb),
   m_max_bb(obj.m_max_bb),
   m_min_bb(obj.m_min_bb),
-  m_is_flat(obj.m_is_flat)
+  m_is_flat(obj.m_is_flat),
+  m_thread_pool(obj.m_thread_pool),
+  m_cache(obj.m_cache),
+  m_cache_d(obj.m_cache_d)
 {
   /* if the last contour is not ended, we need to do a
      deep copy on it.
@@ -1521,6 +2397,460 @@ PathPrivate(const PathPrivate &obj):
       m_contours.back() = m_contours.back()->deep_copy();
       m_is_flat = m_is_flat && m_contours.back()->is_flat();
     }
+  cache_add_new();
+}
+
+PathPrivate::
+~PathPrivate()
+{
+  if(m_pending)
+    {
+      /* the worker reads the contours held by m_pending,
+         wait for it so that they are released here.
+       */
+      m_pending->m_cancel = true;
+      m_pending->wait();
+    }
+  cache_remove_all();
+}
+
+void
+PathPrivate::
+collect_async_tessellation(void)
+{
+  if(!m_pending || !m_pending->done())
+    {
+      return;
+    }
+
+  /* the results only apply if the Path did not change and
+     no finer tessellation was made since m_pending was posted
+   */
+  if(m_pending->m_generation == m_generation
+     && !m_tessellation_done
+     && !m_tessellation.empty()
+     && m_tessellation.back()->effective_curve_distance_threshhold() == m_pending->m_start_thresh
+     && m_tessellation.back()->max_segments() == m_pending->m_start_max_segments)
+    {
+      m_tessellation.insert(m_tessellation.end(),
+                            m_pending->m_results.begin(),
+                            m_pending->m_results.end());
+      m_tessellation_done = m_pending->m_tessellation_done;
+      m_stamp = next_path_stamp();
+    }
+  m_pending = fastuidraw::reference_counted_ptr<AsyncTessellation>();
+}
+
+void
+PathPrivate::
+post_async_tessellation(float thresh, fastuidraw::ThreadPool &pool,
+                        uint32_t derivatives)
+{
+  FASTUIDRAWassert(!m_pending);
+  FASTUIDRAWassert(!m_tessellation.empty());
+
+  m_pending = FASTUIDRAWnew AsyncTessellation();
+  m_pending->m_contours.reserve(m_contours.size());
+  for(unsigned int i = 0, endi = m_contours.size(); i < endi; ++i)
+    {
+      m_pending->m_contours.push_back(m_contours[i]);
+    }
+  m_pending->m_start_thresh = m_tessellation.back()->effective_curve_distance_threshhold();
+  m_pending->m_start_max_segments = m_tessellation.back()->max_segments();
+  m_pending->m_thresh = thresh;
+  m_pending->m_derivatives = derivatives;
+  m_pending->m_thread_pool = m_thread_pool;
+  m_pending->m_generation = m_generation;
+  pool.post(m_pending);
+}
+
+const tessellated_path_ref&
+PathPrivate::
+tessellation(float thresh)
+{
+  FASTUIDRAWassert(!m_tessellation.empty());
+  if(m_tessellation.back()->effective_curve_distance_threshhold() <= thresh)
+    {
+      std::vector<tessellated_path_ref>::const_iterator iter;
+      iter = std::lower_bound(m_tessellation.begin(),
+                              m_tessellation.end(),
+                              thresh,
+                              reverse_compare_curve_distance_thresh);
+
+      FASTUIDRAWassert(iter != m_tessellation.end());
+      FASTUIDRAWassert(*iter);
+      FASTUIDRAWassert((*iter)->effective_curve_distance_threshhold() <= thresh);
+
+      unsigned int idx(iter - m_tessellation.begin());
+      if(idx > 0 && idx < m_cache_entries.size()
+         && m_cache_entries[idx]->m_gap_before
+         && m_cache_entries[idx]->m_gap_thresh <= thresh)
+        {
+          idx = fill_gap(idx, thresh);
+        }
+      return m_tessellation[idx];
+    }
+
+  if(!m_tessellation_done)
+    {
+      std::vector<const_contour_ref> contours(m_contours.begin(), m_contours.end());
+      const tessellated_path_ref &ref(m_tessellation.back());
+
+      m_tessellation_done = refine_tessellation(fastuidraw::make_c_array(contours),
+                                                ref->effective_curve_distance_threshhold(),
+                                                ref->max_segments(), thresh,
+                                                m_thread_pool, nullptr,
+                                                m_tessellation);
+      m_stamp = next_path_stamp();
+    }
+  return m_tessellation.back();
+}
+
+void
+PathPrivate::
+update_tessellation(void)
+{
+  if(m_tessellation.empty()
+     || (m_valid_contours == m_tessellation.front()->number_contours()
+         && m_valid_contours == m_contours.size()))
+    {
+      return;
+    }
+
+  FASTUIDRAWtrace_scope("Path::update_tessellation");
+  FASTUIDRAWassert(m_valid_contours <= m_tessellation.front()->number_contours());
+  cache_remove_all();
+  m_stamp = next_path_stamp();
+  if(m_valid_contours == 0)
+    {
+      m_tessellation.clear();
+      return;
+    }
+
+  /* each tessellation keeps its parameters; the contours
+     not changed are copied and only the others are
+     tessellated.
+   */
+  std::vector<const_contour_ref> contours(m_contours.begin() + m_valid_contours, m_contours.end());
+  std::vector<tessellated_path_ref> tessellation;
+
+  tessellation.reserve(m_tessellation.size());
+  for(const tessellated_path_ref &ref : m_tessellation)
+    {
+      tessellated_path_ref v;
+
+      v = FASTUIDRAWnew fastuidraw::TessellatedPath(*ref, m_valid_contours,
+                                                    fastuidraw::make_c_array(contours),
+                                                    m_thread_pool);
+
+      /* the new contours can make a finer tessellation no
+         finer than the one before it, drop those to keep
+         the elements sorted.
+       */
+      if(tessellation.empty()
+         || v->effective_curve_distance_threshhold() < tessellation.back()->effective_curve_distance_threshhold())
+        {
+          tessellation.push_back(v);
+        }
+    }
+  m_tessellation.swap(tessellation);
+  m_tessellation_done = false;
+  m_valid_contours = m_contours.size();
+}
+
+const tessellated_path_ref&
+PathPrivate::
+use_tessellation(const tessellated_path_ref &ref)
+{
+  const fastuidraw::TessellatedPath *lod;
+  unsigned int idx;
+
+  if(!m_cache_d)
+    {
+      return ref;
+    }
+
+  cache_add_new();
+  FASTUIDRAWassert(&ref >= &m_tessellation[0] && &ref < &m_tessellation[0] + m_tessellation.size());
+  idx = &ref - &m_tessellation[0];
+  lod = ref.get();
+
+  /* measure again since the FilledPath or StrokedPath
+     may have been made since the last use.
+   */
+  PathLODCachePrivate::entry_list::iterator entry(m_cache_entries[idx]);
+  if(m_cache_d->m_last_used)
+    {
+      m_cache_d->measure(*m_cache_d->m_last_used);
+    }
+  m_cache_d->measure(*entry);
+  m_cache_d->m_last_used = &*entry;
+  if(!entry->m_coarsest)
+    {
+      m_cache_d->m_lru.splice(m_cache_d->m_lru.begin(), m_cache_d->m_lru, entry);
+    }
+
+  m_cache_d->evict(true);
+
+  /* evicting an element before lod moves it */
+  for(idx = 0; m_tessellation[idx].get() != lod; ++idx)
+    {
+      FASTUIDRAWassert(idx + 1 < m_tessellation.size());
+    }
+  return m_tessellation[idx];
+}
+
+unsigned int
+PathPrivate::
+fill_gap(unsigned int idx, float thresh)
+{
+  std::vector<const_contour_ref> contours(m_contours.begin(), m_contours.end());
+  std::vector<tessellated_path_ref> lods;
+  const tessellated_path_ref &prev(m_tessellation[idx - 1]);
+  const tessellated_path_ref &next(m_tessellation[idx]);
+  LODCacheEntry &next_entry(*m_cache_entries[idx]);
+
+  FASTUIDRAWassert(m_cache_d);
+  refine_tessellation(fastuidraw::make_c_array(contours),
+                      prev->effective_curve_distance_threshhold(),
+                      prev->max_segments(), thresh,
+                      m_thread_pool, nullptr, lods);
+
+  /* the refinements need not be those first made since
+     those depend on the order of the requests; keep only
+     those coarser than next so that m_tessellation stays
+     sorted.
+   */
+  while(!lods.empty()
+        && lods.back()->effective_curve_distance_threshhold() <= next->effective_curve_distance_threshhold())
+    {
+      lods.pop_back();
+    }
+
+  /* if no refinement is coarser than next and fine enough
+     for thresh, next is what remaking the gap gives for
+     thresh; otherwise, what was released finer than the
+     last of lods is still missing.
+   */
+  if(lods.empty() || lods.back()->effective_curve_distance_threshhold() > thresh)
+    {
+      next_entry.m_gap_before = false;
+    }
+  else
+    {
+      next_entry.m_gap_before = next_entry.m_gap_thresh
+        < lods.back()->effective_curve_distance_threshhold();
+    }
+
+  m_tessellation.insert(m_tessellation.begin() + idx, lods.begin(), lods.end());
+  m_stamp = next_path_stamp();
+  m_cache_entries.insert(m_cache_entries.begin() + idx, lods.size(),
+                         PathLODCachePrivate::entry_list::iterator());
+  for(unsigned int i = idx, endi = idx + lods.size(); i < endi; ++i)
+    {
+      m_cache_entries[i] = cache_create_entry(i);
+    }
+
+  for(; m_tessellation[idx]->effective_curve_distance_threshhold() > thresh; ++idx)
+    {
+      FASTUIDRAWassert(idx + 1 < m_tessellation.size());
+    }
+  return idx;
+}
+
+PathLODCachePrivate::entry_list::iterator
+PathPrivate::
+cache_create_entry(unsigned int i)
+{
+  LODCacheEntry entry;
+
+  entry.m_path = this;
+  entry.m_lod = m_tessellation[i].get();
+  entry.m_gap_before = false;
+  entry.m_gap_thresh = 0.0f;
+  entry.m_coarsest = (i == 0);
+  return m_cache_d->insert(entry);
+}
+
+void
+PathPrivate::
+cache_add_new(void)
+{
+  if(!m_cache_d)
+    {
+      return;
+    }
+
+  for(unsigned int i = m_cache_entries.size(), endi = m_tessellation.size(); i < endi; ++i)
+    {
+      m_cache_entries.push_back(cache_create_entry(i));
+    }
+}
+
+void
+PathPrivate::
+cache_remove_all(void)
+{
+  if(!m_cache_d)
+    {
+      return;
+    }
+
+  for(unsigned int i = 0, endi = m_cache_entries.size(); i < endi; ++i)
+    {
+      m_cache_d->erase(m_cache_entries[i]);
+    }
+  m_cache_entries.clear();
+}
+
+bool
+PathPrivate::
+evict(PathLODCachePrivate::entry_list::iterator entry)
+{
+  unsigned int idx;
+  bool released;
+
+  for(idx = 1; m_cache_entries[idx] != entry; ++idx)
+    {
+      FASTUIDRAWassert(idx + 1 < m_cache_entries.size());
+    }
+
+  /* releasing the finest tessellation means a finer
+     one can be made again; releasing another leaves a
+     gap that fill_gap() fills on demand.
+   */
+  if(idx + 1 == m_tessellation.size())
+    {
+      m_tessellation_done = false;
+    }
+  else if(idx + 1 < m_cache_entries.size())
+    {
+      LODCacheEntry &next(*m_cache_entries[idx + 1]);
+      float t(entry->m_lod->effective_curve_distance_threshhold());
+
+      next.m_gap_thresh = (next.m_gap_before) ? fastuidraw::t_min(next.m_gap_thresh, t) : t;
+      next.m_gap_before = true;
+    }
+
+  released = m_cache_d->erase(entry);
+  m_cache_entries.erase(m_cache_entries.begin() + idx);
+  m_tessellation.erase(m_tessellation.begin() + idx);
+  m_stamp = next_path_stamp();
+  return released;
+}
+
+/////////////////////////////////////////
+// PathLODCachePrivate methods
+void
+PathLODCachePrivate::
+evict(bool keep_mru)
+{
+  while(m_bytes > m_byte_budget && !m_lru.empty())
+    {
+      entry_list::iterator iter(m_lru.end());
+
+      --iter;
+      if(keep_mru && iter == m_lru.begin())
+        {
+          return;
+        }
+      if(iter->m_path->evict(iter))
+        {
+          ++m_number_evicted;
+        }
+    }
+}
+
+/////////////////////////////////////////
+// fastuidraw::PathLODCache methods
+fastuidraw::PathLODCache::
+PathLODCache(uint64_t byte_budget)
+{
+  m_d = FASTUIDRAWnew PathLODCachePrivate(byte_budget);
+}
+
+fastuidraw::PathLODCache::
+~PathLODCache()
+{
+  PathLODCachePrivate *d;
+  d = static_cast<PathLODCachePrivate*>(m_d);
+
+  /* each Path holds a reference to its PathLODCache */
+  FASTUIDRAWassert(d->m_coarsest.empty() && d->m_lru.empty());
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+uint64_t
+fastuidraw::PathLODCache::
+byte_budget(void) const
+{
+  PathLODCachePrivate *d;
+  d = static_cast<PathLODCachePrivate*>(m_d);
+  return d->m_byte_budget;
+}
+
+void
+fastuidraw::PathLODCache::
+byte_budget(uint64_t v)
+{
+  PathLODCachePrivate *d;
+  d = static_cast<PathLODCachePrivate*>(m_d);
+  d->m_byte_budget = v;
+}
+
+uint64_t
+fastuidraw::PathLODCache::
+memory_usage(void) const
+{
+  PathLODCachePrivate *d;
+  d = static_cast<PathLODCachePrivate*>(m_d);
+  return d->m_bytes;
+}
+
+uint64_t
+fastuidraw::PathLODCache::
+coarsest_memory_usage(void) const
+{
+  PathLODCachePrivate *d;
+  d = static_cast<PathLODCachePrivate*>(m_d);
+  return d->m_coarsest_bytes;
+}
+
+unsigned int
+fastuidraw::PathLODCache::
+number_lods(void) const
+{
+  PathLODCachePrivate *d;
+  d = static_cast<PathLODCachePrivate*>(m_d);
+  return d->m_shared.size();
+}
+
+unsigned int
+fastuidraw::PathLODCache::
+number_evicted(void) const
+{
+  PathLODCachePrivate *d;
+  d = static_cast<PathLODCachePrivate*>(m_d);
+  return d->m_number_evicted;
+}
+
+void
+fastuidraw::PathLODCache::
+trim(void)
+{
+  PathLODCachePrivate *d;
+  d = static_cast<PathLODCachePrivate*>(m_d);
+
+  for(LODCacheEntry &entry : d->m_coarsest)
+    {
+      d->measure(entry);
+    }
+  for(LODCacheEntry &entry : d->m_lru)
+    {
+      d->measure(entry);
+    }
+  d->evict(false);
 }
 
 /////////////////////////////////////////
@@ -1583,9 +2913,8 @@ clear(void)
 {
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
-  d->m_tessellation.clear();
+  d->clear_tessellation();
   d->m_contours.clear();
-  d->m_tessellation_done = false;
   d->m_start_check_bb = 0u;
 }
 
@@ -1605,7 +2934,7 @@ add_contour(const reference_counted_ptr<const PathContour> &pcontour)
   contour = pcontour.const_cast_ptr<PathContour>();
   d->m_is_flat = d->m_is_flat && contour->is_flat();
 
-  d->m_tessellation.clear();
+  d->invalidate_tessellation(d->first_changed_on_insert());
   if(d->m_contours.empty() || d->m_contours.back()->ended())
     {
       d->m_contours.push_back(contour);
@@ -1631,7 +2960,7 @@ add_contours(const Path &path)
 
   if(d != pd && !pd->m_contours.empty())
     {
-      d->m_tessellation.clear();
+      d->invalidate_tessellation(d->first_changed_on_insert());
       d->m_contours.reserve(d->m_contours.size() + pd->m_contours.size());
       d->m_is_flat = d->m_is_flat && pd->m_is_flat;
 
@@ -1670,13 +2999,9 @@ move(const fastuidraw::vec2 &pt)
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
 
-  if(!d->m_contours.empty())
+  if(!d->m_contours.empty() && !d->m_contours.back()->ended())
     {
-      const reference_counted_ptr<PathContour> &h(d->current_contour());
-      if(!h->ended())
-        {
-          h->end();
-        }
+      d->current_contour()->end();
     }
   d->move_common(pt);
   return *this;
@@ -1711,82 +3036,144 @@ const fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath>&
 fastuidraw::Path::
 tessellation(float thresh) const
 {
+  FASTUIDRAWtrace_scope("Path::tessellation");
+
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
 
+  d->collect_async_tessellation();
+  d->update_tessellation();
   if(d->m_tessellation.empty())
     {
       PathPrivate::tessellated_path_ref ref;
       TessellatedPath::TessellationParams params;
-      ref = FASTUIDRAWnew TessellatedPath(*this, params);
+      ref = FASTUIDRAWnew TessellatedPath(*this, params, d->m_thread_pool);
       d->m_tessellation.push_back(ref);
+      d->m_valid_contours = d->m_contours.size();
+      d->m_stamp = next_path_stamp();
     }
 
   if(thresh <= 0.0f || is_flat())
     {
-      return d->m_tessellation.front();
+      return d->use_tessellation(d->m_tessellation.front());
     }
 
-  if(d->m_tessellation.back()->effective_curve_distance_threshhold() <= thresh)
-    {
-      std::vector<PathPrivate::tessellated_path_ref>::const_iterator iter;
-      iter = std::lower_bound(d->m_tessellation.begin(),
-                              d->m_tessellation.end(),
-                              thresh,
-                              reverse_compare_curve_distance_thresh);
+  return d->use_tessellation(d->tessellation(thresh));
+}
 
-      FASTUIDRAWassert(iter != d->m_tessellation.end());
-      FASTUIDRAWassert(*iter);
-      FASTUIDRAWassert((*iter)->effective_curve_distance_threshhold() <= thresh);
-      return *iter;
+const fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath>&
+fastuidraw::Path::
+tessellation_async(float thresh, ThreadPool &pool,
+                   uint32_t derivatives, bool *out_pending) const
+{
+  PathPrivate *d;
+  bool pending(false);
+
+  d = static_cast<PathPrivate*>(m_d);
+  d->collect_async_tessellation();
+  d->update_tessellation();
+  if(d->m_tessellation.empty())
+    {
+      /* the coarsest tessellation is always made right away */
+      tessellation();
     }
-  else
+
+  /* the contours given to the worker must not change while
+     it runs, which is the case only for ended contours.
+   */
+  if(thresh > 0.0f
+     && !d->m_tessellation_done
+     && d->m_tessellation.back()->effective_curve_distance_threshhold() > thresh
+     && !is_flat()
+     && d->m_contours.back()->ended())
     {
-      if(d->m_tessellation_done)
+      if(!d->m_pending)
         {
-          return d->m_tessellation.back();
+          d->post_async_tessellation(thresh, pool, derivatives);
         }
+      pending = true;
+    }
 
-      PathPrivate::tessellated_path_ref prev_ref, ref;
-      TessellatedPath::TessellationParams params;
+  if(out_pending)
+    {
+      *out_pending = pending;
+    }
 
-      ref = d->m_tessellation.back();
-      params
-        .max_segments(2 * ref->max_segments())
-        .curve_distance_tessellate(ref->effective_curve_distance_threshhold());
+  if(pending)
+    {
+      return d->use_tessellation(d->m_tessellation.back());
+    }
+  return tessellation(thresh);
+}
 
-      while(!d->m_tessellation_done
-            && ref->effective_curve_distance_threshhold() > thresh)
-        {
-          float last_tess;
+const fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool>&
+fastuidraw::Path::
+tessellation_thread_pool(void) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  return d->m_thread_pool;
+}
 
-          params.m_threshhold *= 0.5f;
-          last_tess = ref->effective_curve_distance_threshhold();
-          ref = FASTUIDRAWnew TessellatedPath(*this, params);
-          d->m_tessellation_done = (last_tess <= ref->effective_curve_distance_threshhold());
+void
+fastuidraw::Path::
+tessellation_thread_pool(const reference_counted_ptr<ThreadPool> &v)
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  d->m_thread_pool = v;
+}
 
-          while(!d->m_tessellation_done && ref->effective_curve_distance_threshhold() > params.m_threshhold)
-            {
-              params.m_max_segments *= 2;
-              last_tess = ref->effective_curve_distance_threshhold();
-              ref = FASTUIDRAWnew TessellatedPath(*this, params);
-              d->m_tessellation_done = (last_tess <= ref->effective_curve_distance_threshhold());
-            }
+const fastuidraw::reference_counted_ptr<fastuidraw::PathLODCache>&
+fastuidraw::Path::
+tessellation_cache(void) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  return d->m_cache;
+}
 
-          if(d->m_tessellation_done)
-            {
-              /*
-              std::cout << "Tapped out at (max_segs = "
-                        << ref->max_segments() << ", tess_factor = "
-                        << ref->effective_curve_distance_threshhold()
-                        << ", num_points = " << ref->point_data().size()
-                        << ")\n";
-              */
-            }
-          d->m_tessellation.push_back(ref);
-        }
-      return d->m_tessellation.back();
+void
+fastuidraw::Path::
+tessellation_cache(const reference_counted_ptr<PathLODCache> &v)
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  if(d->m_cache == v)
+    {
+      return;
+    }
+
+  d->cache_remove_all();
+  d->m_cache = v;
+  d->m_cache_d = (v) ?
+    static_cast<PathLODCachePrivate*>(v->m_d) :
+    nullptr;
+  d->cache_add_new();
+}
+
+uint64_t
+fastuidraw::Path::
+tessellation_memory_usage(void) const
+{
+  PathPrivate *d;
+  uint64_t return_value(0);
+
+  d = static_cast<PathPrivate*>(m_d);
+  for(const PathPrivate::tessellated_path_ref &ref : d->m_tessellation)
+    {
+      return_value += ref->memory_usage();
     }
+  return return_value;
+}
+
+uint64_t
+fastuidraw::Path::
+tessellation_stamp(void) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  return d->m_stamp;
 }
 
 bool
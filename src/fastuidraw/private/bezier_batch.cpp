@@ -0,0 +1,651 @@
+/*!
+ * \file bezier_batch.cpp
+ * \brief file bezier_batch.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include "bezier_batch.hpp"
+
+/* As in bulk_copy.cpp, the SSE2 and AVX2 routines are compiled
+   with a target attribute and which routine is used is decided
+   at runtime from the features of the CPU. The AVX2 routine is
+   compiled for avx2 only and not for fma, so that the compiler
+   cannot contract a multiply and an add into an FMA: the values
+   would then no longer be exactly those of bezier::compute().
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FASTUIDRAW_BEZIER_BATCH_X86
+#include <immintrin.h>
+#define FASTUIDRAW_TARGET_SSE2 __attribute__((target("sse2")))
+#define FASTUIDRAW_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FASTUIDRAW_BEZIER_BATCH_NEON
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+  /* Each of the compute_poly_*() functions evaluates a polynomial
+     given by Bernstein coefficients that are multiplied by the
+     binomial coefficients with exactly the operations, in the
+     same order, that poly::compute_poly() of path.cpp uses for
+     a polynomial with at most 4 coefficients. In particular
+     the values s * s2 and t * t2 are what compute_poly() gets
+     for s^3 and t^3.
+   */
+  inline
+  fastuidraw::vec2
+  compute_poly_scalar(const fastuidraw::vec2 *poly, unsigned int poly_size,
+                      float t, float s, float st, float s2, float t2)
+  {
+    switch(poly_size)
+      {
+      case 1:
+        return poly[0];
+
+      case 2:
+        return s * poly[0] + t * poly[1];
+
+      case 3:
+        return (poly[2] * t2) + (poly[0] * s2) + (st * poly[1]);
+
+      default:
+        {
+          fastuidraw::vec2 work;
+
+          FASTUIDRAWassert(poly_size == 4);
+          work = s * poly[1] + t * poly[2];
+          return (poly[3] * (t * t2)) + (poly[0] * (s * s2)) + (st * work);
+        }
+      }
+  }
+
+  void
+  evaluate_scalar(const fastuidraw::vec2 *poly,
+                  const fastuidraw::vec2 *poly_prime,
+                  const fastuidraw::vec2 *poly_prime_prime,
+                  unsigned int degree,
+                  const float *pt, unsigned int count,
+                  fastuidraw::vec2 *p, fastuidraw::vec2 *p_t,
+                  fastuidraw::vec2 *p_tt)
+  {
+    for(unsigned int i = 0; i < count; ++i)
+      {
+        float t(pt[i]);
+        float s(1.0f - t);
+        float st(s * t), s2(s * s), t2(t * t);
+
+        p[i] = compute_poly_scalar(poly, degree + 1, t, s, st, s2, t2);
+        p_t[i] = compute_poly_scalar(poly_prime, degree, t, s, st, s2, t2);
+        p_tt[i] = compute_poly_scalar(poly_prime_prime, degree - 1, t, s, st, s2, t2);
+      }
+  }
+
+#ifdef FASTUIDRAW_BEZIER_BATCH_X86
+
+  /* evaluates coordinate C of the polynomial at 4 times */
+  FASTUIDRAW_TARGET_SSE2
+  inline
+  __m128
+  compute_poly_sse2(const fastuidraw::vec2 *poly, unsigned int poly_size, unsigned int C,
+                    __m128 t, __m128 s, __m128 st, __m128 s2, __m128 t2)
+  {
+    switch(poly_size)
+      {
+      case 1:
+        return _mm_set1_ps(poly[0][C]);
+
+      case 2:
+        return _mm_add_ps(_mm_mul_ps(s, _mm_set1_ps(poly[0][C])),
+                          _mm_mul_ps(t, _mm_set1_ps(poly[1][C])));
+
+      case 3:
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(poly[2][C]), t2),
+                                     _mm_mul_ps(_mm_set1_ps(poly[0][C]), s2)),
+                          _mm_mul_ps(st, _mm_set1_ps(poly[1][C])));
+
+      default:
+        {
+          __m128 work;
+
+          work = _mm_add_ps(_mm_mul_ps(s, _mm_set1_ps(poly[1][C])),
+                            _mm_mul_ps(t, _mm_set1_ps(poly[2][C])));
+          return _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(poly[3][C]), _mm_mul_ps(t, t2)),
+                                       _mm_mul_ps(_mm_set1_ps(poly[0][C]), _mm_mul_ps(s, s2))),
+                            _mm_mul_ps(st, work));
+        }
+      }
+  }
+
+  /* writes the values of the polynomial at 4 times to dst[0], .., dst[3] */
+  FASTUIDRAW_TARGET_SSE2
+  inline
+  void
+  store_poly_sse2(const fastuidraw::vec2 *poly, unsigned int poly_size,
+                  __m128 t, __m128 s, __m128 st, __m128 s2, __m128 t2,
+                  fastuidraw::vec2 *dst)
+  {
+    __m128 x, y;
+    float *fdst;
+
+    x = compute_poly_sse2(poly, poly_size, 0, t, s, st, s2, t2);
+    y = compute_poly_sse2(poly, poly_size, 1, t, s, st, s2, t2);
+    fdst = reinterpret_cast<float*>(dst);
+    _mm_storeu_ps(fdst, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(fdst + 4, _mm_unpackhi_ps(x, y));
+  }
+
+  FASTUIDRAW_TARGET_SSE2
+  void
+  evaluate_sse2(const fastuidraw::vec2 *poly,
+                const fastuidraw::vec2 *poly_prime,
+                const fastuidraw::vec2 *poly_prime_prime,
+                unsigned int degree,
+                const float *pt, unsigned int count,
+                fastuidraw::vec2 *p, fastuidraw::vec2 *p_t,
+                fastuidraw::vec2 *p_tt)
+  {
+    unsigned int i;
+
+    for(i = 0; i + 4 <= count; i += 4)
+      {
+        __m128 t, s, st, s2, t2;
+
+        t = _mm_loadu_ps(pt + i);
+        s = _mm_sub_ps(_mm_set1_ps(1.0f), t);
+        st = _mm_mul_ps(s, t);
+        s2 = _mm_mul_ps(s, s);
+        t2 = _mm_mul_ps(t, t);
+        store_poly_sse2(poly, degree + 1, t, s, st, s2, t2, p + i);
+        store_poly_sse2(poly_prime, degree, t, s, st, s2, t2, p_t + i);
+        store_poly_sse2(poly_prime_prime, degree - 1, t, s, st, s2, t2, p_tt + i);
+      }
+    evaluate_scalar(poly, poly_prime, poly_prime_prime, degree,
+                    pt + i, count - i, p + i, p_t + i, p_tt + i);
+  }
+
+  /* evaluates coordinate C of the polynomial at 8 times */
+  FASTUIDRAW_TARGET_AVX2
+  inline
+  __m256
+  compute_poly_avx2(const fastuidraw::vec2 *poly, unsigned int poly_size, unsigned int C,
+                    __m256 t, __m256 s, __m256 st, __m256 s2, __m256 t2)
+  {
+    switch(poly_size)
+      {
+      case 1:
+        return _mm256_set1_ps(poly[0][C]);
+
+      case 2:
+        return _mm256_add_ps(_mm256_mul_ps(s, _mm256_set1_ps(poly[0][C])),
+                             _mm256_mul_ps(t, _mm256_set1_ps(poly[1][C])));
+
+      case 3:
+        return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(poly[2][C]), t2),
+                                           _mm256_mul_ps(_mm256_set1_ps(poly[0][C]), s2)),
+                             _mm256_mul_ps(st, _mm256_set1_ps(poly[1][C])));
+
+      default:
+        {
+          __m256 work;
+
+          work = _mm256_add_ps(_mm256_mul_ps(s, _mm256_set1_ps(poly[1][C])),
+                               _mm256_mul_ps(t, _mm256_set1_ps(poly[2][C])));
+          return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(poly[3][C]), _mm256_mul_ps(t, t2)),
+                                             _mm256_mul_ps(_mm256_set1_ps(poly[0][C]), _mm256_mul_ps(s, s2))),
+                               _mm256_mul_ps(st, work));
+        }
+      }
+  }
+
+  /* writes the values of the polynomial at 8 times to dst[0], .., dst[7];
+     the unpacks interleave within each 128-bit lane, so the lanes are
+     then put back in order.
+   */
+  FASTUIDRAW_TARGET_AVX2
+  inline
+  void
+  store_poly_avx2(const fastuidraw::vec2 *poly, unsigned int poly_size,
+                  __m256 t, __m256 s, __m256 st, __m256 s2, __m256 t2,
+                  fastuidraw::vec2 *dst)
+  {
+    __m256 x, y, lo, hi;
+    float *fdst;
+
+    x = compute_poly_avx2(poly, poly_size, 0, t, s, st, s2, t2);
+    y = compute_poly_avx2(poly, poly_size, 1, t, s, st, s2, t2);
+    lo = _mm256_unpacklo_ps(x, y);
+    hi = _mm256_unpackhi_ps(x, y);
+    fdst = reinterpret_cast<float*>(dst);
+    _mm256_storeu_ps(fdst, _mm256_permute2f128_ps(lo, hi, 0x20));
+    _mm256_storeu_ps(fdst + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+  }
+
+  FASTUIDRAW_TARGET_AVX2
+  void
+  evaluate_avx2(const fastuidraw::vec2 *poly,
+                const fastuidraw::vec2 *poly_prime,
+                const fastuidraw::vec2 *poly_prime_prime,
+                unsigned int degree,
+                const float *pt, unsigned int count,
+                fastuidraw::vec2 *p, fastuidraw::vec2 *p_t,
+                fastuidraw::vec2 *p_tt)
+  {
+    unsigned int i;
+
+    for(i = 0; i + 8 <= count; i += 8)
+      {
+        __m256 t, s, st, s2, t2;
+
+        t = _mm256_loadu_ps(pt + i);
+        s = _mm256_sub_ps(_mm256_set1_ps(1.0f), t);
+        st = _mm256_mul_ps(s, t);
+        s2 = _mm256_mul_ps(s, s);
+        t2 = _mm256_mul_ps(t, t);
+        store_poly_avx2(poly, degree + 1, t, s, st, s2, t2, p + i);
+        store_poly_avx2(poly_prime, degree, t, s, st, s2, t2, p_t + i);
+        store_poly_avx2(poly_prime_prime, degree - 1, t, s, st, s2, t2, p_tt + i);
+      }
+    evaluate_sse2(poly, poly_prime, poly_prime_prime, degree,
+                  pt + i, count - i, p + i, p_t + i, p_tt + i);
+  }
+
+#endif
+
+#ifdef FASTUIDRAW_BEZIER_BATCH_NEON
+
+  inline
+  float32x4_t
+  compute_poly_neon(const fastuidraw::vec2 *poly, unsigned int poly_size, unsigned int C,
+                    float32x4_t t, float32x4_t s, float32x4_t st,
+                    float32x4_t s2, float32x4_t t2)
+  {
+    switch(poly_size)
+      {
+      case 1:
+        return vdupq_n_f32(poly[0][C]);
+
+      case 2:
+        return vaddq_f32(vmulq_f32(s, vdupq_n_f32(poly[0][C])),
+                         vmulq_f32(t, vdupq_n_f32(poly[1][C])));
+
+      case 3:
+        return vaddq_f32(vaddq_f32(vmulq_f32(vdupq_n_f32(poly[2][C]), t2),
+                                   vmulq_f32(vdupq_n_f32(poly[0][C]), s2)),
+                         vmulq_f32(st, vdupq_n_f32(poly[1][C])));
+
+      default:
+        {
+          float32x4_t work;
+
+          work = vaddq_f32(vmulq_f32(s, vdupq_n_f32(poly[1][C])),
+                           vmulq_f32(t, vdupq_n_f32(poly[2][C])));
+          return vaddq_f32(vaddq_f32(vmulq_f32(vdupq_n_f32(poly[3][C]), vmulq_f32(t, t2)),
+                                     vmulq_f32(vdupq_n_f32(poly[0][C]), vmulq_f32(s, s2))),
+                           vmulq_f32(st, work));
+        }
+      }
+  }
+
+  inline
+  void
+  store_poly_neon(const fastuidraw::vec2 *poly, unsigned int poly_size,
+                  float32x4_t t, float32x4_t s, float32x4_t st,
+                  float32x4_t s2, float32x4_t t2,
+                  fastuidraw::vec2 *dst)
+  {
+    float32x4x2_t xy;
+
+    xy.val[0] = compute_poly_neon(poly, poly_size, 0, t, s, st, s2, t2);
+    xy.val[1] = compute_poly_neon(poly, poly_size, 1, t, s, st, s2, t2);
+    vst2q_f32(reinterpret_cast<float*>(dst), xy);
+  }
+
+  void
+  evaluate_neon(const fastuidraw::vec2 *poly,
+                const fastuidraw::vec2 *poly_prime,
+                const fastuidraw::vec2 *poly_prime_prime,
+                unsigned int degree,
+                const float *pt, unsigned int count,
+                fastuidraw::vec2 *p, fastuidraw::vec2 *p_t,
+                fastuidraw::vec2 *p_tt)
+  {
+    unsigned int i;
+
+    for(i = 0; i + 4 <= count; i += 4)
+      {
+        float32x4_t t, s, st, s2, t2;
+
+        t = vld1q_f32(pt + i);
+        s = vsubq_f32(vdupq_n_f32(1.0f), t);
+        st = vmulq_f32(s, t);
+        s2 = vmulq_f32(s, s);
+        t2 = vmulq_f32(t, t);
+        store_poly_neon(poly, degree + 1, t, s, st, s2, t2, p + i);
+        store_poly_neon(poly_prime, degree, t, s, st, s2, t2, p_t + i);
+        store_poly_neon(poly_prime_prime, degree - 1, t, s, st, s2, t2, p_tt + i);
+      }
+    evaluate_scalar(poly, poly_prime, poly_prime_prime, degree,
+                    pt + i, count - i, p + i, p_t + i, p_tt + i);
+  }
+
+#endif
+
+  /* Forward differencing of a polynomial of degree N given in
+     the power basis: m_x[0], m_y[0] is the value at the current
+     time and m_x[k], m_y[k] is the k'th forward difference at
+     the current time, so that stepping to the next time is
+     m_x[k] += m_x[k + 1].
+   */
+  template<unsigned int N>
+  class ForwardDifference
+  {
+  public:
+    ForwardDifference(const fastuidraw::dvec2 *power, double t0, double dt)
+    {
+      for(unsigned int k = 0; k <= N; ++k)
+        {
+          double t(t0 + static_cast<double>(k) * dt);
+
+          /* Horner's rule */
+          m_x[k] = power[N].x();
+          m_y[k] = power[N].y();
+          for(unsigned int j = N; j > 0; --j)
+            {
+              m_x[k] = m_x[k] * t + power[j - 1].x();
+              m_y[k] = m_y[k] * t + power[j - 1].y();
+            }
+        }
+
+      for(unsigned int j = 1; j <= N; ++j)
+        {
+          for(unsigned int k = N; k >= j; --k)
+            {
+              m_x[k] -= m_x[k - 1];
+              m_y[k] -= m_y[k - 1];
+            }
+        }
+    }
+
+    void
+    next(fastuidraw::vec2 *dst)
+    {
+      dst->x() = static_cast<float>(m_x[0]);
+      dst->y() = static_cast<float>(m_y[0]);
+      for(unsigned int k = 0; k < N; ++k)
+        {
+          m_x[k] += m_x[k + 1];
+          m_y[k] += m_y[k + 1];
+        }
+    }
+
+  private:
+    double m_x[N + 1], m_y[N + 1];
+  };
+
+  /* N is the degree of the curve */
+  template<unsigned int N>
+  void
+  evaluate_uniform_implement(const fastuidraw::dvec2 *power,
+                             const fastuidraw::dvec2 *power_prime,
+                             const fastuidraw::dvec2 *power_prime_prime,
+                             double t0, double dt, unsigned int count,
+                             fastuidraw::vec2 *p, fastuidraw::vec2 *p_t,
+                             fastuidraw::vec2 *p_tt)
+  {
+    ForwardDifference<N> fp(power, t0, dt);
+    ForwardDifference<N - 1> fp_t(power_prime, t0, dt);
+    ForwardDifference<N - 2> fp_tt(power_prime_prime, t0, dt);
+
+    for(unsigned int i = 0; i < count; ++i)
+      {
+        fp.next(p + i);
+        fp_t.next(p_t + i);
+        fp_tt.next(p_tt + i);
+      }
+  }
+
+  /* multiply the Bernstein coefficients by the binomial
+     coefficients as binomial_coeff::prepare_bernstein()
+     of path.cpp does.
+   */
+  void
+  prepare_bernstein(fastuidraw::vec2 *poly, unsigned int poly_size)
+  {
+    const float coeffs[4][4] =
+      {
+        {1.0f, 0.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f, 0.0f},
+        {1.0f, 2.0f, 1.0f, 0.0f},
+        {1.0f, 3.0f, 3.0f, 1.0f},
+      };
+
+    FASTUIDRAWassert(poly_size >= 1 && poly_size <= 4);
+    for(unsigned int k = 0; k < poly_size; ++k)
+      {
+        poly[k] *= coeffs[poly_size - 1][k];
+      }
+  }
+
+  enum fastuidraw::detail::bezier_batch_impl_t
+  compute_best_impl(void)
+  {
+    using namespace fastuidraw::detail;
+
+    if(bezier_batch_impl_supported(bezier_batch_avx2))
+      {
+        return bezier_batch_avx2;
+      }
+    if(bezier_batch_impl_supported(bezier_batch_sse2))
+      {
+        return bezier_batch_sse2;
+      }
+    if(bezier_batch_impl_supported(bezier_batch_neon))
+      {
+        return bezier_batch_neon;
+      }
+    return bezier_batch_scalar;
+  }
+}
+
+bool
+fastuidraw::detail::
+bezier_batch_impl_supported(enum bezier_batch_impl_t impl)
+{
+  switch(impl)
+    {
+    case bezier_batch_scalar:
+      return true;
+
+#ifdef FASTUIDRAW_BEZIER_BATCH_X86
+    case bezier_batch_sse2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("sse2");
+
+    case bezier_batch_avx2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+#endif
+
+#ifdef FASTUIDRAW_BEZIER_BATCH_NEON
+    case bezier_batch_neon:
+      return true;
+#endif
+
+    default:
+      return false;
+    }
+}
+
+enum fastuidraw::detail::bezier_batch_impl_t
+fastuidraw::detail::
+bezier_batch_best_impl(void)
+{
+  static enum bezier_batch_impl_t R(compute_best_impl());
+  return R;
+}
+
+const char*
+fastuidraw::detail::
+bezier_batch_impl_label(enum bezier_batch_impl_t impl)
+{
+  switch(impl)
+    {
+    case bezier_batch_scalar:
+      return "scalar";
+    case bezier_batch_sse2:
+      return "sse2";
+    case bezier_batch_avx2:
+      return "avx2";
+    case bezier_batch_neon:
+      return "neon";
+    default:
+      return "invalid";
+    }
+}
+
+//////////////////////////////////////////
+// fastuidraw::detail::BezierBatch methods
+fastuidraw::detail::BezierBatch::
+BezierBatch(const_c_array<vec2> pts):
+  m_degree(pts.size() - 1)
+{
+  float degree;
+
+  FASTUIDRAWassert(pts.size() == 3 || pts.size() == 4);
+
+  /* the derivatives are computed as
+     poly::compute_bernstein_derivative() does
+   */
+  degree = static_cast<float>(m_degree);
+  for(unsigned int k = 0; k <= m_degree; ++k)
+    {
+      m_poly[k] = pts[k];
+    }
+  for(unsigned int k = 0; k < m_degree; ++k)
+    {
+      m_poly_prime[k] = degree * (m_poly[k + 1] - m_poly[k]);
+    }
+  degree = static_cast<float>(m_degree - 1);
+  for(unsigned int k = 0; k + 1 < m_degree; ++k)
+    {
+      m_poly_prime_prime[k] = degree * (m_poly_prime[k + 1] - m_poly_prime[k]);
+    }
+
+  prepare_bernstein(m_poly.c_ptr(), m_degree + 1);
+  prepare_bernstein(m_poly_prime.c_ptr(), m_degree);
+  prepare_bernstein(m_poly_prime_prime.c_ptr(), m_degree - 1);
+
+  /* the power basis coefficients from the control points */
+  dvec2 p0(pts[0].x(), pts[0].y());
+  dvec2 p1(pts[1].x(), pts[1].y());
+  dvec2 p2(pts[2].x(), pts[2].y());
+
+  m_power[0] = p0;
+  if(m_degree == 2)
+    {
+      m_power[1] = 2.0 * (p1 - p0);
+      m_power[2] = p0 - 2.0 * p1 + p2;
+      m_power[3] = dvec2(0.0, 0.0);
+    }
+  else
+    {
+      dvec2 p3(pts[3].x(), pts[3].y());
+
+      m_power[1] = 3.0 * (p1 - p0);
+      m_power[2] = 3.0 * (p0 - 2.0 * p1 + p2);
+      m_power[3] = p3 - p0 + 3.0 * (p1 - p2);
+    }
+}
+
+void
+fastuidraw::detail::BezierBatch::
+evaluate(const_c_array<float> t,
+         c_array<vec2> p, c_array<vec2> p_t, c_array<vec2> p_tt,
+         enum bezier_batch_impl_t impl) const
+{
+  FASTUIDRAWassert(bezier_batch_impl_supported(impl));
+  FASTUIDRAWassert(p.size() >= t.size());
+  FASTUIDRAWassert(p_t.size() >= t.size());
+  FASTUIDRAWassert(p_tt.size() >= t.size());
+
+  if(t.empty())
+    {
+      return;
+    }
+
+  switch(impl)
+    {
+#ifdef FASTUIDRAW_BEZIER_BATCH_X86
+    case bezier_batch_sse2:
+      evaluate_sse2(m_poly.c_ptr(), m_poly_prime.c_ptr(), m_poly_prime_prime.c_ptr(),
+                    m_degree, t.c_ptr(), t.size(),
+                    p.c_ptr(), p_t.c_ptr(), p_tt.c_ptr());
+      break;
+
+    case bezier_batch_avx2:
+      evaluate_avx2(m_poly.c_ptr(), m_poly_prime.c_ptr(), m_poly_prime_prime.c_ptr(),
+                    m_degree, t.c_ptr(), t.size(),
+                    p.c_ptr(), p_t.c_ptr(), p_tt.c_ptr());
+      break;
+#endif
+
+#ifdef FASTUIDRAW_BEZIER_BATCH_NEON
+    case bezier_batch_neon:
+      evaluate_neon(m_poly.c_ptr(), m_poly_prime.c_ptr(), m_poly_prime_prime.c_ptr(),
+                    m_degree, t.c_ptr(), t.size(),
+                    p.c_ptr(), p_t.c_ptr(), p_tt.c_ptr());
+      break;
+#endif
+
+    default:
+      evaluate_scalar(m_poly.c_ptr(), m_poly_prime.c_ptr(), m_poly_prime_prime.c_ptr(),
+                      m_degree, t.c_ptr(), t.size(),
+                      p.c_ptr(), p_t.c_ptr(), p_tt.c_ptr());
+    }
+}
+
+void
+fastuidraw::detail::BezierBatch::
+evaluate_uniform(float t0, float dt,
+                 c_array<vec2> p, c_array<vec2> p_t, c_array<vec2> p_tt) const
+{
+  vecN<dvec2, 3> power_prime;
+  vecN<dvec2, 2> power_prime_prime;
+
+  FASTUIDRAWassert(p_t.size() >= p.size());
+  FASTUIDRAWassert(p_tt.size() >= p.size());
+
+  for(unsigned int k = 0; k < m_degree; ++k)
+    {
+      power_prime[k] = static_cast<double>(k + 1) * m_power[k + 1];
+    }
+  for(unsigned int k = 0; k + 1 < m_degree; ++k)
+    {
+      power_prime_prime[k] = static_cast<double>((k + 1) * (k + 2)) * m_power[k + 2];
+    }
+
+  if(m_degree == 2)
+    {
+      evaluate_uniform_implement<2>(m_power.c_ptr(), power_prime.c_ptr(), power_prime_prime.c_ptr(),
+                                    t0, dt, p.size(), p.c_ptr(), p_t.c_ptr(), p_tt.c_ptr());
+    }
+  else
+    {
+      evaluate_uniform_implement<3>(m_power.c_ptr(), power_prime.c_ptr(), power_prime_prime.c_ptr(),
+                                    t0, dt, p.size(), p.c_ptr(), p_t.c_ptr(), p_tt.c_ptr());
+    }
+}
@@ -0,0 +1,120 @@
+/*!
+ * \file bezier_batch.hpp
+ * \brief file bezier_batch.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/util/c_array.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* Implementations of BezierBatch::evaluate(); which are
+       available depends on the CPU the code runs on.
+     */
+    enum bezier_batch_impl_t
+      {
+        bezier_batch_scalar,
+        bezier_batch_sse2,
+        bezier_batch_avx2,
+        bezier_batch_neon,
+
+        bezier_batch_number_impls
+      };
+
+    /* returns true if impl can be used on the running CPU */
+    bool
+    bezier_batch_impl_supported(enum bezier_batch_impl_t impl);
+
+    /* returns the fastest implementation the running CPU
+       supports, chosen once on the first call.
+     */
+    enum bezier_batch_impl_t
+    bezier_batch_best_impl(void);
+
+    const char*
+    bezier_batch_impl_label(enum bezier_batch_impl_t impl);
+
+    /* A BezierBatch evaluates a quadratic or cubic Bezier
+       curve, together with its first and second derivatives,
+       at many times with one call. The values of evaluate()
+       are computed with the same operations in the same order
+       as PathContour::bezier::compute(), so they are exactly
+       the same. The values of evaluate_uniform() come from
+       forward differencing and differ from those only by
+       rounding; on the curves of the bezier-tessellation
+       benchmark (coordinates up to 1000) the largest
+       distance between positions is about 2.6e-4.
+     */
+    class BezierBatch
+    {
+    public:
+      /* pts are the start point, the one or two control
+         points and the end point of the curve.
+       */
+      explicit
+      BezierBatch(const_c_array<vec2> pts);
+
+      /* returns 2 for a quadratic and 3 for a cubic */
+      unsigned int
+      degree(void) const
+      {
+        return m_degree;
+      }
+
+      /* Sets p[i], p_t[i] and p_tt[i] to the position, the
+         derivative and the second derivative of the curve
+         at t[i]. Each of p, p_t and p_tt must be as large
+         as t.
+       */
+      void
+      evaluate(const_c_array<float> t,
+               c_array<vec2> p, c_array<vec2> p_t, c_array<vec2> p_tt,
+               enum bezier_batch_impl_t impl = bezier_batch_best_impl()) const;
+
+      /* Same as evaluate() for the times t0 + i * dt,
+         0 <= i < p.size(), by forward differencing: after
+         a setup that evaluates the curve degree + 1 times,
+         each time costs only additions. The differences
+         are accumulated in double precision so that the
+         error does not grow with the number of times.
+       */
+      void
+      evaluate_uniform(float t0, float dt,
+                       c_array<vec2> p, c_array<vec2> p_t, c_array<vec2> p_tt) const;
+
+    private:
+      unsigned int m_degree;
+
+      /* Bernstein coefficients of the curve and of its
+         derivatives multiplied by the binomial coefficients,
+         as in PathContour::bezier.
+       */
+      vecN<vec2, 4> m_poly;
+      vecN<vec2, 3> m_poly_prime;
+      vecN<vec2, 2> m_poly_prime_prime;
+
+      /* coefficients of the curve in the power basis,
+         i.e. p(t) = sum_k m_power[k] t^k.
+       */
+      vecN<dvec2, 4> m_power;
+    };
+  }
+}
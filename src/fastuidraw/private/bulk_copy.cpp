@@ -0,0 +1,581 @@
+/*!
+ * \file bulk_copy.cpp
+ * \brief file bulk_copy.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <cstring>
+#include <stdint.h>
+#include "bulk_copy.hpp"
+
+/* The SSE2 and AVX2 routines are compiled with a target
+   attribute so that the library does not need to be built
+   with -mavx2; which routine is used is decided at runtime
+   from the features of the CPU.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FASTUIDRAW_BULK_COPY_X86
+#include <immintrin.h>
+#define FASTUIDRAW_TARGET_SSE2 __attribute__((target("sse2")))
+#define FASTUIDRAW_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FASTUIDRAW_BULK_COPY_NEON
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+  /* below this many bytes, the fence that must follow
+     non-temporal stores costs more than it saves.
+   */
+  enum
+    {
+      streaming_threshold_bytes = 8 * 1024
+    };
+
+  template<typename T>
+  unsigned int
+  elements_until_aligned(const T *p, uintptr_t alignment, unsigned int count)
+  {
+    uintptr_t v, r;
+
+    v = reinterpret_cast<uintptr_t>(p);
+    r = (alignment - (v & (alignment - 1u))) & (alignment - 1u);
+    if(r % sizeof(T) != 0)
+      {
+        /* p can never be aligned, use normal stores */
+        return count;
+      }
+    return fastuidraw::t_min(count, static_cast<unsigned int>(r / sizeof(T)));
+  }
+
+  void
+  rebase_indices_scalar(uint32_t *dst, const uint32_t *src,
+                        unsigned int count, uint32_t offset)
+  {
+    for(unsigned int i = 0; i < count; ++i)
+      {
+        dst[i] = src[i] + offset;
+      }
+  }
+
+  void
+  rebase_short_indices_scalar(uint16_t *dst, const uint32_t *src,
+                              unsigned int count, uint32_t offset)
+  {
+    for(unsigned int i = 0; i < count; ++i)
+      {
+        FASTUIDRAWassert(src[i] + offset <= 0xFFFFu);
+        dst[i] = static_cast<uint16_t>(src[i] + offset);
+      }
+  }
+
+  void
+  copy_compact_attributes_scalar(fastuidraw::uvec4 *dst,
+                                 const fastuidraw::PainterAttribute *src,
+                                 unsigned int count)
+  {
+    for(unsigned int i = 0; i < count; ++i)
+      {
+        dst[i] = src[i].m_attrib0;
+      }
+  }
+
+#ifdef FASTUIDRAW_BULK_COPY_X86
+
+  /* dst must be 16-byte aligned; a uvec4 is 16 bytes
+     so then every element of dst is aligned too.
+   */
+  FASTUIDRAW_TARGET_SSE2
+  void
+  stream_compact_attributes_sse2(fastuidraw::uvec4 *dst,
+                                 const fastuidraw::PainterAttribute *src,
+                                 unsigned int count)
+  {
+    for(unsigned int i = 0; i < count; ++i)
+      {
+        __m128i v;
+        v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i].m_attrib0));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), v);
+      }
+    _mm_sfence();
+  }
+
+  FASTUIDRAW_TARGET_SSE2
+  void
+  rebase_indices_sse2(uint32_t *dst, const uint32_t *src,
+                      unsigned int count, uint32_t offset, bool streaming)
+  {
+    __m128i voffset;
+    unsigned int i(0);
+
+    if(streaming)
+      {
+        i = elements_until_aligned(dst, 16, count);
+        rebase_indices_scalar(dst, src, i, offset);
+      }
+
+    voffset = _mm_set1_epi32(static_cast<int>(offset));
+    if(streaming && i < count && (reinterpret_cast<uintptr_t>(dst + i) & 15u) == 0)
+      {
+        for(; i + 4 <= count; i += 4)
+          {
+            __m128i v;
+            v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi32(v, voffset));
+          }
+        _mm_sfence();
+      }
+    else
+      {
+        for(; i + 4 <= count; i += 4)
+          {
+            __m128i v;
+            v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi32(v, voffset));
+          }
+      }
+    rebase_indices_scalar(dst + i, src + i, count - i, offset);
+  }
+
+  FASTUIDRAW_TARGET_AVX2
+  void
+  rebase_indices_avx2(uint32_t *dst, const uint32_t *src,
+                      unsigned int count, uint32_t offset, bool streaming)
+  {
+    __m256i voffset;
+    unsigned int i(0);
+
+    if(streaming)
+      {
+        i = elements_until_aligned(dst, 32, count);
+        rebase_indices_scalar(dst, src, i, offset);
+      }
+
+    voffset = _mm256_set1_epi32(static_cast<int>(offset));
+    if(streaming && i < count && (reinterpret_cast<uintptr_t>(dst + i) & 31u) == 0)
+      {
+        for(; i + 8 <= count; i += 8)
+          {
+            __m256i v;
+            v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_add_epi32(v, voffset));
+          }
+        _mm_sfence();
+      }
+    else
+      {
+        for(; i + 8 <= count; i += 8)
+          {
+            __m256i v;
+            v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_add_epi32(v, voffset));
+          }
+      }
+    rebase_indices_scalar(dst + i, src + i, count - i, offset);
+  }
+
+  /* SSE2 only has a signed saturating pack from 32-bits to
+     16-bits, so the values are biased by -32768 to be in
+     the signed range, packed and then unbiased.
+   */
+  FASTUIDRAW_TARGET_SSE2
+  void
+  rebase_short_indices_sse2(uint16_t *dst, const uint32_t *src,
+                            unsigned int count, uint32_t offset, bool streaming)
+  {
+    __m128i voffset, vbias16;
+    unsigned int i(0);
+    bool aligned;
+
+    if(streaming)
+      {
+        i = elements_until_aligned(dst, 16, count);
+        rebase_short_indices_scalar(dst, src, i, offset);
+      }
+
+    voffset = _mm_set1_epi32(static_cast<int>(offset) - 0x8000);
+    vbias16 = _mm_set1_epi16(static_cast<short>(0x8000));
+    aligned = streaming && i < count && (reinterpret_cast<uintptr_t>(dst + i) & 15u) == 0;
+    for(; i + 8 <= count; i += 8)
+      {
+        __m128i a, b, v;
+
+        a = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), voffset);
+        b = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4)), voffset);
+        v = _mm_xor_si128(_mm_packs_epi32(a, b), vbias16);
+        if(aligned)
+          {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), v);
+          }
+        else
+          {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+          }
+      }
+    if(aligned)
+      {
+        _mm_sfence();
+      }
+    rebase_short_indices_scalar(dst + i, src + i, count - i, offset);
+  }
+
+  /* _mm256_packus_epi32 packs within each 128-bit lane,
+     the permute puts the 64-bit blocks back in order.
+   */
+  FASTUIDRAW_TARGET_AVX2
+  void
+  rebase_short_indices_avx2(uint16_t *dst, const uint32_t *src,
+                            unsigned int count, uint32_t offset, bool streaming)
+  {
+    __m256i voffset;
+    unsigned int i(0);
+    bool aligned;
+
+    if(streaming)
+      {
+        i = elements_until_aligned(dst, 32, count);
+        rebase_short_indices_scalar(dst, src, i, offset);
+      }
+
+    voffset = _mm256_set1_epi32(static_cast<int>(offset));
+    aligned = streaming && i < count && (reinterpret_cast<uintptr_t>(dst + i) & 31u) == 0;
+    for(; i + 16 <= count; i += 16)
+      {
+        __m256i a, b, v;
+
+        a = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), voffset);
+        b = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 8)), voffset);
+        v = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8);
+        if(aligned)
+          {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i), v);
+          }
+        else
+          {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+          }
+      }
+    if(aligned)
+      {
+        _mm_sfence();
+      }
+    rebase_short_indices_scalar(dst + i, src + i, count - i, offset);
+  }
+
+  /* non-temporal copy of bytes; dst and the size are
+     multiples of 4 bytes.
+   */
+  FASTUIDRAW_TARGET_SSE2
+  void
+  stream_copy_sse2(uint8_t *dst, const uint8_t *src, size_t bytes)
+  {
+    size_t head, i;
+
+    head = fastuidraw::t_min(bytes, static_cast<size_t>((16u - (reinterpret_cast<uintptr_t>(dst) & 15u)) & 15u));
+    std::memcpy(dst, src, head);
+    for(i = head; i + 16 <= bytes; i += 16)
+      {
+        __m128i v;
+        v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), v);
+      }
+    std::memcpy(dst + i, src + i, bytes - i);
+    _mm_sfence();
+  }
+
+  FASTUIDRAW_TARGET_AVX2
+  void
+  stream_copy_avx2(uint8_t *dst, const uint8_t *src, size_t bytes)
+  {
+    size_t head, i;
+
+    head = fastuidraw::t_min(bytes, static_cast<size_t>((32u - (reinterpret_cast<uintptr_t>(dst) & 31u)) & 31u));
+    std::memcpy(dst, src, head);
+    for(i = head; i + 32 <= bytes; i += 32)
+      {
+        __m256i v;
+        v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i), v);
+      }
+    std::memcpy(dst + i, src + i, bytes - i);
+    _mm_sfence();
+  }
+
+#endif
+
+#ifdef FASTUIDRAW_BULK_COPY_NEON
+
+  /* NEON has no non-temporal store intrinsic, the streaming
+     flag is ignored.
+   */
+  void
+  rebase_indices_neon(uint32_t *dst, const uint32_t *src,
+                      unsigned int count, uint32_t offset)
+  {
+    uint32x4_t voffset;
+    unsigned int i;
+
+    voffset = vdupq_n_u32(offset);
+    for(i = 0; i + 4 <= count; i += 4)
+      {
+        vst1q_u32(dst + i, vaddq_u32(vld1q_u32(src + i), voffset));
+      }
+    rebase_indices_scalar(dst + i, src + i, count - i, offset);
+  }
+
+  void
+  rebase_short_indices_neon(uint16_t *dst, const uint32_t *src,
+                            unsigned int count, uint32_t offset)
+  {
+    uint32x4_t voffset;
+    unsigned int i;
+
+    voffset = vdupq_n_u32(offset);
+    for(i = 0; i + 8 <= count; i += 8)
+      {
+        uint16x4_t a, b;
+
+        a = vmovn_u32(vaddq_u32(vld1q_u32(src + i), voffset));
+        b = vmovn_u32(vaddq_u32(vld1q_u32(src + i + 4), voffset));
+        vst1q_u16(dst + i, vcombine_u16(a, b));
+      }
+    rebase_short_indices_scalar(dst + i, src + i, count - i, offset);
+  }
+
+#endif
+
+  enum fastuidraw::detail::bulk_copy_impl_t
+  compute_best_impl(void)
+  {
+    using namespace fastuidraw::detail;
+
+    if(bulk_copy_impl_supported(bulk_copy_avx2))
+      {
+        return bulk_copy_avx2;
+      }
+    if(bulk_copy_impl_supported(bulk_copy_sse2))
+      {
+        return bulk_copy_sse2;
+      }
+    if(bulk_copy_impl_supported(bulk_copy_neon))
+      {
+        return bulk_copy_neon;
+      }
+    return bulk_copy_scalar;
+  }
+}
+
+bool
+fastuidraw::detail::
+bulk_copy_impl_supported(enum bulk_copy_impl_t impl)
+{
+  switch(impl)
+    {
+    case bulk_copy_scalar:
+      return true;
+
+#ifdef FASTUIDRAW_BULK_COPY_X86
+    case bulk_copy_sse2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("sse2");
+
+    case bulk_copy_avx2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+#endif
+
+#ifdef FASTUIDRAW_BULK_COPY_NEON
+    case bulk_copy_neon:
+      return true;
+#endif
+
+    default:
+      return false;
+    }
+}
+
+enum fastuidraw::detail::bulk_copy_impl_t
+fastuidraw::detail::
+bulk_copy_best_impl(void)
+{
+  static enum bulk_copy_impl_t R(compute_best_impl());
+  return R;
+}
+
+const char*
+fastuidraw::detail::
+bulk_copy_impl_label(enum bulk_copy_impl_t impl)
+{
+  switch(impl)
+    {
+    case bulk_copy_scalar:
+      return "scalar";
+    case bulk_copy_sse2:
+      return "sse2";
+    case bulk_copy_avx2:
+      return "avx2";
+    case bulk_copy_neon:
+      return "neon";
+    default:
+      return "invalid";
+    }
+}
+
+void
+fastuidraw::detail::
+rebase_indices(c_array<PainterIndex> dst,
+               const_c_array<PainterIndex> src,
+               int offset, bool streaming,
+               enum bulk_copy_impl_t impl)
+{
+  uint32_t uoffset;
+
+  FASTUIDRAWassert(dst.size() == src.size());
+  FASTUIDRAWassert(bulk_copy_impl_supported(impl));
+
+  uoffset = static_cast<uint32_t>(offset);
+  streaming = streaming && sizeof(PainterIndex) * dst.size() >= streaming_threshold_bytes;
+  switch(impl)
+    {
+#ifdef FASTUIDRAW_BULK_COPY_X86
+    case bulk_copy_sse2:
+      rebase_indices_sse2(dst.c_ptr(), src.c_ptr(), dst.size(), uoffset, streaming);
+      break;
+
+    case bulk_copy_avx2:
+      rebase_indices_avx2(dst.c_ptr(), src.c_ptr(), dst.size(), uoffset, streaming);
+      break;
+#endif
+
+#ifdef FASTUIDRAW_BULK_COPY_NEON
+    case bulk_copy_neon:
+      rebase_indices_neon(dst.c_ptr(), src.c_ptr(), dst.size(), uoffset);
+      break;
+#endif
+
+    default:
+      rebase_indices_scalar(dst.c_ptr(), src.c_ptr(), dst.size(), uoffset);
+    }
+}
+
+void
+fastuidraw::detail::
+rebase_indices(c_array<PainterShortIndex> dst,
+               const_c_array<PainterIndex> src,
+               int offset, bool streaming,
+               enum bulk_copy_impl_t impl)
+{
+  uint32_t uoffset;
+
+  FASTUIDRAWassert(dst.size() == src.size());
+  FASTUIDRAWassert(bulk_copy_impl_supported(impl));
+
+  uoffset = static_cast<uint32_t>(offset);
+  streaming = streaming && sizeof(PainterShortIndex) * dst.size() >= streaming_threshold_bytes;
+  switch(impl)
+    {
+#ifdef FASTUIDRAW_BULK_COPY_X86
+    case bulk_copy_sse2:
+      rebase_short_indices_sse2(dst.c_ptr(), src.c_ptr(), dst.size(), uoffset, streaming);
+      break;
+
+    case bulk_copy_avx2:
+      rebase_short_indices_avx2(dst.c_ptr(), src.c_ptr(), dst.size(), uoffset, streaming);
+      break;
+#endif
+
+#ifdef FASTUIDRAW_BULK_COPY_NEON
+    case bulk_copy_neon:
+      rebase_short_indices_neon(dst.c_ptr(), src.c_ptr(), dst.size(), uoffset);
+      break;
+#endif
+
+    default:
+      rebase_short_indices_scalar(dst.c_ptr(), src.c_ptr(), dst.size(), uoffset);
+    }
+}
+
+void
+fastuidraw::detail::
+copy_attributes(c_array<PainterAttribute> dst,
+                const_c_array<PainterAttribute> src,
+                bool streaming,
+                enum bulk_copy_impl_t impl)
+{
+  uint8_t *pdst;
+  const uint8_t *psrc;
+  size_t bytes;
+
+  FASTUIDRAWassert(dst.size() == src.size());
+  FASTUIDRAWassert(bulk_copy_impl_supported(impl));
+
+  pdst = reinterpret_cast<uint8_t*>(dst.c_ptr());
+  psrc = reinterpret_cast<const uint8_t*>(src.c_ptr());
+  bytes = sizeof(PainterAttribute) * dst.size();
+
+  /* a copy without streaming is left to memcpy, which
+     already picks the best routine for the CPU.
+   */
+  if(streaming && bytes >= streaming_threshold_bytes)
+    {
+      switch(impl)
+        {
+#ifdef FASTUIDRAW_BULK_COPY_X86
+        case bulk_copy_sse2:
+          stream_copy_sse2(pdst, psrc, bytes);
+          return;
+
+        case bulk_copy_avx2:
+          stream_copy_avx2(pdst, psrc, bytes);
+          return;
+#endif
+
+        default:
+          break;
+        }
+    }
+  std::memcpy(pdst, psrc, bytes);
+}
+
+void
+fastuidraw::detail::
+copy_compact_attributes(c_array<uvec4> dst,
+                        const_c_array<PainterAttribute> src,
+                        bool streaming,
+                        enum bulk_copy_impl_t impl)
+{
+  FASTUIDRAWassert(dst.size() == src.size());
+  FASTUIDRAWassert(bulk_copy_impl_supported(impl));
+
+  if(streaming
+     && sizeof(uvec4) * dst.size() >= streaming_threshold_bytes
+     && (reinterpret_cast<uintptr_t>(dst.c_ptr()) & 15u) == 0)
+    {
+      switch(impl)
+        {
+#ifdef FASTUIDRAW_BULK_COPY_X86
+        case bulk_copy_sse2:
+        case bulk_copy_avx2:
+          stream_compact_attributes_sse2(dst.c_ptr(), src.c_ptr(), dst.size());
+          return;
+#endif
+
+        default:
+          break;
+        }
+    }
+  copy_compact_attributes_scalar(dst.c_ptr(), src.c_ptr(), dst.size());
+}
@@ -0,0 +1,93 @@
+/*!
+ * \file bulk_copy.hpp
+ * \brief file bulk_copy.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/painter/painter_attribute.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* Implementations of the copy routines; which are
+       available depends on the CPU the code runs on.
+     */
+    enum bulk_copy_impl_t
+      {
+        bulk_copy_scalar,
+        bulk_copy_sse2,
+        bulk_copy_avx2,
+        bulk_copy_neon,
+
+        bulk_copy_number_impls
+      };
+
+    /* returns true if impl can be used on the running CPU */
+    bool
+    bulk_copy_impl_supported(enum bulk_copy_impl_t impl);
+
+    /* returns the fastest implementation the running CPU
+       supports, chosen once on the first call.
+     */
+    enum bulk_copy_impl_t
+    bulk_copy_best_impl(void);
+
+    const char*
+    bulk_copy_impl_label(enum bulk_copy_impl_t impl);
+
+    /* Sets dst[i] = src[i] + offset. If streaming is true,
+       dst is written with non-temporal stores, which do not
+       read dst into the cache; use it when dst is write-
+       combined memory (for example a mapped GL buffer). Copies
+       of only a few kilobytes are always done with normal
+       stores.
+     */
+    void
+    rebase_indices(c_array<PainterIndex> dst,
+                   const_c_array<PainterIndex> src,
+                   int offset, bool streaming,
+                   enum bulk_copy_impl_t impl = bulk_copy_best_impl());
+
+    /* Sets dst[i] = src[i] + offset converted to 16-bits, each
+       value must fit in 16-bits. Streaming as in rebase_indices().
+     */
+    void
+    rebase_indices(c_array<PainterShortIndex> dst,
+                   const_c_array<PainterIndex> src,
+                   int offset, bool streaming,
+                   enum bulk_copy_impl_t impl = bulk_copy_best_impl());
+
+    /* Copies src to dst, streaming as in rebase_indices(). */
+    void
+    copy_attributes(c_array<PainterAttribute> dst,
+                    const_c_array<PainterAttribute> src,
+                    bool streaming,
+                    enum bulk_copy_impl_t impl = bulk_copy_best_impl());
+
+    /* Sets dst[i] = src[i].m_attrib0, streaming as in
+       rebase_indices().
+     */
+    void
+    copy_compact_attributes(c_array<uvec4> dst,
+                            const_c_array<PainterAttribute> src,
+                            bool streaming,
+                            enum bulk_copy_impl_t impl = bulk_copy_best_impl());
+  }
+}
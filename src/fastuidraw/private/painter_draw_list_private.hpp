@@ -0,0 +1,174 @@
+/*!
+ * \file painter_draw_list_private.hpp
+ * \brief file painter_draw_list_private.hpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <list>
+#include <map>
+#include <fastuidraw/painter/painter_header.hpp>
+#include <fastuidraw/painter/packing/painter_draw_list.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* The data of a PainterDrawList; filled by PainterPacker
+       while capturing and read by PainterPacker::draw_list().
+       The packer packs into arrays of its own and copies them
+       to the PainterDraw of the backend and to the draw when
+       the draw is unmapped, so the (write only) buffers of the
+       backend are never read back.
+     */
+    class PainterDrawListPrivate
+    {
+    public:
+      /* values of a PainterShaderGroup */
+      class shader_group
+      {
+      public:
+        uint32_t m_item_group;
+        uint32_t m_brush;
+        uint32_t m_blend_group;
+        BlendMode::packed_value m_blend_mode;
+      };
+
+      class draw_break
+      {
+      public:
+        shader_group m_old_groups, m_new_groups;
+        unsigned int m_attributes_written, m_indices_written;
+      };
+
+      /* a header added with the DataCallBack of patch_point() */
+      class patch_header
+      {
+      public:
+        unsigned int m_id;
+        unsigned int m_location;
+        PainterHeader m_header;
+      };
+
+      class draw
+      {
+      public:
+        std::vector<PainterAttribute> m_attributes;
+
+        /* empty if the PainterDraw had no compact attributes,
+           see PainterDraw::m_compact_attributes.
+         */
+        std::vector<uvec4> m_compact_attributes;
+        unsigned int m_compact_attributes_written;
+        std::vector<uint32_t> m_header_attributes;
+        std::vector<PainterIndex> m_indices;
+        std::vector<generic_data> m_store;
+        std::vector<draw_break> m_draw_breaks;
+
+        /* shader group active at the end of the draw */
+        shader_group m_final_groups;
+
+        /* location (in blocks) of every header of the draw */
+        std::vector<unsigned int> m_headers;
+        std::vector<patch_header> m_patch_headers;
+      };
+
+      class patch
+      {
+      public:
+        patch(void):
+          m_has_item_matrix(false),
+          m_has_brush(false),
+          m_z_offset(0)
+        {}
+
+        bool m_has_item_matrix;
+        PainterItemMatrix m_item_matrix;
+        bool m_has_brush;
+        PainterBrush m_brush;
+        int m_z_offset;
+      };
+
+      /* the DataCallBack returned by PainterDrawList::patch_point() */
+      class PatchPoint:public PainterPacker::DataCallBack
+      {
+      public:
+        explicit
+        PatchPoint(unsigned int id):
+          m_id(id)
+        {}
+
+        virtual
+        void
+        current_draw(const reference_counted_ptr<const PainterDraw> &h)
+        {
+          FASTUIDRAWunused(h);
+        }
+
+        virtual
+        void
+        header_added(const PainterHeader &original_value, c_array<generic_data> mapped_location)
+        {
+          FASTUIDRAWunused(original_value);
+          FASTUIDRAWunused(mapped_location);
+        }
+
+        unsigned int m_id;
+      };
+
+      PainterDrawListPrivate(void):
+        m_z_range(0, 0),
+        m_captured(false)
+      {}
+
+      void
+      clear_capture(void)
+      {
+        m_draws.clear();
+        m_z_range = range_type<int>(0, 0);
+        m_captured = false;
+      }
+
+      void
+      add_z(int z)
+      {
+        if(m_z_range.m_begin == m_z_range.m_end)
+          {
+            m_z_range = range_type<int>(z, z + 1);
+          }
+        else
+          {
+            m_z_range.m_begin = t_min(m_z_range.m_begin, z);
+            m_z_range.m_end = t_max(m_z_range.m_end, z + 1);
+          }
+      }
+
+      /* a list so that the arrays of a draw being captured
+         stay put when later draws are added.
+       */
+      std::list<draw> m_draws;
+      std::map<unsigned int, patch> m_patches;
+      range_type<int> m_z_range;
+
+      /* true once a capture to the list has ended, even
+         if nothing was drawn during the capture.
+       */
+      bool m_captured;
+    };
+  }
+}
@@ -19,6 +19,7 @@
 
 #include <list>
 #include <memory>
+#include <functional>
 
 #include <fastuidraw/util/fastuidraw_memory.hpp>
 #include <fastuidraw/util/reference_counted.hpp>
@@ -17,23 +17,109 @@
  */
 
 
-#include <list>
 #include <vector>
 #include <fastuidraw/tessellated_path.hpp>
 #include <fastuidraw/path.hpp>
 #include <fastuidraw/painter/stroked_path.hpp>
 #include <fastuidraw/painter/filled_path.hpp>
+#include <fastuidraw/util/trace.hpp>
 #include "private/util_private.hpp"
 
 namespace
 {
+  /* The values of the tessellation of a single contour that
+     are combined into those of a TessellatedPath; these are
+     kept by the TessellatedPath so that the tessellation
+     of a contour can be reused, see TessellatedPath's ctor
+     that takes a TessellatedPath.
+   */
+  class ContourInfo
+  {
+  public:
+    ContourInfo(void):
+      m_box_min(0.0f, 0.0f),
+      m_box_max(0.0f, 0.0f),
+      m_effective_curve_distance_threshhold(0.0f),
+      m_effective_curvature_threshhold(0.0f),
+      m_max_segments(0u)
+    {}
+
+    fastuidraw::vec2 m_box_min, m_box_max;
+    float m_effective_curve_distance_threshhold;
+    float m_effective_curvature_threshhold;
+    unsigned int m_max_segments;
+  };
+
+  /* The tessellation of a single contour; the ranges of
+     m_edge_ranges are relative to the start of m_points.
+   */
+  class ContourTessellation:public ContourInfo
+  {
+  public:
+    void
+    tessellate(const fastuidraw::PathContour &contour,
+               const fastuidraw::TessellatedPath::TessellationParams &params);
+
+    std::vector<fastuidraw::TessellatedPath::point> m_points;
+    std::vector<fastuidraw::range_type<unsigned int> > m_edge_ranges;
+  };
+
+  /* Task to tessellate the contours of a Path from
+     the worker threads of a ThreadPool; the contours
+     are fetched beforehand since the reference count
+     of PathContour is not thread safe.
+   */
+  class ContourTessellationTask:public fastuidraw::ThreadPool::Task
+  {
+  public:
+    ContourTessellationTask(fastuidraw::const_c_array<const fastuidraw::PathContour*> contours,
+                            const fastuidraw::TessellatedPath::TessellationParams &params,
+                            fastuidraw::c_array<ContourTessellation> dst):
+      m_contours(contours),
+      m_params(params),
+      m_dst(dst)
+    {}
+
+    virtual
+    void
+    run(unsigned int idx) const
+    {
+      m_dst[idx].tessellate(*m_contours[idx], m_params);
+    }
+
+  private:
+    fastuidraw::const_c_array<const fastuidraw::PathContour*> m_contours;
+    const fastuidraw::TessellatedPath::TessellationParams &m_params;
+    fastuidraw::c_array<ContourTessellation> m_dst;
+  };
+
   class TessellatedPathPrivate
   {
   public:
-    TessellatedPathPrivate(const fastuidraw::Path &input,
-                           fastuidraw::TessellatedPath::TessellationParams TP);
+    TessellatedPathPrivate(fastuidraw::const_c_array<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour> > input,
+                           fastuidraw::TessellatedPath::TessellationParams TP,
+                           const fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> &thread_pool);
+
+    TessellatedPathPrivate(const TessellatedPathPrivate &src, unsigned int number_contours,
+                           fastuidraw::const_c_array<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour> > input,
+                           const fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> &thread_pool);
+
+    /* tessellate input with m_params and add the contours */
+    void
+    add_contours(fastuidraw::const_c_array<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour> > input,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> &thread_pool);
+
+    /* add a contour, the point data of its edges is given by
+       ranges into pts where pts starts at the value pts_begin.
+     */
+    void
+    add_contour(const ContourInfo &info,
+                fastuidraw::const_c_array<fastuidraw::TessellatedPath::point> pts,
+                fastuidraw::const_c_array<fastuidraw::range_type<unsigned int> > ranges,
+                unsigned int pts_begin);
 
     std::vector<std::vector<fastuidraw::range_type<unsigned int> > > m_edge_ranges;
+    std::vector<ContourInfo> m_contour_info;
     std::vector<fastuidraw::TessellatedPath::point> m_point_data;
     fastuidraw::vec2 m_box_min, m_box_max;
     fastuidraw::TessellatedPath::TessellationParams m_params;
@@ -45,12 +131,83 @@ namespace
   };
 }
 
+//////////////////////////////////////////////
+// ContourTessellation methods
+void
+ContourTessellation::
+tessellate(const fastuidraw::PathContour &contour,
+           const fastuidraw::TessellatedPath::TessellationParams &params)
+{
+  float contour_length(0.0f), open_contour_length(0.0f), closed_contour_length(0.0f);
+
+  m_edge_ranges.resize(contour.number_points());
+  for(unsigned int e = 0, ende = contour.number_points(); e < ende; ++e)
+    {
+      unsigned int needed, loc(m_points.size());
+      float thresh_dist(0.0f), thresh_curvature(0.0f);
+      fastuidraw::c_array<fastuidraw::TessellatedPath::point> pts;
+
+      /* let the interpolator write directly to the end of m_points
+         and drop the room that it did not use
+       */
+      m_points.resize(loc + params.m_max_segments + 1);
+      pts = fastuidraw::make_c_array(m_points).sub_array(loc);
+      needed = contour.interpolator(e)->produce_tessellation(params, pts,
+                                                             &thresh_dist,
+                                                             &thresh_curvature);
+      FASTUIDRAWassert(needed > 0u);
+      m_points.resize(loc + needed);
+      pts = fastuidraw::make_c_array(m_points).sub_array(loc);
+      m_edge_ranges[e] = fastuidraw::range_type<unsigned int>(loc, loc + needed);
+
+      m_max_segments = fastuidraw::t_max(m_max_segments, needed - 1);
+      m_effective_curve_distance_threshhold = fastuidraw::t_max(m_effective_curve_distance_threshhold, thresh_dist);
+      m_effective_curvature_threshhold = fastuidraw::t_max(m_effective_curvature_threshhold, thresh_curvature);
+
+      for(unsigned int n = 0; n < needed; ++n)
+        {
+          const fastuidraw::vec2 &pt(pts[n].m_p);
+
+          pts[n].m_distance_from_contour_start = contour_length + pts[n].m_distance_from_edge_start;
+          pts[n].m_edge_length = pts[needed - 1].m_distance_from_edge_start;
+          if(loc == 0 && n == 0)
+            {
+              m_box_min = pt;
+              m_box_max = pt;
+            }
+          else
+            {
+              m_box_min.x() = std::min(m_box_min.x(), pt.x());
+              m_box_min.y() = std::min(m_box_min.y(), pt.y());
+              m_box_max.x() = std::max(m_box_max.x(), pt.x());
+              m_box_max.y() = std::max(m_box_max.y(), pt.y());
+            }
+        }
+
+      contour_length = pts[needed - 1].m_distance_from_contour_start;
+      if(e + 2 == ende)
+        {
+          open_contour_length = contour_length;
+        }
+      else if(e + 1 == ende)
+        {
+          closed_contour_length = contour_length;
+        }
+    }
+
+  for(unsigned int i = 0, endi = m_points.size(); i < endi; ++i)
+    {
+      m_points[i].m_open_contour_length = open_contour_length;
+      m_points[i].m_closed_contour_length = closed_contour_length;
+    }
+}
+
 //////////////////////////////////////////////
 // TessellatedPathPrivate methods
 TessellatedPathPrivate::
-TessellatedPathPrivate(const fastuidraw::Path &input,
-                       fastuidraw::TessellatedPath::TessellationParams TP):
-  m_edge_ranges(input.number_contours()),
+TessellatedPathPrivate(fastuidraw::const_c_array<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour> > input,
+                       fastuidraw::TessellatedPath::TessellationParams TP,
+                       const fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> &thread_pool):
   m_box_min(0.0f, 0.0f),
   m_box_max(0.0f, 0.0f),
   m_params(TP),
@@ -58,106 +215,134 @@ TessellatedPathPrivate(const fastuidraw::Path &input,
   m_effective_curvature_threshhold(0.0f),
   m_max_segments(0u)
 {
-  if(input.number_contours() > 0)
+  add_contours(input, thread_pool);
+}
+
+TessellatedPathPrivate::
+TessellatedPathPrivate(const TessellatedPathPrivate &src, unsigned int number_contours,
+                       fastuidraw::const_c_array<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour> > input,
+                       const fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> &thread_pool):
+  m_box_min(0.0f, 0.0f),
+  m_box_max(0.0f, 0.0f),
+  m_params(src.m_params),
+  m_effective_curve_distance_threshhold(0.0f),
+  m_effective_curvature_threshhold(0.0f),
+  m_max_segments(0u)
+{
+  unsigned int num_points(0);
+
+  FASTUIDRAWassert(number_contours <= src.m_edge_ranges.size());
+  if(number_contours > 0 && !src.m_edge_ranges[number_contours - 1].empty())
     {
-      std::list<std::vector<fastuidraw::TessellatedPath::point> > temp;
-      std::vector<fastuidraw::TessellatedPath::point> work_room(m_params.m_max_segments + 1);
-      std::list<std::vector<fastuidraw::TessellatedPath::point> >::const_iterator iter, end_iter;
+      num_points = src.m_edge_ranges[number_contours - 1].back().m_end;
+    }
 
-      for(unsigned int loc = 0, o = 0, endo = input.number_contours(); o < endo; ++o)
+  m_edge_ranges.reserve(number_contours + input.size());
+  m_contour_info.reserve(number_contours + input.size());
+  m_point_data.reserve(num_points);
+  for(unsigned int o = 0; o < number_contours; ++o)
+    {
+      fastuidraw::const_c_array<fastuidraw::range_type<unsigned int> > ranges;
+      fastuidraw::const_c_array<fastuidraw::TessellatedPath::point> pts;
+      unsigned int begin(0);
+
+      ranges = fastuidraw::make_c_array(src.m_edge_ranges[o]);
+      if(!ranges.empty())
         {
-          fastuidraw::reference_counted_ptr<const fastuidraw::PathContour> contour(input.contour(o));
-          float contour_length(0.0f), open_contour_length(0.0f), closed_contour_length(0.0f);
-          std::list<std::vector<fastuidraw::TessellatedPath::point> >::iterator start_contour;
+          begin = ranges.front().m_begin;
+          pts = fastuidraw::make_c_array(src.m_point_data).sub_array(begin, ranges.back().m_end - begin);
+        }
+      add_contour(src.m_contour_info[o], pts, ranges, begin);
+    }
+  add_contours(input, thread_pool);
+}
 
-          m_edge_ranges[o].resize(contour->number_points());
-          for(unsigned int e = 0, ende = contour->number_points(); e < ende; ++e)
-            {
-              unsigned int needed;
-              float thresh_dist(0.0f), thresh_curvature(0.0f);
-
-              temp.push_back(std::vector<fastuidraw::TessellatedPath::point>());
-              needed = contour->interpolator(e)->produce_tessellation(m_params,
-                                                                      fastuidraw::make_c_array(work_room),
-                                                                      &thresh_dist,
-                                                                      &thresh_curvature);
-              m_edge_ranges[o][e] = fastuidraw::range_type<unsigned int>(loc, loc + needed);
-              loc += needed;
-
-              FASTUIDRAWassert(needed > 0u);
-              m_max_segments = fastuidraw::t_max(m_max_segments, needed - 1);
-              m_effective_curve_distance_threshhold = fastuidraw::t_max(m_effective_curve_distance_threshhold, thresh_dist);
-              m_effective_curvature_threshhold = fastuidraw::t_max(m_effective_curvature_threshhold, thresh_curvature);
-
-              for(unsigned int n = 0; n < needed; ++n)
-                {
-                  const fastuidraw::vec2 &pt(work_room[n].m_p);
-
-                  work_room[n].m_distance_from_contour_start = contour_length + work_room[n].m_distance_from_edge_start;
-
-                  if(o == 0 and e == 0 and n == 0)
-                    {
-                      m_box_min = pt;
-                      m_box_max = pt;
-                    }
-                  else
-                    {
-                      m_box_min.x() = std::min(m_box_min.x(), pt.x());
-                      m_box_min.y() = std::min(m_box_min.y(), pt.y());
-                      m_box_max.x() = std::max(m_box_max.x(), pt.x());
-                      m_box_max.y() = std::max(m_box_max.y(), pt.y());
-                    }
-                }
-              std::list<std::vector<fastuidraw::TessellatedPath::point> >::iterator t;
-              t = temp.insert(temp.end(),
-                              std::vector<fastuidraw::TessellatedPath::point>(work_room.begin(), work_room.begin() + needed));
-              if(e == 0)
-                {
-                  start_contour = t;
-                }
-
-              contour_length = temp.back().back().m_distance_from_contour_start;
-
-              if(e + 2 == ende)
-                {
-                  open_contour_length = contour_length;
-                }
-              else if(e + 1 == ende)
-                {
-                  closed_contour_length = contour_length;
-                }
-
-              for(unsigned int n = 0; n < needed; ++n)
-                {
-                  (*t)[n].m_edge_length = (*t)[needed - 1].m_distance_from_edge_start;
-                }
-            }
+void
+TessellatedPathPrivate::
+add_contours(fastuidraw::const_c_array<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour> > input,
+             const fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool> &thread_pool)
+{
+  unsigned int num_contours(input.size());
+  std::vector<ContourTessellation> contours(num_contours);
 
-          for(std::list<std::vector<fastuidraw::TessellatedPath::point> >::iterator
-                t = start_contour, endt = temp.end(); t != endt; ++t)
-            {
-              for(unsigned int e = 0, ende = t->size(); e < ende; ++e)
-                {
-                  (*t)[e].m_open_contour_length = open_contour_length;
-                  (*t)[e].m_closed_contour_length = closed_contour_length;
-                }
-            }
-        }
+  if(thread_pool && thread_pool->number_threads() > 0 && num_contours > 1)
+    {
+      std::vector<const fastuidraw::PathContour*> src(num_contours);
 
-      unsigned int total_needed;
+      for(unsigned int o = 0; o < num_contours; ++o)
+        {
+          src[o] = input[o].get();
+        }
 
-      total_needed = m_edge_ranges.back().back().m_end;
-      m_point_data.reserve(total_needed);
-      for(iter = temp.begin(), end_iter = temp.end(); iter != end_iter; ++iter)
+      ContourTessellationTask task(fastuidraw::make_c_array(src), m_params,
+                                   fastuidraw::make_c_array(contours));
+      thread_pool->run(task, num_contours);
+    }
+  else
+    {
+      for(unsigned int o = 0; o < num_contours; ++o)
         {
-          std::copy(iter->begin(), iter->end(),
-                    std::back_insert_iterator<std::vector<fastuidraw::TessellatedPath::point> >(m_point_data));
+          contours[o].tessellate(*input[o], m_params);
         }
-      FASTUIDRAWassert(total_needed == m_point_data.size());
+    }
+
+  /* stitch the contours together in order */
+  unsigned int total_needed(m_point_data.size());
+  for(unsigned int o = 0; o < num_contours; ++o)
+    {
+      total_needed += contours[o].m_points.size();
+    }
+
+  m_point_data.reserve(total_needed);
+  m_edge_ranges.reserve(m_edge_ranges.size() + num_contours);
+  m_contour_info.reserve(m_contour_info.size() + num_contours);
+  for(unsigned int o = 0; o < num_contours; ++o)
+    {
+      const ContourTessellation &C(contours[o]);
+      add_contour(C, fastuidraw::make_c_array(C.m_points),
+                  fastuidraw::make_c_array(C.m_edge_ranges), 0);
+    }
+  FASTUIDRAWassert(total_needed == m_point_data.size());
+}
+
+void
+TessellatedPathPrivate::
+add_contour(const ContourInfo &C,
+            fastuidraw::const_c_array<fastuidraw::TessellatedPath::point> pts,
+            fastuidraw::const_c_array<fastuidraw::range_type<unsigned int> > ranges,
+            unsigned int pts_begin)
+{
+  unsigned int loc(m_point_data.size());
+
+  m_edge_ranges.push_back(std::vector<fastuidraw::range_type<unsigned int> >(ranges.size()));
+  for(unsigned int e = 0, ende = ranges.size(); e < ende; ++e)
+    {
+      m_edge_ranges.back()[e] = fastuidraw::range_type<unsigned int>(loc + ranges[e].m_begin - pts_begin,
+                                                                     loc + ranges[e].m_end - pts_begin);
+    }
+  m_point_data.insert(m_point_data.end(), pts.begin(), pts.end());
+  m_contour_info.push_back(C);
+
+  m_max_segments = fastuidraw::t_max(m_max_segments, C.m_max_segments);
+  m_effective_curve_distance_threshhold = fastuidraw::t_max(m_effective_curve_distance_threshhold,
+                                                            C.m_effective_curve_distance_threshhold);
+  m_effective_curvature_threshhold = fastuidraw::t_max(m_effective_curvature_threshhold,
+                                                       C.m_effective_curvature_threshhold);
+  if(pts.empty())
+    {
+      return;
+    }
+  if(loc == 0)
+    {
+      m_box_min = C.m_box_min;
+      m_box_max = C.m_box_max;
     }
   else
     {
-      m_box_min = m_box_max = fastuidraw::vec2(0.0f, 0.0f);
+      m_box_min.x() = std::min(m_box_min.x(), C.m_box_min.x());
+      m_box_min.y() = std::min(m_box_min.y(), C.m_box_min.y());
+      m_box_max.x() = std::max(m_box_max.x(), C.m_box_max.x());
+      m_box_max.y() = std::max(m_box_max.y(), C.m_box_max.y());
     }
 }
 
@@ -165,9 +350,34 @@ TessellatedPathPrivate(const fastuidraw::Path &input,
 // fastuidraw::TessellatedPath methods
 fastuidraw::TessellatedPath::
 TessellatedPath(const Path &input,
-                fastuidraw::TessellatedPath::TessellationParams TP)
+                fastuidraw::TessellatedPath::TessellationParams TP,
+                const reference_counted_ptr<ThreadPool> &thread_pool)
+{
+  std::vector<reference_counted_ptr<const PathContour> > contours(input.number_contours());
+
+  for(unsigned int o = 0, endo = contours.size(); o < endo; ++o)
+    {
+      contours[o] = input.contour(o);
+    }
+  m_d = FASTUIDRAWnew TessellatedPathPrivate(make_c_array(contours), TP, thread_pool);
+}
+
+fastuidraw::TessellatedPath::
+TessellatedPath(const_c_array<reference_counted_ptr<const PathContour> > contours,
+                fastuidraw::TessellatedPath::TessellationParams TP,
+                const reference_counted_ptr<ThreadPool> &thread_pool)
+{
+  m_d = FASTUIDRAWnew TessellatedPathPrivate(contours, TP, thread_pool);
+}
+
+fastuidraw::TessellatedPath::
+TessellatedPath(const TessellatedPath &src, unsigned int number_contours,
+                const_c_array<reference_counted_ptr<const PathContour> > contours,
+                const reference_counted_ptr<ThreadPool> &thread_pool)
 {
-  m_d = FASTUIDRAWnew TessellatedPathPrivate(input, TP);
+  TessellatedPathPrivate *src_d;
+  src_d = static_cast<TessellatedPathPrivate*>(src.m_d);
+  m_d = FASTUIDRAWnew TessellatedPathPrivate(*src_d, number_contours, contours, thread_pool);
 }
 
 fastuidraw::TessellatedPath::
@@ -187,6 +397,7 @@ stroked(void) const
   d = static_cast<TessellatedPathPrivate*>(m_d);
   if(!d->m_stroked)
     {
+      FASTUIDRAWtrace_scope("TessellatedPath::stroked");
       d->m_stroked = FASTUIDRAWnew StrokedPath(*this);
     }
   return d->m_stroked;
@@ -200,11 +411,39 @@ filled(void) const
   d = static_cast<TessellatedPathPrivate*>(m_d);
   if(!d->m_filled)
     {
+      FASTUIDRAWtrace_scope("TessellatedPath::filled");
       d->m_filled = FASTUIDRAWnew FilledPath(*this);
     }
   return d->m_filled;
 }
 
+uint64_t
+fastuidraw::TessellatedPath::
+memory_usage(void) const
+{
+  TessellatedPathPrivate *d;
+  uint64_t return_value;
+
+  d = static_cast<TessellatedPathPrivate*>(m_d);
+  return_value = sizeof(TessellatedPathPrivate)
+    + d->m_point_data.capacity() * sizeof(point);
+  for(const std::vector<range_type<unsigned int> > &R : d->m_edge_ranges)
+    {
+      return_value += sizeof(std::vector<range_type<unsigned int> >)
+        + R.capacity() * sizeof(range_type<unsigned int>);
+    }
+  return_value += d->m_contour_info.capacity() * sizeof(ContourInfo);
+  if(d->m_stroked)
+    {
+      return_value += d->m_stroked->memory_usage();
+    }
+  if(d->m_filled)
+    {
+      return_value += d->m_filled->memory_usage();
+    }
+  return return_value;
+}
+
 const fastuidraw::TessellatedPath::TessellationParams&
 fastuidraw::TessellatedPath::
 tessellation_parameters(void) const
@@ -18,6 +18,7 @@
 
 
 #include <fastuidraw/text/glyph_atlas.hpp>
+#include <fastuidraw/util/trace.hpp>
 
 #include "../private/interval_allocator.hpp"
 #include "../private/util_private.hpp"
@@ -445,6 +446,7 @@ flush(void) const
   GlyphAtlasPrivate *d;
   d = static_cast<GlyphAtlasPrivate*>(m_d);
 
+  FASTUIDRAWtrace_scope("GlyphAtlas::flush");
   autolock_mutex m(d->m_mutex);
   d->m_texel_store->flush();
   d->m_geometry_store->flush();
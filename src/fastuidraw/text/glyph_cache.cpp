@@ -21,6 +21,7 @@
 #include <vector>
 #include <fastuidraw/text/glyph_cache.hpp>
 #include <fastuidraw/text/glyph_render_data.hpp>
+#include <fastuidraw/util/trace.hpp>
 #include "../private/util_private.hpp"
 
 
@@ -371,6 +372,8 @@ fetch_glyph(GlyphRender render,
             const fastuidraw::reference_counted_ptr<const FontBase> &font,
             uint32_t glyph_code)
 {
+  FASTUIDRAWtrace_scope("GlyphCache::fetch_glyph");
+
   if(!font || !font->can_create_rendering_data(render.m_type))
     {
       return Glyph();
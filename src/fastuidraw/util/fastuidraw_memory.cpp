@@ -24,10 +24,17 @@
 #include <iosfwd>
 #include <cstdlib>
 #include <sstream>
+#include <atomic>
 
 #include <fastuidraw/util/fastuidraw_memory.hpp>
 #include "../private/util_private.hpp"
 
+namespace
+{
+  /* number of allocations made, see memory::number_allocations() */
+  std::atomic<uint64_t> allocation_counter(0);
+}
+
 #ifdef FASTUIDRAW_DEBUG
 
 namespace
@@ -184,6 +191,7 @@ malloc_implement(size_t size, const char *file, int line)
       return nullptr;
     }
 
+  allocation_counter.fetch_add(1, std::memory_order_relaxed);
   return_value = std::malloc(size);
 
   #ifdef FASTUIDRAW_DEBUG
@@ -218,6 +226,7 @@ calloc_implement(size_t nmemb, size_t size, const char *file, int line)
       return nullptr;
     }
 
+  allocation_counter.fetch_add(1, std::memory_order_relaxed);
   return_value = std::calloc(nmemb, size);
 
   #ifdef FASTUIDRAW_DEBUG
@@ -274,6 +283,7 @@ realloc_implement(void *ptr, size_t size, const char *file, int line)
     }
   #endif
 
+  allocation_counter.fetch_add(1, std::memory_order_relaxed);
   return_value = std::realloc(ptr, size);
 
   #ifdef FASTUIDRAW_DEBUG
@@ -310,6 +320,13 @@ free_implement(void *ptr, const char *file, int line)
   std::free(ptr);
 }
 
+uint64_t
+fastuidraw::memory::
+number_allocations(void)
+{
+  return allocation_counter.load(std::memory_order_relaxed);
+}
+
 void*
 operator new(std::size_t n, const char *file, int line) throw ()
 {
@@ -0,0 +1,347 @@
+/*!
+ * \file thread_pool.cpp
+ * \brief file thread_pool.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <fastuidraw/util/thread_pool.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  class AsyncTaskPrivate
+  {
+  public:
+    AsyncTaskPrivate(void):
+      m_done(false)
+    {}
+
+    void
+    mark_done(void)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_done = true;
+      m_cv.notify_all();
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_done;
+  };
+
+  class PostedTask
+  {
+  public:
+    fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool::AsyncTask> m_task;
+    AsyncTaskPrivate *m_d;
+  };
+
+  class ThreadPoolPrivate
+  {
+  public:
+    explicit
+    ThreadPoolPrivate(unsigned int number_threads);
+
+    ~ThreadPoolPrivate();
+
+    void
+    run(const fastuidraw::ThreadPool::Task &task, unsigned int count);
+
+    void
+    post(PostedTask &task);
+
+    unsigned int
+    number_threads(void) const
+    {
+      return m_threads.size();
+    }
+
+  private:
+    void
+    worker(void);
+
+    /* Runs work items of the current job until there are
+       none left to start; m_mutex must be locked by the
+       caller and is locked on return.
+     */
+    void
+    run_items(std::unique_lock<std::mutex> &lock);
+
+    std::vector<std::thread> m_threads;
+
+    /* serializes calls to run() */
+    fastuidraw::mutex m_run_mutex;
+
+    /* protects all fields below */
+    std::mutex m_mutex;
+    std::condition_variable m_job_ready, m_job_done;
+    const fastuidraw::ThreadPool::Task *m_task;
+    unsigned int m_count, m_next, m_finished;
+    unsigned int m_job_id;
+    std::deque<PostedTask> m_posted;
+    bool m_quit;
+  };
+
+  void
+  run_posted_task(PostedTask &task)
+  {
+    /* drop the reference before marking the task done so
+       that the thread that waited on the task is the one
+       that releases it.
+     */
+    task.m_task->run();
+    task.m_task = fastuidraw::reference_counted_ptr<fastuidraw::ThreadPool::AsyncTask>();
+    task.m_d->mark_done();
+  }
+}
+
+/////////////////////////////////////
+// ThreadPoolPrivate methods
+ThreadPoolPrivate::
+ThreadPoolPrivate(unsigned int number_threads):
+  m_task(nullptr),
+  m_count(0),
+  m_next(0),
+  m_finished(0),
+  m_job_id(0),
+  m_quit(false)
+{
+  m_threads.reserve(number_threads);
+  for(unsigned int i = 0; i < number_threads; ++i)
+    {
+      m_threads.push_back(std::thread(&ThreadPoolPrivate::worker, this));
+    }
+}
+
+ThreadPoolPrivate::
+~ThreadPoolPrivate()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_quit = true;
+  }
+  m_job_ready.notify_all();
+  for(std::thread &t : m_threads)
+    {
+      t.join();
+    }
+
+  /* run what was posted but not started so that
+     no one waits forever on an AsyncTask
+   */
+  for(PostedTask &task : m_posted)
+    {
+      run_posted_task(task);
+    }
+}
+
+void
+ThreadPoolPrivate::
+run_items(std::unique_lock<std::mutex> &lock)
+{
+  const fastuidraw::ThreadPool::Task *task(m_task);
+
+  while(m_next < m_count)
+    {
+      unsigned int idx(m_next++);
+
+      lock.unlock();
+      task->run(idx);
+      lock.lock();
+
+      if(++m_finished == m_count)
+        {
+          m_job_done.notify_all();
+        }
+    }
+}
+
+void
+ThreadPoolPrivate::
+worker(void)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  unsigned int last_job(m_job_id);
+
+  for(;;)
+    {
+      while(!m_quit && last_job == m_job_id && m_posted.empty())
+        {
+          m_job_ready.wait(lock);
+        }
+
+      if(m_quit)
+        {
+          return;
+        }
+
+      if(last_job != m_job_id)
+        {
+          /* the work items of run() come first since
+             a thread is blocked waiting on them
+           */
+          last_job = m_job_id;
+          run_items(lock);
+        }
+      else
+        {
+          PostedTask task(m_posted.front());
+
+          m_posted.pop_front();
+          lock.unlock();
+          run_posted_task(task);
+          lock.lock();
+        }
+    }
+}
+
+void
+ThreadPoolPrivate::
+post(PostedTask &task)
+{
+  if(m_threads.empty())
+    {
+      run_posted_task(task);
+      return;
+    }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_posted.push_back(task);
+  m_job_ready.notify_one();
+}
+
+void
+ThreadPoolPrivate::
+run(const fastuidraw::ThreadPool::Task &task, unsigned int count)
+{
+  fastuidraw::autolock_mutex run_lock(m_run_mutex);
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  if(count == 0)
+    {
+      return;
+    }
+
+  m_task = &task;
+  m_count = count;
+  m_next = 0;
+  m_finished = 0;
+  ++m_job_id;
+  m_job_ready.notify_all();
+
+  run_items(lock);
+  while(m_finished < m_count)
+    {
+      m_job_done.wait(lock);
+    }
+  m_task = nullptr;
+}
+
+////////////////////////////////////////
+// fastuidraw::ThreadPool::AsyncTask methods
+fastuidraw::ThreadPool::AsyncTask::
+AsyncTask(void)
+{
+  m_d = FASTUIDRAWnew AsyncTaskPrivate();
+}
+
+fastuidraw::ThreadPool::AsyncTask::
+~AsyncTask()
+{
+  AsyncTaskPrivate *d;
+  d = static_cast<AsyncTaskPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+bool
+fastuidraw::ThreadPool::AsyncTask::
+done(void) const
+{
+  AsyncTaskPrivate *d;
+  d = static_cast<AsyncTaskPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> lock(d->m_mutex);
+  return d->m_done;
+}
+
+void
+fastuidraw::ThreadPool::AsyncTask::
+wait(void) const
+{
+  AsyncTaskPrivate *d;
+  d = static_cast<AsyncTaskPrivate*>(m_d);
+
+  std::unique_lock<std::mutex> lock(d->m_mutex);
+  while(!d->m_done)
+    {
+      d->m_cv.wait(lock);
+    }
+}
+
+////////////////////////////////////////
+// fastuidraw::ThreadPool methods
+fastuidraw::ThreadPool::
+ThreadPool(unsigned int number_threads)
+{
+  m_d = FASTUIDRAWnew ThreadPoolPrivate(number_threads);
+}
+
+fastuidraw::ThreadPool::
+~ThreadPool()
+{
+  ThreadPoolPrivate *d;
+  d = static_cast<ThreadPoolPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+unsigned int
+fastuidraw::ThreadPool::
+number_threads(void) const
+{
+  ThreadPoolPrivate *d;
+  d = static_cast<ThreadPoolPrivate*>(m_d);
+  return d->number_threads();
+}
+
+void
+fastuidraw::ThreadPool::
+run(const Task &task, unsigned int count)
+{
+  ThreadPoolPrivate *d;
+  d = static_cast<ThreadPoolPrivate*>(m_d);
+  d->run(task, count);
+}
+
+void
+fastuidraw::ThreadPool::
+post(const reference_counted_ptr<AsyncTask> &task)
+{
+  ThreadPoolPrivate *d;
+  PostedTask P;
+
+  FASTUIDRAWassert(task);
+  d = static_cast<ThreadPoolPrivate*>(m_d);
+  P.m_task = task;
+  P.m_d = static_cast<AsyncTaskPrivate*>(task->m_d);
+  d->post(P);
+}
@@ -0,0 +1,336 @@
+/*!
+ * \file trace.cpp
+ * \brief file trace.cpp
+ *
+ * Copyright 2026 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <vector>
+#include <stdint.h>
+#include <fastuidraw/util/trace.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  class TraceEvent
+  {
+  public:
+    const char *m_name;
+    char m_phase;
+    unsigned int m_thread;
+    uint64_t m_time; //in nanoseconds of std::chrono::steady_clock
+  };
+
+  /* The events recorded by one thread. A thread only takes
+     the lock of its own ThreadEvents, which is contended only
+     while stop() collects the events.
+   */
+  class ThreadEvents:fastuidraw::noncopyable
+  {
+  public:
+    explicit
+    ThreadEvents(unsigned int thread):
+      m_thread(thread)
+    {}
+
+    unsigned int m_thread;
+    fastuidraw::mutex m_mutex;
+    std::vector<TraceEvent> m_events;
+  };
+
+  class TraceRecorder
+  {
+  public:
+    TraceRecorder(void):
+      m_active(false),
+      m_file(nullptr),
+      m_start(0),
+      m_next_thread(0)
+    {}
+
+    void
+    record(const char *name, char phase);
+
+    ThreadEvents*
+    acquire_thread_events(void);
+
+    void
+    release_thread_events(ThreadEvents *p);
+
+    std::atomic<bool> m_active;
+
+    /* protects the fields below */
+    fastuidraw::mutex m_mutex;
+    std::FILE *m_file;
+    uint64_t m_start;
+
+    /* the thread id of the next acquired ThreadEvents */
+    unsigned int m_next_thread;
+
+    /* a std::list so that the address of each
+       element stays the same as threads are added
+     */
+    std::list<ThreadEvents> m_threads;
+
+    /* the elements of m_threads whose thread has exited */
+    std::vector<ThreadEvents*> m_free_threads;
+  };
+
+  /* The ThreadEvents of a thread is acquired on its first
+     event and released when the thread exits. A released
+     ThreadEvents keeps its events for stop() and is reused
+     by the next new thread, so that the number of them is
+     the largest number of threads that record at once. Each
+     acquisition gets a new thread id, so events of different
+     threads that used the same ThreadEvents stay apart.
+   */
+  class ThreadEventsRef:fastuidraw::noncopyable
+  {
+  public:
+    ThreadEventsRef(void):
+      m_events(nullptr)
+    {}
+
+    ~ThreadEventsRef();
+
+    ThreadEvents&
+    get(void);
+
+  private:
+    ThreadEvents *m_events;
+  };
+
+  TraceRecorder&
+  recorder(void)
+  {
+    static TraceRecorder R;
+    return R;
+  }
+
+  uint64_t
+  time_now(void)
+  {
+    std::chrono::steady_clock::duration d;
+    d = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+  }
+
+  void
+  write_name(std::FILE *file, const char *name)
+  {
+    std::fputc('"', file);
+    for(; *name; ++name)
+      {
+        if(*name == '"' || *name == '\\')
+          {
+            std::fputc('\\', file);
+          }
+        std::fputc(*name, file);
+      }
+    std::fputc('"', file);
+  }
+}
+
+//////////////////////////////////
+// TraceRecorder methods
+ThreadEvents*
+TraceRecorder::
+acquire_thread_events(void)
+{
+  ThreadEvents *p;
+  fastuidraw::autolock_mutex m(m_mutex);
+
+  /* the thread id is the small integer per
+     thread that Chrome trace wants; each event
+     records the id of the thread that made it.
+   */
+  if(m_free_threads.empty())
+    {
+      m_threads.emplace_back(m_next_thread);
+      p = &m_threads.back();
+    }
+  else
+    {
+      p = m_free_threads.back();
+      m_free_threads.pop_back();
+      p->m_thread = m_next_thread;
+    }
+  ++m_next_thread;
+  return p;
+}
+
+void
+TraceRecorder::
+release_thread_events(ThreadEvents *p)
+{
+  fastuidraw::autolock_mutex m(m_mutex);
+  m_free_threads.push_back(p);
+}
+
+//////////////////////////////////
+// ThreadEventsRef methods
+ThreadEventsRef::
+~ThreadEventsRef()
+{
+  if(m_events)
+    {
+      recorder().release_thread_events(m_events);
+    }
+}
+
+ThreadEvents&
+ThreadEventsRef::
+get(void)
+{
+  if(!m_events)
+    {
+      m_events = recorder().acquire_thread_events();
+    }
+  return *m_events;
+}
+
+void
+TraceRecorder::
+record(const char *name, char phase)
+{
+  static thread_local ThreadEventsRef R;
+  ThreadEvents &T(R.get());
+  TraceEvent ev;
+
+  ev.m_name = name;
+  ev.m_phase = phase;
+  ev.m_thread = T.m_thread;
+  ev.m_time = time_now();
+
+  fastuidraw::autolock_mutex m(T.m_mutex);
+  /* check again with the lock held, stop() may
+     have run since the caller checked m_active.
+   */
+  if(m_active)
+    {
+      T.m_events.push_back(ev);
+    }
+}
+
+////////////////////////////////////
+// fastuidraw::trace methods
+bool
+fastuidraw::trace::
+start(const char *filename)
+{
+  TraceRecorder &R(recorder());
+  autolock_mutex m(R.m_mutex);
+
+  if(R.m_active)
+    {
+      return false;
+    }
+
+  R.m_file = std::fopen(filename, "w");
+  if(!R.m_file)
+    {
+      return false;
+    }
+
+  R.m_start = time_now();
+  R.m_active = true;
+  return true;
+}
+
+void
+fastuidraw::trace::
+stop(void)
+{
+  TraceRecorder &R(recorder());
+  std::vector<TraceEvent> events;
+  std::FILE *file;
+
+  {
+    autolock_mutex m(R.m_mutex);
+    if(!R.m_active)
+      {
+        return;
+      }
+    R.m_active = false;
+    file = R.m_file;
+    R.m_file = nullptr;
+
+    /* an event that was timed before start() but added
+       after it belongs to the previous recording, drop it.
+     */
+    for(ThreadEvents &T : R.m_threads)
+      {
+        autolock_mutex mt(T.m_mutex);
+        for(const TraceEvent &ev : T.m_events)
+          {
+            if(ev.m_time >= R.m_start)
+              {
+                events.push_back(ev);
+                events.back().m_time -= R.m_start;
+              }
+          }
+        T.m_events.clear();
+      }
+  }
+
+  std::fprintf(file, "{\"traceEvents\":[\n");
+  for(unsigned int i = 0, endi = events.size(); i < endi; ++i)
+    {
+      const TraceEvent &ev(events[i]);
+
+      std::fprintf(file, "%s{\"name\":", (i == 0) ? "" : ",\n");
+      write_name(file, ev.m_name);
+      /* ts is in microseconds */
+      std::fprintf(file, ",\"cat\":\"fastuidraw\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%u}",
+                   ev.m_phase,
+                   static_cast<unsigned long long>(ev.m_time / 1000u),
+                   static_cast<unsigned int>(ev.m_time % 1000u),
+                   ev.m_thread);
+    }
+  std::fprintf(file, "\n],\n\"displayTimeUnit\":\"ns\"}\n");
+  std::fclose(file);
+}
+
+bool
+fastuidraw::trace::
+active(void)
+{
+  return recorder().m_active;
+}
+
+void
+fastuidraw::trace::
+begin_event(const char *name)
+{
+  TraceRecorder &R(recorder());
+  if(R.m_active)
+    {
+      R.record(name, 'B');
+    }
+}
+
+void
+fastuidraw::trace::
+end_event(const char *name)
+{
+  TraceRecorder &R(recorder());
+  if(R.m_active)
+    {
+      R.record(name, 'E');
+    }
+}
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,117,110,105,116,95,118,101,99,116,111,114,40,102,108,111,97,116,32,120,44,32,117,105,110,116,32,98,41,10,123,10,32,32,118,101,99,50,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,46,120,32,61,32,120,59,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,46,121,32,61,32,115,113,114,116,40,109,97,120,40,48,46,48,44,32,49,46,48,32,45,32,120,32,42,32,120,41,41,59,10,32,32,105,102,40,98,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,46,121,32,61,32,45,114,101,116,117,114,110,95,118,97,108,117,101,46,121,59,10,32,32,32,32,125,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_unpack_unit_vector.glsl.resource_string", fastuidraw::const_c_array<uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+102,108,111,97,116,10,99,111,109,112,117,116,101,95,103,114,97,100,105,101,110,116,95,105,110,116,101,114,112,111,108,97,116,101,40,105,110,32,118,101,99,50,32,112,44,32,111,117,116,32,102,108,111,97,116,32,103,111,111,100,41,10,123,10,32,32,102,108,111,97,116,32,116,59,10,10,32,32,116,32,61,32,49,46,48,59,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,113,44,32,100,101,108,116,97,95,112,59,10,32,32,32,32,32,32,102,108,111,97,116,32,100,101,108,116,97,95,114,44,32,97,44,32,98,44,32,99,44,32,100,101,115,99,44,32,116,48,44,32,116,49,44,32,114,101,99,105,112,95,116,119,111,95,97,59,10,10,32,32,32,32,32,32,113,32,61,32,112,32,45,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,121,41,59,10,32,32,32,32,32,32,100,101,108,116,97,95,112,46,120,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,120,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,120,59,10,32,32,32,32,32,32,100,101,108,116,97,95,112,46,121,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,121,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,121,59,10,32,32,32,32,32,32,100,101,108,116,97,95,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,49,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,48,59,10,10,32,32,32,32,32,32,99,32,61,32,100,111,116,40,113,44,32,113,41,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,48,32,42,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,48,59,10,32,32,32,32,32,32,98,32,61,32,50,46,48,32,42,32,40,100,111,116,40,113,44,32,100,101,108,116,97,95,112,41,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,48,32,42,32,100,101,108,116,97,95,114,41,59,10,32,32,32,32,32,32,97,32,61,32,100,111,116,40,100,101,108,116,97,95,112,44,32,100,101,108,116,97,95,112,41,32,45,32,100,101,108,116,97,95,114,32,42,32,100,101,108,116,97,95,114,59,10,10,32,32,32,32,32,32,100,101,115,99,32,61,32,98,32,42,32,98,32,45,32,52,46,48,32,42,32,97,32,42,32,99,59,10,32,32,32,32,32,32,105,102,40,100,101,115,99,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,103,111,111,100,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,116,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,103,111,111,100,32,61,32,49,46,48,59,10,10,32,32,32,32,32,32,32,32,32,32,100,101,115,99,32,61,32,115,113,114,116,40,97,98,115,40,100,101,115,99,41,41,59,10,32,32,32,32,32,32,32,32,32,32,114,101,99,105,112,95,116,119,111,95,97,32,61,32,48,46,53,32,47,32,97,59,10,32,32,32,32,32,32,32,32,32,32,116,48,32,61,32,40,45,98,32,43,32,100,101,115,99,41,32,42,32,114,101,99,105,112,95,116,119,111,95,97,59,10,32,32,32,32,32,32,32,32,32,32,116,49,32,61,32,40,45,98,32,45,32,100,101,115,99,41,32,42,32,114,101,99,105,112,95,116,119,111,95,97,59,10,10,32,32,32,32,32,32,32,32,32,32,47,42,32,105,102,32,98,111,116,104,32,116,48,32,97,110,100,32,116,49,32,97,114,101,32,105,110,32,114,97,110,103,101,44,32,116,104,101,110,32,116,97,107,101,32,116,104,101,32,109,97,120,10,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,98,111,116,104,32,116,48,32,97,110,100,32,116,49,32,97,114,101,32,110,111,116,32,105,110,32,114,97,110,103,101,44,32,116,104,101,110,32,116,97,107,101,32,109,97,120,10,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,111,110,108,121,32,111,110,101,32,111,102,32,116,48,32,97,110,100,32,116,49,32,97,114,101,32,105,110,32,114,97,110,103,101,32,116,97,107,101,32,116,104,97,116,32,111,110,101,46,10,32,32,32,32,32,32,32,32,32,32,42,47,10,10,32,32,32,32,32,32,32,32,32,32,47,42,32,71,46,120,32,105,115,32,49,32,101,120,97,99,116,108,121,32,119,104,101,110,32,116,48,32,105,115,32,105,110,32,114,97,110,103,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,71,46,121,32,105,115,32,49,32,101,120,97,99,116,108,121,32,119,104,101,110,32,116,49,32,105,115,32,105,110,32,114,97,110,103,101,10,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,118,101,99,50,32,71,59,10,32,32,32,32,32,32,32,32,32,32,71,32,61,32,115,116,101,112,40,48,46,48,44,32,118,101,99,50,40,116,48,44,32,116,49,41,41,32,42,32,115,116,101,112,40,118,101,99,50,40,116,48,44,32,116,49,41,44,32,118,101,99,50,40,49,46,48,44,32,49,46,48,41,41,59,10,10,32,32,32,32,32,32,32,32,32,32,105,102,40,71,46,120,32,61,61,32,71,46,121,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,32,61,32,109,97,120,40,116,48,44,32,116,49,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,32,61,32,100,111,116,40,71,44,32,118,101,99,50,40,116,48,44,32,116,49,41,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,118,44,32,100,59,10,32,32,32,32,32,32,103,111,111,100,32,61,32,49,46,48,59,10,32,32,32,32,32,32,118,46,120,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,120,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,120,59,10,32,32,32,32,32,32,118,46,121,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,121,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,121,59,10,32,32,32,32,32,32,100,46,120,32,61,32,112,46,120,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,120,59,10,32,32,32,32,32,32,100,46,121,32,61,32,112,46,121,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,121,59,10,32,32,32,32,32,32,116,32,61,32,100,111,116,40,118,44,32,100,41,32,47,32,100,111,116,40,118,44,32,118,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,116,59,10,125,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,117,98,105,99,95,119,101,105,103,104,116,115,40,102,108,111,97,116,32,120,41,10,123,10,32,32,32,32,102,108,111,97,116,32,120,95,115,113,117,97,114,101,100,32,61,32,120,32,42,32,120,59,10,32,32,32,32,102,108,111,97,116,32,120,95,99,117,98,101,100,32,61,32,120,95,115,113,117,97,114,101,100,32,42,32,120,59,10,32,32,32,32,102,108,111,97,116,32,111,110,101,95,109,105,110,117,115,95,120,32,61,32,49,46,48,32,45,32,120,59,10,32,32,32,32,102,108,111,97,116,32,111,110,101,95,109,105,110,117,115,95,120,95,115,113,117,97,114,101,100,32,61,32,111,110,101,95,109,105,110,117,115,95,120,32,42,32,111,110,101,95,109,105,110,117,115,95,120,59,10,32,32,32,32,102,108,111,97,116,32,111,110,101,95,109,105,110,117,115,95,120,95,99,117,98,101,100,32,61,32,111,110,101,95,109,105,110,117,115,95,120,95,115,113,117,97,114,101,100,32,32,42,32,111,110,101,95,109,105,110,117,115,95,120,59,10,32,32,32,32,118,101,99,52,32,119,59,10,10,32,32,32,32,119,46,120,32,61,32,111,110,101,95,109,105,110,117,115,95,120,95,99,117,98,101,100,59,10,32,32,32,32,119,46,121,32,61,32,51,46,48,32,42,32,120,95,99,117,98,101,100,32,45,32,54,46,48,32,42,32,120,95,115,113,117,97,114,101,100,32,43,32,52,46,48,59,10,32,32,32,32,119,46,122,32,61,32,51,46,48,32,42,32,111,110,101,95,109,105,110,117,115,95,120,95,99,117,98,101,100,32,45,32,54,46,48,32,42,32,111,110,101,95,109,105,110,117,115,95,120,95,115,113,117,97,114,101,100,32,43,32,52,46,48,59,10,32,32,32,32,119,46,119,32,61,32,120,95,99,117,98,101,100,59,10,32,32,32,32,114,101,116,117,114,110,32,119,32,47,32,54,46,48,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,115,104,97,100,101,114,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,110,117,109,95,108,111,111,107,117,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,115,108,97,99,107,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,105,110,116,32,105,109,97,103,101,95,97,116,108,97,115,95,108,97,121,101,114,41,10,123,10,32,32,47,42,32,116,104,105,115,32,115,101,97,109,115,32,115,105,108,108,121,44,32,98,117,116,32,116,104,101,114,101,32,105,115,32,97,32,114,101,97,115,111,110,46,10,32,32,32,32,32,79,110,32,77,101,115,97,47,105,57,54,53,32,40,97,115,32,111,102,32,79,99,116,32,50,51,44,32,50,48,49,53,41,32,119,105,116,104,111,117,116,32,116,104,105,115,32,119,114,97,112,112,101,114,44,10,32,32,32,32,32,116,104,101,32,71,76,83,76,32,99,111,109,112,105,108,101,114,32,112,114,111,100,117,99,101,115,32,97,110,32,105,110,99,111,114,114,101,99,116,32,115,104,97,100,101,114,32,116,104,97,116,10,32,32,32,32,32,102,97,105,108,115,32,102,111,114,32,116,104,101,32,99,97,115,101,32,119,104,101,114,101,32,110,117,109,95,108,111,111,107,117,112,115,32,105,115,32,111,110,101,46,10,32,32,32,32,32,72,111,119,101,118,101,114,44,32,109,97,107,105,110,103,32,116,104,101,32,99,97,115,101,32,111,102,32,49,32,101,120,112,108,105,99,105,116,32,109,97,107,101,115,32,116,104,105,115,10,32,32,32,32,32,116,104,105,110,103,32,119,111,114,107,46,10,32,32,32,42,47,10,32,32,105,102,40,110,117,109,95,108,111,111,107,117,112,115,32,61,61,32,49,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,105,109,97,103,101,95,115,104,97,100,101,114,95,99,111,111,114,100,44,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,44,32,115,108,97,99,107,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,97,116,108,97,115,95,108,97,121,101,114,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,105,109,97,103,101,95,115,104,97,100,101,114,95,99,111,111,114,100,44,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,110,117,109,95,108,111,111,107,117,112,115,44,32,115,108,97,99,107,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,97,116,108,97,115,95,108,97,121,101,114,41,59,10,32,32,32,32,125,10,125,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,98,114,117,115,104,95,99,111,108,111,114,40,118,111,105,100,41,10,123,10,32,32,118,101,99,52,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,118,101,99,52,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,101,110,95,99,111,108,111,114,95,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,101,110,95,99,111,108,111,114,95,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,101,110,95,99,111,108,111,114,95,122,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,101,110,95,99,111,108,111,114,95,119,41,59,10,32,32,118,101,99,50,32,112,59,10,10,32,32,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,111,115,105,116,105,111,110,59,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,114,101,112,101,97,116,95,119,105,110,100,111,119,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,112,32,45,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,121,41,59,10,32,32,32,32,32,32,112,32,61,32,109,111,100,40,112,44,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,119,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,104,41,41,59,10,32,32,32,32,32,32,112,32,43,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,121,41,59,10,32,32,32,32,125,10,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,41,10,32,32,32,32,32,124,124,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,116,44,32,103,111,111,100,59,10,10,32,32,32,32,32,32,116,32,61,32,99,111,109,112,117,116,101,95,103,114,97,100,105,101,110,116,95,105,110,116,101,114,112,111,108,97,116,101,40,112,44,32,103,111,111,100,41,59,10,32,32,32,32,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,103,114,97,100,105,101,110,116,95,114,101,112,101,97,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,41,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,116,32,61,32,102,114,97,99,116,40,116,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,116,32,61,32,99,108,97,109,112,40,116,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,115,116,111,112,95,120,32,43,32,116,32,42,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,115,116,111,112,95,108,101,110,103,116,104,59,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,42,61,32,40,103,111,111,100,32,42,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,116,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,115,116,111,112,95,121,41,41,59,10,32,32,32,32,125,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,105,109,97,103,101,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,105,110,100,101,120,95,99,111,111,114,100,44,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,109,97,103,101,95,120,121,59,10,32,32,32,32,32,32,105,110,116,32,99,111,108,111,114,95,108,97,121,101,114,59,10,32,32,32,32,32,32,117,105,110,116,32,115,108,97,99,107,44,32,110,117,109,98,101,114,95,108,111,111,107,117,112,115,59,10,32,32,32,32,32,32,118,101,99,50,32,113,59,10,32,32,32,32,32,32,117,105,110,116,32,105,109,97,103,101,95,102,105,108,116,101,114,59,10,32,32,32,32,32,32,118,101,99,52,32,105,109,97,103,101,95,99,111,108,111,114,59,10,10,32,32,32,32,32,32,115,108,97,99,107,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,108,97,99,107,59,10,32,32,32,32,32,32,110,117,109,98,101,114,95,108,111,111,107,117,112,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,59,10,10,32,32,32,32,32,32,105,109,97,103,101,95,102,105,108,116,101,114,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,105,109,97,103,101,95,102,105,108,116,101,114,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,105,109,97,103,101,95,102,105,108,116,101,114,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,41,59,10,10,32,32,32,32,32,32,47,42,32,102,114,97,99,116,32,116,104,101,32,98,114,117,115,104,32,99,111,111,114,100,105,110,97,116,101,32,116,111,32,116,104,101,32,115,105,122,101,32,111,102,10,32,32,32,32,32,32,32,32,32,116,104,101,32,105,109,97,103,101,46,10,32,32,32,32,32,32,32,32,32,84,79,68,79,58,32,112,101,114,104,97,112,115,32,115,104,97,100,101,114,32,98,105,116,45,102,108,97,103,115,32,116,111,32,115,97,121,32,116,111,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,101,112,101,97,116,32,40,102,114,97,99,116,41,44,32,109,105,114,114,111,114,95,114,101,112,101,97,116,44,32,101,116,99,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,113,32,61,32,109,111,100,40,112,44,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,121,41,41,59,10,10,32,32,32,32,32,32,47,42,32,99,111,110,118,101,114,116,32,102,114,111,109,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,115,32,116,111,32,105,110,100,101,120,45,116,105,108,101,32,99,111,111,114,100,105,110,97,116,101,115,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,105,109,97,103,101,95,120,121,32,61,32,113,32,42,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,97,99,116,111,114,32,43,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,121,41,59,10,10,32,32,32,32,32,32,47,42,32,108,111,111,107,117,112,32,116,104,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,105,110,32,116,104,101,32,108,97,114,103,101,32,97,116,108,97,115,32,102,114,111,109,32,116,104,101,32,105,110,100,101,120,45,116,105,108,101,10,32,32,32,32,32,32,32,32,32,99,111,111,114,100,105,110,97,116,101,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,105,109,97,103,101,95,120,121,44,32,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,108,97,121,101,114,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,40,110,117,109,98,101,114,95,108,111,111,107,117,112,115,41,44,32,105,110,116,40,115,108,97,99,107,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,101,120,101,108,95,99,111,111,114,100,44,32,99,111,108,111,114,95,108,97,121,101,114,41,59,10,10,32,32,32,32,32,32,105,102,40,105,109,97,103,101,95,102,105,108,116,101,114,32,61,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,105,109,97,103,101,95,102,105,108,116,101,114,95,110,101,97,114,101,115,116,41,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,44,32,105,118,101,99,51,40,116,101,120,101,108,95,99,111,111,114,100,44,32,99,111,108,111,114,95,108,97,121,101,114,41,44,32,48,41,46,114,103,98,97,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,40,105,109,97,103,101,95,102,105,108,116,101,114,32,61,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,105,109,97,103,101,95,102,105,108,116,101,114,95,108,105,110,101,97,114,41,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,70,105,108,116,101,114,101,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,51,40,116,101,120,101,108,95,99,111,111,114,100,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,95,115,105,122,101,95,114,101,99,105,112,114,111,99,97,108,44,32,99,111,108,111,114,95,108,97,121,101,114,41,41,46,114,103,98,97,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,47,42,32,67,117,98,105,99,32,102,105,108,116,101,114,105,110,103,32,98,121,32,114,101,97,108,105,122,105,110,103,32,99,117,98,105,99,45,102,105,108,116,101,114,105,110,103,32,97,115,32,114,101,112,101,97,116,101,100,10,32,32,32,32,32,32,32,32,32,32,32,32,32,98,105,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,44,32,115,101,101,32,71,80,85,32,71,101,109,115,32,50,44,32,67,104,97,112,116,101,114,32,50,48,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,67,111,100,101,32,105,110,115,112,105,114,101,100,32,98,121,32,83,116,97,99,107,79,118,101,114,102,108,111,119,32,40,104,116,116,112,58,47,47,115,116,97,99,107,111,118,101,114,102,108,111,119,46,99,111,109,47,113,117,101,115,116,105,111,110,115,47,49,51,53,48,49,48,56,49,47,101,102,102,105,99,105,101,110,116,45,98,105,99,117,98,105,99,45,102,105,108,116,101,114,105,110,103,45,99,111,100,101,45,105,110,45,103,108,115,108,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,97,110,100,32,102,114,111,109,32,83,104,105,110,121,32,80,105,120,101,108,115,32,40,104,116,116,112,58,47,47,118,101,99,51,46,99,97,47,98,105,99,117,98,105,99,45,102,105,108,116,101,114,105,110,103,45,105,110,45,102,101,119,101,114,45,116,97,112,115,47,41,10,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,118,101,99,50,32,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,44,32,108,105,110,101,97,114,95,119,101,105,103,104,116,59,10,32,32,32,32,32,32,32,32,32,32,118,101,99,52,32,120,95,119,101,105,103,104,116,115,44,32,121,95,119,101,105,103,104,116,115,59,10,32,32,32,32,32,32,32,32,32,32,118,101,99,52,32,99,111,114,110,101,114,95,99,111,111,114,100,115,44,32,119,101,105,103,104,116,95,115,117,109,115,44,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,59,10,32,32,32,32,32,32,32,32,32,32,118,101,99,52,32,116,48,48,44,32,116,49,48,44,32,116,48,49,44,32,116,49,49,59,10,10,32,32,32,32,32,32,32,32,32,32,116,101,120,101,108,95,99,111,111,114,100,32,45,61,32,118,101,99,50,40,48,46,53,44,32,48,46,53,41,59,10,32,32,32,32,32,32,32,32,32,32,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,32,61,32,102,114,97,99,116,40,116,101,120,101,108,95,99,111,111,114,100,41,59,10,32,32,32,32,32,32,32,32,32,32,116,101,120,101,108,95,99,111,111,114,100,32,45,61,32,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,59,10,10,32,32,32,32,32,32,32,32,32,32,120,95,119,101,105,103,104,116,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,117,98,105,99,95,119,101,105,103,104,116,115,40,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,46,120,41,59,10,32,32,32,32,32,32,32,32,32,32,121,95,119,101,105,103,104,116,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,117,98,105,99,95,119,101,105,103,104,116,115,40,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,46,121,41,59,10,10,32,32,32,32,32,32,32,32,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,32,61,32,118,101,99,52,40,116,101,120,101,108,95,99,111,111,114,100,46,120,32,45,32,48,46,53,44,32,116,101,120,101,108,95,99,111,111,114,100,46,120,32,43,32,49,46,53,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,101,120,101,108,95,99,111,111,114,100,46,121,32,45,32,48,46,53,44,32,116,101,120,101,108,95,99,111,111,114,100,46,121,32,43,32,49,46,53,41,59,10,32,32,32,32,32,32,32,32,32,32,119,101,105,103,104,116,95,115,117,109,115,32,61,32,118,101,99,52,40,120,95,119,101,105,103,104,116,115,46,120,32,43,32,120,95,119,101,105,103,104,116,115,46,121,44,32,120,95,119,101,105,103,104,116,115,46,122,32,43,32,120,95,119,101,105,103,104,116,115,46,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,121,95,119,101,105,103,104,116,115,46,120,32,43,32,121,95,119,101,105,103,104,116,115,46,121,44,32,121,95,119,101,105,103,104,116,115,46,122,32,43,32,121,95,119,101,105,103,104,116,115,46,119,41,59,10,10,32,32,32,32,32,32,32,32,32,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,32,61,32,99,111,114,110,101,114,95,99,111,111,114,100,115,32,43,32,118,101,99,52,40,120,95,119,101,105,103,104,116,115,46,121,44,32,120,95,119,101,105,103,104,116,115,46,119,44,32,121,95,119,101,105,103,104,116,115,46,121,44,32,121,95,119,101,105,103,104,116,115,46,119,41,32,47,32,119,101,105,103,104,116,95,115,117,109,115,59,10,32,32,32,32,32,32,32,32,32,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,32,42,61,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,95,115,105,122,101,95,114,101,99,105,112,114,111,99,97,108,46,120,121,120,121,59,10,10,32,32,32,32,32,32,32,32,32,32,116,48,48,32,61,32,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,70,105,108,116,101,114,101,100,44,32,118,101,99,51,40,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,120,122,44,32,99,111,108,111,114,95,108,97,121,101,114,41,41,59,10,32,32,32,32,32,32,32,32,32,32,116,49,48,32,61,32,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,70,105,108,116,101,114,101,100,44,32,118,101,99,51,40,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,121,122,44,32,99,111,108,111,114,95,108,97,121,101,114,41,41,59,10,32,32,32,32,32,32,32,32,32,32,116,48,49,32,61,32,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,70,105,108,116,101,114,101,100,44,32,118,101,99,51,40,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,120,119,44,32,99,111,108,111,114,95,108,97,121,101,114,41,41,59,10,32,32,32,32,32,32,32,32,32,32,116,49,49,32,61,32,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,70,105,108,116,101,114,101,100,44,32,118,101,99,51,40,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,121,119,44,32,99,111,108,111,114,95,108,97,121,101,114,41,41,59,10,10,32,32,32,32,32,32,32,32,32,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,120,32,61,32,119,101,105,103,104,116,95,115,117,109,115,46,121,32,47,32,40,119,101,105,103,104,116,95,115,117,109,115,46,120,32,43,32,119,101,105,103,104,116,95,115,117,109,115,46,121,41,59,10,32,32,32,32,32,32,32,32,32,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,121,32,61,32,119,101,105,103,104,116,95,115,117,109,115,46,119,32,47,32,40,119,101,105,103,104,116,95,115,117,109,115,46,122,32,43,32,119,101,105,103,104,116,95,115,117,109,115,46,119,41,59,10,10,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,109,105,120,40,109,105,120,40,116,48,48,44,32,116,49,48,44,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,120,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,120,40,116,48,49,44,32,116,49,49,44,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,120,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,121,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,42,61,32,105,109,97,103,101,95,99,111,108,111,114,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_brush.frag.glsl.resource_string", fastuidraw::const_c_array<uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,10,123,10,32,32,47,47,32,108,111,99,97,116,105,111,110,32,111,102,32,109,97,116,101,114,32,105,110,100,101,120,32,116,105,108,101,32,102,111,114,32,116,104,101,32,105,109,97,103,101,10,32,32,118,101,99,51,32,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,59,10,10,32,32,47,47,32,115,105,122,101,32,111,102,32,116,104,101,32,40,115,117,98,41,105,109,97,103,101,32,105,110,32,116,101,120,101,108,115,10,32,32,117,118,101,99,50,32,105,109,97,103,101,95,115,105,122,101,59,10,10,32,32,47,47,32,115,108,97,99,107,32,105,110,32,116,105,108,101,115,44,32,105,46,101,46,32,104,111,119,32,109,97,110,121,32,116,101,120,101,108,32,114,101,112,101,97,116,101,100,10,32,32,47,47,32,111,110,32,101,97,99,104,32,115,105,122,101,32,111,102,32,116,105,108,101,32,116,111,32,102,97,99,105,108,105,116,97,116,101,32,102,105,108,116,101,114,105,110,103,10,32,32,117,105,110,116,32,115,108,97,99,107,59,10,10,32,32,47,47,32,110,117,109,98,101,114,32,111,102,32,105,110,100,101,120,32,116,105,108,101,32,108,111,111,107,117,112,115,10,32,32,117,105,110,116,32,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,59,10,10,32,32,47,47,32,99,111,110,118,101,114,115,105,111,110,32,102,97,99,116,111,114,32,102,114,111,109,32,109,97,115,116,101,114,32,105,110,100,101,120,32,116,105,108,101,10,32,32,47,47,32,99,111,111,114,100,105,110,97,116,101,115,32,116,111,32,105,109,97,103,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,115,10,32,32,47,47,32,84,104,101,32,102,111,114,109,117,108,97,116,32,105,115,32,103,105,118,101,110,32,97,115,58,10,32,32,47,47,32,32,105,109,97,103,101,95,115,105,122,101,95,111,118,101,114,95,109,97,115,116,101,114,95,115,105,122,101,32,61,32,112,111,119,40,73,110,100,101,120,84,105,108,101,83,105,122,101,44,32,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,32,45,32,49,41,32,42,32,67,10,32,32,47,47,32,119,104,101,114,101,10,32,32,47,47,32,32,32,67,32,61,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,32,45,32,50,32,42,32,115,108,97,99,107,10,32,32,47,47,32,97,110,100,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,32,105,115,32,116,104,101,32,99,111,108,111,114,10,32,32,47,47,32,116,105,108,101,32,115,105,122,101,46,10,32,32,117,105,110,116,32,105,109,97,103,101,95,115,105,122,101,95,111,118,101,114,95,109,97,115,116,101,114,95,115,105,122,101,59,10,10,32,32,47,47,32,108,111,99,97,116,105,111,110,32,119,105,116,104,105,110,32,105,109,97,103,101,32,111,102,32,115,116,97,114,116,32,111,102,32,115,117,98,45,105,109,97,103,101,10,32,32,117,118,101,99,50,32,105,109,97,103,101,95,115,116,97,114,116,59,10,125,59,10,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,10,123,10,32,32,47,42,32,108,111,99,97,116,105,111,110,32,111,110,32,97,116,108,97,115,32,105,110,32,116,101,120,101,108,115,10,32,32,32,42,47,10,32,32,118,101,99,50,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,59,10,10,32,32,47,42,32,106,117,115,116,32,116,104,101,32,108,101,110,103,116,104,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,59,10,10,32,32,47,42,32,115,116,97,114,116,32,97,110,100,32,101,110,100,32,111,102,32,103,114,97,100,105,101,110,116,115,32,112,97,99,107,101,100,32,97,115,32,117,115,117,97,108,32,102,108,111,97,116,115,10,32,32,32,42,47,10,32,32,118,101,99,50,32,112,48,44,32,112,49,59,10,10,32,32,47,42,32,114,97,100,105,97,108,32,103,114,97,100,105,101,110,116,32,118,97,108,117,101,115,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,114,48,44,32,114,49,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,10,123,10,32,32,118,101,99,50,32,120,121,59,32,47,47,120,45,121,32,112,111,115,105,116,105,111,110,32,111,102,32,119,105,110,100,111,119,10,32,32,118,101,99,50,32,119,104,59,32,47,47,119,105,100,116,104,32,97,110,100,32,104,101,105,103,104,116,32,111,102,32,119,105,110,100,111,119,10,125,59,10,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,95,114,97,119,10,123,10,32,32,47,42,32,112,97,99,107,101,100,58,32,73,109,97,103,101,58,58,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,40,41,46,120,121,122,40,41,10,32,32,32,42,47,10,32,32,117,105,110,116,32,105,109,97,103,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,59,10,10,32,32,47,42,32,112,97,99,107,101,100,58,32,73,109,97,103,101,58,58,100,105,109,101,110,115,105,111,110,115,40,41,46,120,121,40,41,32,40,111,114,32,97,32,115,117,98,45,118,97,108,117,101,32,102,111,114,32,115,117,98,45,105,109,97,103,105,110,103,41,10,10,32,32,32,32,32,78,79,84,69,58,32,84,104,101,32,102,111,114,109,117,108,97,32,116,111,32,103,111,32,102,114,111,109,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,115,32,116,111,10,32,32,32,32,32,32,32,32,32,32,32,109,97,115,116,101,114,32,105,110,100,101,120,32,116,105,108,101,32,99,111,111,114,100,105,110,97,116,101,115,32,105,115,32,103,105,118,101,110,32,98,121,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,32,43,32,112,32,47,32,65,10,32,32,32,32,32,32,32,32,32,32,32,119,104,101,114,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,32,61,32,73,109,97,103,101,58,58,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,40,41,46,120,121,40,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,32,61,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,115,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,65,32,61,32,40,32,40,84,105,108,101,83,105,122,101,32,45,32,50,32,42,32,83,108,97,99,107,41,32,42,32,112,111,119,40,73,110,100,101,120,84,105,108,101,83,105,122,101,44,32,78,117,109,98,101,114,73,110,100,101,120,76,111,111,107,117,112,115,32,45,32,49,41,32,41,10,10,32,32,32,32,32,32,32,32,32,32,32,84,105,108,101,83,105,122,101,32,105,115,32,103,105,118,101,110,32,98,121,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,10,32,32,32,32,32,32,32,32,32,32,32,83,108,97,99,107,32,99,111,109,101,115,32,102,114,111,109,32,116,104,101,32,115,104,97,100,101,114,95,98,114,117,115,104,32,40,105,116,32,105,115,32,112,97,99,107,101,100,32,105,110,116,111,32,50,32,98,105,116,115,41,10,32,32,32,32,32,32,32,32,32,32,32,78,117,109,98,101,114,73,110,100,101,120,76,111,111,107,117,112,115,32,105,115,32,97,108,115,111,32,112,97,99,107,101,100,32,105,110,116,111,32,115,104,97,100,101,114,95,98,114,117,115,104,32,40,111,99,99,117,112,121,105,110,103,32,53,32,98,105,116,115,41,10,32,32,32,32,32,32,32,32,32,32,32,73,110,100,101,120,84,105,108,101,83,105,122,101,32,105,115,32,103,105,118,101,110,32,98,121,32,40,49,32,60,60,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,110,111,116,101,32,116,104,97,116,32,116,104,101,110,32,112,111,119,40,73,110,100,101,120,84,105,108,101,83,105,122,101,44,32,78,117,109,98,101,114,73,110,100,101,120,76,101,118,101,108,115,32,45,32,49,41,32,105,115,32,115,97,109,101,32,97,115,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,49,32,60,60,32,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,32,42,32,40,78,117,109,98,101,114,73,110,100,101,120,76,111,111,107,117,112,115,32,45,32,49,41,32,41,10,32,32,32,42,47,10,32,32,117,105,110,116,32,105,109,97,103,101,95,115,105,122,101,95,120,121,59,10,10,32,32,47,42,10,32,32,32,32,111,102,102,115,101,116,32,111,102,32,115,116,97,114,116,32,114,101,99,116,97,110,103,108,101,32,102,111,114,32,115,117,98,45,105,109,97,103,101,46,10,32,32,32,42,47,10,32,32,117,105,110,116,32,105,109,97,103,101,95,115,116,97,114,116,95,120,121,59,10,10,32,32,47,42,32,105,109,97,103,101,32,115,108,97,99,107,32,97,110,100,32,110,117,109,98,101,114,32,111,102,32,105,110,100,101,120,32,108,111,111,107,117,112,115,32,110,101,101,100,101,100,10,32,32,32,42,47,10,32,32,117,105,110,116,32,105,109,97,103,101,95,115,108,97,99,107,95,110,117,109,98,101,114,95,108,111,111,107,117,112,115,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,10,123,10,32,32,47,42,32,115,116,97,114,116,32,97,110,100,32,101,110,100,32,111,102,32,103,114,97,100,105,101,110,116,115,32,112,97,99,107,101,100,32,97,115,32,117,115,117,97,108,32,102,108,111,97,116,115,10,32,32,32,42,47,10,32,32,118,101,99,50,32,112,48,44,32,112,49,59,10,10,32,32,47,42,32,112,97,99,107,101,100,58,10,32,32,32,32,32,45,32,98,105,116,115,32,91,48,32,44,32,49,53,93,32,67,111,108,111,114,83,116,111,112,83,101,113,117,101,110,99,101,79,110,65,116,108,97,115,58,58,116,101,120,101,108,95,108,111,99,97,116,105,111,110,40,41,46,120,40,41,10,32,32,32,32,32,45,32,98,105,116,115,32,91,49,54,44,32,51,49,93,32,67,111,108,111,114,83,116,111,112,83,101,113,117,101,110,99,101,79,110,65,116,108,97,115,58,58,116,101,120,101,108,95,108,111,99,97,116,105,111,110,40,41,46,121,10,32,32,32,42,47,10,32,32,117,105,110,116,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,59,10,10,32,32,47,42,32,106,117,115,116,32,116,104,101,32,108,101,110,103,116,104,10,32,32,32,42,47,10,32,32,117,105,110,116,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,59,10,10,32,32,47,42,32,114,97,100,105,97,108,32,103,114,97,100,105,101,110,116,32,118,97,108,117,101,115,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,114,48,44,32,114,49,59,10,125,59,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_brush_types.glsl.resource_string", fastuidraw::const_c_array<uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,112,114,111,99,101,115,115,95,105,109,97,103,101,95,100,97,116,97,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,95,114,97,119,32,114,97,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,32,99,111,111,107,101,100,41,10,123,10,32,32,117,118,101,99,51,32,109,97,115,116,101,114,95,120,121,122,59,10,32,32,117,105,110,116,32,105,110,100,101,120,95,112,111,119,115,44,32,115,108,97,99,107,44,32,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,44,32,119,119,59,10,10,32,32,109,97,115,116,101,114,95,120,121,122,46,120,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,120,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,120,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,105,109,97,103,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,41,59,10,10,32,32,109,97,115,116,101,114,95,120,121,122,46,121,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,121,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,121,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,105,109,97,103,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,41,59,10,10,32,32,109,97,115,116,101,114,95,120,121,122,46,122,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,122,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,122,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,105,109,97,103,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,41,59,10,10,32,32,99,111,111,107,101,100,46,105,109,97,103,101,95,115,105,122,101,46,120,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,105,122,101,95,120,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,105,122,101,95,120,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,105,109,97,103,101,95,115,105,122,101,95,120,121,41,59,10,10,32,32,99,111,111,107,101,100,46,105,109,97,103,101,95,115,105,122,101,46,121,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,105,122,101,95,121,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,105,122,101,95,121,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,105,109,97,103,101,95,115,105,122,101,95,120,121,41,59,10,10,32,32,99,111,111,107,101,100,46,105,109,97,103,101,95,115,116,97,114,116,46,120,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,105,122,101,95,120,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,105,122,101,95,120,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,105,109,97,103,101,95,115,116,97,114,116,95,120,121,41,59,10,10,32,32,99,111,111,107,101,100,46,105,109,97,103,101,95,115,116,97,114,116,46,121,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,105,122,101,95,121,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,105,122,101,95,121,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,105,109,97,103,101,95,115,116,97,114,116,95,120,121,41,59,10,10,32,32,115,108,97,99,107,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,108,97,99,107,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,115,108,97,99,107,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,105,109,97,103,101,95,115,108,97,99,107,95,110,117,109,98,101,114,95,108,111,111,107,117,112,115,41,59,10,10,32,32,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,105,109,97,103,101,95,115,108,97,99,107,95,110,117,109,98,101,114,95,108,111,111,107,117,112,115,41,59,10,10,32,32,109,97,115,116,101,114,95,120,121,122,46,120,121,32,42,61,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,41,59,10,32,32,99,111,111,107,101,100,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,32,61,32,118,101,99,51,40,109,97,115,116,101,114,95,120,121,122,41,59,10,32,32,99,111,111,107,101,100,46,115,108,97,99,107,32,61,32,115,108,97,99,107,59,10,32,32,99,111,111,107,101,100,46,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,32,61,32,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,59,10,10,32,32,105,102,40,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,32,62,32,117,105,110,116,40,48,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,10,32,32,32,32,32,32,32,32,84,104,101,32,102,97,99,116,111,114,32,102,114,111,109,32,109,97,115,116,101,114,32,105,110,100,101,120,32,116,105,108,101,32,116,111,32,99,111,108,111,114,32,116,105,108,101,32,105,115,32,103,105,118,101,110,32,98,121,10,32,32,32,32,32,32,32,32,32,32,112,111,119,40,83,105,122,101,79,102,73,109,97,103,101,84,105,108,101,44,32,78,117,109,98,101,114,73,110,100,101,120,76,111,111,107,85,112,115,32,45,32,49,41,10,32,32,32,32,32,32,32,32,32,32,61,32,112,111,119,40,50,44,32,108,111,103,50,40,83,105,122,101,79,102,73,109,97,103,101,84,105,108,101,41,32,42,32,40,78,117,109,98,101,114,73,110,100,101,120,76,111,111,107,85,112,115,32,45,32,49,41,41,10,32,32,32,32,32,32,32,32,66,105,116,32,115,104,105,102,116,105,110,103,32,103,105,118,101,115,32,117,115,32,116,104,101,32,112,111,119,40,50,44,32,86,41,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,119,119,32,61,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,41,32,42,32,40,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,32,45,32,117,105,110,116,40,49,41,41,59,10,32,32,32,32,32,32,105,110,100,101,120,95,112,111,119,115,32,61,32,117,105,110,116,40,49,41,32,60,60,32,119,119,59,10,32,32,32,32,32,32,99,111,111,107,101,100,46,105,109,97,103,101,95,115,105,122,101,95,111,118,101,114,95,109,97,115,116,101,114,95,115,105,122,101,32,61,32,40,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,41,32,45,32,117,105,110,116,40,50,41,32,42,32,115,108,97,99,107,41,32,42,32,105,110,100,101,120,95,112,111,119,115,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,99,111,111,107,101,100,46,105,109,97,103,101,95,115,105,122,101,95,111,118,101,114,95,109,97,115,116,101,114,95,115,105,122,101,32,61,32,117,105,110,116,40,49,41,59,10,32,32,32,32,125,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,112,114,111,99,101,115,115,95,103,114,97,100,105,101,110,116,95,100,97,116,97,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,32,114,97,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,32,99,111,111,107,101,100,41,10,123,10,32,32,99,111,111,107,101,100,46,112,48,32,61,32,114,97,119,46,112,48,59,10,32,32,99,111,111,107,101,100,46,112,49,32,61,32,114,97,119,46,112,49,59,10,10,32,32,99,111,111,107,101,100,46,114,48,32,61,32,114,97,119,46,114,48,59,10,32,32,99,111,111,107,101,100,46,114,49,32,61,32,114,97,119,46,114,49,59,10,10,32,32,99,111,111,107,101,100,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,32,61,32,102,108,111,97,116,40,114,97,119,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,41,59,10,10,32,32,117,118,101,99,50,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,59,10,32,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,46,120,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,95,115,116,111,112,95,120,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,95,115,116,111,112,95,120,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,41,59,10,10,32,32,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,46,121,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,95,115,116,111,112,95,121,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,95,115,116,111,112,95,121,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,41,59,10,10,32,32,99,111,111,107,101,100,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,32,61,32,118,101,99,50,40,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,41,59,10,125,10,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,32,105,109,97,103,101,41,10,123,10,32,32,117,105,110,116,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,95,114,97,119,32,114,97,119,59,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,105,109,97,103,101,95,114,97,119,95,100,97,116,97,40,108,111,99,97,116,105,111,110,44,32,114,97,119,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,112,114,111,99,101,115,115,95,105,109,97,103,101,95,100,97,116,97,40,114,97,119,44,32,105,109,97,103,101,41,59,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,95,100,97,116,97,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,32,103,114,97,100,41,10,123,10,32,32,117,105,110,116,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,32,114,97,119,59,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,95,100,97,116,97,40,108,111,99,97,116,105,111,110,44,32,114,97,119,41,59,10,32,32,114,97,119,46,114,48,32,61,32,48,46,48,59,10,32,32,114,97,119,46,114,49,32,61,32,49,46,48,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,112,114,111,99,101,115,115,95,103,114,97,100,105,101,110,116,95,100,97,116,97,40,114,97,119,44,32,103,114,97,100,41,59,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,32,103,114,97,100,41,10,123,10,32,32,117,105,110,116,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,97,119,32,114,97,119,59,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,40,108,111,99,97,116,105,111,110,44,32,114,97,119,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,112,114,111,99,101,115,115,95,103,114,97,100,105,101,110,116,95,100,97,116,97,40,114,97,119,44,32,103,114,97,100,41,59,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10,10,47,42,32,85,110,112,97,99,107,115,32,116,104,101,32,98,114,117,115,104,32,100,97,116,97,32,102,114,111,109,32,116,104,101,32,108,111,99,97,116,105,111,110,32,97,116,32,100,97,116,97,95,112,116,114,10,32,32,32,116,111,32,116,104,101,32,118,97,108,117,101,115,32,100,101,102,105,110,101,100,32,105,110,32,116,104,101,32,115,104,97,100,101,114,32,102,105,108,101,10,32,32,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,98,114,117,115,104,95,117,110,112,97,99,107,101,100,95,118,97,108,117,101,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,46,10,32,32,32,73,110,32,97,100,100,105,116,105,111,110,44,32,105,110,99,114,101,109,101,110,116,115,32,100,97,116,97,95,112,116,114,32,116,111,32,116,104,101,32,108,111,99,97,116,105,111,110,32,111,102,32,116,104,101,10,32,32,32,98,114,117,115,104,32,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,109,97,116,114,105,120,46,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,98,114,117,115,104,95,117,110,112,97,99,107,95,118,97,108,117,101,115,40,105,110,32,117,105,110,116,32,115,104,97,100,101,114,44,32,105,110,111,117,116,32,117,105,110,116,32,100,97,116,97,95,112,116,114,41,10,123,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,32,105,109,97,103,101,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,32,103,114,97,100,105,101,110,116,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,32,114,101,112,101,97,116,95,119,105,110,100,111,119,59,10,10,32,32,118,101,99,52,32,112,101,110,95,99,111,108,111,114,59,10,32,32,100,97,116,97,95,112,116,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,112,101,110,95,99,111,108,111,114,40,100,97,116,97,95,112,116,114,44,32,112,101,110,95,99,111,108,111,114,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,101,110,95,99,111,108,111,114,95,120,32,61,32,112,101,110,95,99,111,108,111,114,46,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,101,110,95,99,111,108,111,114,95,121,32,61,32,112,101,110,95,99,111,108,111,114,46,121,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,101,110,95,99,111,108,111,114,95,122,32,61,32,112,101,110,95,99,111,108,111,114,46,122,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,101,110,95,99,111,108,111,114,95,119,32,61,32,112,101,110,95,99,111,108,111,114,46,119,59,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,105,109,97,103,101,40,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,100,97,116,97,95,112,116,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,105,109,97,103,101,95,100,97,116,97,40,100,97,116,97,95,112,116,114,44,32,105,109,97,103,101,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,105,109,97,103,101,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,32,61,32,118,101,99,51,40,48,46,48,44,32,48,46,48,44,32,48,46,48,41,59,10,32,32,32,32,32,32,105,109,97,103,101,46,105,109,97,103,101,95,115,105,122,101,32,61,32,117,118,101,99,50,40,49,44,32,49,41,59,10,32,32,32,32,32,32,105,109,97,103,101,46,115,108,97,99,107,32,61,32,117,105,110,116,40,48,41,59,10,32,32,32,32,32,32,105,109,97,103,101,46,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,32,61,32,117,105,110,116,40,48,41,59,10,32,32,32,32,32,32,105,109,97,103,101,46,105,109,97,103,101,95,115,105,122,101,95,111,118,101,114,95,109,97,115,116,101,114,95,115,105,122,101,32,61,32,117,105,110,116,40,49,41,59,10,32,32,32,32,125,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,40,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,100,97,116,97,95,112,116,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,100,97,116,97,40,100,97,116,97,95,112,116,114,44,32,103,114,97,100,105,101,110,116,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,40,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,100,97,116,97,95,112,116,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,95,100,97,116,97,40,100,97,116,97,95,112,116,114,44,32,103,114,97,100,105,101,110,116,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,103,114,97,100,105,101,110,116,46,112,48,32,61,32,103,114,97,100,105,101,110,116,46,112,49,32,61,32,118,101,99,50,40,48,46,48,44,32,48,46,48,41,59,10,32,32,32,32,32,32,103,114,97,100,105,101,110,116,46,114,48,32,61,32,103,114,97,100,105,101,110,116,46,114,49,32,61,32,48,46,48,59,10,32,32,32,32,32,32,103,114,97,100,105,101,110,116,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,32,61,32,49,46,48,59,10,32,32,32,32,32,32,103,114,97,100,105,101,110,116,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,32,61,32,118,101,99,50,40,48,46,48,44,32,48,46,48,41,59,10,32,32,32,32,125,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,114,101,112,101,97,116,95,119,105,110,100,111,119,40,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,100,97,116,97,95,112,116,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,40,100,97,116,97,95,112,116,114,44,32,114,101,112,101,97,116,95,119,105,110,100,111,119,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,112,101,97,116,95,119,105,110,100,111,119,46,120,121,32,61,32,118,101,99,50,40,48,46,48,44,32,48,46,48,41,59,10,32,32,32,32,32,32,114,101,112,101,97,116,95,119,105,110,100,111,119,46,119,104,32,61,32,118,101,99,50,40,49,46,48,44,32,49,46,48,41,59,10,32,32,32,32,125,10,10,32,32,102,108,111,97,116,32,105,109,97,103,101,95,102,97,99,116,111,114,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,120,32,61,32,114,101,112,101,97,116,95,119,105,110,100,111,119,46,120,121,46,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,121,32,61,32,114,101,112,101,97,116,95,119,105,110,100,111,119,46,120,121,46,121,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,119,32,61,32,114,101,112,101,97,116,95,119,105,110,100,111,119,46,119,104,46,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,104,32,61,32,114,101,112,101,97,116,95,119,105,110,100,111,119,46,119,104,46,121,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,120,32,61,32,103,114,97,100,105,101,110,116,46,112,48,46,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,48,95,121,32,61,32,103,114,97,100,105,101,110,116,46,112,48,46,121,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,120,32,61,32,103,114,97,100,105,101,110,116,46,112,49,46,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,112,49,95,121,32,61,32,103,114,97,100,105,101,110,116,46,112,49,46,121,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,48,32,61,32,103,114,97,100,105,101,110,116,46,114,48,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,114,49,32,61,32,103,114,97,100,105,101,110,116,46,114,49,59,10,10,32,32,105,109,97,103,101,95,102,97,99,116,111,114,32,61,32,49,46,48,32,47,32,102,108,111,97,116,40,105,109,97,103,101,46,105,109,97,103,101,95,115,105,122,101,95,111,118,101,114,95,109,97,115,116,101,114,95,115,105,122,101,41,59,10,32,32,118,101,99,50,32,84,59,10,32,32,84,32,61,32,105,109,97,103,101,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,46,120,121,32,43,32,118,101,99,50,40,105,109,97,103,101,46,105,109,97,103,101,95,115,116,97,114,116,41,32,42,32,105,109,97,103,101,95,102,97,99,116,111,114,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,120,32,61,32,84,46,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,121,32,61,32,84,46,121,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,108,97,121,101,114,32,61,32,105,109,97,103,101,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,120,121,122,46,122,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,97,99,116,111,114,32,61,32,105,109,97,103,101,95,102,97,99,116,111,114,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,120,32,61,32,102,108,111,97,116,40,105,109,97,103,101,46,105,109,97,103,101,95,115,105,122,101,46,120,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,121,32,61,32,102,108,111,97,116,40,105,109,97,103,101,46,105,109,97,103,101,95,115,105,122,101,46,121,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,108,97,99,107,32,61,32,105,109,97,103,101,46,115,108,97,99,107,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,32,61,32,105,109,97,103,101,46,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,59,10,10,32,32,102,108,111,97,116,32,99,111,108,111,114,95,115,116,111,112,95,114,101,99,105,112,59,10,10,32,32,99,111,108,111,114,95,115,116,111,112,95,114,101,99,105,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,95,115,105,122,101,95,114,101,99,105,112,114,111,99,97,108,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,115,116,111,112,95,108,101,110,103,116,104,32,61,32,99,111,108,111,114,95,115,116,111,112,95,114,101,99,105,112,32,42,32,103,114,97,100,105,101,110,116,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,108,101,110,103,116,104,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,115,116,111,112,95,120,32,61,32,99,111,108,111,114,95,115,116,111,112,95,114,101,99,105,112,32,42,32,103,114,97,100,105,101,110,116,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,46,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,115,116,111,112,95,121,32,61,32,103,114,97,100,105,101,110,116,46,99,111,108,111,114,95,115,116,111,112,95,115,101,113,117,101,110,99,101,95,120,121,46,121,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,32,61,32,115,104,97,100,101,114,59,10,125,10,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,111,102,102,115,101,116,95,116,111,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,40,117,105,110,116,32,115,104,97,100,101,114,41,10,123,10,32,32,117,105,110,116,32,114,59,10,10,32,32,114,32,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,112,101,110,95,110,117,109,95,98,108,111,99,107,115,41,59,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,105,109,97,103,101,40,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,32,43,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,105,109,97,103,101,95,110,117,109,95,98,108,111,99,107,115,41,59,10,32,32,32,32,125,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,40,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,32,43,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,95,110,117,109,95,98,108,111,99,107,115,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,40,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,32,43,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,95,110,117,109,95,98,108,111,99,107,115,41,59,10,32,32,32,32,125,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,104,97,100,101,114,95,104,97,115,95,114,101,112,101,97,116,95,119,105,110,100,111,119,40,115,104,97,100,101,114,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,32,43,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,110,117,109,95,98,108,111,99,107,115,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,114,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_brush_unpack.glsl.resource_string", fastuidraw::const_c_array<uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,32,118,97,114,105,97,98,108,101,115,32,116,104,97,116,32,97,114,101,32,105,110,105,116,105,97,108,105,122,101,100,32,97,116,32,109,97,105,110,40,41,44,32,98,117,116,32,117,115,101,114,32,100,101,102,105,110,101,100,10,32,32,32,102,114,97,103,109,101,110,116,32,115,104,97,100,101,114,32,99,97,110,32,99,104,97,110,103,101,46,10,32,42,47,10,118,101,99,50,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,111,115,105,116,105,111,110,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,104,101,97,100,101,114,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,104,101,97,100,101,114,32,104,41,59,10,10,10,47,42,32,110,101,101,100,101,100,32,102,117,110,99,116,105,111,110,115,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,102,114,97,103,95,115,104,97,100,101,114,40,105,110,32,117,105,110,116,32,102,114,97,103,95,115,104,97,100,101,114,44,32,105,110,32,117,105,110,116,32,102,114,97,103,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,41,59,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,98,114,117,115,104,95,99,111,108,111,114,40,118,111,105,100,41,59,10,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,66,76,69,78,68,95,68,85,65,76,95,83,82,67,95,66,76,69,78,68,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,98,108,101,110,100,95,115,104,97,100,101,114,40,105,110,32,117,105,110,116,32,98,108,101,110,100,95,115,104,97,100,101,114,44,32,105,110,32,117,105,110,116,32,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,32,105,110,32,118,101,99,52,32,99,111,108,111,114,48,44,32,111,117,116,32,118,101,99,52,32,115,114,99,48,44,32,111,117,116,32,118,101,99,52,32,115,114,99,49,41,59,10,35,101,110,100,105,102,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,66,76,69,78,68,95,70,82,65,77,69,66,85,70,70,69,82,95,70,69,84,67,72,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,98,108,101,110,100,95,115,104,97,100,101,114,40,105,110,32,117,105,110,116,32,98,108,101,110,100,95,115,104,97,100,101,114,44,32,105,110,32,117,105,110,116,32,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,32,105,110,32,118,101,99,52,32,105,110,95,115,114,99,44,32,105,110,32,118,101,99,52,32,105,110,95,102,98,44,32,111,117,116,32,118,101,99,52,32,111,117,116,95,115,114,99,41,59,10,35,101,110,100,105,102,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,66,76,69,78,68,95,83,73,78,71,76,69,95,83,82,67,95,66,76,69,78,68,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,98,108,101,110,100,95,115,104,97,100,101,114,40,105,110,32,117,105,110,116,32,98,108,101,110,100,95,115,104,97,100,101,114,44,32,105,110,32,117,105,110,116,32,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,32,105,110,32,118,101,99,52,32,105,110,95,115,114,99,44,32,111,117,116,32,118,101,99,52,32,111,117,116,95,115,114,99,41,59,10,35,101,110,100,105,102,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,115,104,97,100,101,114,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,110,117,109,95,108,111,111,107,117,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,115,108,97,99,107,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,105,110,116,32,105,109,97,103,101,95,97,116,108,97,115,95,108,97,121,101,114,41,59,10,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,32,112,41,59,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_forward_declares.frag.glsl.resource_string", fastuidraw::const_c_array<uint8_t>(values, sizeof(values)));
+ 
+
+}
+
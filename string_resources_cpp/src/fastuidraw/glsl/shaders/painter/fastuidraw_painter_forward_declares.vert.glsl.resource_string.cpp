@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,109,97,99,104,105,110,101,32,103,101,110,101,114,97,116,101,100,32,104,101,97,100,101,114,32,102,114,111,109,32,67,43,43,32,115,111,117,114,99,101,115,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,32,112,41,59,10,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,32,112,41,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,104,101,97,100,101,114,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,104,101,97,100,101,114,32,104,41,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,99,108,105,112,112,105,110,103,40,105,110,32,117,105,110,116,32,99,108,105,112,112,105,110,103,95,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,112,105,110,103,95,100,97,116,97,32,112,41,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,105,116,101,109,95,109,97,116,114,105,120,40,105,110,32,117,105,110,116,32,105,116,101,109,95,109,97,116,114,105,120,95,108,111,99,97,116,105,111,110,44,32,111,117,116,32,109,97,116,51,32,109,41,59,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,118,101,114,116,95,115,104,97,100,101,114,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,104,101,97,100,101,114,32,104,44,32,111,117,116,32,105,110,116,32,97,100,100,95,122,41,59,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,114,111,117,116,105,110,101,115,32,105,109,112,108,101,109,101,110,116,101,100,32,105,110,32,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,32,102,105,108,101,115,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,118,101,114,116,95,98,114,117,115,104,95,112,114,111,99,101,115,115,105,110,103,40,105,110,32,118,101,99,50,32,105,110,95,112,44,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,104,101,97,100,101,114,32,104,41,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,97,112,112,108,121,95,99,108,105,112,112,105,110,103,40,105,110,32,118,101,99,51,32,112,44,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,112,105,110,103,95,100,97,116,97,32,99,41,59,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_forward_declares.vert.glsl.resource_string", fastuidraw::const_c_array<uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+35,105,102,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,83,84,82,79,75,69,95,86,69,82,84,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,83,84,82,79,75,69,95,86,69,82,84,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,111,102,102,115,101,116,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,41,10,123,10,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,95,106,111,105,110,10,32,32,32,32,32,124,124,32,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,95,106,111,105,110,95,108,97,109,98,100,97,95,110,101,103,97,116,101,100,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,110,48,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,74,110,48,32,61,32,118,101,99,50,40,110,48,46,121,44,32,45,110,48,46,120,41,59,10,32,32,32,32,32,32,118,101,99,50,32,110,49,32,61,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,32,74,110,49,32,61,32,118,101,99,50,40,110,49,46,121,44,32,45,110,49,46,120,41,59,10,32,32,32,32,32,32,102,108,111,97,116,32,114,44,32,100,101,116,44,32,108,97,109,98,100,97,59,10,10,32,32,32,32,32,32,100,101,116,32,61,32,100,111,116,40,74,110,49,44,32,110,48,41,59,10,32,32,32,32,32,32,108,97,109,98,100,97,32,61,32,45,115,105,103,110,40,100,101,116,41,59,10,32,32,32,32,32,32,114,32,61,32,40,100,101,116,32,33,61,32,48,46,48,41,32,63,32,40,100,111,116,40,110,48,44,32,110,49,41,32,45,32,49,46,48,41,32,47,32,100,101,116,32,58,32,48,46,48,59,10,10,32,32,32,32,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,95,106,111,105,110,95,108,97,109,98,100,97,95,110,101,103,97,116,101,100,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,108,97,109,98,100,97,32,61,32,45,108,97,109,98,100,97,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,47,42,32,101,110,102,111,114,99,101,32,109,105,116,101,114,45,108,105,109,105,116,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,105,102,40,109,105,116,101,114,95,108,105,109,105,116,32,62,61,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,109,109,59,10,10,32,32,32,32,32,32,32,32,32,32,109,109,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,42,32,97,98,115,40,114,41,32,47,32,115,113,114,116,40,49,46,48,32,43,32,114,32,42,32,114,41,59,10,32,32,32,32,32,32,32,32,32,32,114,32,61,32,99,108,97,109,112,40,114,44,32,45,109,109,44,32,109,109,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,108,97,109,98,100,97,32,42,32,40,110,48,32,43,32,114,32,42,32,74,110,48,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,106,111,105,110,10,32,32,32,32,32,32,32,32,32,32,124,124,32,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,98,101,118,101,108,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,110,48,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,74,110,48,32,61,32,118,101,99,50,40,110,48,46,121,44,32,45,110,48,46,120,41,59,10,32,32,32,32,32,32,118,101,99,50,32,110,49,32,61,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,32,74,110,49,32,61,32,118,101,99,50,40,110,49,46,121,44,32,45,110,49,46,120,41,59,10,32,32,32,32,32,32,118,101,99,50,32,110,48,95,112,108,117,115,95,110,49,32,61,32,110,48,32,43,32,110,49,59,10,32,32,32,32,32,32,102,108,111,97,116,32,114,44,32,108,97,109,98,100,97,44,32,100,101,110,59,10,10,32,32,32,32,32,32,108,97,109,98,100,97,32,61,32,115,105,103,110,40,100,111,116,40,74,110,48,44,32,110,49,41,41,59,10,32,32,32,32,32,32,100,101,110,32,61,32,49,46,48,32,43,32,100,111,116,40,110,48,44,32,110,49,41,59,10,32,32,32,32,32,32,114,32,61,32,40,100,101,110,32,33,61,32,48,46,48,41,32,63,32,49,46,48,32,47,32,100,101,110,32,58,32,48,46,48,59,10,10,32,32,32,32,32,32,47,42,32,101,110,102,111,114,99,101,32,109,105,116,101,114,95,108,105,109,105,116,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,105,102,40,109,105,116,101,114,95,108,105,109,105,116,32,62,61,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,100,44,32,100,101,110,95,109,59,10,32,32,32,32,32,32,32,32,32,32,100,32,61,32,100,111,116,40,110,48,95,112,108,117,115,95,110,49,44,32,110,48,95,112,108,117,115,95,110,49,41,59,10,32,32,32,32,32,32,32,32,32,32,100,101,110,95,109,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,42,32,100,101,110,59,10,32,32,32,32,32,32,32,32,32,32,105,102,40,100,32,62,61,32,100,101,110,95,109,32,42,32,100,101,110,95,109,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,98,101,118,101,108,95,106,111,105,110,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,32,61,32,48,46,53,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,32,47,47,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,106,111,105,110,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,47,32,115,113,114,116,40,100,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,114,32,61,32,109,97,120,40,114,44,32,48,46,53,41,32,42,32,108,97,109,98,100,97,59,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,114,32,42,32,40,110,48,95,112,108,117,115,95,110,49,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,99,115,59,10,32,32,32,32,32,32,99,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,117,110,105,116,95,118,101,99,116,111,114,40,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,46,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,105,110,95,115,105,103,110,95,109,97,115,107,41,32,38,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,59,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,99,115,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,115,113,117,97,114,101,95,99,97,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,112,114,101,95,111,102,102,115,101,116,32,43,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,99,97,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,110,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,118,32,61,32,118,101,99,50,40,110,46,121,44,32,45,110,46,120,41,59,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,46,120,32,42,32,118,32,43,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,46,121,32,42,32,112,114,101,95,111,102,102,115,101,116,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,112,114,101,95,111,102,102,115,101,116,59,10,32,32,32,32,125,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,10,123,10,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,95,106,111,105,110,10,32,32,32,32,32,124,124,32,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,95,106,111,105,110,95,108,97,109,98,100,97,95,110,101,103,97,116,101,100,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,110,48,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,118,48,32,61,32,118,101,99,50,40,110,48,46,121,44,32,45,110,48,46,120,41,59,10,32,32,32,32,32,32,118,101,99,50,32,110,49,32,61,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,32,118,49,32,61,32,118,101,99,50,40,110,49,46,121,44,32,45,110,49,46,120,41,59,10,32,32,32,32,32,32,118,101,99,50,32,112,48,44,32,112,49,44,32,100,101,108,116,97,95,100,44,32,100,48,44,32,100,49,59,10,32,32,32,32,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,59,10,32,32,32,32,32,32,102,108,111,97,116,32,100,101,116,44,32,114,44,32,114,48,44,32,114,49,44,32,108,97,109,98,100,97,59,10,10,32,32,32,32,32,32,108,97,109,98,100,97,32,61,32,45,115,105,103,110,40,100,111,116,40,118,49,44,32,110,48,41,41,59,10,32,32,32,32,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,95,106,111,105,110,95,108,97,109,98,100,97,95,110,101,103,97,116,101,100,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,108,97,109,98,100,97,32,61,32,45,108,97,109,98,100,97,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,10,32,32,32,32,32,32,110,48,32,61,32,108,97,109,98,100,97,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,48,41,59,10,32,32,32,32,32,32,110,49,32,61,32,108,97,109,98,100,97,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,49,41,59,10,10,32,32,32,32,32,32,47,42,32,108,101,116,32,112,48,32,98,101,32,112,32,109,111,118,101,100,32,98,121,32,110,48,32,116,104,101,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,48,44,32,48,46,48,41,59,10,32,32,32,32,32,32,114,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,100,48,32,61,32,114,48,32,42,32,110,48,59,10,10,32,32,32,32,32,32,47,42,32,108,101,116,32,112,49,32,98,101,32,112,32,109,111,118,101,100,32,98,121,32,110,49,32,116,104,101,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,49,44,32,48,46,48,41,59,10,32,32,32,32,32,32,114,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,100,49,32,61,32,114,49,32,42,32,110,49,59,10,10,32,32,32,32,32,32,47,42,32,110,111,119,32,99,111,109,112,117,116,101,32,119,104,101,114,101,32,116,104,101,32,108,105,110,101,115,32,76,48,32,97,110,100,32,76,49,32,105,110,116,101,114,115,101,99,116,10,32,32,32,32,32,32,32,32,32,119,104,101,114,101,32,76,48,32,61,32,123,32,112,48,32,43,32,115,32,42,32,118,48,32,124,32,115,32,62,32,48,125,10,32,32,32,32,32,32,32,32,32,97,110,100,32,76,49,32,61,32,123,32,112,49,32,45,32,115,32,42,32,118,49,32,124,32,115,32,62,32,48,125,10,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,100,101,108,116,97,95,100,32,61,32,100,49,32,45,32,100,48,59,10,32,32,32,32,32,32,100,101,116,32,61,32,118,48,46,120,32,42,32,118,49,46,121,32,45,32,118,48,46,121,32,42,32,118,49,46,120,59,10,10,32,32,32,32,32,32,105,102,40,100,101,116,32,33,61,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,114,32,61,32,40,118,49,46,121,32,42,32,100,101,108,116,97,95,100,46,120,32,45,32,118,49,46,120,32,42,32,100,101,108,116,97,95,100,46,121,41,32,47,32,100,101,116,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,114,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,47,42,32,109,105,116,101,114,32,108,105,109,105,116,59,32,119,101,32,117,115,101,32,116,104,101,32,100,105,115,116,97,110,99,101,32,105,110,100,117,99,101,115,10,32,32,32,32,32,32,32,32,32,102,114,111,109,32,100,48,32,115,105,110,99,101,32,116,104,101,32,109,105,116,101,114,45,112,111,105,110,116,32,105,115,32,112,97,105,114,101,100,10,32,32,32,32,32,32,32,32,32,119,105,116,104,32,100,48,46,10,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,105,102,40,109,105,116,101,114,95,108,105,109,105,116,32,62,61,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,109,44,32,109,109,44,32,108,100,48,59,10,10,32,32,32,32,32,32,32,32,32,32,47,42,32,109,105,116,101,114,32,100,105,115,116,97,110,99,101,44,32,119,104,105,99,104,32,105,115,32,109,101,97,115,117,114,101,32,102,114,111,109,32,116,104,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,105,110,116,32,111,102,32,116,104,101,32,112,97,116,104,32,40,103,105,118,101,110,32,98,121,32,112,111,115,105,116,105,111,110,41,10,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,109,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,42,32,108,101,110,103,116,104,40,100,48,41,59,10,10,32,32,32,32,32,32,32,32,32,32,47,42,32,116,104,101,32,118,97,108,117,101,32,114,32,105,115,32,104,111,119,32,109,117,99,104,32,116,111,32,111,102,102,115,101,116,32,105,110,32,116,104,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,114,101,99,116,105,111,110,32,118,48,59,32,87,101,32,104,97,118,101,32,97,32,114,105,103,104,116,32,116,114,105,97,110,103,108,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,40,99,111,114,110,101,114,32,97,116,32,112,111,115,105,116,105,111,110,41,44,32,104,101,105,103,104,116,32,105,115,32,97,108,111,110,103,32,110,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,105,115,32,119,105,116,104,32,104,101,105,103,104,116,32,114,48,32,97,110,100,32,116,104,101,32,108,101,110,103,116,104,32,105,115,32,103,105,118,101,110,10,32,32,32,32,32,32,32,32,32,32,32,32,32,98,121,32,114,46,10,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,109,109,32,61,32,109,32,42,32,97,98,115,40,114,41,32,47,32,108,101,110,103,116,104,40,100,48,32,43,32,114,32,42,32,118,48,41,59,10,32,32,32,32,32,32,32,32,32,32,114,32,61,32,99,108,97,109,112,40,114,44,32,45,109,109,44,32,109,109,41,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,100,48,32,43,32,114,32,42,32,118,48,59,10,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,49,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,106,111,105,110,10,32,32,32,32,32,32,32,32,32,32,124,124,32,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,98,101,118,101,108,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,110,48,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,118,48,32,61,32,118,101,99,50,40,110,48,46,121,44,32,45,110,48,46,120,41,59,10,32,32,32,32,32,32,118,101,99,50,32,110,49,32,61,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,32,118,49,32,61,32,118,101,99,50,40,110,49,46,121,44,32,45,110,49,46,120,41,59,10,32,32,32,32,32,32,118,101,99,50,32,112,48,44,32,112,49,44,32,100,101,108,116,97,95,100,44,32,100,48,44,32,100,49,59,10,32,32,32,32,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,59,10,32,32,32,32,32,32,102,108,111,97,116,32,100,101,116,44,32,114,44,32,114,48,44,32,114,49,44,32,108,97,109,98,100,97,59,10,10,32,32,32,32,32,32,108,97,109,98,100,97,32,61,32,45,115,105,103,110,40,100,111,116,40,118,49,44,32,110,48,41,41,59,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,10,32,32,32,32,32,32,110,48,32,61,32,110,111,114,109,97,108,105,122,101,40,108,97,109,98,100,97,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,48,41,41,59,10,32,32,32,32,32,32,110,49,32,61,32,110,111,114,109,97,108,105,122,101,40,108,97,109,98,100,97,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,49,41,41,59,10,10,32,32,32,32,32,32,47,42,32,108,101,116,32,112,48,32,98,101,32,112,32,109,111,118,101,100,32,98,121,32,110,48,32,116,104,101,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,48,44,32,48,46,48,41,59,10,32,32,32,32,32,32,114,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,100,48,32,61,32,114,48,32,42,32,110,48,59,10,10,32,32,32,32,32,32,47,42,32,108,101,116,32,112,49,32,98,101,32,112,32,109,111,118,101,100,32,98,121,32,110,49,32,116,104,101,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,49,44,32,48,46,48,41,59,10,32,32,32,32,32,32,114,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,100,49,32,61,32,114,49,32,42,32,110,49,59,10,10,32,32,32,32,32,32,47,42,32,110,111,119,32,99,111,109,112,117,116,101,32,119,104,101,114,101,32,116,104,101,32,108,105,110,101,115,32,76,48,32,97,110,100,32,76,49,32,105,110,116,101,114,115,101,99,116,10,32,32,32,32,32,32,32,32,32,119,104,101,114,101,32,76,48,32,61,32,123,32,112,48,32,43,32,115,32,42,32,118,48,32,124,32,115,32,62,32,48,125,10,32,32,32,32,32,32,32,32,32,97,110,100,32,76,49,32,61,32,123,32,112,49,32,45,32,115,32,42,32,118,49,32,124,32,115,32,62,32,48,125,10,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,100,101,108,116,97,95,100,32,61,32,100,49,32,45,32,100,48,59,10,32,32,32,32,32,32,100,101,116,32,61,32,118,48,46,120,32,42,32,118,49,46,121,32,45,32,118,48,46,121,32,42,32,118,49,46,120,59,10,10,32,32,32,32,32,32,105,102,40,100,101,116,32,33,61,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,105,110,118,101,114,115,101,95,100,101,116,59,10,10,32,32,32,32,32,32,32,32,32,32,105,110,118,101,114,115,101,95,100,101,116,32,61,32,49,46,48,32,47,32,100,101,116,59,10,32,32,32,32,32,32,32,32,32,32,114,32,61,32,40,118,49,46,121,32,42,32,100,101,108,116,97,95,100,46,120,32,45,32,118,49,46,120,32,42,32,100,101,108,116,97,95,100,46,121,41,32,42,32,105,110,118,101,114,115,101,95,100,101,116,59,10,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,100,48,32,43,32,114,32,42,32,118,48,59,10,10,32,32,32,32,32,32,32,32,32,32,47,42,32,105,110,102,111,114,99,101,32,109,105,116,101,114,45,108,105,109,105,116,46,10,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,105,102,40,109,105,116,101,114,95,108,105,109,105,116,32,62,61,32,48,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,109,44,32,109,109,44,32,108,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,42,32,109,97,120,40,114,48,44,32,114,49,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,108,32,61,32,108,101,110,103,116,104,40,111,102,102,115,101,116,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,108,32,62,32,109,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,98,101,118,101,108,95,106,111,105,110,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,48,46,53,32,42,32,40,100,48,32,43,32,100,49,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,32,47,47,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,106,111,105,110,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,107,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,107,32,61,32,48,46,53,32,42,32,108,101,110,103,116,104,40,100,48,32,43,32,100,49,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,42,61,32,109,97,120,40,109,44,32,107,41,32,47,32,108,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,48,46,53,32,42,32,40,100,48,32,43,32,100,49,41,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,49,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,110,48,44,32,110,49,59,10,32,32,32,32,32,32,102,108,111,97,116,32,105,110,116,101,114,112,111,108,97,116,101,59,10,32,32,32,32,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,59,10,32,32,32,32,32,32,118,101,99,50,32,116,48,44,32,116,49,44,32,115,99,114,101,101,110,95,116,48,44,32,115,99,114,101,101,110,95,116,49,44,32,115,99,114,101,101,110,95,116,44,32,115,99,114,101,101,110,95,110,59,10,32,32,32,32,32,32,109,97,116,50,32,81,44,32,97,100,106,81,59,10,32,32,32,32,32,32,102,108,111,97,116,32,100,59,10,10,32,32,32,32,32,32,110,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,117,110,105,116,95,118,101,99,116,111,114,40,112,114,101,95,111,102,102,115,101,116,46,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,114,109,97,108,48,95,121,95,115,105,103,110,95,109,97,115,107,41,32,38,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,59,10,32,32,32,32,32,32,110,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,117,110,105,116,95,118,101,99,116,111,114,40,112,114,101,95,111,102,102,115,101,116,46,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,114,109,97,108,49,95,121,95,115,105,103,110,95,109,97,115,107,41,32,38,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,59,10,32,32,32,32,32,32,105,110,116,101,114,112,111,108,97,116,101,32,61,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,46,120,59,10,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,99,111,109,112,117,116,101,95,81,95,97,100,106,111,105,110,116,95,81,40,99,108,105,112,95,112,44,32,81,44,32,97,100,106,81,41,59,10,10,32,32,32,32,32,32,116,48,32,61,32,118,101,99,50,40,45,110,48,46,121,44,32,110,48,46,120,41,59,10,32,32,32,32,32,32,116,49,32,61,32,118,101,99,50,40,45,110,49,46,121,44,32,110,49,46,120,41,59,10,32,32,32,32,32,32,115,99,114,101,101,110,95,116,48,32,61,32,110,111,114,109,97,108,105,122,101,40,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,112,105,120,101,108,115,32,42,32,40,81,32,42,32,116,48,41,41,59,10,32,32,32,32,32,32,115,99,114,101,101,110,95,116,49,32,61,32,110,111,114,109,97,108,105,122,101,40,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,112,105,120,101,108,115,32,42,32,40,81,32,42,32,116,49,41,41,59,10,32,32,32,32,32,32,100,32,61,32,100,111,116,40,115,99,114,101,101,110,95,116,48,44,32,115,99,114,101,101,110,95,116,49,41,59,10,10,32,32,32,32,32,32,105,102,40,100,32,62,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,115,99,114,101,101,110,95,116,32,61,32,109,105,120,40,115,99,114,101,101,110,95,116,48,44,32,115,99,114,101,101,110,95,116,49,44,32,105,110,116,101,114,112,111,108,97,116,101,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,47,42,32,34,74,111,121,34,44,32,115,99,114,101,101,110,95,116,48,32,97,110,100,32,115,99,114,101,101,110,95,116,49,32,112,111,105,110,116,32,105,110,32,100,105,102,102,101,114,101,110,116,10,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,114,101,99,116,105,111,110,115,46,32,73,110,32,116,104,105,115,32,112,97,105,110,102,117,108,32,99,97,115,101,32,119,101,32,119,105,108,108,32,105,110,116,101,114,112,111,108,97,116,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,97,108,111,110,103,32,97,32,99,105,114,99,108,101,10,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,115,99,114,101,101,110,95,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,105,114,99,117,108,97,114,95,105,110,116,101,114,112,111,108,97,116,101,40,115,99,114,101,101,110,95,116,48,44,32,115,99,114,101,101,110,95,116,49,44,32,100,44,32,105,110,116,101,114,112,111,108,97,116,101,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,115,99,114,101,101,110,95,110,32,61,32,118,101,99,50,40,115,99,114,101,101,110,95,116,46,121,44,32,45,115,99,114,101,101,110,95,116,46,120,41,59,10,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,97,100,106,81,32,42,32,40,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,114,101,99,105,112,95,112,105,120,101,108,115,32,42,32,115,99,114,101,101,110,95,110,41,59,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,111,102,102,115,101,116,44,32,48,46,48,41,59,10,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,115,113,117,97,114,101,95,99,97,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,51,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,48,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,49,44,32,99,108,105,112,95,112,59,10,32,32,32,32,32,32,102,108,111,97,116,32,115,48,44,32,115,49,59,10,32,32,32,32,32,32,118,101,99,50,32,110,59,10,10,32,32,32,32,32,32,47,42,32,109,111,118,101,32,97,108,111,110,103,32,116,97,110,103,101,110,116,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,32,48,46,48,41,59,10,32,32,32,32,32,32,115,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,48,41,59,10,10,32,32,32,32,32,32,47,42,32,109,111,118,101,32,97,108,111,110,103,32,110,111,114,109,97,108,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,32,43,32,115,48,32,42,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,32,49,46,48,41,59,10,32,32,32,32,32,32,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,112,114,101,95,111,102,102,115,101,116,41,59,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,44,32,48,46,48,41,59,10,32,32,32,32,32,32,115,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,49,41,59,10,10,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,49,46,48,59,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,115,48,32,42,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,32,43,32,115,49,32,42,32,110,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,99,97,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,110,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,118,32,61,32,118,101,99,50,40,110,46,121,44,32,45,110,46,120,41,59,10,32,32,32,32,32,32,118,101,99,51,32,99,108,105,112,95,110,44,32,99,108,105,112,95,118,44,32,99,108,105,112,95,112,59,10,32,32,32,32,32,32,118,101,99,50,32,116,110,32,61,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,59,10,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,32,32,32,32,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,41,59,10,10,32,32,32,32,32,32,99,108,105,112,95,118,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,118,44,32,48,46,48,41,59,10,32,32,32,32,32,32,116,110,46,120,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,116,110,46,120,32,42,32,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,118,41,59,10,10,32,32,32,32,32,32,99,108,105,112,95,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,44,32,48,46,48,41,59,10,32,32,32,32,32,32,116,110,46,121,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,116,110,46,121,32,42,32,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,110,41,59,10,10,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,49,46,48,59,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,116,110,46,120,32,42,32,118,32,43,32,116,110,46,121,32,42,32,110,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,51,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,44,32,99,108,105,112,95,112,59,10,32,32,32,32,32,32,118,101,99,50,32,110,59,10,32,32,32,32,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,101,110,100,95,115,117,98,95,101,100,103,101,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,32,43,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,32,49,46,48,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,112,114,101,95,111,102,102,115,101,116,41,59,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,44,32,48,46,48,41,59,10,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,110,59,10,32,32,32,32,125,10,125,10,35,101,110,100,105,102,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,118,101,114,116,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,117,112,114,105,109,97,114,121,95,97,116,116,114,105,98,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,117,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,117,105,110,116,95,97,116,116,114,105,98,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,105,110,116,32,122,95,97,100,100,41,10,123,10,32,32,118,101,99,52,32,112,114,105,109,97,114,121,95,97,116,116,114,105,98,44,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,59,10,10,32,32,112,114,105,109,97,114,121,95,97,116,116,114,105,98,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,117,112,114,105,109,97,114,121,95,97,116,116,114,105,98,41,59,10,32,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,117,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,41,59,10,10,32,32,117,105,110,116,32,119,105,100,116,104,95,112,105,120,101,108,115,59,10,32,32,117,105,110,116,32,114,101,110,100,101,114,95,112,97,115,115,59,10,32,32,98,111,111,108,32,115,116,114,111,107,101,95,119,105,100,116,104,95,112,105,120,101,108,115,59,10,32,32,105,110,116,32,115,116,114,111,107,105,110,103,95,112,97,115,115,59,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,97,110,116,105,95,97,108,105,97,115,95,116,104,105,99,107,110,101,115,115,32,61,32,49,46,53,59,10,10,32,32,114,101,110,100,101,114,95,112,97,115,115,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,114,101,110,100,101,114,95,112,97,115,115,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,114,101,110,100,101,114,95,112,97,115,115,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,119,105,100,116,104,95,112,105,120,101,108,115,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,119,105,100,116,104,95,112,105,120,101,108,115,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,119,105,100,116,104,95,112,105,120,101,108,115,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,10,32,32,115,116,114,111,107,101,95,119,105,100,116,104,95,112,105,120,101,108,115,32,61,32,40,119,105,100,116,104,95,112,105,120,101,108,115,32,61,61,32,117,105,110,116,40,49,41,41,59,10,32,32,115,116,114,111,107,105,110,103,95,112,97,115,115,32,61,32,105,110,116,40,114,101,110,100,101,114,95,112,97,115,115,41,59,10,10,10,32,32,118,101,99,50,32,112,59,10,32,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,32,111,102,102,115,101,116,59,10,32,32,102,108,111,97,116,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,101,100,103,101,95,115,116,97,114,116,44,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,99,111,110,116,111,117,114,95,115,116,97,114,116,59,10,32,32,102,108,111,97,116,32,116,111,116,97,108,95,101,100,103,101,95,108,101,110,103,116,104,44,32,116,111,116,97,108,95,111,112,101,110,95,99,111,110,116,111,117,114,95,108,101,110,103,116,104,44,32,116,111,116,97,108,95,99,108,111,115,101,100,95,99,111,110,116,111,117,114,95,108,101,110,103,116,104,59,10,32,32,102,108,111,97,116,32,109,105,116,101,114,95,100,105,115,116,97,110,99,101,44,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,105,110,116,32,111,110,95,98,111,117,110,100,97,114,121,44,32,111,102,102,115,101,116,95,116,121,112,101,59,10,32,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,59,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,83,84,82,79,75,69,95,68,65,83,72,69,68,10,32,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,32,115,116,114,111,107,101,95,112,97,114,97,109,115,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,40,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,112,97,114,97,109,115,41,59,10,32,32,35,101,108,115,101,10,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,32,115,116,114,111,107,101,95,112,97,114,97,109,115,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,40,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,112,97,114,97,109,115,41,59,10,32,32,35,101,110,100,105,102,10,10,32,32,112,111,115,105,116,105,111,110,32,61,32,112,114,105,109,97,114,121,95,97,116,116,114,105,98,46,120,121,59,10,32,32,112,114,101,95,111,102,102,115,101,116,32,61,32,112,114,105,109,97,114,121,95,97,116,116,114,105,98,46,122,119,59,10,32,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,32,61,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,122,119,59,10,32,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,101,100,103,101,95,115,116,97,114,116,32,61,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,120,59,10,32,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,99,111,110,116,111,117,114,95,115,116,97,114,116,32,61,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,121,59,10,32,32,116,111,116,97,108,95,101,100,103,101,95,108,101,110,103,116,104,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,117,105,110,116,95,97,116,116,114,105,98,46,121,41,59,10,32,32,116,111,116,97,108,95,111,112,101,110,95,99,111,110,116,111,117,114,95,108,101,110,103,116,104,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,117,105,110,116,95,97,116,116,114,105,98,46,122,41,59,10,32,32,116,111,116,97,108,95,99,108,111,115,101,100,95,99,111,110,116,111,117,114,95,108,101,110,103,116,104,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,117,105,110,116,95,97,116,116,114,105,98,46,119,41,59,10,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,61,32,117,105,110,116,95,97,116,116,114,105,98,46,120,59,10,32,32,111,102,102,115,101,116,95,116,121,112,101,32,61,32,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,116,121,112,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,116,121,112,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,41,59,10,32,32,111,110,95,98,111,117,110,100,97,114,121,32,61,32,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,98,111,117,110,100,97,114,121,95,98,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,41,59,10,10,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,114,97,100,105,117,115,59,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,83,84,82,79,75,69,95,68,65,83,72,69,68,10,32,32,32,32,123,10,32,32,32,32,32,32,105,110,116,32,105,110,116,101,114,118,97,108,95,105,100,59,10,32,32,32,32,32,32,102,108,111,97,116,32,100,44,32,115,44,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,105,110,116,101,114,118,97,108,95,101,110,100,59,10,32,32,32,32,32,32,117,105,110,116,32,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,59,10,10,32,32,32,32,32,32,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,32,61,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,32,43,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,95,110,117,109,95,98,108,111,99,107,115,41,59,10,10,32,32,32,32,32,32,100,32,61,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,99,111,110,116,111,117,114,95,115,116,97,114,116,32,43,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,100,97,115,104,95,111,102,102,115,101,116,59,10,32,32,32,32,32,32,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,40,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,116,111,116,97,108,95,108,101,110,103,116,104,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,105,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,105,110,116,101,114,118,97,108,95,101,110,100,41,59,10,10,32,32,32,32,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,115,116,97,114,116,95,115,117,98,95,101,100,103,101,10,32,32,32,32,32,32,32,32,32,124,124,32,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,101,110,100,95,115,117,98,95,101,100,103,101,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,102,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,98,101,118,101,108,95,101,100,103,101,95,109,97,115,107,41,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,98,101,118,101,108,32,112,111,105,110,116,115,32,104,97,118,101,32,101,105,116,104,101,114,32,116,104,101,32,99,111,109,112,117,116,97,116,105,111,110,32,102,111,114,32,100,97,115,104,105,110,103,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,107,105,112,112,101,100,32,79,82,32,97,114,101,32,99,111,108,108,97,112,115,101,100,32,116,111,32,97,32,112,111,105,110,116,32,116,111,32,97,118,111,105,100,32,100,114,97,119,105,110,103,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,103,97,117,114,97,110,116,101,101,100,95,116,111,95,98,101,95,99,111,118,101,114,101,100,95,109,97,115,107,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,115,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,110,95,98,111,117,110,100,97,114,121,32,61,32,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,115,50,44,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,50,44,32,105,110,116,101,114,118,97,108,95,101,110,100,50,44,32,100,50,44,32,100,101,108,116,97,95,109,97,103,44,32,103,114,111,119,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,32,105,110,116,101,114,118,97,108,95,105,100,50,44,32,100,97,115,104,95,115,116,121,108,101,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,97,115,104,95,115,116,121,108,101,32,61,32,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,100,97,115,104,95,115,116,121,108,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,100,97,115,104,95,115,116,121,108,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,41,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,101,108,116,97,95,109,97,103,32,61,32,108,101,110,103,116,104,40,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,50,32,61,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,115,116,97,114,116,95,115,117,98,95,101,100,103,101,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,32,43,32,100,101,108,116,97,95,109,97,103,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,32,45,32,100,101,108,116,97,95,109,97,103,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,103,114,111,119,32,61,32,40,100,97,115,104,95,115,116,121,108,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,102,108,97,116,95,99,97,112,115,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,46,48,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,50,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,40,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,116,111,116,97,108,95,108,101,110,103,116,104,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,50,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,105,100,50,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,50,44,32,105,110,116,101,114,118,97,108,95,101,110,100,50,41,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,101,120,97,109,105,110,101,32,119,104,97,116,32,104,97,112,112,101,110,115,32,111,110,32,116,104,101,32,111,116,104,101,114,32,115,105,100,101,32,111,102,32,116,104,101,32,101,100,103,101,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,87,101,32,104,97,118,101,32,116,104,101,32,102,111,108,108,111,119,105,110,103,32,99,97,115,101,115,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,45,32,105,110,32,115,97,109,101,32,105,110,116,101,114,118,97,108,44,32,116,104,101,110,32,104,97,110,100,108,101,32,106,117,115,116,32,108,105,107,101,32,119,101,32,100,111,32,97,32,98,101,118,101,108,45,101,100,103,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,119,104,101,114,101,32,101,105,116,104,101,114,32,116,104,101,32,116,104,105,110,103,32,105,115,32,99,111,109,112,108,101,116,101,108,121,32,100,114,97,119,110,32,111,114,32,99,111,108,108,97,112,115,101,100,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,111,32,97,32,112,111,105,110,116,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,45,32,105,110,32,100,105,102,102,101,114,101,110,116,32,105,110,116,101,114,118,97,108,115,59,32,105,102,32,119,101,32,104,97,118,101,32,99,97,112,115,44,32,116,104,101,110,32,101,120,112,97,110,100,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,104,101,32,108,101,110,103,116,104,32,111,102,32,116,104,101,32,115,117,98,45,101,100,103,101,32,116,111,32,105,110,99,108,117,100,101,32,116,104,101,32,97,114,101,97,32,116,104,97,116,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,97,112,115,32,109,97,121,32,99,111,118,101,114,32,40,119,104,105,99,104,32,109,97,121,32,98,101,32,98,101,121,111,110,100,32,116,104,101,32,111,114,105,103,105,110,97,108,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,45,101,100,103,101,32,97,114,101,97,41,46,32,65,108,115,111,32,112,97,121,32,97,116,116,101,110,116,105,111,110,32,105,102,32,116,104,101,32,112,111,105,110,116,32,119,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,101,32,97,116,32,105,115,32,97,32,115,117,98,45,101,100,103,101,32,97,116,32,116,104,101,32,115,116,97,114,116,32,111,114,32,101,110,100,32,111,102,32,116,104,101,32,101,100,103,101,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,73,102,32,115,111,44,32,97,118,111,105,100,32,101,120,112,97,110,100,105,110,103,32,112,97,115,116,32,116,104,101,32,115,116,97,114,116,32,111,114,32,101,110,100,32,111,102,32,116,104,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,100,103,101,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,105,110,116,101,114,118,97,108,95,105,100,50,32,61,61,32,105,110,116,101,114,118,97,108,95,105,100,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,103,97,117,114,97,110,116,101,101,100,95,116,111,95,98,101,95,99,111,118,101,114,101,100,95,109,97,115,107,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,48,46,48,102,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,115,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,110,95,98,111,117,110,100,97,114,121,32,61,32,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,99,111,110,116,114,97,99,116,32,116,111,32,97,118,111,105,100,32,100,114,97,119,105,110,103,32,101,120,116,114,97,115,32,97,110,100,32,101,120,112,97,110,100,32,116,111,32,100,114,97,119,32,99,97,112,115,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,61,32,48,117,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,115,116,97,114,116,95,115,117,98,95,101,100,103,101,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,110,101,119,95,100,44,32,99,108,97,109,112,95,105,110,116,101,114,118,97,108,95,101,110,100,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,115,116,97,114,116,32,61,32,40,115,32,60,32,48,46,48,32,41,63,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,101,110,100,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,101,110,100,32,61,32,40,115,50,32,60,32,48,46,48,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,50,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,50,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,115,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,108,97,109,112,95,105,110,116,101,114,118,97,108,95,101,110,100,32,61,32,109,105,110,40,105,110,116,101,114,118,97,108,95,101,110,100,44,32,100,50,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,110,101,119,95,100,32,61,32,99,108,97,109,112,95,105,110,116,101,114,118,97,108,95,101,110,100,32,45,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,32,43,61,32,40,110,101,119,95,100,32,45,32,100,41,32,42,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,32,47,32,100,101,108,116,97,95,109,97,103,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,110,101,119,95,100,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,100,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,110,101,119,95,100,44,32,99,108,97,109,112,95,105,110,116,101,114,118,97,108,95,98,101,103,105,110,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,115,116,97,114,116,32,61,32,40,115,50,32,60,32,48,46,48,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,101,110,100,50,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,50,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,101,110,100,32,61,32,40,115,32,60,32,48,46,48,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,115,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,108,97,109,112,95,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,61,32,109,97,120,40,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,100,50,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,110,101,119,95,100,32,61,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,43,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,32,105,115,32,116,104,101,32,100,105,114,101,99,116,105,111,110,32,102,114,111,109,32,116,104,105,115,32,112,111,105,110,116,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,116,104,101,32,101,110,100,32,111,102,32,116,104,101,32,115,117,98,45,101,100,103,101,41,32,116,111,32,116,104,101,32,115,116,97,114,116,32,111,102,32,116,104,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,45,101,100,103,101,46,32,84,104,105,115,32,105,115,32,119,104,121,32,119,101,32,104,97,118,101,32,116,104,101,32,99,111,101,102,102,105,99,105,101,110,116,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,100,32,45,32,110,101,119,95,100,41,32,98,101,99,97,117,115,101,32,109,111,118,105,110,103,32,105,110,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,115,32,109,111,118,105,110,103,32,116,111,119,97,114,100,115,32,116,104,101,32,115,116,97,114,116,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,32,43,61,32,40,100,32,45,32,110,101,119,95,100,41,32,42,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,32,47,32,100,101,108,116,97,95,109,97,103,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,110,101,119,95,100,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,100,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,97,100,106,117,115,116,97,98,108,101,95,99,97,112,95,99,111,110,116,111,117,114,95,115,116,97,114,116,10,32,32,32,32,32,32,32,32,32,124,124,32,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,97,100,106,117,115,116,97,98,108,101,95,99,97,112,95,99,111,110,116,111,117,114,95,101,110,100,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,102,40,115,32,62,32,48,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,116,104,101,32,99,111,110,116,111,117,114,32,115,116,97,114,116,32,40,111,114,32,101,110,100,41,32,105,115,32,105,110,115,105,100,101,32,116,104,101,32,100,97,115,104,32,112,97,116,116,101,114,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,111,32,119,101,32,110,101,101,100,32,116,111,32,100,114,97,119,32,102,117,108,108,32,99,97,112,59,32,115,101,116,32,115,116,97,114,116,105,110,103,32,100,105,115,116,97,110,99,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,115,32,48,32,97,110,100,32,116,104,101,32,98,111,117,110,100,97,114,121,32,100,105,115,116,97,110,99,101,32,97,115,32,114,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,97,100,106,117,115,116,97,98,108,101,95,99,97,112,95,101,110,100,105,110,103,95,109,97,115,107,41,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,32,43,61,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,42,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,45,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,99,111,109,112,108,101,116,101,32,99,111,108,108,97,112,115,101,32,98,101,99,97,117,115,101,32,116,104,101,32,110,101,105,103,104,116,98,111,114,105,110,103,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,45,101,100,103,101,32,119,105,108,108,32,101,120,116,101,110,100,32,105,116,115,101,108,102,32,116,111,32,100,114,97,119,32,116,104,101,32,99,97,112,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,110,95,98,111,117,110,100,97,114,121,32,61,32,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,32,61,32,118,101,99,50,40,48,46,48,44,32,48,46,48,41,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,107,105,112,95,100,97,115,104,95,105,110,116,101,114,118,97,108,95,108,111,111,107,117,112,95,109,97,115,107,41,59,10,10,32,32,32,32,32,32,32,32,32,32,47,42,32,99,104,97,110,103,101,32,111,102,102,115,101,116,95,116,121,112,101,32,116,111,32,115,104,97,114,101,100,95,119,105,116,104,95,101,100,103,101,32,115,105,110,99,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,119,101,32,104,97,118,101,32,109,111,100,105,102,105,101,100,32,116,104,101,32,100,97,116,97,32,115,111,32,116,104,97,116,32,105,116,115,32,103,101,111,109,101,116,114,121,10,32,32,32,32,32,32,32,32,32,32,32,32,32,99,97,110,32,98,101,32,99,111,109,112,117,116,101,100,32,106,117,115,116,32,97,115,32,116,104,97,116,46,10,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,95,116,121,112,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,115,104,97,114,101,100,95,119,105,116,104,95,101,100,103,101,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,106,111,105,110,95,109,97,115,107,41,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,103,97,117,114,97,110,116,101,101,100,95,116,111,95,98,101,95,99,111,118,101,114,101,100,95,109,97,115,107,41,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,10,32,32,35,105,102,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,83,84,82,79,75,69,95,85,83,69,95,68,73,83,67,65,82,68,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,40,115,116,114,111,107,105,110,103,95,112,97,115,115,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,112,97,113,117,101,95,112,97,115,115,32,38,38,32,115,116,114,111,107,101,95,119,105,100,116,104,95,112,105,120,101,108,115,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,109,97,120,40,115,116,114,111,107,101,95,114,97,100,105,117,115,32,45,32,97,110,116,105,95,97,108,105,97,115,95,116,104,105,99,107,110,101,115,115,44,32,48,46,48,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,10,32,32,105,102,40,111,110,95,98,111,117,110,100,97,114,121,32,33,61,32,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,40,115,116,114,111,107,101,95,119,105,100,116,104,95,112,105,120,101,108,115,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,111,102,102,115,101,116,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,41,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,112,32,61,32,112,111,115,105,116,105,111,110,32,43,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,42,32,111,102,102,115,101,116,59,10,10,32,32,32,32,32,35,105,102,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,83,84,82,79,75,69,95,85,83,69,95,68,73,83,67,65,82,68,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,102,40,115,116,114,111,107,105,110,103,95,112,97,115,115,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,112,97,113,117,101,95,112,97,115,115,32,38,38,32,33,115,116,114,111,107,101,95,119,105,100,116,104,95,112,105,120,101,108,115,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,114,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,44,32,49,46,48,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,111,102,102,115,101,116,44,32,48,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,97,110,116,105,95,97,108,105,97,115,95,116,104,105,99,107,110,101,115,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,32,45,61,32,109,105,110,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,114,41,32,42,32,111,102,102,115,101,116,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,35,101,110,100,105,102,10,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,112,32,61,32,112,111,115,105,116,105,111,110,59,10,32,32,32,32,125,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,111,110,95,98,111,117,110,100,97,114,121,32,61,32,102,108,111,97,116,40,111,110,95,98,111,117,110,100,97,114,121,41,59,10,32,32,105,102,40,115,116,114,111,107,105,110,103,95,112,97,115,115,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,97,97,95,112,97,115,115,41,10,32,32,32,32,123,10,32,32,32,32,32,32,122,95,97,100,100,32,61,32,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,122,95,97,100,100,32,61,32,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,101,112,116,104,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,101,112,116,104,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,118,101,99,52,40,112,44,32,112,41,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_stroke.vert.glsl.resource_string", fastuidraw::const_c_array<uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,67,79,76,79,82,83,84,79,80,95,65,84,76,65,83,95,50,68,95,65,82,82,65,89,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,83,84,79,80,95,65,84,76,65,83,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,120,44,32,76,41,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,44,32,118,101,99,51,40,102,108,111,97,116,40,120,41,44,32,48,46,48,44,32,102,108,111,97,116,40,76,41,41,44,32,48,46,48,41,10,10,35,101,108,115,101,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,83,84,79,80,95,65,84,76,65,83,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,49,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,120,44,32,76,41,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,44,32,118,101,99,50,40,102,108,111,97,116,40,120,41,44,32,102,108,111,97,116,40,76,41,41,44,32,48,46,48,41,10,10,35,101,110,100,105,102,10,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,95,84,73,76,69,95,85,78,70,73,76,84,69,82,69,68,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,59,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,95,84,73,76,69,95,70,73,76,84,69,82,69,68,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,70,105,108,116,101,114,101,100,59,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,73,78,68,69,88,95,84,73,76,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,73,110,100,101,120,65,116,108,97,115,59,10,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,84,69,88,69,76,95,65,84,76,65,83,95,85,73,78,84,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,84,101,120,101,108,83,116,111,114,101,85,73,78,84,59,10,10,35,105,102,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,69,77,85,76,65,84,69,95,71,76,89,80,72,95,84,69,88,69,76,95,83,84,79,82,69,95,70,76,79,65,84,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,84,69,88,69,76,95,65,84,76,65,83,95,70,76,79,65,84,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,84,101,120,101,108,83,116,111,114,101,70,76,79,65,84,59,10,35,101,110,100,105,102,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,84,69,88,84,85,82,69,95,65,82,82,65,89,10,32,32,47,42,32,84,104,101,32,119,105,100,116,104,32,97,110,100,32,104,101,105,103,104,116,32,111,102,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,71,101,111,109,101,116,114,121,68,97,116,97,83,116,111,114,101,32,97,114,101,10,32,32,32,32,32,112,111,119,101,114,115,32,111,102,32,50,44,32,116,104,101,32,118,97,108,117,101,115,32,103,105,118,101,110,32,98,121,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,87,73,68,84,72,95,76,79,71,50,10,32,32,32,32,32,97,110,100,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,72,69,73,71,72,84,95,76,79,71,50,46,32,87,101,32,119,97,110,116,32,116,111,32,117,115,101,10,32,32,32,32,32,98,105,116,32,115,104,105,102,116,115,32,97,110,100,32,109,97,115,107,105,110,103,32,116,111,32,103,101,116,32,116,104,101,32,99,111,114,114,101,99,116,32,108,97,121,101,114,44,32,104,101,105,103,104,116,32,97,110,100,32,115,111,32,111,110,46,10,32,32,42,47,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,83,84,79,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,71,101,111,109,101,116,114,121,68,97,116,97,83,116,111,114,101,59,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,87,73,68,84,72,95,80,76,85,83,95,72,69,73,71,72,84,95,76,79,71,50,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,87,73,68,84,72,95,76,79,71,50,32,43,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,72,69,73,71,72,84,95,76,79,71,50,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,76,65,89,69,82,40,84,41,32,40,117,105,110,116,40,84,41,32,62,62,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,87,73,68,84,72,95,80,76,85,83,95,72,69,73,71,72,84,95,76,79,71,50,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,89,40,84,41,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,87,73,68,84,72,95,76,79,71,50,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,72,69,73,71,72,84,95,76,79,71,50,44,32,84,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,88,40,84,41,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,48,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,87,73,68,84,72,95,76,79,71,50,44,32,84,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,67,79,79,82,68,40,118,41,32,105,118,101,99,51,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,88,40,118,41,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,89,40,118,41,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,76,65,89,69,82,40,118,41,41,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,98,108,111,99,107,41,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,71,101,111,109,101,116,114,121,68,97,116,97,83,116,111,114,101,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,67,79,79,82,68,40,98,108,111,99,107,41,44,32,48,41,10,35,101,108,115,101,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,71,69,79,77,69,84,82,89,95,83,84,79,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,66,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,71,101,111,109,101,116,114,121,68,97,116,97,83,116,111,114,101,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,98,108,111,99,107,41,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,71,101,111,109,101,116,114,121,68,97,116,97,83,116,111,114,101,44,32,105,110,116,40,98,108,111,99,107,41,41,10,35,101,110,100,105,102,10,10,35,105,102,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,68,65,84,65,95,85,66,79,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,83,84,79,82,69,95,84,66,79,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,66,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,116,98,111,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,95,102,114,111,109,95,115,116,111,114,101,40,98,108,111,99,107,41,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,116,98,111,44,32,105,110,116,40,98,108,111,99,107,41,41,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,80,69,82,83,73,83,84,69,78,84,95,83,84,79,82,69,10,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,80,69,82,83,73,83,84,69,78,84,95,83,84,79,82,69,95,84,66,79,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,66,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,80,101,114,115,105,115,116,101,110,116,83,116,111,114,101,95,116,98,111,59,10,32,32,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,95,102,114,111,109,95,112,101,114,115,105,115,116,101,110,116,95,115,116,111,114,101,40,98,108,111,99,107,41,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,80,101,114,115,105,115,116,101,110,116,83,116,111,114,101,95,116,98,111,44,32,105,110,116,40,98,108,111,99,107,41,41,10,32,32,35,101,110,100,105,102,10,35,101,108,115,101,10,47,42,10,32,32,84,121,112,101,32,105,110,32,116,104,101,32,97,114,114,97,121,32,102,111,114,32,116,104,101,32,117,110,105,102,111,114,109,32,98,108,111,99,107,115,58,10,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,68,65,84,65,95,83,84,79,82,69,95,85,73,78,84,95,84,89,80,69,32,105,115,32,117,105,110,116,44,32,117,118,101,99,50,44,32,117,118,101,99,51,32,111,114,32,117,118,101,99,52,10,32,32,83,105,122,101,32,111,102,32,116,104,101,32,97,114,114,97,121,32,105,115,32,103,105,118,101,110,32,98,121,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,68,65,84,65,95,83,84,79,82,69,95,65,82,82,65,89,95,83,73,90,69,10,32,42,47,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,95,65,82,71,83,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,83,84,79,82,69,95,85,66,79,95,66,73,78,68,73,78,71,44,32,115,116,100,49,52,48,41,32,117,110,105,102,111,114,109,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,117,98,111,10,32,32,123,10,32,32,32,32,117,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,68,65,84,65,95,83,84,79,82,69,95,65,82,82,65,89,95,83,73,90,69,93,59,10,32,32,125,59,10,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,95,102,114,111,109,95,115,116,111,114,101,40,98,108,111,99,107,41,32,117,118,101,99,52,40,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,105,110,116,40,98,108,111,99,107,41,93,41,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,80,69,82,83,73,83,84,69,78,84,95,83,84,79,82,69,10,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,95,65,82,71,83,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,80,69,82,83,73,83,84,69,78,84,95,83,84,79,82,69,95,85,66,79,95,66,73,78,68,73,78,71,44,32,115,116,100,49,52,48,41,32,117,110,105,102,111,114,109,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,80,101,114,115,105,115,116,101,110,116,83,116,111,114,101,95,117,98,111,10,32,32,32,32,123,10,32,32,32,32,32,32,117,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,80,101,114,115,105,115,116,101,110,116,83,116,111,114,101,91,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,80,69,82,83,73,83,84,69,78,84,95,83,84,79,82,69,95,65,82,82,65,89,95,83,73,90,69,93,59,10,32,32,32,32,125,59,10,10,32,32,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,95,102,114,111,109,95,112,101,114,115,105,115,116,101,110,116,95,115,116,111,114,101,40,98,108,111,99,107,41,32,117,118,101,99,52,40,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,80,101,114,115,105,115,116,101,110,116,83,116,111,114,101,91,105,110,116,40,98,108,111,99,107,41,93,41,10,32,32,35,101,110,100,105,102,10,10,35,101,110,100,105,102,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,80,69,82,83,73,83,84,69,78,84,95,83,84,79,82,69,10,32,32,47,42,32,65,32,108,111,99,97,116,105,111,110,32,119,105,116,104,32,116,104,101,32,98,105,116,32,102,97,115,116,117,105,100,114,97,119,95,112,101,114,115,105,115,116,101,110,116,95,115,116,111,114,101,95,109,97,115,107,10,32,32,32,32,32,117,112,32,105,115,32,97,32,108,111,99,97,116,105,111,110,32,105,110,116,111,32,116,104,101,32,112,101,114,115,105,115,116,101,110,116,32,115,116,111,114,101,44,32,115,101,101,10,32,32,32,32,32,80,97,105,110,116,101,114,72,101,97,100,101,114,58,58,112,101,114,115,105,115,116,101,110,116,95,115,116,111,114,101,95,98,105,116,46,10,32,32,32,42,47,10,32,32,117,118,101,99,52,10,32,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,95,105,109,112,108,101,109,101,110,116,40,105,110,32,117,105,110,116,32,98,108,111,99,107,41,10,32,32,123,10,32,32,32,32,105,102,40,40,98,108,111,99,107,32,38,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,112,101,114,115,105,115,116,101,110,116,95,115,116,111,114,101,95,109,97,115,107,41,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,95,102,114,111,109,95,112,101,114,115,105,115,116,101,110,116,95,115,116,111,114,101,40,98,108,111,99,107,32,38,32,126,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,112,101,114,115,105,115,116,101,110,116,95,115,116,111,114,101,95,109,97,115,107,41,41,59,10,32,32,32,32,32,32,125,10,32,32,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,95,102,114,111,109,95,115,116,111,114,101,40,98,108,111,99,107,41,59,10,32,32,125,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,98,108,111,99,107,41,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,95,105,109,112,108,101,109,101,110,116,40,117,105,110,116,40,98,108,111,99,107,41,41,10,35,101,108,115,101,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,98,108,111,99,107,41,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,95,102,114,111,109,95,115,116,111,114,101,40,98,108,111,99,107,41,10,35,101,110,100,105,102,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_uniforms.glsl.resource_string", fastuidraw::const_c_array<uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,102,114,97,103,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,41,10,123,10,32,32,47,42,10,32,32,32,32,118,97,114,121,105,110,103,115,58,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,116,101,120,95,99,111,111,114,100,95,120,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,116,101,120,95,99,111,111,114,100,95,121,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,115,101,99,111,110,100,97,114,121,95,116,101,120,95,99,111,111,114,100,95,120,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,115,101,99,111,110,100,97,114,121,95,116,101,120,95,99,111,111,114,100,95,121,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,116,101,120,95,99,111,111,114,100,95,108,97,121,101,114,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,115,101,99,111,110,100,97,114,121,95,116,101,120,95,99,111,111,114,100,95,108,97,121,101,114,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,103,101,111,109,101,116,114,121,95,100,97,116,97,95,108,111,99,97,116,105,111,110,10,10,32,32,32,32,103,108,121,112,104,32,116,101,120,101,108,32,115,116,111,114,101,32,97,116,58,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,84,101,120,101,108,83,116,111,114,101,85,73,78,84,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,84,101,120,101,108,83,116,111,114,101,70,76,79,65,84,10,10,32,32,32,32,103,108,121,112,104,32,103,101,111,109,101,116,114,121,32,115,116,111,114,101,32,97,116,58,10,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,32,40,109,97,99,114,111,41,10,32,32,42,47,10,32,32,117,105,110,116,32,116,101,120,101,108,48,44,32,116,101,120,101,108,49,44,32,116,101,120,101,108,59,10,32,32,102,108,111,97,116,32,100,44,32,99,111,118,101,114,97,103,101,44,32,115,99,97,108,101,95,105,110,118,101,114,115,101,59,10,32,32,118,101,99,50,32,116,101,120,95,99,111,111,114,100,44,32,100,120,44,32,100,121,59,10,10,10,32,32,116,101,120,95,99,111,111,114,100,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,116,101,120,95,99,111,111,114,100,95,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,116,101,120,95,99,111,111,114,100,95,121,41,59,10,10,32,32,116,101,120,101,108,48,32,61,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,84,101,120,101,108,83,116,111,114,101,85,73,78,84,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,118,101,99,51,40,116,101,120,95,99,111,111,114,100,44,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,116,101,120,95,99,111,111,114,100,95,108,97,121,101,114,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,41,46,114,59,10,10,32,32,105,102,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,115,101,99,111,110,100,97,114,121,95,116,101,120,95,99,111,111,114,100,95,108,97,121,101,114,32,33,61,32,126,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,116,101,120,101,108,49,32,61,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,84,101,120,101,108,83,116,111,114,101,85,73,78,84,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,118,101,99,51,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,115,101,99,111,110,100,97,114,121,95,116,101,120,95,99,111,111,114,100,95,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,115,101,99,111,110,100,97,114,121,95,116,101,120,95,99,111,111,114,100,95,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,115,101,99,111,110,100,97,114,121,95,116,101,120,95,99,111,111,114,100,95,108,97,121,101,114,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,41,46,114,59,10,32,32,32,32,32,32,116,101,120,101,108,32,61,32,116,101,120,101,108,48,32,43,32,40,116,101,120,101,108,49,32,60,60,32,117,105,110,116,40,56,41,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,116,101,120,101,108,32,61,32,116,101,120,101,108,48,59,10,32,32,32,32,125,10,32,32,100,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,117,114,118,101,112,97,105,114,95,112,115,101,117,100,111,95,100,105,115,116,97,110,99,101,40,116,101,120,101,108,44,32,116,101,120,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,103,101,111,109,101,116,114,121,95,100,97,116,97,95,108,111,99,97,116,105,111,110,41,59,10,10,10,10,32,32,100,120,32,61,32,100,70,100,120,40,116,101,120,95,99,111,111,114,100,41,59,10,32,32,100,121,32,61,32,100,70,100,121,40,116,101,120,95,99,111,111,114,100,41,59,10,32,32,115,99,97,108,101,95,105,110,118,101,114,115,101,32,61,32,109,97,120,40,49,46,48,44,32,105,110,118,101,114,115,101,115,113,114,116,40,48,46,53,32,42,32,40,100,111,116,40,100,120,44,100,120,41,32,43,32,100,111,116,40,100,121,44,100,121,41,41,41,41,59,10,32,32,99,111,118,101,114,97,103,101,32,61,32,99,108,97,109,112,40,48,46,53,32,43,32,100,32,42,32,115,99,97,108,101,95,105,110,118,101,114,115,101,44,32,48,46,48,44,32,49,46,48,41,59,10,10,32,32,114,101,116,117,114,110,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,99,111,118,101,114,97,103,101,41,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_glyph_curve_pair.frag.glsl.resource_string", fastuidraw::const_c_array<uint8_t>(values, sizeof(values)));
+ 
+
+}
+